@@ -2,8 +2,11 @@
 
 #include "browser/platform_flags.h"
 #include "cef_command_line.h"
+#include "cef_process_message.h"
 #include "cef_scheme.h"
+#include "cef_v8.h"
 #include "resources/scheme_handler.h"
+#include "utils/trace.h"
 #include "wrapper/cef_helpers.h"
 // For message router renderer side
 #include "wrapper/cef_message_router.h"
@@ -11,6 +14,37 @@
 #include <cstdio>
 #include <cstdlib>
 
+namespace {
+
+// Native function the main frame calls once on DOMContentLoaded; forwards the
+// event to the browser process, which has no direct callback for it
+class DomContentLoadedHandler : public CefV8Handler {
+ public:
+  bool Execute(const CefString& name,
+               CefRefPtr<CefV8Value> object,
+               const CefV8ValueList& arguments,
+               CefRefPtr<CefV8Value>& retval,
+               CefString& exception) override {
+    (void)name;
+    (void)object;
+    (void)arguments;
+    (void)retval;
+    (void)exception;
+
+    CefRefPtr<CefV8Context> context = CefV8Context::GetCurrentContext();
+    CefRefPtr<CefFrame> frame = context ? context->GetFrame() : nullptr;
+    if (frame) {
+      frame->SendProcessMessage(PID_BROWSER, CefProcessMessage::Create("Athena.DomContentLoaded"));
+    }
+    return true;
+  }
+
+ private:
+  IMPLEMENT_REFCOUNTING(DomContentLoadedHandler);
+};
+
+}  // namespace
+
 AppHandler::AppHandler() {}
 
 void AppHandler::OnBeforeCommandLineProcessing(const CefString& process_type,
@@ -41,6 +75,11 @@ void AppHandler::OnBeforeCommandLineProcessing(const CefString& process_type,
     }
 #endif
 
+    // Headless flags go first: platform flags never override existing switches
+    if (athena::browser::IsHeadlessMode()) {
+      athena::browser::ApplyHeadlessFlags(command_line);
+    }
+
     // Apply platform-specific flags using centralized system
     athena::browser::ApplyPlatformFlags(command_line, preset);
   }
@@ -84,6 +123,22 @@ void AppHandler::OnContextCreated(CefRefPtr<CefBrowser> browser,
     } catch(e) { /* noop */ }
   })())JS";
   frame->ExecuteJavaScript(inject, frame->GetURL(), 0);
+
+  // Report DOMContentLoaded of the main document for waitUntil conditions.
+  // Evaluated synchronously, and the native callback is never exposed on window.
+  if (frame->IsMain()) {
+    const char* install = R"JS((function(notify){
+      if (document.readyState !== 'loading') { notify(); return; }
+      document.addEventListener('DOMContentLoaded', function(){ notify(); }, { once: true });
+    }))JS";
+    CefRefPtr<CefV8Value> installer;
+    CefRefPtr<CefV8Exception> exception;
+    if (context->Eval(install, CefString(), 0, installer, exception) && installer->IsFunction()) {
+      CefV8ValueList args;
+      args.push_back(CefV8Value::CreateFunction("notify", new DomContentLoadedHandler()));
+      installer->ExecuteFunction(nullptr, args);
+    }
+  }
 }
 
 void AppHandler::OnContextReleased(CefRefPtr<CefBrowser> browser,
@@ -120,6 +175,9 @@ bool AppHandler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 
   const std::string request_id = args->GetString(0);
   const std::string code = args->GetString(1);
+  // Set by the browser process while it is tracing the control request
+  const std::string trace_request = args->GetSize() >= 3 ? args->GetString(2).ToString() : "";
+  const bool traced = !trace_request.empty() && trace_request != "0";
 
   auto escape_json = [](const std::string& input) -> std::string {
     std::string out;
@@ -157,6 +215,7 @@ bool AppHandler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
 
   std::string payload =
       R"({"success":false,"error":{"message":"Unable to enter V8 context","stack":""}})";
+  const int64_t eval_start_us = traced ? athena::utils::Tracer::NowMicros() : 0;
   CefRefPtr<CefV8Context> context = frame->GetV8Context();
   if (context && context->Enter()) {
     CefRefPtr<CefV8Value> retval;
@@ -231,6 +290,16 @@ bool AppHandler::OnProcessMessageReceived(CefRefPtr<CefBrowser> browser,
   CefRefPtr<CefListValue> response_args = response->GetArgumentList();
   response_args->SetString(0, request_id);
   response_args->SetString(1, payload);
+  if (traced) {
+    // The browser process records this span with the request's own spans;
+    // both processes read the same monotonic clock
+    const int64_t eval_end_us = athena::utils::Tracer::NowMicros();
+    response_args->SetString(2, trace_request);
+    response_args->SetDouble(3, static_cast<double>(eval_start_us));
+    response_args->SetDouble(4, static_cast<double>(eval_end_us - eval_start_us));
+    response_args->SetInt(5, athena::utils::Tracer::ProcessId());
+    response_args->SetInt(6, static_cast<int>(athena::utils::Tracer::ThreadId()));
+  }
 
   frame->SendProcessMessage(PID_BROWSER, response);
   return true;
@@ -9,7 +9,8 @@
 namespace athena {
 namespace rendering {
 class GLRenderer;
-}
+class SoftwareRenderer;
+}  // namespace rendering
 
 namespace browser {
 
@@ -28,6 +29,12 @@ struct EngineConfig {
   int windowless_frame_rate = 60;
   uint16_t remote_debugging_port = 0;
   int remote_debugging_port_wait_timeout_ms = 3000;
+
+  // HTTP archive for deterministic offline runs (at most one may be set):
+  // record writes every response to the file at shutdown, replay serves
+  // http(s) from the file and never touches the network.
+  std::string http_record_path;
+  std::string http_replay_path;
 };
 
 /**
@@ -41,6 +48,13 @@ struct BrowserConfig {
   rendering::GLRenderer* gl_renderer = nullptr;  // Non-owning pointer
   void* native_window_handle = nullptr;          // Platform-specific (QWidget*, HWND, etc.)
 
+  // Headless tabs render into CPU memory instead of a GL renderer (non-owning)
+  rendering::SoftwareRenderer* software_renderer = nullptr;
+
+  // Start in the background frame-rate tier (spare browsers nobody sees yet).
+  // Browsers may be created with no renderer at all and have one attached later.
+  bool hidden = false;
+
   // Cookie/cache isolation: When true, creates a separate RequestContext for this browser.
   // This provides per-tab cookie/cache isolation while sharing disk storage.
   // Benefits: Isolated sessions, independent cookie stores, separate cache entries.
@@ -196,6 +210,15 @@ class BrowserEngine {
    */
   virtual void Invalidate(BrowserId id) = 0;
 
+  /**
+   * Report that a browser was shown or hidden (e.g. on tab switch), so the
+   * engine can throttle hidden ones. Ignored by engines that do not.
+   */
+  virtual void SetBrowserVisible(BrowserId id, bool visible) {
+    (void)id;
+    (void)visible;
+  }
+
   // ============================================================================
   // Input Events (Platform-independent)
   // ============================================================================
@@ -205,6 +228,18 @@ class BrowserEngine {
    */
   virtual void SetFocus(BrowserId id, bool focus) = 0;
 
+  /**
+   * Report user input routed to a browser, e.g. so the engine can raise its
+   * frame rate. Ignored by engines that do not track activity.
+   */
+  virtual void NotifyUserInput(BrowserId id) { (void)id; }
+
+  /**
+   * Report a control-server request targeting a browser, which should keep
+   * rendering as if in use. Ignored by engines that do not track activity.
+   */
+  virtual void NotifyAgentDemand(BrowserId id) { (void)id; }
+
   // ============================================================================
   // Message Loop Integration
   // ============================================================================
@@ -4,9 +4,12 @@
 #include "include/cef_app.h"
 #include "include/wrapper/cef_helpers.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
+#include <cstdlib>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 namespace athena {
 namespace browser {
@@ -138,6 +141,176 @@ void CefClient::OnRenderProcessTerminated(CefRefPtr<::CefBrowser> browser,
   }
 }
 
+// ============================================================================
+// CefResourceRequestHandler methods
+// ============================================================================
+
+namespace {
+
+ResourceFilter::ResourceType ToFilterResourceType(cef_resource_type_t type) {
+  using Type = ResourceFilter::ResourceType;
+  switch (type) {
+    case RT_MAIN_FRAME:
+    case RT_NAVIGATION_PRELOAD_MAIN_FRAME:
+      return Type::kDocument;
+    case RT_SUB_FRAME:
+    case RT_NAVIGATION_PRELOAD_SUB_FRAME:
+      return Type::kSubFrame;
+    case RT_STYLESHEET:
+      return Type::kStylesheet;
+    case RT_SCRIPT:
+    case RT_WORKER:
+    case RT_SHARED_WORKER:
+    case RT_SERVICE_WORKER:
+      return Type::kScript;
+    case RT_IMAGE:
+    case RT_FAVICON:
+      return Type::kImage;
+    case RT_FONT_RESOURCE:
+      return Type::kFont;
+    case RT_MEDIA:
+      return Type::kMedia;
+    case RT_XHR:
+      return Type::kXhr;
+    case RT_PING:
+    case RT_CSP_REPORT:
+      return Type::kPing;
+    default:
+      return Type::kOther;
+  }
+}
+
+resources::HttpArchive::Headers ToArchiveHeaders(CefRefPtr<::CefResponse> response) {
+  ::CefResponse::HeaderMap header_map;
+  response->GetHeaderMap(header_map);
+
+  resources::HttpArchive::Headers headers;
+  headers.reserve(header_map.size());
+  for (const auto& [name, value] : header_map) {
+    headers.emplace_back(name.ToString(), value.ToString());
+  }
+  return headers;
+}
+
+}  // namespace
+
+CefRefPtr<::CefResourceRequestHandler> CefClient::GetResourceRequestHandler(
+    CefRefPtr<::CefBrowser> browser,
+    CefRefPtr<::CefFrame> frame,
+    CefRefPtr<::CefRequest> request,
+    bool is_navigation,
+    bool is_download,
+    const CefString& request_initiator,
+    bool& disable_default_handling) {
+  (void)browser;
+  (void)frame;
+  (void)request;
+  (void)is_navigation;
+  (void)is_download;
+  (void)request_initiator;
+  (void)disable_default_handling;
+
+  // Every request is seen for in-flight tracking; filtering happens per request
+  return this;
+}
+
+CefResourceRequestHandler::ReturnValue CefClient::OnBeforeResourceLoad(
+    CefRefPtr<::CefBrowser> browser,
+    CefRefPtr<::CefFrame> frame,
+    CefRefPtr<::CefRequest> request,
+    CefRefPtr<::CefCallback> callback) {
+  (void)browser;
+  (void)frame;
+  (void)callback;
+  CEF_REQUIRE_IO_THREAD();
+
+  std::shared_ptr<const ResourceFilter> filter = GetResourceFilter();
+  if (filter) {
+    const std::string url = request->GetURL().ToString();
+    if (filter->ShouldBlock(url, ToFilterResourceType(request->GetResourceType()))) {
+      logger.Debug("Blocked resource: {}", url);
+      return RV_CANCEL;
+    }
+  }
+
+  load_tracker_.OnRequestStarted(request->GetIdentifier(), LoadTracker::Clock::now());
+  return RV_CONTINUE;
+}
+
+void CefClient::OnResourceLoadComplete(CefRefPtr<::CefBrowser> browser,
+                                       CefRefPtr<::CefFrame> frame,
+                                       CefRefPtr<::CefRequest> request,
+                                       CefRefPtr<::CefResponse> response,
+                                       URLRequestStatus status,
+                                       int64_t received_content_length) {
+  (void)browser;
+  (void)frame;
+  (void)received_content_length;
+  CEF_REQUIRE_IO_THREAD();
+
+  load_tracker_.OnRequestFinished(request->GetIdentifier(), LoadTracker::Clock::now());
+
+  auto it = recording_filters_.find(request->GetIdentifier());
+  if (it == recording_filters_.end()) {
+    return;
+  }
+  CefRefPtr<::RecordingResponseFilter> filter = it->second;
+  recording_filters_.erase(it);
+
+  // Failed, cancelled and oversized responses are not worth replaying
+  if (status == UR_SUCCESS && filter->IsRecordable()) {
+    http_recorder_->Add("GET",
+                        request->GetURL().ToString(),
+                        response->GetStatus(),
+                        response->GetStatusText().ToString(),
+                        response->GetMimeType().ToString(),
+                        ToArchiveHeaders(response),
+                        filter->TakeBody());
+  }
+}
+
+CefRefPtr<::CefResponseFilter> CefClient::GetResourceResponseFilter(
+    CefRefPtr<::CefBrowser> browser,
+    CefRefPtr<::CefFrame> frame,
+    CefRefPtr<::CefRequest> request,
+    CefRefPtr<::CefResponse> response) {
+  (void)browser;
+  (void)frame;
+  (void)response;
+  CEF_REQUIRE_IO_THREAD();
+
+  // Replay is keyed by method and URL only, so request bodies (POST) cannot be matched
+  if (!http_recorder_ || request->GetMethod().ToString() != "GET") {
+    return nullptr;
+  }
+
+  CefRefPtr<::RecordingResponseFilter> filter = new ::RecordingResponseFilter();
+  recording_filters_[request->GetIdentifier()] = filter;
+  return filter;
+}
+
+void CefClient::OnResourceRedirect(CefRefPtr<::CefBrowser> browser,
+                                   CefRefPtr<::CefFrame> frame,
+                                   CefRefPtr<::CefRequest> request,
+                                   CefRefPtr<::CefResponse> response,
+                                   CefString& new_url) {
+  (void)browser;
+  (void)frame;
+  (void)new_url;
+  CEF_REQUIRE_IO_THREAD();
+
+  // The redirect response carries the Location header replay follows
+  if (http_recorder_ && request->GetMethod().ToString() == "GET") {
+    http_recorder_->Add("GET",
+                        request->GetURL().ToString(),
+                        response->GetStatus(),
+                        response->GetStatusText().ToString(),
+                        response->GetMimeType().ToString(),
+                        ToArchiveHeaders(response),
+                        std::string());
+  }
+}
+
 bool CefClient::OnBeforePopup(CefRefPtr<::CefBrowser> browser,
                               CefRefPtr<::CefFrame> frame,
                               int popup_id,
@@ -243,25 +416,92 @@ void CefClient::OnLoadingStateChange(CefRefPtr<::CefBrowser> browser,
   }
 }
 
+void CefClient::OnLoadStart(CefRefPtr<::CefBrowser> browser,
+                            CefRefPtr<::CefFrame> frame,
+                            TransitionType transition_type) {
+  (void)browser;
+  (void)transition_type;
+  CEF_REQUIRE_UI_THREAD();
+
+  if (frame->IsMain()) {
+    load_tracker_.OnMainFrameLoadStart(LoadTracker::Clock::now());
+  } else {
+    load_tracker_.OnFrameLoadStart(frame->GetIdentifier().ToString());
+  }
+}
+
+void CefClient::OnLoadEnd(CefRefPtr<::CefBrowser> browser,
+                          CefRefPtr<::CefFrame> frame,
+                          int httpStatusCode) {
+  (void)browser;
+  (void)httpStatusCode;
+  CEF_REQUIRE_UI_THREAD();
+
+  if (frame->IsMain()) {
+    load_tracker_.OnMainFrameLoadEnd();
+  } else {
+    load_tracker_.OnFrameLoadEnd(frame->GetIdentifier().ToString());
+  }
+}
+
+void CefClient::OnLoadError(CefRefPtr<::CefBrowser> browser,
+                            CefRefPtr<::CefFrame> frame,
+                            ErrorCode errorCode,
+                            const CefString& errorText,
+                            const CefString& failedUrl) {
+  (void)browser;
+  CEF_REQUIRE_UI_THREAD();
+
+  // ERR_ABORTED: superseded by another navigation, which reports its own progress
+  if (errorCode == ERR_ABORTED) {
+    if (!frame->IsMain()) {
+      load_tracker_.OnFrameLoadEnd(frame->GetIdentifier().ToString());
+    }
+    return;
+  }
+
+  logger.Debug("Load failed ({}): {} - {}",
+               static_cast<int>(errorCode),
+               failedUrl.ToString(),
+               errorText.ToString());
+  if (frame->IsMain()) {
+    load_tracker_.OnMainFrameLoadEnd();
+  } else {
+    load_tracker_.OnFrameLoadEnd(frame->GetIdentifier().ToString());
+  }
+}
+
 void CefClient::OnPopupShow(CefRefPtr<::CefBrowser> browser, bool show) {
   CEF_REQUIRE_UI_THREAD();
 
-  if (!gl_renderer_) {
+  if (!gl_renderer_ && !software_renderer_) {
     return;
   }
 
-  gl_renderer_->OnPopupShow(browser, show);
+  if (gl_renderer_) {
+    gl_renderer_->OnPopupShow(browser, show);
+  }
+  if (software_renderer_) {
+    software_renderer_->SetPopupVisible(show);
+  }
+  damage_tracker_.InvalidateAll();
 }
 
 void CefClient::OnPopupSize(CefRefPtr<::CefBrowser> browser, const CefRect& rect) {
   CEF_REQUIRE_UI_THREAD();
 
-  if (!gl_renderer_) {
+  if (!gl_renderer_ && !software_renderer_) {
     return;
   }
 
   core::Rect popup_rect{rect.x, rect.y, rect.width, rect.height};
-  gl_renderer_->OnPopupSize(browser, popup_rect);
+  if (gl_renderer_) {
+    gl_renderer_->OnPopupSize(browser, popup_rect);
+  }
+  if (software_renderer_) {
+    software_renderer_->SetPopupRect(popup_rect);
+  }
+  damage_tracker_.InvalidateAll();
 }
 
 // ============================================================================
@@ -295,12 +535,42 @@ void CefClient::OnPaint(CefRefPtr<::CefBrowser> browser,
                         int height) {
   CEF_REQUIRE_UI_THREAD();
 
-  if (!gl_renderer_) {
+  if (!gl_renderer_ && !software_renderer_) {
     return;
   }
 
+  utils::TraceSpan span("render", "OnPaint");
+  span.AddArg("rects", static_cast<int64_t>(dirtyRects.size()));
+
+  std::vector<core::Rect> damage;
+  damage.reserve(dirtyRects.size());
+  for (const auto& rect : dirtyRects) {
+    damage.emplace_back(rect.x, rect.y, rect.width, rect.height);
+  }
+
   // Forward to GLRenderer which handles OpenGL texture updates
-  gl_renderer_->OnPaint(browser, type, dirtyRects, buffer, width, height);
+  if (gl_renderer_) {
+    gl_renderer_->OnPaint(browser, type, dirtyRects, buffer, width, height);
+  }
+
+  // Headless tabs keep the frame in CPU memory instead
+  if (software_renderer_) {
+    auto layer = type == PET_VIEW ? rendering::SoftwareRenderer::Layer::kView
+                                  : rendering::SoftwareRenderer::Layer::kPopup;
+    auto stored = software_renderer_->OnPaint(layer, damage, buffer, core::Size(width, height));
+    if (!stored) {
+      logger.Warn("Failed to store {}x{} frame: {}", width, height, stored.GetError().Message());
+    }
+  }
+
+  // Track repainted regions so screenshots can report what changed
+  if (type == PET_VIEW) {
+    damage_tracker_.AddDamage(core::Size(width, height), damage);
+    view_paint_count_++;
+  } else {
+    // Popups are composited over the view; treat them as a full-frame change
+    damage_tracker_.InvalidateAll();
+  }
 
   if (on_render_invalidated_) {
     on_render_invalidated_(type, width, height);
@@ -361,12 +631,50 @@ void CefClient::SetSize(int width, int height) {
 void CefClient::SetDeviceScaleFactor(float scale_factor) {
   if (device_scale_factor_ != scale_factor) {
     device_scale_factor_ = scale_factor;
+    damage_tracker_.InvalidateAll();
+    if (software_renderer_) {
+      software_renderer_->SetDeviceScaleFactor(scale_factor);
+    }
     if (browser_) {
       browser_->GetHost()->WasResized();
     }
   }
 }
 
+void CefClient::SetGLRenderer(rendering::GLRenderer* gl_renderer) {
+  gl_renderer_ = gl_renderer;
+  if (gl_renderer_) {
+    gl_renderer_->SetViewSize(width_, height_);
+    RequestFullRepaint();
+  }
+}
+
+void CefClient::SetSoftwareRenderer(rendering::SoftwareRenderer* software_renderer) {
+  software_renderer_ = software_renderer;
+  if (software_renderer_) {
+    software_renderer_->SetDeviceScaleFactor(device_scale_factor_);
+    RequestFullRepaint();
+  }
+}
+
+void CefClient::SetResourceFilter(std::shared_ptr<const ResourceFilter> filter) {
+  std::lock_guard<std::mutex> lock(resource_filter_mutex_);
+  resource_filter_ = std::move(filter);
+}
+
+std::shared_ptr<const ResourceFilter> CefClient::GetResourceFilter() const {
+  std::lock_guard<std::mutex> lock(resource_filter_mutex_);
+  return resource_filter_;
+}
+
+void CefClient::RequestFullRepaint() {
+  // A newly attached renderer has none of the frames painted so far
+  damage_tracker_.InvalidateAll();
+  if (browser_) {
+    browser_->GetHost()->Invalidate(PET_VIEW);
+  }
+}
+
 void CefClient::SetFocus(bool focus) {
   has_focus_ = focus;
   logger.Debug("Focus state changed to: {}", focus);
@@ -410,6 +718,7 @@ std::string CefClient::GenerateRequestId() {
 
 std::optional<std::string> CefClient::RequestJavaScriptEvaluation(const std::string& code) {
   CEF_REQUIRE_UI_THREAD();
+  ATHENA_TRACE_SCOPE("browser", "JsDispatch");
 
   if (!browser_) {
     logger.Warn("RequestJavaScriptEvaluation: browser_ is null");
@@ -432,6 +741,11 @@ std::optional<std::string> CefClient::RequestJavaScriptEvaluation(const std::str
   CefRefPtr<CefListValue> args = message->GetArgumentList();
   args->SetString(0, request_id);
   args->SetString(1, code);
+  // Control request id, so the renderer can report how long the evaluation
+  // took; 0 when not tracing
+  const uint64_t trace_request =
+      utils::Tracer::Instance().IsEnabled() ? utils::Tracer::CurrentRequestId() : 0;
+  args->SetString(2, std::to_string(trace_request));
 
   logger.Debug("Dispatching JS evaluation request {}", request_id);
   frame->SendProcessMessage(PID_RENDERER, message);
@@ -471,6 +785,12 @@ bool CefClient::OnProcessMessageReceived(CefRefPtr<::CefBrowser> browser,
 
   // Then handle custom IPC messages
   const std::string name = message->GetName();
+  if (name == "Athena.DomContentLoaded") {
+    if (frame && frame->IsMain()) {
+      load_tracker_.OnDomContentLoaded();
+    }
+    return true;
+  }
   if (name != "Athena.ExecuteJavaScriptResult") {
     return false;
   }
@@ -484,6 +804,21 @@ bool CefClient::OnProcessMessageReceived(CefRefPtr<::CefBrowser> browser,
   const std::string request_id = args->GetString(0);
   const std::string payload = args->GetString(1);
 
+  // Traced evaluations also carry the renderer's span:
+  // (trace request id, start us, duration us, renderer pid, renderer thread)
+  utils::Tracer& tracer = utils::Tracer::Instance();
+  if (args->GetSize() >= 7 && tracer.IsEnabled()) {
+    utils::TraceEvent event;
+    event.category = "renderer";
+    event.name = "RendererEval";
+    event.request_id = std::strtoull(args->GetString(2).ToString().c_str(), nullptr, 10);
+    event.start_us = static_cast<int64_t>(args->GetDouble(3));
+    event.duration_us = static_cast<int64_t>(args->GetDouble(4));
+    event.pid = args->GetInt(5);
+    event.tid = static_cast<uint64_t>(args->GetInt(6));
+    tracer.Record(std::move(event));
+  }
+
   {
     std::lock_guard<std::mutex> lock(js_mutex_);
     auto it = pending_js_.find(request_id);
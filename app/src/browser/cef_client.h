@@ -1,7 +1,9 @@
 #ifndef ATHENA_BROWSER_CEF_CLIENT_H_
 #define ATHENA_BROWSER_CEF_CLIENT_H_
 
+#include "browser/load_tracker.h"
 #include "browser/message_router_handler.h"
+#include "browser/resource_filter.h"
 #include "include/cef_client.h"
 #include "include/cef_display_handler.h"
 #include "include/cef_life_span_handler.h"
@@ -9,8 +11,13 @@
 #include "include/cef_process_message.h"
 #include "include/cef_render_handler.h"
 #include "include/cef_request_handler.h"
+#include "include/cef_resource_request_handler.h"
 #include "include/wrapper/cef_message_router.h"
+#include "rendering/damage_tracker.h"
 #include "rendering/gl_renderer.h"
+#include "rendering/software_renderer.h"
+#include "resources/http_archive.h"
+#include "resources/scheme_handler.h"
 
 #include <atomic>
 #include <functional>
@@ -32,6 +39,8 @@ namespace browser {
  * - CefDisplayHandler: Display-related events (title changes, etc.)
  * - CefLoadHandler: Load and navigation events (address changes, loading state)
  * - CefRenderHandler: Rendering events (paint, resize, etc.)
+ * - CefResourceRequestHandler: Per-request blocking, in-flight request tracking and
+ *   HTTP archive recording
  *
  * Design:
  * - Non-copyable, movable
@@ -44,7 +53,8 @@ class CefClient : public ::CefClient,
                   public ::CefDisplayHandler,
                   public ::CefLoadHandler,
                   public ::CefRenderHandler,
-                  public ::CefRequestHandler {
+                  public ::CefRequestHandler,
+                  public ::CefResourceRequestHandler {
  public:
   /**
    * Construct a CEF client.
@@ -120,6 +130,17 @@ class CefClient : public ::CefClient,
                             bool isLoading,
                             bool canGoBack,
                             bool canGoForward) override;
+  void OnLoadStart(CefRefPtr<::CefBrowser> browser,
+                   CefRefPtr<::CefFrame> frame,
+                   TransitionType transition_type) override;
+  void OnLoadEnd(CefRefPtr<::CefBrowser> browser,
+                 CefRefPtr<::CefFrame> frame,
+                 int httpStatusCode) override;
+  void OnLoadError(CefRefPtr<::CefBrowser> browser,
+                   CefRefPtr<::CefFrame> frame,
+                   ErrorCode errorCode,
+                   const CefString& errorText,
+                   const CefString& failedUrl) override;
 
   void OnPopupShow(CefRefPtr<::CefBrowser> browser, bool show) override;
   void OnPopupSize(CefRefPtr<::CefBrowser> browser, const CefRect& rect) override;
@@ -133,6 +154,40 @@ class CefClient : public ::CefClient,
                                  int error_code,
                                  const CefString& error_string) override;
 
+  CefRefPtr<::CefResourceRequestHandler> GetResourceRequestHandler(
+      CefRefPtr<::CefBrowser> browser,
+      CefRefPtr<::CefFrame> frame,
+      CefRefPtr<::CefRequest> request,
+      bool is_navigation,
+      bool is_download,
+      const CefString& request_initiator,
+      bool& disable_default_handling) override;
+
+  // ============================================================================
+  // CefResourceRequestHandler methods
+  // ============================================================================
+
+  ReturnValue OnBeforeResourceLoad(CefRefPtr<::CefBrowser> browser,
+                                   CefRefPtr<::CefFrame> frame,
+                                   CefRefPtr<::CefRequest> request,
+                                   CefRefPtr<::CefCallback> callback) override;
+  void OnResourceLoadComplete(CefRefPtr<::CefBrowser> browser,
+                              CefRefPtr<::CefFrame> frame,
+                              CefRefPtr<::CefRequest> request,
+                              CefRefPtr<::CefResponse> response,
+                              URLRequestStatus status,
+                              int64_t received_content_length) override;
+  CefRefPtr<::CefResponseFilter> GetResourceResponseFilter(
+      CefRefPtr<::CefBrowser> browser,
+      CefRefPtr<::CefFrame> frame,
+      CefRefPtr<::CefRequest> request,
+      CefRefPtr<::CefResponse> response) override;
+  void OnResourceRedirect(CefRefPtr<::CefBrowser> browser,
+                          CefRefPtr<::CefFrame> frame,
+                          CefRefPtr<::CefRequest> request,
+                          CefRefPtr<::CefResponse> response,
+                          CefString& new_url) override;
+
   // ============================================================================
   // CefRenderHandler methods (for OSR)
   // ============================================================================
@@ -183,6 +238,46 @@ class CefClient : public ::CefClient,
    */
   void SetDeviceScaleFactor(float scale_factor);
 
+  /**
+   * Attach a GL renderer to a browser created without one (an adopted spare).
+   * Sizes it to the current view and requests a full repaint.
+   * @param gl_renderer Non-owning pointer, or nullptr to stop drawing
+   */
+  void SetGLRenderer(rendering::GLRenderer* gl_renderer);
+
+  /**
+   * Also store painted frames in CPU memory (headless tabs, which have no GL
+   * renderer). May be attached after the browser exists (an adopted spare);
+   * reset to nullptr before the renderer is destroyed.
+   * @param software_renderer Non-owning pointer, or nullptr to stop storing frames
+   */
+  void SetSoftwareRenderer(rendering::SoftwareRenderer* software_renderer);
+
+  /**
+   * Cancel subresource requests matching a filter. Safe to call from any
+   * thread; requests already in flight are not affected.
+   * @param filter Shared, immutable filter, or nullptr to allow everything
+   */
+  void SetResourceFilter(std::shared_ptr<const ResourceFilter> filter);
+
+  std::shared_ptr<const ResourceFilter> GetResourceFilter() const;
+
+  /**
+   * Record every GET response this browser receives (headers and decoded
+   * body) into an archive. Call before the browser is created.
+   * @param archive Archive shared by all browsers, or nullptr to stop recording
+   */
+  void SetHttpRecorder(std::shared_ptr<resources::HttpArchive> archive) {
+    http_recorder_ = std::move(archive);
+  }
+
+  /**
+   * Get the load tracker (commit, DOMContentLoaded, load, requests in flight).
+   * Windows report requested navigations to it before starting them.
+   */
+  LoadTracker& GetLoadTracker() { return load_tracker_; }
+  const LoadTracker& GetLoadTracker() const { return load_tracker_; }
+
   /**
    * Get current width in logical pixels.
    */
@@ -234,6 +329,18 @@ class CefClient : public ::CefClient,
    */
   void CancelJavaScriptEvaluation(const std::string& request_id);
 
+  /**
+   * Get the damage tracker for the main view.
+   * Accumulates repainted regions between screenshots (change-aware capture).
+   */
+  rendering::DamageTracker& GetDamageTracker() { return damage_tracker_; }
+
+  /**
+   * Get the number of main-view frames painted so far.
+   * Lets callers wait for the frame produced by an action (e.g. scrolling).
+   */
+  uint64_t GetViewPaintCount() const { return view_paint_count_.load(); }
+
   /**
    * Set callback for address changes.
    * Called when the URL in the address bar should be updated.
@@ -286,6 +393,11 @@ class CefClient : public ::CefClient,
   }
 
  private:
+  /**
+   * Drop tracked damage and ask CEF to repaint the whole view.
+   */
+  void RequestFullRepaint();
+
   void* native_window_;                 // Platform-specific window handle (non-owning)
   CefRefPtr<::CefBrowser> browser_;     // CEF browser instance
   rendering::GLRenderer* gl_renderer_;  // GL renderer (non-owning)
@@ -294,6 +406,20 @@ class CefClient : public ::CefClient,
   float device_scale_factor_;           // HiDPI scale factor (1.0, 2.0, etc.)
   bool has_focus_;                      // Focus state tracking (CEF #3870 workaround)
 
+  // CPU frame store for headless tabs (non-owning, optional)
+  rendering::SoftwareRenderer* software_renderer_ = nullptr;
+
+  // Subresource blocking; read on the CEF IO thread
+  mutable std::mutex resource_filter_mutex_;
+  std::shared_ptr<const ResourceFilter> resource_filter_;
+
+  // Load progress of the current page (UI and IO threads)
+  LoadTracker load_tracker_;
+
+  // Record mode: the archive, and body copies of responses still loading (IO thread)
+  std::shared_ptr<resources::HttpArchive> http_recorder_;
+  std::unordered_map<uint64_t, CefRefPtr<::RecordingResponseFilter>> recording_filters_;
+
   // Message router for JS↔C++ bridge (promise-based API)
   CefRefPtr<CefMessageRouterBrowserSide> message_router_;
   std::unique_ptr<MessageRouterHandler> message_router_handler_;
@@ -318,6 +444,10 @@ class CefClient : public ::CefClient,
   std::mutex js_mutex_;
   std::unordered_map<std::string, JavaScriptRequest> pending_js_;
 
+  // Regions repainted since the last screenshot
+  rendering::DamageTracker damage_tracker_;
+  std::atomic<uint64_t> view_paint_count_{0};
+
   std::string GenerateRequestId();
 
   IMPLEMENT_REFCOUNTING(CefClient);
@@ -2,7 +2,9 @@
 
 #include "include/cef_browser.h"
 #include "include/cef_request_context.h"
+#include "include/cef_scheme.h"
 #include "include/wrapper/cef_helpers.h"
+#include "resources/scheme_handler.h"
 #include "utils/logging.h"
 
 #include <algorithm>
@@ -132,9 +134,28 @@ utils::Result<void> CefEngine::Initialize(const EngineConfig& config) {
   }
 
   remote_debugging_port_ = config.remote_debugging_port;
+  // CEF accepts windowless frame rates between 1 and 60
+  windowless_frame_rate_ = std::clamp(config.windowless_frame_rate, 1, 60);
   remote_debugging_wait_timeout_ms_ =
       std::clamp(config.remote_debugging_port_wait_timeout_ms, 0, 60000);
 
+  if (!config.http_record_path.empty() && !config.http_replay_path.empty()) {
+    return utils::Err<void>("Cannot record and replay an HTTP archive at the same time");
+  }
+
+  // Load before starting CEF, so a bad archive fails fast
+  std::shared_ptr<resources::HttpArchive> replay_archive;
+  if (!config.http_replay_path.empty()) {
+    auto archive = resources::HttpArchive::LoadFromFile(config.http_replay_path);
+    if (!archive) {
+      return utils::Err<void>(archive.GetError().Message());
+    }
+    replay_archive = archive.Value();
+    logger.Info("Replaying {} HTTP responses from {}",
+                replay_archive->Size(),
+                config.http_replay_path);
+  }
+
   if (remote_debugging_port_ > 0) {
     if (!WaitForPortAvailability(remote_debugging_port_, remote_debugging_wait_timeout_ms_)) {
       return utils::Err<void>("Remote debugging port " + std::to_string(remote_debugging_port_) +
@@ -184,6 +205,17 @@ utils::Result<void> CefEngine::Initialize(const EngineConfig& config) {
     }
   }
 
+  if (replay_archive) {
+    // Built-in schemes take factories too; every http(s) load is served from the archive
+    CefRegisterSchemeHandlerFactory("http", "", new ArchiveSchemeHandlerFactory(replay_archive));
+    CefRegisterSchemeHandlerFactory("https", "", new ArchiveSchemeHandlerFactory(replay_archive));
+  }
+  if (!config.http_record_path.empty()) {
+    http_recorder_ = std::make_shared<resources::HttpArchive>();
+    http_record_path_ = config.http_record_path;
+    logger.Info("Recording HTTP responses to {}", http_record_path_);
+  }
+
   initialized_ = true;
   logger.Info("CEF initialized successfully");
   return utils::Ok();
@@ -201,11 +233,28 @@ void CefEngine::Shutdown() {
     }
   }
   browsers_.clear();
+  governor_ = FrameRateGovernor();
 
   // Shutdown CEF
   CefShutdown();
   initialized_ = false;
 
+  // Every load has completed or been cancelled by now
+  if (http_recorder_) {
+    auto stats = http_recorder_->GetStats();
+    auto saved = http_recorder_->SaveToFile(http_record_path_);
+    if (saved) {
+      logger.Info("Saved {} HTTP responses ({} bodies, {} bytes) to {}",
+                  stats.entries,
+                  stats.bodies,
+                  stats.body_bytes,
+                  http_record_path_);
+    } else {
+      logger.Error("Failed to save HTTP archive: {}", saved.GetError().Message());
+    }
+    http_recorder_.reset();
+  }
+
   if (remote_debugging_port_ > 0) {
     if (!WaitForPortAvailability(remote_debugging_port_, remote_debugging_wait_timeout_ms_)) {
       logger.Warn("Remote debugging port {} did not become available within {} ms; "
@@ -228,10 +277,6 @@ utils::Result<BrowserId> CefEngine::CreateBrowser(const BrowserConfig& config) {
     return utils::Err<BrowserId>("CEF engine not initialized");
   }
 
-  if (!config.gl_renderer) {
-    return utils::Err<BrowserId>("gl_renderer is required");
-  }
-
   // Generate unique ID
   BrowserId id = GenerateId();
 
@@ -241,6 +286,8 @@ utils::Result<BrowserId> CefEngine::CreateBrowser(const BrowserConfig& config) {
   // Initialize message router for JS↔C++ bridge
   client->InitializeMessageRouter();
 
+  client->SetSoftwareRenderer(config.software_renderer);
+  client->SetHttpRecorder(http_recorder_);
   client->SetDeviceScaleFactor(config.device_scale_factor);
   client->SetSize(config.width, config.height);
 
@@ -248,8 +295,14 @@ utils::Result<BrowserId> CefEngine::CreateBrowser(const BrowserConfig& config) {
   CefWindowInfo window_info;
   window_info.SetAsWindowless(0);  // 0 = no parent window handle
 
+  // Start at the governor's rate for a new browser; it adapts from there
+  governor_.AddBrowser(id, windowless_frame_rate_, FrameRateGovernor::Clock::now());
+  if (config.hidden) {
+    governor_.SetVisible(id, false, FrameRateGovernor::Clock::now());
+  }
+
   CefBrowserSettings browser_settings;
-  browser_settings.windowless_frame_rate = 60;
+  browser_settings.windowless_frame_rate = governor_.GetFrameRate(id);
 
   // Create RequestContext for per-tab cookie/cache isolation (if requested)
   CefRefPtr<::CefRequestContext> request_context = nullptr;
@@ -272,12 +325,14 @@ utils::Result<BrowserId> CefEngine::CreateBrowser(const BrowserConfig& config) {
   info.client = client;
   info.browser = nullptr;  // Will be set after creation
   info.request_context = request_context;
+  info.frame_rate = browser_settings.windowless_frame_rate;
   browsers_[id] = info;
 
   // Create browser asynchronously
   if (!CefBrowserHost::CreateBrowser(
           window_info, client, config.url, browser_settings, nullptr, request_context)) {
     browsers_.erase(id);
+    governor_.RemoveBrowser(id);
     return utils::Err<BrowserId>("CefBrowserHost::CreateBrowser failed");
   }
 
@@ -298,6 +353,7 @@ void CefEngine::CloseBrowser(BrowserId id, bool force_close) {
   }
 
   browsers_.erase(id);
+  governor_.RemoveBrowser(id);
 }
 
 bool CefEngine::HasBrowser(BrowserId id) const {
@@ -458,6 +514,74 @@ CefRefPtr<CefClient> CefEngine::GetCefClient(BrowserId id) const {
   return info ? info->client : nullptr;
 }
 
+// ============================================================================
+// Frame Rate Governor
+// ============================================================================
+
+void CefEngine::SetBrowserVisible(BrowserId id, bool visible) {
+  if (auto decision = governor_.SetVisible(id, visible, FrameRateGovernor::Clock::now())) {
+    ApplyFrameRate(*decision);
+  }
+}
+
+void CefEngine::NotifyUserInput(BrowserId id) {
+  if (auto decision = governor_.NotifyInput(id, FrameRateGovernor::Clock::now())) {
+    ApplyFrameRate(*decision);
+  }
+}
+
+void CefEngine::NotifyAgentDemand(BrowserId id) {
+  if (auto decision = governor_.NotifyDemand(id, FrameRateGovernor::Clock::now())) {
+    ApplyFrameRate(*decision);
+  }
+}
+
+void CefEngine::UpdateFrameRates() {
+  const auto now = FrameRateGovernor::Clock::now();
+
+  for (const auto& pair : browsers_) {
+    if (pair.second.client) {
+      governor_.ObservePaintCount(pair.first, pair.second.client->GetViewPaintCount(), now);
+    }
+  }
+
+  for (const auto& decision : governor_.Update(now)) {
+    ApplyFrameRate(decision);
+  }
+
+  // Catch up browsers whose host did not exist yet when their rate changed
+  for (auto& pair : browsers_) {
+    SyncFrameRate(pair.second);
+  }
+}
+
+void CefEngine::ApplyFrameRate(const FrameRateGovernor::Decision& decision) {
+  logger.Debug("Browser {}: {} fps ({}, {})",
+               decision.id,
+               decision.fps,
+               FrameRateGovernor::TierName(decision.tier),
+               decision.reason);
+
+  if (BrowserInfo* info = FindBrowser(decision.id)) {
+    SyncFrameRate(*info);
+  }
+}
+
+void CefEngine::SyncFrameRate(BrowserInfo& info) {
+  const int fps = governor_.GetFrameRate(info.id);
+  if (fps == info.frame_rate || !info.client) {
+    return;
+  }
+
+  CefRefPtr<::CefBrowser> browser = info.client->GetBrowser();
+  if (!browser) {
+    return;  // Still being created; retried on the next update
+  }
+
+  browser->GetHost()->SetWindowlessFrameRate(fps);
+  info.frame_rate = fps;
+}
+
 // ============================================================================
 // Private helpers
 // ============================================================================
@@ -3,10 +3,13 @@
 
 #include "browser/browser_engine.h"
 #include "browser/cef_client.h"
+#include "browser/frame_rate_governor.h"
 #include "include/cef_app.h"
+#include "resources/http_archive.h"
 
 #include <map>
 #include <memory>
+#include <string>
 
 namespace athena {
 namespace browser {
@@ -96,6 +99,37 @@ class CefEngine : public BrowserEngine {
    */
   virtual CefRefPtr<CefClient> GetCefClient(BrowserId id) const;
 
+  // ============================================================================
+  // Frame Rate Governor
+  // ============================================================================
+
+  /**
+   * Report that a browser was shown or hidden (e.g. on tab switch).
+   */
+  void SetBrowserVisible(BrowserId id, bool visible) override;
+
+  /**
+   * Report user input routed to a browser. Raises its frame rate immediately.
+   */
+  void NotifyUserInput(BrowserId id) override;
+
+  /**
+   * Report a control-server request targeting a browser. Keeps it at the
+   * active frame rate for a while, even when hidden.
+   */
+  void NotifyAgentDemand(BrowserId id) override;
+
+  /**
+   * Sample paint activity and re-evaluate every browser's frame rate.
+   * Call periodically (a few times per second) from the UI thread.
+   */
+  void UpdateFrameRates();
+
+  /**
+   * Current frame-rate decisions for all browsers.
+   */
+  FrameRateGovernor::Metrics GetFrameRateMetrics() const { return governor_.GetMetrics(); }
+
  private:
   /**
    * Browser instance info.
@@ -105,6 +139,7 @@ class CefEngine : public BrowserEngine {
     CefRefPtr<CefClient> client;
     CefRefPtr<::CefBrowser> browser;
     CefRefPtr<::CefRequestContext> request_context;  // Per-tab context (optional)
+    int frame_rate = 0;                               // Rate last applied to the host
   };
 
   /**
@@ -118,6 +153,16 @@ class CefEngine : public BrowserEngine {
   BrowserInfo* FindBrowser(BrowserId id);
   const BrowserInfo* FindBrowser(BrowserId id) const;
 
+  /**
+   * Log a governor decision and push it to the browser host.
+   */
+  void ApplyFrameRate(const FrameRateGovernor::Decision& decision);
+
+  /**
+   * Set the host's frame rate to the governor's if they differ.
+   */
+  void SyncFrameRate(BrowserInfo& info);
+
   CefRefPtr<::CefApp> app_;                    // CEF application handler
   const CefMainArgs* main_args_;               // CEF main arguments (non-owning)
   bool initialized_;                           // Initialization state
@@ -125,6 +170,12 @@ class CefEngine : public BrowserEngine {
   std::map<BrowserId, BrowserInfo> browsers_;  // Active browsers
   uint16_t remote_debugging_port_ = 0;         // Cached port for cleanup/logging
   int remote_debugging_wait_timeout_ms_ = 3000;
+  int windowless_frame_rate_ = 60;             // Per-browser frame rate cap
+  FrameRateGovernor governor_;                 // Adapts rates below the cap
+
+  // Record mode: archive every browser records into, saved on shutdown
+  std::shared_ptr<resources::HttpArchive> http_recorder_;
+  std::string http_record_path_;
 };
 
 }  // namespace browser
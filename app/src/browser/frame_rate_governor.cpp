@@ -0,0 +1,233 @@
+#include "browser/frame_rate_governor.h"
+
+#include <algorithm>
+
+namespace athena {
+namespace browser {
+
+FrameRateGovernor::FrameRateGovernor() : FrameRateGovernor(Policy()) {}
+
+FrameRateGovernor::FrameRateGovernor(const Policy& policy) : policy_(policy) {}
+
+// ============================================================================
+// Browser Tracking
+// ============================================================================
+
+void FrameRateGovernor::AddBrowser(BrowserId id, int max_fps, Clock::time_point now) {
+  BrowserState state;
+  state.max_fps = std::max(1, max_fps);
+  state.created = now;
+  state.current = Evaluate(id, state, now);
+
+  browsers_[id] = std::move(state);
+}
+
+void FrameRateGovernor::RemoveBrowser(BrowserId id) {
+  browsers_.erase(id);
+}
+
+bool FrameRateGovernor::HasBrowser(BrowserId id) const {
+  return browsers_.find(id) != browsers_.end();
+}
+
+// ============================================================================
+// Signals
+// ============================================================================
+
+std::optional<FrameRateGovernor::Decision> FrameRateGovernor::SetVisible(BrowserId id,
+                                                                         bool visible,
+                                                                         Clock::time_point now) {
+  auto it = browsers_.find(id);
+  if (it == browsers_.end()) {
+    return std::nullopt;
+  }
+
+  it->second.visible = visible;
+  if (visible) {
+    // Paints from before the tab was hidden say nothing about it now
+    it->second.paints.clear();
+  }
+  return Reevaluate(id, now);
+}
+
+std::optional<FrameRateGovernor::Decision> FrameRateGovernor::NotifyInput(BrowserId id,
+                                                                          Clock::time_point now) {
+  auto it = browsers_.find(id);
+  if (it == browsers_.end()) {
+    return std::nullopt;
+  }
+
+  it->second.last_input = now;
+  return Reevaluate(id, now);
+}
+
+std::optional<FrameRateGovernor::Decision> FrameRateGovernor::NotifyDemand(BrowserId id,
+                                                                           Clock::time_point now) {
+  auto it = browsers_.find(id);
+  if (it == browsers_.end()) {
+    return std::nullopt;
+  }
+
+  it->second.last_demand = now;
+  return Reevaluate(id, now);
+}
+
+void FrameRateGovernor::ObservePaintCount(BrowserId id,
+                                          uint64_t paint_count,
+                                          Clock::time_point now) {
+  auto it = browsers_.find(id);
+  if (it == browsers_.end()) {
+    return;
+  }
+
+  auto& paints = it->second.paints;
+  paints.push_back({now, paint_count});
+
+  // Keep one sample at or before the window start so the delta spans it
+  const auto window_start = now - policy_.paint_window;
+  while (paints.size() > 1 && paints[1].time <= window_start) {
+    paints.pop_front();
+  }
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+std::vector<FrameRateGovernor::Decision> FrameRateGovernor::Update(Clock::time_point now) {
+  std::vector<Decision> changes;
+  for (auto& [id, state] : browsers_) {
+    if (auto change = Apply(state, Evaluate(id, state, now))) {
+      changes.push_back(std::move(*change));
+    }
+  }
+  return changes;
+}
+
+std::optional<FrameRateGovernor::Decision> FrameRateGovernor::Reevaluate(BrowserId id,
+                                                                         Clock::time_point now) {
+  auto it = browsers_.find(id);
+  if (it == browsers_.end()) {
+    return std::nullopt;
+  }
+  return Apply(it->second, Evaluate(id, it->second, now));
+}
+
+FrameRateGovernor::Decision FrameRateGovernor::Evaluate(BrowserId id,
+                                                        const BrowserState& state,
+                                                        Clock::time_point now) const {
+  auto within = [now](const std::optional<Clock::time_point>& when,
+                      std::chrono::milliseconds hold) {
+    return when && now - *when < hold;
+  };
+
+  Decision decision;
+  decision.id = id;
+
+  // Agent demand first: it may be driving a tab the user cannot see
+  if (within(state.last_demand, policy_.demand_hold)) {
+    decision.tier = Tier::kActive;
+    decision.reason = "agent";
+  } else if (!state.visible) {
+    decision.tier = Tier::kBackground;
+    decision.reason = "hidden";
+  } else if (within(state.last_input, policy_.input_hold)) {
+    decision.tier = Tier::kActive;
+    decision.reason = "input";
+  } else if (PaintsInWindow(state) >= static_cast<uint64_t>(policy_.animation_paints)) {
+    decision.tier = Tier::kActive;
+    decision.reason = "animating";
+  } else if (now - state.created < policy_.startup_hold) {
+    decision.tier = Tier::kActive;
+    decision.reason = "startup";
+  } else {
+    decision.tier = Tier::kIdle;
+    decision.reason = "idle";
+  }
+
+  int fps = policy_.active_fps;
+  if (decision.tier == Tier::kIdle) {
+    fps = policy_.idle_fps;
+  } else if (decision.tier == Tier::kBackground) {
+    fps = policy_.background_fps;
+  }
+  decision.fps = std::clamp(fps, 1, state.max_fps);
+  return decision;
+}
+
+std::optional<FrameRateGovernor::Decision> FrameRateGovernor::Apply(BrowserState& state,
+                                                                    Decision decision) {
+  const bool rate_changed = decision.fps != state.current.fps;
+  state.current = std::move(decision);
+  if (!rate_changed) {
+    return std::nullopt;
+  }
+
+  state.rate_changes++;
+  rate_changes_++;
+  return state.current;
+}
+
+uint64_t FrameRateGovernor::PaintsInWindow(const BrowserState& state) const {
+  if (state.paints.size() < 2) {
+    return 0;
+  }
+  return state.paints.back().count - state.paints.front().count;
+}
+
+// ============================================================================
+// Metrics
+// ============================================================================
+
+int FrameRateGovernor::GetFrameRate(BrowserId id) const {
+  auto it = browsers_.find(id);
+  return it != browsers_.end() ? it->second.current.fps : 0;
+}
+
+FrameRateGovernor::Metrics FrameRateGovernor::GetMetrics() const {
+  Metrics metrics;
+  metrics.rate_changes = rate_changes_;
+  metrics.browsers.reserve(browsers_.size());
+
+  for (const auto& [id, state] : browsers_) {
+    BrowserMetrics browser;
+    browser.id = id;
+    browser.fps = state.current.fps;
+    browser.tier = state.current.tier;
+    browser.reason = state.current.reason;
+    browser.visible = state.visible;
+    browser.paints_in_window = PaintsInWindow(state);
+    browser.rate_changes = state.rate_changes;
+    metrics.browsers.push_back(std::move(browser));
+
+    metrics.total_fps += state.current.fps;
+    switch (state.current.tier) {
+      case Tier::kActive:
+        metrics.active++;
+        break;
+      case Tier::kIdle:
+        metrics.idle++;
+        break;
+      case Tier::kBackground:
+        metrics.background++;
+        break;
+    }
+  }
+
+  return metrics;
+}
+
+const char* FrameRateGovernor::TierName(Tier tier) {
+  switch (tier) {
+    case Tier::kActive:
+      return "active";
+    case Tier::kIdle:
+      return "idle";
+    case Tier::kBackground:
+      return "background";
+  }
+  return "unknown";
+}
+
+}  // namespace browser
+}  // namespace athena
@@ -0,0 +1,164 @@
+#ifndef ATHENA_BROWSER_FRAME_RATE_GOVERNOR_H_
+#define ATHENA_BROWSER_FRAME_RATE_GOVERNOR_H_
+
+#include "browser/browser_engine.h"
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace athena {
+namespace browser {
+
+/**
+ * Picks a windowless frame rate for each browser from what it is doing.
+ *
+ * Off-screen browsers render at a fixed rate whether or not anything on the
+ * page changes, so a session with many tabs burns CPU rendering frames nobody
+ * sees. The governor classifies each browser into a tier:
+ *
+ *   - Active (60 fps): recent user input, recent control-server requests,
+ *     sustained repainting (animation, video) or just created
+ *   - Idle (10 fps): visible but nothing is happening
+ *   - Background (1 fps): hidden tab
+ *
+ * Control-server demand wins over visibility so an agent can drive a hidden
+ * tab at full rate. Rates are capped at each browser's configured maximum.
+ *
+ * The governor only decides; the engine applies decisions with
+ * CefBrowserHost::SetWindowlessFrameRate(). Time is passed in explicitly so
+ * the policy is testable. Not thread-safe: call from the browser UI thread.
+ */
+class FrameRateGovernor {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Tier {
+    kActive,
+    kIdle,
+    kBackground,
+  };
+
+  struct Policy {
+    int active_fps = 60;
+    int idle_fps = 10;
+    int background_fps = 1;
+
+    // How long a browser stays active after input, demand or creation
+    std::chrono::milliseconds input_hold{2000};
+    std::chrono::milliseconds demand_hold{3000};
+    std::chrono::milliseconds startup_hold{3000};
+
+    // A browser painting at least animation_paints frames within
+    // paint_window counts as animating (caret blinks stay below this)
+    std::chrono::milliseconds paint_window{1000};
+    int animation_paints = 5;
+  };
+
+  struct Decision {
+    BrowserId id = kInvalidBrowserId;
+    int fps = 0;
+    Tier tier = Tier::kActive;
+    std::string reason;  // "agent", "input", "animating", "startup", "idle", "hidden"
+  };
+
+  struct BrowserMetrics {
+    BrowserId id = kInvalidBrowserId;
+    int fps = 0;
+    Tier tier = Tier::kActive;
+    std::string reason;
+    bool visible = true;
+    uint64_t paints_in_window = 0;
+    uint64_t rate_changes = 0;
+  };
+
+  struct Metrics {
+    std::vector<BrowserMetrics> browsers;
+    size_t active = 0;
+    size_t idle = 0;
+    size_t background = 0;
+    int total_fps = 0;          // Sum of current rates (frame budget)
+    uint64_t rate_changes = 0;  // Changes applied since startup
+  };
+
+  FrameRateGovernor();
+  explicit FrameRateGovernor(const Policy& policy);
+
+  /**
+   * Start tracking a browser. It starts active (at min(active_fps, max_fps)).
+   * @param max_fps Configured rate cap for this browser
+   */
+  void AddBrowser(BrowserId id, int max_fps, Clock::time_point now);
+  void RemoveBrowser(BrowserId id);
+  bool HasBrowser(BrowserId id) const;
+
+  /**
+   * Signals. Each returns a decision if the browser's rate should change
+   * right away, so input never waits for the next Update().
+   */
+  std::optional<Decision> SetVisible(BrowserId id, bool visible, Clock::time_point now);
+  std::optional<Decision> NotifyInput(BrowserId id, Clock::time_point now);
+  std::optional<Decision> NotifyDemand(BrowserId id, Clock::time_point now);
+
+  /**
+   * Record a browser's cumulative view paint count (sampled periodically).
+   */
+  void ObservePaintCount(BrowserId id, uint64_t paint_count, Clock::time_point now);
+
+  /**
+   * Re-evaluate every browser.
+   * @return Decisions for browsers whose rate changed
+   */
+  std::vector<Decision> Update(Clock::time_point now);
+
+  /**
+   * Current rate of a browser, or 0 if unknown.
+   */
+  int GetFrameRate(BrowserId id) const;
+
+  Metrics GetMetrics() const;
+
+  const Policy& GetPolicy() const { return policy_; }
+
+  static const char* TierName(Tier tier);
+
+ private:
+  struct PaintSample {
+    Clock::time_point time;
+    uint64_t count;
+  };
+
+  struct BrowserState {
+    int max_fps = 60;
+    bool visible = true;
+    Clock::time_point created;
+    std::optional<Clock::time_point> last_input;
+    std::optional<Clock::time_point> last_demand;
+    std::deque<PaintSample> paints;  // Samples within the paint window
+
+    Decision current;
+    uint64_t rate_changes = 0;
+  };
+
+  Decision Evaluate(BrowserId id, const BrowserState& state, Clock::time_point now) const;
+
+  // Store |decision| if its rate differs from the current one.
+  std::optional<Decision> Apply(BrowserState& state, Decision decision);
+
+  std::optional<Decision> Reevaluate(BrowserId id, Clock::time_point now);
+
+  uint64_t PaintsInWindow(const BrowserState& state) const;
+
+  Policy policy_;
+  std::map<BrowserId, BrowserState> browsers_;
+  uint64_t rate_changes_ = 0;
+};
+
+}  // namespace browser
+}  // namespace athena
+
+#endif  // ATHENA_BROWSER_FRAME_RATE_GOVERNOR_H_
@@ -0,0 +1,228 @@
+#include "browser/load_tracker.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace athena {
+namespace browser {
+
+namespace {
+
+std::string_view Trim(std::string_view text) {
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+// Non-negative decimal integer; rejects signs, blanks and trailing text
+std::optional<uint64_t> ParseCount(std::string_view text) {
+  text = Trim(text);
+  if (text.empty() || text.size() > 9) {
+    return std::nullopt;
+  }
+  uint64_t value = 0;
+  for (char c : text) {
+    if (!std::isdigit(static_cast<unsigned char>(c))) {
+      return std::nullopt;
+    }
+    value = value * 10 + static_cast<uint64_t>(c - '0');
+  }
+  return value;
+}
+
+}  // namespace
+
+std::optional<LoadTracker::WaitCondition> LoadTracker::ParseWaitCondition(std::string_view text) {
+  text = Trim(text);
+  WaitCondition condition;
+
+  if (text == "load") {
+    condition.until = WaitUntil::kLoad;
+    return condition;
+  }
+  if (text == "domcontentloaded") {
+    condition.until = WaitUntil::kDomContentLoaded;
+    return condition;
+  }
+
+  constexpr std::string_view kNetworkIdle = "networkidle";
+  if (text.substr(0, kNetworkIdle.size()) != kNetworkIdle) {
+    return std::nullopt;
+  }
+  condition.until = WaitUntil::kNetworkIdle;
+  std::string_view rest = text.substr(kNetworkIdle.size());
+
+  if (rest.empty() || rest == "0") {
+    return condition;
+  }
+  if (rest == "2") {
+    condition.max_inflight = 2;
+    return condition;
+  }
+
+  // networkidle(N, ms)
+  if (rest.front() != '(' || rest.back() != ')') {
+    return std::nullopt;
+  }
+  rest = rest.substr(1, rest.size() - 2);
+  size_t comma = rest.find(',');
+  if (comma == std::string_view::npos) {
+    return std::nullopt;
+  }
+  auto connections = ParseCount(rest.substr(0, comma));
+  auto idle_ms = ParseCount(rest.substr(comma + 1));
+  if (!connections || !idle_ms || *connections > kMaxIdleConnections) {
+    return std::nullopt;
+  }
+  condition.max_inflight = static_cast<size_t>(*connections);
+  condition.idle_time = std::chrono::milliseconds(*idle_ms);
+  return condition;
+}
+
+std::string LoadTracker::DescribeWaitCondition(const WaitCondition& condition) {
+  switch (condition.until) {
+    case WaitUntil::kLoad:
+      return "load";
+    case WaitUntil::kDomContentLoaded:
+      return "domcontentloaded";
+    case WaitUntil::kNetworkIdle:
+      return "networkidle(" + std::to_string(condition.max_inflight) + ", " +
+             std::to_string(condition.idle_time.count()) + ")";
+  }
+  return "load";
+}
+
+LoadTracker::LoadTracker() {
+  ResetIdleClock(Clock::now());
+}
+
+// ============================================================================
+// Main Frame Events
+// ============================================================================
+
+void LoadTracker::OnNavigationRequested(Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  awaiting_commit_ = true;
+  committed_ = false;
+  dom_content_loaded_ = false;
+  loaded_ = false;
+  ResetIdleClock(now);
+}
+
+void LoadTracker::OnMainFrameLoadStart(Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  awaiting_commit_ = false;
+  committed_ = true;
+  dom_content_loaded_ = false;
+  loaded_ = false;
+  navigations_++;
+  loading_frames_.clear();  // Subframes of the old document are gone
+  ResetIdleClock(now);
+}
+
+void LoadTracker::OnDomContentLoaded() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!awaiting_commit_) {
+    dom_content_loaded_ = true;
+  }
+}
+
+void LoadTracker::OnMainFrameLoadEnd() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (awaiting_commit_) {
+    return;  // End of the document being replaced
+  }
+  committed_ = true;
+  dom_content_loaded_ = true;
+  loaded_ = true;
+}
+
+// ============================================================================
+// Subframe Events
+// ============================================================================
+
+void LoadTracker::OnFrameLoadStart(const std::string& frame_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  loading_frames_.insert(frame_id);
+}
+
+void LoadTracker::OnFrameLoadEnd(const std::string& frame_id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  loading_frames_.erase(frame_id);
+}
+
+// ============================================================================
+// Network Events
+// ============================================================================
+
+void LoadTracker::OnRequestStarted(uint64_t request_id, Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t old_count = requests_.size();
+  if (requests_.insert(request_id).second) {
+    RecordRequestCountChange(old_count, requests_.size(), now);
+  }
+}
+
+void LoadTracker::OnRequestFinished(uint64_t request_id, Clock::time_point now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t old_count = requests_.size();
+  if (requests_.erase(request_id) > 0) {
+    RecordRequestCountChange(old_count, requests_.size(), now);
+  }
+}
+
+void LoadTracker::RecordRequestCountChange(size_t old_count,
+                                           size_t new_count,
+                                           Clock::time_point now) {
+  // More than n requests were in flight until now for every n below the higher count
+  size_t limit = std::min(std::max(old_count, new_count), busy_until_.size());
+  for (size_t n = 0; n < limit; ++n) {
+    busy_until_[n] = now;
+  }
+}
+
+void LoadTracker::ResetIdleClock(Clock::time_point now) {
+  // Quiet periods are measured from the start of the navigation
+  busy_until_.fill(now);
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool LoadTracker::IsSatisfied(const WaitCondition& condition, Clock::time_point now) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  switch (condition.until) {
+    case WaitUntil::kLoad:
+      return loaded_;
+    case WaitUntil::kDomContentLoaded:
+      return dom_content_loaded_;
+    case WaitUntil::kNetworkIdle: {
+      if (!dom_content_loaded_ || !loading_frames_.empty()) {
+        return false;
+      }
+      size_t n = std::min(condition.max_inflight, kMaxIdleConnections);
+      return requests_.size() <= n && now - busy_until_[n] >= condition.idle_time;
+    }
+  }
+  return false;
+}
+
+LoadTracker::Snapshot LoadTracker::GetSnapshot() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Snapshot snapshot;
+  snapshot.committed = committed_;
+  snapshot.dom_content_loaded = dom_content_loaded_;
+  snapshot.loaded = loaded_;
+  snapshot.requests_in_flight = requests_.size();
+  snapshot.frames_loading = loading_frames_.size();
+  snapshot.navigations = navigations_;
+  return snapshot;
+}
+
+}  // namespace browser
+}  // namespace athena
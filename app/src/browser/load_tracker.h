@@ -0,0 +1,157 @@
+#ifndef ATHENA_BROWSER_LOAD_TRACKER_H_
+#define ATHENA_BROWSER_LOAD_TRACKER_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+namespace athena {
+namespace browser {
+
+/**
+ * Tracks how far a browser's current page has loaded.
+ *
+ * The loading flag from OnLoadingStateChange is too coarse for agents: on
+ * single-page apps it flips before XHRs settle, and on pages with long-lived
+ * beacons or polling it flips much later than the content is usable. The
+ * tracker records, per main-frame navigation:
+ *
+ *   - Commit (OnLoadStart), DOMContentLoaded (reported by the renderer) and
+ *     the load event (OnLoadEnd)
+ *   - Subframe navigations still in progress
+ *   - Network requests in flight, and for how long at most N were in flight
+ *
+ * Callers wait on a WaitCondition: "load", "domcontentloaded" or
+ * "networkidle" (at most N requests in flight for a quiet period, after
+ * DOMContentLoaded, with no subframe loading).
+ *
+ * Thread-safe: load events arrive on the CEF UI thread and request events on
+ * the CEF IO thread. Time is passed in explicitly so the tracker is testable.
+ */
+class LoadTracker {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class WaitUntil {
+    kLoad,              // Load event of the main frame
+    kDomContentLoaded,  // DOMContentLoaded of the main frame
+    kNetworkIdle,       // Few requests in flight for a quiet period
+  };
+
+  // Highest N accepted for networkidle(N, ms)
+  static constexpr size_t kMaxIdleConnections = 8;
+
+  struct WaitCondition {
+    WaitUntil until = WaitUntil::kLoad;
+    size_t max_inflight = 0;                   // Network idle: at most N requests
+    std::chrono::milliseconds idle_time{500};  // ... for at least this long
+  };
+
+  struct Snapshot {
+    bool committed = false;           // Main frame started loading the new document
+    bool dom_content_loaded = false;  // DOMContentLoaded fired
+    bool loaded = false;              // Load event fired (or the load failed)
+    size_t requests_in_flight = 0;    // Started and not yet complete
+    size_t frames_loading = 0;        // Subframes between load start and end
+    uint64_t navigations = 0;         // Main-frame navigations committed so far
+  };
+
+  /**
+   * Parse a control API waitUntil value: "load", "domcontentloaded",
+   * "networkidle" (= networkidle0), "networkidle0", "networkidle2" or
+   * "networkidle(N, ms)".
+   * @return The condition, or nullopt if the value is malformed
+   */
+  static std::optional<WaitCondition> ParseWaitCondition(std::string_view text);
+
+  /**
+   * Canonical name of a condition, e.g. "networkidle(2, 500)".
+   */
+  static std::string DescribeWaitCondition(const WaitCondition& condition);
+
+  LoadTracker();
+
+  LoadTracker(const LoadTracker&) = delete;
+  LoadTracker& operator=(const LoadTracker&) = delete;
+
+  // ============================================================================
+  // Main Frame Events (UI thread)
+  // ============================================================================
+
+  /**
+   * A navigation was requested (LoadURL, reload, history). Until the new
+   * document commits, earlier DOMContentLoaded and load events are forgotten.
+   */
+  void OnNavigationRequested(Clock::time_point now);
+
+  /**
+   * The main frame started loading a new document (OnLoadStart).
+   */
+  void OnMainFrameLoadStart(Clock::time_point now);
+
+  /**
+   * The renderer reported DOMContentLoaded for the main frame. Ignored while a
+   * requested navigation has not committed yet (it belongs to the old page).
+   */
+  void OnDomContentLoaded();
+
+  /**
+   * The main frame finished or failed loading (OnLoadEnd / OnLoadError).
+   * Implies DOMContentLoaded, which error and non-HTML pages never report.
+   */
+  void OnMainFrameLoadEnd();
+
+  // ============================================================================
+  // Subframe Events (UI thread)
+  // ============================================================================
+
+  void OnFrameLoadStart(const std::string& frame_id);
+  void OnFrameLoadEnd(const std::string& frame_id);
+
+  // ============================================================================
+  // Network Events (IO thread)
+  // ============================================================================
+
+  void OnRequestStarted(uint64_t request_id, Clock::time_point now);
+
+  /**
+   * Ignores requests that were never started (e.g. cancelled by a filter).
+   */
+  void OnRequestFinished(uint64_t request_id, Clock::time_point now);
+
+  // ============================================================================
+  // Queries
+  // ============================================================================
+
+  bool IsSatisfied(const WaitCondition& condition, Clock::time_point now) const;
+  Snapshot GetSnapshot() const;
+
+ private:
+  // Record that the in-flight count changes from old_count to new_count
+  void RecordRequestCountChange(size_t old_count, size_t new_count, Clock::time_point now);
+  void ResetIdleClock(Clock::time_point now);
+
+  mutable std::mutex mutex_;
+  bool awaiting_commit_ = false;  // Navigation requested, new document not committed yet
+  bool committed_ = false;
+  bool dom_content_loaded_ = false;
+  bool loaded_ = false;
+  uint64_t navigations_ = 0;
+  std::set<std::string> loading_frames_;
+  std::unordered_set<uint64_t> requests_;
+
+  // busy_until_[n]: last time more than n requests were in flight
+  std::array<Clock::time_point, kMaxIdleConnections + 1> busy_until_{};
+};
+
+}  // namespace browser
+}  // namespace athena
+
+#endif  // ATHENA_BROWSER_LOAD_TRACKER_H_
@@ -1,5 +1,6 @@
 #include "browser/platform_flags.h"
 
+#include <cstdlib>
 #include <sstream>
 
 namespace athena {
@@ -207,6 +208,24 @@ void ApplyPlatformFlags(CefRefPtr<CefCommandLine> command_line, FlagPreset prese
   ApplyMacOSFlags(command_line, preset);
 }
 
+bool IsHeadlessMode() {
+  const char* headless = std::getenv("ATHENA_HEADLESS");
+  return headless && std::string(headless) == "1";
+}
+
+void ApplyHeadlessFlags(CefRefPtr<CefCommandLine> command_line) {
+  if (!command_line) {
+    return;
+  }
+
+  // No X11/Wayland connection: Ozone's headless backend
+  AddSwitchWithValue(command_line, "ozone-platform", "headless");
+
+  // OSR frames are read back into CPU memory anyway; skip the GPU process
+  AddSwitch(command_line, "disable-gpu");
+  AddSwitch(command_line, "disable-gpu-compositing");
+}
+
 std::string GetFlagPresetDescription(FlagPreset preset) {
   std::ostringstream desc;
 
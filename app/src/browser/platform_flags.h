@@ -66,6 +66,25 @@ enum class FlagPreset {
 void ApplyPlatformFlags(CefRefPtr<CefCommandLine> command_line,
                         FlagPreset preset = FlagPreset::RELEASE);
 
+/**
+ * @brief Whether Athena runs without a display (ATHENA_HEADLESS=1)
+ *
+ * Headless mode uses HeadlessWindowSystem: no widgets or GL, tabs render into
+ * CPU memory.
+ */
+bool IsHeadlessMode();
+
+/**
+ * @brief Apply flags for running CEF without a display server
+ *
+ * Selects the headless Ozone platform and software compositing. Must be applied
+ * before ApplyPlatformFlags(), which would otherwise select X11 and ANGLE
+ * (flags are only added when not already present).
+ *
+ * @param command_line CEF command line object to modify
+ */
+void ApplyHeadlessFlags(CefRefPtr<CefCommandLine> command_line);
+
 /**
  * @brief Get description of what flags would be applied for a preset
  *
@@ -0,0 +1,239 @@
+#include "browser/resource_filter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <deque>
+
+namespace athena {
+namespace browser {
+
+namespace {
+
+struct TypeName {
+  ResourceFilter::ResourceType type;
+  const char* name;
+};
+
+constexpr TypeName kTypeNames[] = {
+    {ResourceFilter::ResourceType::kDocument, "document"},
+    {ResourceFilter::ResourceType::kSubFrame, "subframe"},
+    {ResourceFilter::ResourceType::kStylesheet, "stylesheet"},
+    {ResourceFilter::ResourceType::kScript, "script"},
+    {ResourceFilter::ResourceType::kImage, "image"},
+    {ResourceFilter::ResourceType::kFont, "font"},
+    {ResourceFilter::ResourceType::kMedia, "media"},
+    {ResourceFilter::ResourceType::kXhr, "xhr"},
+    {ResourceFilter::ResourceType::kPing, "ping"},
+    {ResourceFilter::ResourceType::kOther, "other"},
+};
+
+unsigned char ToLower(unsigned char c) {
+  return static_cast<unsigned char>(std::tolower(c));
+}
+
+std::string ToLower(std::string_view text) {
+  std::string lower(text);
+  for (char& c : lower) {
+    c = static_cast<char>(ToLower(static_cast<unsigned char>(c)));
+  }
+  return lower;
+}
+
+// Host of an absolute URL ("https://user@Host.example:8080/path" -> "Host.example"),
+// or empty if the URL has no authority (data:, about:, ...)
+std::string_view ExtractHost(std::string_view url) {
+  size_t scheme_end = url.find("://");
+  if (scheme_end == std::string_view::npos) {
+    return {};
+  }
+
+  std::string_view authority = url.substr(scheme_end + 3);
+  authority = authority.substr(0, authority.find_first_of("/?#"));
+
+  size_t at = authority.rfind('@');
+  if (at != std::string_view::npos) {
+    authority.remove_prefix(at + 1);
+  }
+
+  // IPv6 literals are bracketed and never match a domain rule
+  if (!authority.empty() && authority.front() == '[') {
+    return {};
+  }
+  return authority.substr(0, authority.find(':'));
+}
+
+}  // namespace
+
+const char* ResourceFilter::ResourceTypeName(ResourceType type) {
+  for (const auto& entry : kTypeNames) {
+    if (entry.type == type) {
+      return entry.name;
+    }
+  }
+  return "other";
+}
+
+std::optional<ResourceFilter::ResourceType> ResourceFilter::ParseResourceType(
+    std::string_view name) {
+  for (const auto& entry : kTypeNames) {
+    if (name == entry.name) {
+      return entry.type;
+    }
+  }
+  return std::nullopt;
+}
+
+ResourceFilter::ResourceFilter(const Rules& rules) {
+  for (ResourceType type : rules.blocked_types) {
+    if (type == ResourceType::kDocument || blocked_types_[static_cast<size_t>(type)]) {
+      continue;
+    }
+    blocked_types_[static_cast<size_t>(type)] = true;
+    rules_.blocked_types.push_back(type);
+  }
+
+  for (const std::string& domain : rules.blocked_domains) {
+    std::string normalized = ToLower(domain);
+    normalized.erase(0, normalized.find_first_not_of('.'));
+    if (!normalized.empty()) {
+      rules_.blocked_domains.push_back(std::move(normalized));
+    }
+  }
+  // Views are taken once the vector stops growing
+  for (const std::string& domain : rules_.blocked_domains) {
+    domains_.insert(domain);
+  }
+
+  for (const std::string& pattern : rules.blocked_patterns) {
+    if (!pattern.empty()) {
+      rules_.blocked_patterns.push_back(pattern);
+    }
+  }
+  BuildAutomaton();
+}
+
+bool ResourceFilter::IsEmpty() const {
+  return rules_.blocked_types.empty() && domains_.empty() && rules_.blocked_patterns.empty();
+}
+
+bool ResourceFilter::ShouldBlock(std::string_view url, ResourceType type) const {
+  if (type == ResourceType::kDocument) {
+    return false;
+  }
+
+  bool blocked = blocked_types_[static_cast<size_t>(type)] ||
+                 (!domains_.empty() && IsBlockedDomain(ExtractHost(url))) ||
+                 (!rules_.blocked_patterns.empty() && MatchesPattern(url));
+  if (blocked) {
+    blocked_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return blocked;
+}
+
+// ============================================================================
+// Domain Matching
+// ============================================================================
+
+bool ResourceFilter::IsBlockedDomain(std::string_view host) const {
+  if (host.empty()) {
+    return false;
+  }
+
+  // Chromium canonicalizes hosts to lowercase; lowercase anyway for other callers
+  const std::string lower = ToLower(host);
+  std::string_view suffix = lower;
+  while (true) {
+    if (domains_.count(suffix) > 0) {
+      return true;
+    }
+    size_t dot = suffix.find('.');
+    if (dot == std::string_view::npos) {
+      return false;
+    }
+    suffix.remove_prefix(dot + 1);
+  }
+}
+
+// ============================================================================
+// Pattern Matching (Aho-Corasick)
+// ============================================================================
+
+int32_t ResourceFilter::FindChild(int32_t node, unsigned char c) const {
+  const auto& children = nodes_[node].children;
+  auto it = std::lower_bound(children.begin(),
+                             children.end(),
+                             c,
+                             [](const auto& edge, unsigned char key) { return edge.first < key; });
+  return (it != children.end() && it->first == c) ? it->second : -1;
+}
+
+int32_t ResourceFilter::Step(int32_t node, unsigned char c) const {
+  while (node != 0) {
+    int32_t child = FindChild(node, c);
+    if (child >= 0) {
+      return child;
+    }
+    node = nodes_[node].fail;
+  }
+  return root_next_[c];
+}
+
+void ResourceFilter::BuildAutomaton() {
+  nodes_.assign(1, Node());
+
+  // Trie of lowercased patterns
+  for (const std::string& pattern : rules_.blocked_patterns) {
+    int32_t node = 0;
+    for (char raw : pattern) {
+      unsigned char c = ToLower(static_cast<unsigned char>(raw));
+      int32_t child = FindChild(node, c);
+      if (child < 0) {
+        child = static_cast<int32_t>(nodes_.size());
+        auto& children = nodes_[node].children;
+        children.insert(std::upper_bound(children.begin(),
+                                         children.end(),
+                                         std::make_pair(c, int32_t{-1})),
+                        {c, child});
+        nodes_.emplace_back();
+      }
+      node = child;
+    }
+    nodes_[node].terminal = true;
+  }
+
+  // Root transitions are dense; missing ones loop back to the root
+  root_next_.fill(0);
+  for (const auto& [c, child] : nodes_[0].children) {
+    root_next_[c] = child;
+  }
+
+  // Breadth-first fail links; a node is terminal if its fail target is
+  std::deque<int32_t> queue;
+  for (const auto& edge : nodes_[0].children) {
+    queue.push_back(edge.second);
+  }
+  while (!queue.empty()) {
+    int32_t node = queue.front();
+    queue.pop_front();
+    for (const auto& [c, child] : nodes_[node].children) {
+      int32_t fail = Step(nodes_[node].fail, c);
+      nodes_[child].fail = fail;
+      nodes_[child].terminal = nodes_[child].terminal || nodes_[fail].terminal;
+      queue.push_back(child);
+    }
+  }
+}
+
+bool ResourceFilter::MatchesPattern(std::string_view url) const {
+  int32_t node = 0;
+  for (char raw : url) {
+    node = Step(node, ToLower(static_cast<unsigned char>(raw)));
+    if (nodes_[node].terminal) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace browser
+}  // namespace athena
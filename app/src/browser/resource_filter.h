@@ -0,0 +1,129 @@
+#ifndef ATHENA_BROWSER_RESOURCE_FILTER_H_
+#define ATHENA_BROWSER_RESOURCE_FILTER_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace athena {
+namespace browser {
+
+/**
+ * Decides which subresource requests of a tab to cancel.
+ *
+ * Agents extracting text rarely need images, fonts, media or trackers, and
+ * skipping them cuts page-load time and renderer memory. A filter blocks a
+ * request if any rule matches:
+ *
+ *   - Type: the resource type is blocked (e.g. image, font, media)
+ *   - Domain: the host, or any parent domain of it, is listed
+ *     ("doubleclick.net" also blocks "ad.doubleclick.net")
+ *   - Pattern: the URL contains a listed substring (case-insensitive)
+ *
+ * Domains live in a hash set, so a lookup costs one probe per host label.
+ * Patterns are compiled into an Aho-Corasick automaton, so matching is one
+ * pass over the URL however long the list is. Top-level documents are never
+ * blocked: cancelling them would only break navigation.
+ *
+ * Immutable after construction, so a CEF IO thread may match against it while
+ * the UI thread swaps in a new one. The blocked counter is atomic.
+ */
+class ResourceFilter {
+ public:
+  enum class ResourceType {
+    kDocument,    // Top-level page (never blocked)
+    kSubFrame,    // iframe document
+    kStylesheet,
+    kScript,
+    kImage,
+    kFont,
+    kMedia,       // Audio and video
+    kXhr,         // XMLHttpRequest and fetch()
+    kPing,        // Beacons, <a ping> and CSP reports
+    kOther,
+  };
+
+  static constexpr size_t kResourceTypeCount = static_cast<size_t>(ResourceType::kOther) + 1;
+
+  struct Rules {
+    std::vector<ResourceType> blocked_types;
+    std::vector<std::string> blocked_domains;   // Also blocks subdomains
+    std::vector<std::string> blocked_patterns;  // URL substrings
+  };
+
+  /**
+   * Type name as used by the control API ("image", "font", ...).
+   */
+  static const char* ResourceTypeName(ResourceType type);
+
+  /**
+   * Parse a control API type name.
+   * @return The type, or nullopt if the name is unknown
+   */
+  static std::optional<ResourceType> ParseResourceType(std::string_view name);
+
+  /**
+   * Compile rules. Domains are lowercased and stripped of leading dots;
+   * empty domains and patterns are ignored.
+   */
+  explicit ResourceFilter(const Rules& rules);
+
+  ResourceFilter(const ResourceFilter&) = delete;
+  ResourceFilter& operator=(const ResourceFilter&) = delete;
+
+  /**
+   * True if a request should be cancelled. Counts blocked requests.
+   */
+  bool ShouldBlock(std::string_view url, ResourceType type) const;
+
+  /**
+   * True if no rule can match anything.
+   */
+  bool IsEmpty() const;
+
+  /**
+   * Rules after normalization (for reporting back over the control API).
+   */
+  const Rules& GetRules() const { return rules_; }
+
+  /**
+   * Requests blocked so far.
+   */
+  uint64_t GetBlockedCount() const { return blocked_count_.load(std::memory_order_relaxed); }
+
+ private:
+  // Aho-Corasick trie node; children are few except near the root, so they
+  // are kept as a sorted edge list
+  struct Node {
+    std::vector<std::pair<unsigned char, int32_t>> children;
+    int32_t fail = 0;
+    bool terminal = false;  // A pattern ends here or at a suffix reachable by fail links
+  };
+
+  void BuildAutomaton();
+  int32_t FindChild(int32_t node, unsigned char c) const;
+  int32_t Step(int32_t node, unsigned char c) const;
+
+  bool IsBlockedDomain(std::string_view host) const;
+  bool MatchesPattern(std::string_view url) const;
+
+  Rules rules_;
+  std::array<bool, kResourceTypeCount> blocked_types_{};
+  std::unordered_set<std::string_view> domains_;  // Views into rules_.blocked_domains
+  std::vector<Node> nodes_;
+  std::array<int32_t, 256> root_next_{};  // Dense transitions out of the root
+
+  mutable std::atomic<uint64_t> blocked_count_{0};
+};
+
+}  // namespace browser
+}  // namespace athena
+
+#endif  // ATHENA_BROWSER_RESOURCE_FILTER_H_
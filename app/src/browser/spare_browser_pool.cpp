@@ -0,0 +1,111 @@
+#include "browser/spare_browser_pool.h"
+
+#include "utils/logging.h"
+
+#include <algorithm>
+
+namespace athena {
+namespace browser {
+
+static utils::Logger logger("SpareBrowserPool");
+
+SpareBrowserPool::SpareBrowserPool(BrowserEngine* engine, const Config& config)
+    : engine_(engine), config_(config) {}
+
+SpareBrowserPool::~SpareBrowserPool() {
+  Clear();
+}
+
+// ============================================================================
+// Adoption
+// ============================================================================
+
+std::optional<BrowserId> SpareBrowserPool::Acquire() {
+  // Spares closed behind our back (e.g. renderer crash cleanup) are dropped
+  spares_.erase(std::remove_if(spares_.begin(),
+                               spares_.end(),
+                               [this](BrowserId id) { return !engine_->HasBrowser(id); }),
+                spares_.end());
+
+  for (auto it = spares_.begin(); it != spares_.end(); ++it) {
+    if (IsReady(*it)) {
+      BrowserId id = *it;
+      spares_.erase(it);
+      stats_.hits++;
+      logger.Debug("Adopted spare browser {} ({} left)", id, spares_.size());
+      return id;
+    }
+  }
+
+  stats_.misses++;
+  return std::nullopt;
+}
+
+bool SpareBrowserPool::IsReady(BrowserId id) const {
+  // The engine reports no URL until the CEF browser has been created
+  return !engine_->GetURL(id).empty();
+}
+
+// ============================================================================
+// Pool Maintenance
+// ============================================================================
+
+size_t SpareBrowserPool::Refill() {
+  if (!engine_ || !engine_->IsInitialized()) {
+    return 0;
+  }
+
+  size_t created = 0;
+  while (spares_.size() < config_.size && consecutive_failures_ < kMaxConsecutiveFailures) {
+    BrowserConfig browser_config;
+    browser_config.url = "about:blank";
+    browser_config.width = config_.width;
+    browser_config.height = config_.height;
+    browser_config.device_scale_factor = config_.device_scale_factor;
+    browser_config.hidden = true;
+
+    auto result = engine_->CreateBrowser(browser_config);
+    if (!result) {
+      stats_.failed++;
+      consecutive_failures_++;
+      logger.Warn("Failed to create spare browser: {}", result.GetError().Message());
+      continue;
+    }
+
+    spares_.push_back(result.Value());
+    stats_.created++;
+    consecutive_failures_ = 0;
+    created++;
+  }
+
+  if (created > 0) {
+    logger.Debug("Created {} spare browser(s), pool size {}", created, spares_.size());
+  }
+  return created;
+}
+
+void SpareBrowserPool::SetTargetSize(size_t size) {
+  config_.size = size;
+  consecutive_failures_ = 0;
+
+  while (spares_.size() > config_.size) {
+    engine_->CloseBrowser(spares_.back(), true);
+    spares_.pop_back();
+  }
+}
+
+void SpareBrowserPool::SetViewport(int width, int height, float device_scale_factor) {
+  config_.width = width;
+  config_.height = height;
+  config_.device_scale_factor = device_scale_factor;
+}
+
+void SpareBrowserPool::Clear() {
+  for (BrowserId id : spares_) {
+    engine_->CloseBrowser(id, true);
+  }
+  spares_.clear();
+}
+
+}  // namespace browser
+}  // namespace athena
@@ -0,0 +1,108 @@
+#ifndef ATHENA_BROWSER_SPARE_BROWSER_POOL_H_
+#define ATHENA_BROWSER_SPARE_BROWSER_POOL_H_
+
+#include "browser/browser_engine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+
+namespace athena {
+namespace browser {
+
+/**
+ * Keeps a few hidden about:blank browsers warm so new tabs skip browser and
+ * renderer-process startup.
+ *
+ * Creating a CEF browser costs a renderer process launch plus the first
+ * navigation, which dominates the latency of opening a tab (and of an agent's
+ * /internal/tab/create). The pool creates spares ahead of time with no
+ * renderer attached; a window adopts one by attaching its renderer, resizing
+ * it and loading the real URL.
+ *
+ * A spare is only handed out once its CEF browser exists (GetURL() is no
+ * longer empty); until then Acquire() misses and the caller creates a browser
+ * the normal way. Call Refill() after acquiring, off the critical path (e.g.
+ * from a zero-delay timer), to restore the target size.
+ *
+ * Not thread-safe: call from the browser UI thread.
+ */
+class SpareBrowserPool {
+ public:
+  struct Config {
+    size_t size = 1;  // Target number of spares (0 disables the pool)
+    int width = 1200;
+    int height = 800;
+    float device_scale_factor = 1.0f;
+  };
+
+  struct Stats {
+    uint64_t hits = 0;     // Acquire() returned a spare
+    uint64_t misses = 0;   // Acquire() found no ready spare
+    uint64_t created = 0;  // Spares created
+    uint64_t failed = 0;   // Spare creations that failed
+  };
+
+  /**
+   * @param engine Browser engine spares are created in (non-owning)
+   */
+  SpareBrowserPool(BrowserEngine* engine, const Config& config);
+
+  /**
+   * Closes any spares that were never adopted.
+   */
+  ~SpareBrowserPool();
+
+  SpareBrowserPool(const SpareBrowserPool&) = delete;
+  SpareBrowserPool& operator=(const SpareBrowserPool&) = delete;
+
+  /**
+   * Take the oldest ready spare. Ownership passes to the caller, which must
+   * attach a renderer, size it and navigate it.
+   * @return Browser ID, or nullopt if no spare is ready
+   */
+  std::optional<BrowserId> Acquire();
+
+  /**
+   * Create spares until the pool holds its target size.
+   * @return Number of spares created
+   */
+  size_t Refill();
+
+  /**
+   * Change the target size. Shrinking closes the newest surplus spares.
+   */
+  void SetTargetSize(size_t size);
+
+  /**
+   * Viewport and scale for spares created from now on.
+   */
+  void SetViewport(int width, int height, float device_scale_factor);
+
+  /**
+   * Close all spares. Call before the engine shuts down.
+   */
+  void Clear();
+
+  size_t GetTargetSize() const { return config_.size; }
+  size_t GetSpareCount() const { return spares_.size(); }
+  const Stats& GetStats() const { return stats_; }
+
+ private:
+  // Consecutive creation failures after which Refill() stops trying
+  static constexpr uint64_t kMaxConsecutiveFailures = 3;
+
+  bool IsReady(BrowserId id) const;
+
+  BrowserEngine* engine_;  // Non-owning
+  Config config_;
+  std::deque<BrowserId> spares_;  // Oldest first
+  Stats stats_;
+  uint64_t consecutive_failures_ = 0;
+};
+
+}  // namespace browser
+}  // namespace athena
+
+#endif  // ATHENA_BROWSER_SPARE_BROWSER_POOL_H_
@@ -0,0 +1,91 @@
+#include "browser/tab_discard_policy.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace athena {
+namespace browser {
+
+TabDiscardPolicy::TabDiscardPolicy() : TabDiscardPolicy(Policy()) {}
+
+TabDiscardPolicy::TabDiscardPolicy(const Policy& policy) : policy_(policy) {}
+
+bool TabDiscardPolicy::IsEnabled() const {
+  return policy_.max_live_tabs > 0 || policy_.idle_timeout.count() > 0 ||
+         policy_.memory_budget_bytes > 0;
+}
+
+// ============================================================================
+// Tab Tracking
+// ============================================================================
+
+void TabDiscardPolicy::AddTab(BrowserId id, Clock::time_point now) {
+  last_used_[id] = now;
+}
+
+void TabDiscardPolicy::RemoveTab(BrowserId id) {
+  last_used_.erase(id);
+}
+
+bool TabDiscardPolicy::HasTab(BrowserId id) const {
+  return last_used_.find(id) != last_used_.end();
+}
+
+void TabDiscardPolicy::Touch(BrowserId id, Clock::time_point now) {
+  auto it = last_used_.find(id);
+  if (it != last_used_.end()) {
+    it->second = std::max(it->second, now);
+  }
+}
+
+// ============================================================================
+// Decisions
+// ============================================================================
+
+std::vector<BrowserId> TabDiscardPolicy::SelectVictims(
+    BrowserId active, Clock::time_point now, std::optional<uint64_t> resident_bytes) const {
+  // Candidates in least-recently-used order
+  std::vector<std::pair<Clock::time_point, BrowserId>> candidates;
+  candidates.reserve(last_used_.size());
+  for (const auto& [id, last_used] : last_used_) {
+    if (id != active) {
+      candidates.emplace_back(last_used, id);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+
+  // Victims are always a prefix of the LRU order: every trigger prefers the
+  // least recently used tab, so only the number to discard differs
+  size_t count = 0;
+
+  if (policy_.idle_timeout.count() > 0) {
+    while (count < candidates.size() &&
+           now - candidates[count].first >= policy_.idle_timeout) {
+      count++;
+    }
+  }
+
+  const size_t live = last_used_.size();
+  if (policy_.max_live_tabs > 0 && live > policy_.max_live_tabs) {
+    count = std::max(count, std::min(candidates.size(), live - policy_.max_live_tabs));
+  }
+
+  if (policy_.memory_budget_bytes > 0 && resident_bytes && live > 0) {
+    const uint64_t per_tab = *resident_bytes / live;
+    uint64_t projected = *resident_bytes - per_tab * count;
+    while (count < candidates.size() && projected > policy_.memory_budget_bytes) {
+      projected -= per_tab;
+      count++;
+    }
+  }
+
+  std::vector<BrowserId> victims;
+  victims.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    victims.push_back(candidates[i].second);
+  }
+  return victims;
+}
+
+}  // namespace browser
+}  // namespace athena
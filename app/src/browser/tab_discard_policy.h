@@ -0,0 +1,118 @@
+#ifndef ATHENA_BROWSER_TAB_DISCARD_POLICY_H_
+#define ATHENA_BROWSER_TAB_DISCARD_POLICY_H_
+
+#include "browser/browser_engine.h"
+#include "core/types.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace athena {
+namespace browser {
+
+/**
+ * What a window keeps of a tab whose browser was discarded.
+ *
+ * Enough to show the tab in the tab strip and to recreate it: the browser,
+ * its renderer process and its frame buffers are gone.
+ */
+struct TabSnapshot {
+  std::string url;
+  std::string title;
+  std::string thumbnail_png;  // Base64 PNG of the last frame (may be empty)
+  core::Point scroll;         // CSS pixels, restored after the page reloads
+};
+
+/**
+ * Chooses which live tabs to discard (hibernate) to bound memory use.
+ *
+ * Every live tab keeps a browser, a renderer process and frame buffers, so a
+ * long agent session that opens dozens of tabs grows without bound. The
+ * policy tracks when each live tab was last used (shown, given input, or
+ * addressed by the control server) and picks least-recently-used victims:
+ *
+ *   - Idle: unused for longer than idle_timeout
+ *   - Count: more than max_live_tabs tabs are live
+ *   - Memory: measured resident memory exceeds memory_budget_bytes
+ *     (each discard is assumed to free an average tab's share)
+ *
+ * The active tab is never discarded. Windows remove a tab from the policy
+ * when they discard it and add it back (under its new browser ID) when it is
+ * restored. Time is passed in explicitly so the policy is testable. Not
+ * thread-safe: call from the browser UI thread.
+ */
+class TabDiscardPolicy {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Policy {
+    size_t max_live_tabs = 0;                   // 0 = no limit
+    std::chrono::milliseconds idle_timeout{0};  // 0 = never discard for idleness
+    uint64_t memory_budget_bytes = 0;           // 0 = no budget
+  };
+
+  // Scale of the thumbnail kept for a discarded tab
+  static constexpr float kThumbnailScale = 0.25f;
+
+  TabDiscardPolicy();
+  explicit TabDiscardPolicy(const Policy& policy);
+
+  void SetPolicy(const Policy& policy) { policy_ = policy; }
+  const Policy& GetPolicy() const { return policy_; }
+
+  /**
+   * True if any discard trigger is configured.
+   */
+  bool IsEnabled() const;
+
+  // ============================================================================
+  // Tab Tracking
+  // ============================================================================
+
+  /**
+   * Start tracking a live tab (created or restored). Counts as a use.
+   */
+  void AddTab(BrowserId id, Clock::time_point now);
+
+  /**
+   * Stop tracking a tab (closed or discarded).
+   */
+  void RemoveTab(BrowserId id);
+
+  bool HasTab(BrowserId id) const;
+  size_t GetLiveTabCount() const { return last_used_.size(); }
+
+  /**
+   * Record a use of a tab: shown, user input or a control-server request.
+   */
+  void Touch(BrowserId id, Clock::time_point now);
+
+  // ============================================================================
+  // Decisions
+  // ============================================================================
+
+  /**
+   * Pick tabs to discard, least recently used first.
+   *
+   * @param active Active tab's browser, never selected
+   * @param resident_bytes Measured resident memory of the browser and its
+   *        children, or nullopt if unknown (disables the memory trigger)
+   */
+  std::vector<BrowserId> SelectVictims(BrowserId active,
+                                       Clock::time_point now,
+                                       std::optional<uint64_t> resident_bytes) const;
+
+ private:
+  Policy policy_;
+  std::map<BrowserId, Clock::time_point> last_used_;  // Live tabs only
+};
+
+}  // namespace browser
+}  // namespace athena
+
+#endif  // ATHENA_BROWSER_TAB_DISCARD_POLICY_H_
@@ -1,7 +1,8 @@
 #include "core/application.h"
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "utils/logging.h"
+#include "utils/startup_timeline.h"
 
 #include <algorithm>
 #include <iostream>
@@ -76,6 +77,17 @@ utils::Result<void> Application::Initialize(int& argc, char* argv[]) {
   }
 
   logger.Debug("Application::Initialize - Window system initialized");
+  utils::StartupTimeline::Instance().Mark("window_system_initialized");
+
+  // Spawn Node now so it boots while CEF initializes and the homepage loads;
+  // READY is picked up by the event loop. Node only calls the browser control
+  // server (started in Run()) once a tool runs, so it need not be up yet.
+  auto runtime_result = InitializeRuntime();
+  if (!runtime_result) {
+    logger.Warn("Application::Initialize - Node runtime initialization failed: " +
+                runtime_result.GetError().Message());
+    // Continue without runtime (non-fatal)
+  }
 
   // Initialize browser engine (initializes CEF)
   browser::EngineConfig engine_config;
@@ -87,19 +99,19 @@ utils::Result<void> Application::Initialize(int& argc, char* argv[]) {
   engine_config.remote_debugging_port = config_.remote_debugging_port;
   engine_config.remote_debugging_port_wait_timeout_ms =
       config_.remote_debugging_port_wait_timeout_ms;
+  engine_config.http_record_path = config_.http_record_path;
+  engine_config.http_replay_path = config_.http_replay_path;
 
   auto engine_result = browser_engine_->Initialize(engine_config);
   if (!engine_result) {
+    ShutdownRuntime();
     window_system_->Shutdown();
     return utils::Error("Failed to initialize browser engine: " +
                         engine_result.GetError().Message());
   }
 
   logger.Debug("Application::Initialize - Browser engine initialized");
-
-  // NOTE: Node runtime initialization is deferred until Run() is called.
-  // This ensures the runtime starts right before the event loop begins,
-  // providing better timing and guaranteed cleanup on exit.
+  utils::StartupTimeline::Instance().Mark("cef_initialized");
 
   initialized_ = true;
   logger.Info("Application initialized successfully");
@@ -119,8 +131,8 @@ void Application::Run() {
     return;
   }
 
-  // Initialize browser control server FIRST (before Node runtime)
-  // This ensures the server is listening before Node tries to connect
+  // Start the browser control server before the event loop; Node (spawned
+  // in Initialize()) only calls it once a tool runs
   auto server_result = InitializeBrowserControlServer();
   if (!server_result) {
     logger.Warn("Application::Run - Browser control server initialization failed: " +
@@ -128,15 +140,6 @@ void Application::Run() {
     // Continue without server (non-fatal)
   }
 
-  // Initialize Node runtime right before event loop starts
-  // Node will connect to browser control server during MCP initialization
-  auto runtime_result = InitializeRuntime();
-  if (!runtime_result) {
-    logger.Warn("Application::Run - Node runtime initialization failed: " +
-                runtime_result.GetError().Message());
-    // Continue without runtime (non-fatal)
-  }
-
   logger.Info("Application::Run - Entering main event loop");
   window_system_->Run();
   logger.Info("Application::Run - Exited main event loop");
@@ -322,18 +325,38 @@ utils::Result<void> Application::InitializeRuntime() {
     return utils::Ok();
   }
 
+  // Already spawned by Initialize(); a second start would fail and cancel
+  // the node_ready phase the first one is waiting for
+  if (node_runtime_->GetState() != runtime::RuntimeState::STOPPED) {
+    return utils::Ok();
+  }
+
   logger.Info("Application::InitializeRuntime - Starting Node runtime");
 
-  auto result = node_runtime_->Initialize();
+  auto& timeline = utils::StartupTimeline::Instance();
+  timeline.Expect("node_ready");
+
+  // Completes on the main thread once Node prints READY
+  auto result = node_runtime_->InitializeAsync([this](utils::Result<void> ready) {
+    auto& timeline = utils::StartupTimeline::Instance();
+    if (!ready) {
+      logger.Warn("Application::InitializeRuntime - Node runtime failed to start: " +
+                  ready.GetError().Message());
+      timeline.Cancel("node_ready");
+      return;
+    }
+
+    // Start health monitoring with automatic restart on failure
+    node_runtime_->StartHealthMonitoring();
+    timeline.Mark("node_ready");
+    logger.Info("Application::InitializeRuntime - Node runtime ready with health monitoring");
+  });
   if (!result) {
+    timeline.Cancel("node_ready");
     return utils::Error("Failed to initialize Node runtime: " + result.GetError().Message());
   }
 
-  // Start health monitoring with automatic restart on failure
-  node_runtime_->StartHealthMonitoring();
-
-  logger.Info(
-      "Application::InitializeRuntime - Node runtime started successfully with health monitoring");
+  timeline.Mark("node_spawned");
   return utils::Ok();
 }
 
@@ -381,10 +404,10 @@ utils::Result<void> Application::InitializeBrowserControlServer() {
     return utils::Error("First window's native window is null");
   }
 
-  // Cast to QtMainWindow (Qt-only build)
-  auto qt_window = std::dynamic_pointer_cast<platform::QtMainWindow>(window_shared);
-  if (!qt_window) {
-    return utils::Error("Failed to cast window to QtMainWindow");
+  // Both QtMainWindow and HeadlessWindow expose their tabs through TabHost
+  auto tab_host = std::dynamic_pointer_cast<platform::TabHost>(window_shared);
+  if (!tab_host) {
+    return utils::Error("Window does not implement TabHost");
   }
 
   // Create server config
@@ -393,7 +416,7 @@ utils::Result<void> Application::InitializeBrowserControlServer() {
 
   // Create and initialize server
   browser_control_server_ = std::make_unique<runtime::BrowserControlServer>(server_config);
-  browser_control_server_->SetBrowserWindow(qt_window);
+  browser_control_server_->SetBrowserWindow(tab_host);
 
   auto result = browser_control_server_->Initialize();
   if (!result) {
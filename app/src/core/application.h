@@ -28,6 +28,8 @@ struct ApplicationConfig {
   std::string node_runtime_script_path;  // Path to agent/dist/server/server.js
   uint16_t remote_debugging_port = 0;
   int remote_debugging_port_wait_timeout_ms = 3000;
+  std::string http_record_path;  // Record responses into this archive
+  std::string http_replay_path;  // Serve http(s) from this archive, offline
 };
 
 /**
@@ -46,7 +48,8 @@ struct ApplicationConfig {
  *
  * Lifecycle:
  *   1. Create Application with config
- *   2. Initialize() - set up engine and window system
+ *   2. Initialize() - set up window system and engine; the Node runtime is
+ *      spawned first and finishes starting in the event loop
  *   3. CreateWindow() - create browser windows
  *   4. Run() - enter main event loop
  *   5. Shutdown() or destructor - clean shutdown
@@ -301,6 +301,10 @@ utils::Result<void> BrowserWindow::Initialize() {
   window_config.enable_input = config_.enable_input;
   window_config.url = config_.url;                    // Pass URL for browser creation
   window_config.node_runtime = config_.node_runtime;  // Pass Node runtime for Agent chat
+  window_config.spare_browsers = config_.spare_browsers;
+  window_config.max_live_tabs = config_.max_live_tabs;
+  window_config.tab_idle_discard_minutes = config_.tab_idle_discard_minutes;
+  window_config.tab_memory_budget_mb = config_.tab_memory_budget_mb;
 
   platform::WindowCallbacks window_callbacks;
   SetupWindowCallbacks();
@@ -29,6 +29,10 @@ struct BrowserWindowConfig {
   bool resizable = true;
   bool enable_input = true;
   runtime::NodeRuntime* node_runtime = nullptr;  // Optional Node runtime for Agent chat
+  size_t spare_browsers = 1;                     // Pre-warmed browsers for new tabs (0 = off)
+  size_t max_live_tabs = 0;                      // Discard LRU tabs beyond this many (0 = no limit)
+  int tab_idle_discard_minutes = 0;              // Discard tabs unused this long (0 = never)
+  size_t tab_memory_budget_mb = 0;               // Discard LRU tabs above this RSS (0 = no budget)
 };
 
 /**
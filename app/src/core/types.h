@@ -1,9 +1,13 @@
 #ifndef ATHENA_CORE_TYPES_H_
 #define ATHENA_CORE_TYPES_H_
 
+#include <algorithm>
+#include <cstdint>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace athena {
 namespace core {
@@ -143,6 +147,309 @@ inline std::ostream& operator<<(std::ostream& os, const Rect& r) {
   return os << r.ToString();
 }
 
+// Region represents an arbitrary set of pixels as a list of non-overlapping
+// rectangles in banded form (the representation used by X11 and pixman):
+// - Rectangles are sorted top to bottom, then left to right.
+// - Rectangles sharing a vertical extent form a band; bands never overlap.
+// - Within a band, rectangles neither overlap nor touch.
+// - Vertically adjacent bands with identical horizontal spans are merged.
+// Because the form is canonical, two regions covering the same pixels compare
+// equal, and every pixel is covered by exactly one rectangle.
+class Region {
+ public:
+  Region() = default;
+  explicit Region(const Rect& rect) {
+    if (!rect.IsEmpty()) {
+      rects_.push_back(rect);
+    }
+  }
+
+  // Build a region from possibly overlapping rectangles (empty ones are ignored).
+  static Region FromRects(const std::vector<Rect>& rects) {
+    std::vector<int> edges;
+    edges.reserve(rects.size() * 2);
+    for (const auto& rect : rects) {
+      if (!rect.IsEmpty()) {
+        edges.push_back(rect.y);
+        edges.push_back(rect.Bottom());
+      }
+    }
+    SortUnique(&edges);
+
+    // Single sweep: each slab takes the merged spans of every rect crossing it
+    Region result;
+    BandBuilder builder(&result);
+    std::vector<Span> spans;
+    for (size_t e = 0; e + 1 < edges.size(); e++) {
+      spans.clear();
+      for (const auto& rect : rects) {
+        if (!rect.IsEmpty() && rect.y <= edges[e] && rect.Bottom() > edges[e]) {
+          spans.emplace_back(rect.x, rect.Right());
+        }
+      }
+      std::sort(spans.begin(), spans.end());
+      std::vector<Span> merged;
+      CombineSpans(spans, {}, Op::kUnion, &merged);
+      builder.Add(edges[e], edges[e + 1], merged);
+    }
+    return result;
+  }
+
+  bool operator==(const Region& other) const { return rects_ == other.rects_; }
+
+  bool operator!=(const Region& other) const { return !(*this == other); }
+
+  bool IsEmpty() const { return rects_.empty(); }
+
+  // Non-overlapping rectangles covering the region, in band order.
+  const std::vector<Rect>& Rects() const { return rects_; }
+
+  // Smallest rectangle containing the region.
+  Rect Bounds() const {
+    if (rects_.empty()) {
+      return Rect();
+    }
+    int left = rects_.front().x;
+    int right = rects_.front().Right();
+    for (const auto& rect : rects_) {
+      left = std::min(left, rect.x);
+      right = std::max(right, rect.Right());
+    }
+    int top = rects_.front().y;
+    int bottom = rects_.back().Bottom();
+    return Rect(left, top, right - left, bottom - top);
+  }
+
+  // Number of pixels covered.
+  int64_t Area() const {
+    int64_t area = 0;
+    for (const auto& rect : rects_) {
+      area += static_cast<int64_t>(rect.width) * rect.height;
+    }
+    return area;
+  }
+
+  bool Contains(const Point& point) const {
+    for (const auto& rect : rects_) {
+      if (rect.Contains(point)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool Contains(const Rect& rect) const {
+    return rect.IsEmpty() || Region(rect).Subtract(*this).IsEmpty();
+  }
+
+  bool Intersects(const Rect& rect) const {
+    for (const auto& r : rects_) {
+      if (r.Intersects(rect)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Region Union(const Region& other) const { return Combine(*this, other, Op::kUnion); }
+
+  Region Intersect(const Region& other) const { return Combine(*this, other, Op::kIntersect); }
+
+  Region Subtract(const Region& other) const { return Combine(*this, other, Op::kSubtract); }
+
+  Region Union(const Rect& rect) const { return Union(Region(rect)); }
+
+  Region Intersect(const Rect& rect) const { return Intersect(Region(rect)); }
+
+  Region Subtract(const Rect& rect) const { return Subtract(Region(rect)); }
+
+  Region& UnionWith(const Rect& rect) {
+    *this = Union(rect);
+    return *this;
+  }
+
+  Region& UnionWith(const Region& other) {
+    *this = Union(other);
+    return *this;
+  }
+
+  Region& IntersectWith(const Rect& rect) {
+    *this = Intersect(rect);
+    return *this;
+  }
+
+  void Clear() { rects_.clear(); }
+
+  std::string ToString() const {
+    std::ostringstream oss;
+    oss << "Region(";
+    for (size_t i = 0; i < rects_.size(); i++) {
+      if (i > 0) {
+        oss << ", ";
+      }
+      oss << rects_[i].ToString();
+    }
+    oss << ")";
+    return oss.str();
+  }
+
+ private:
+  enum class Op { kUnion, kIntersect, kSubtract };
+
+  // Half-open horizontal interval [first, second)
+  using Span = std::pair<int, int>;
+
+  // Collect the spans of the band covering row y, advancing |index| past
+  // bands that end at or above y.
+  static void SpansAt(const std::vector<Rect>& rects,
+                      size_t* index,
+                      int y,
+                      std::vector<Span>* out) {
+    out->clear();
+    while (*index < rects.size() && rects[*index].Bottom() <= y) {
+      (*index)++;
+    }
+    if (*index >= rects.size() || rects[*index].y > y) {
+      return;
+    }
+    const int band_top = rects[*index].y;
+    for (size_t i = *index; i < rects.size() && rects[i].y == band_top; i++) {
+      out->emplace_back(rects[i].x, rects[i].Right());
+    }
+  }
+
+  // Combine two sorted, disjoint span lists.
+  static void CombineSpans(const std::vector<Span>& a,
+                           const std::vector<Span>& b,
+                           Op op,
+                           std::vector<Span>* out) {
+    out->clear();
+    auto append = [out](int left, int right) {
+      if (left >= right) {
+        return;
+      }
+      if (!out->empty() && out->back().second >= left) {
+        out->back().second = std::max(out->back().second, right);
+      } else {
+        out->emplace_back(left, right);
+      }
+    };
+
+    if (op == Op::kUnion) {
+      size_t i = 0;
+      size_t j = 0;
+      while (i < a.size() || j < b.size()) {
+        if (j >= b.size() || (i < a.size() && a[i].first <= b[j].first)) {
+          append(a[i].first, a[i].second);
+          i++;
+        } else {
+          append(b[j].first, b[j].second);
+          j++;
+        }
+      }
+    } else if (op == Op::kIntersect) {
+      size_t i = 0;
+      size_t j = 0;
+      while (i < a.size() && j < b.size()) {
+        append(std::max(a[i].first, b[j].first), std::min(a[i].second, b[j].second));
+        if (a[i].second < b[j].second) {
+          i++;
+        } else {
+          j++;
+        }
+      }
+    } else {
+      size_t j = 0;
+      for (const auto& span : a) {
+        int left = span.first;
+        while (j < b.size() && b[j].second <= left) {
+          j++;
+        }
+        size_t k = j;
+        while (k < b.size() && b[k].first < span.second) {
+          append(left, b[k].first);
+          left = std::max(left, b[k].second);
+          k++;
+        }
+        append(left, span.second);
+      }
+    }
+  }
+
+  static void SortUnique(std::vector<int>* values) {
+    std::sort(values->begin(), values->end());
+    values->erase(std::unique(values->begin(), values->end()), values->end());
+  }
+
+  // Appends bands to a region in top-to-bottom order, merging each band into
+  // the one above when they touch and have the same spans.
+  class BandBuilder {
+   public:
+    explicit BandBuilder(Region* region) : region_(region) {}
+
+    void Add(int top, int bottom, const std::vector<Span>& spans) {
+      if (spans.empty() || top >= bottom) {
+        return;
+      }
+      auto& rects = region_->rects_;
+      if (!rects.empty() && previous_bottom_ == top && spans == previous_) {
+        for (size_t i = previous_start_; i < rects.size(); i++) {
+          rects[i].height = bottom - rects[i].y;
+        }
+      } else {
+        previous_start_ = rects.size();
+        for (const auto& span : spans) {
+          rects.emplace_back(span.first, top, span.second - span.first, bottom - top);
+        }
+        previous_ = spans;
+      }
+      previous_bottom_ = bottom;
+    }
+
+   private:
+    Region* region_;
+    std::vector<Span> previous_;
+    size_t previous_start_ = 0;  // First rect of the last emitted band
+    int previous_bottom_ = 0;
+  };
+
+  // Sweep both regions band by band, combining the spans in each horizontal slab.
+  static Region Combine(const Region& a, const Region& b, Op op) {
+    std::vector<int> edges;
+    edges.reserve((a.rects_.size() + b.rects_.size()) * 2);
+    for (const auto* rects : {&a.rects_, &b.rects_}) {
+      for (const auto& rect : *rects) {
+        edges.push_back(rect.y);
+        edges.push_back(rect.Bottom());
+      }
+    }
+    SortUnique(&edges);
+
+    Region result;
+    BandBuilder builder(&result);
+    std::vector<Span> spans_a;
+    std::vector<Span> spans_b;
+    std::vector<Span> spans;
+    size_t index_a = 0;
+    size_t index_b = 0;
+
+    for (size_t e = 0; e + 1 < edges.size(); e++) {
+      SpansAt(a.rects_, &index_a, edges[e], &spans_a);
+      SpansAt(b.rects_, &index_b, edges[e], &spans_b);
+      CombineSpans(spans_a, spans_b, op, &spans);
+      builder.Add(edges[e], edges[e + 1], spans);
+    }
+
+    return result;
+  }
+
+  std::vector<Rect> rects_;
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Region& r) {
+  return os << r.ToString();
+}
+
 // ScaleFactor represents a scaling factor (e.g., HiDPI scaling)
 struct ScaleFactor {
   float value;
@@ -7,15 +7,18 @@
 
 #include "browser/app_handler.h"
 #include "browser/cef_engine.h"
+#include "browser/platform_flags.h"
 #include "core/application.h"
 #include "include/cef_app.h"
 #include "runtime/node_runtime.h"
 #include "utils/logging.h"
+#include "utils/startup_timeline.h"
 
 // Platform-specific includes
+#include "platform/headless_window_system.h"
 #include "platform/qt_window_system.h"
 
-#include <QApplication>
+#include <QCoreApplication>
 #include <QTimer>
 
 // Forward declare GTK function to avoid header conflicts with Qt
@@ -26,6 +29,7 @@ extern "C" void gtk_disable_setlocale();
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <optional>
 
 // ============================================================================
 // Signal Handling for Clean Shutdown
@@ -51,9 +55,38 @@ void signal_handler(int signum) {
   (void)signum;  // Suppress unused parameter warning
 }
 
+/**
+ * Read an integer setting from the environment.
+ * @return The value, or nullopt if unset or outside [min_value, max_value]
+ */
+static std::optional<long> ReadEnvInt(athena::utils::Logger& logger,
+                                      const char* name,
+                                      long min_value,
+                                      long max_value) {
+  const char* env_value = std::getenv(name);
+  if (!env_value) {
+    return std::nullopt;
+  }
+
+  char* end = nullptr;
+  long value = std::strtol(env_value, &end, 10);
+  if (end == env_value || *end != '\0' || value < min_value || value > max_value) {
+    logger.Warn("Invalid {} '{}'; using default", name, env_value);
+    return std::nullopt;
+  }
+
+  logger.Info("{} set to {} via env", name, value);
+  return value;
+}
+
 int main(int argc, char* argv[]) {
   using namespace athena;
 
+  // Cold start is measured from here; the summary is logged once the first
+  // page has loaded and the Node runtime is up
+  auto& startup_timeline = utils::StartupTimeline::Instance();
+  startup_timeline.Expect("first_load_end");
+
   // Create logger for main
   utils::Logger logger("Main");
 
@@ -124,6 +157,16 @@ int main(int argc, char* argv[]) {
     }
   }
 
+  // Deterministic offline page loads for benchmarks and CI
+  if (const char* env_record = std::getenv("ATHENA_HTTP_RECORD")) {
+    config.http_record_path = env_record;
+    logger.Info("Recording HTTP responses to {}", env_record);
+  }
+  if (const char* env_replay = std::getenv("ATHENA_HTTP_REPLAY")) {
+    config.http_replay_path = env_replay;
+    logger.Info("Replaying HTTP responses from {}", env_replay);
+  }
+
   // Get initial URL from environment or use default
   std::string initial_url = "https://www.google.com";
   if (const char* env_url = std::getenv("DEV_URL")) {
@@ -201,8 +244,14 @@ int main(int argc, char* argv[]) {
   // ============================================================================
 
   auto browser_engine = std::make_unique<browser::CefEngine>(app, &main_args);
-  auto window_system = std::make_unique<platform::QtWindowSystem>();
-  logger.Info("Using Qt window system");
+  std::unique_ptr<platform::WindowSystem> window_system;
+  if (browser::IsHeadlessMode()) {
+    window_system = std::make_unique<platform::HeadlessWindowSystem>();
+    logger.Info("Using headless window system (ATHENA_HEADLESS=1)");
+  } else {
+    window_system = std::make_unique<platform::QtWindowSystem>();
+    logger.Info("Using Qt window system");
+  }
 
   auto application = std::make_unique<core::Application>(
       config, std::move(browser_engine), std::move(window_system), std::move(node_runtime));
@@ -228,6 +277,19 @@ int main(int argc, char* argv[]) {
   window_config.size = {1200, 800};
   window_config.url = initial_url;
 
+  if (auto spares = ReadEnvInt(logger, "ATHENA_SPARE_BROWSERS", 0, 8)) {
+    window_config.spare_browsers = static_cast<size_t>(*spares);
+  }
+  if (auto max_tabs = ReadEnvInt(logger, "ATHENA_MAX_LIVE_TABS", 0, 1000)) {
+    window_config.max_live_tabs = static_cast<size_t>(*max_tabs);
+  }
+  if (auto idle_minutes = ReadEnvInt(logger, "ATHENA_TAB_IDLE_DISCARD_MIN", 0, 24 * 60)) {
+    window_config.tab_idle_discard_minutes = static_cast<int>(*idle_minutes);
+  }
+  if (auto budget_mb = ReadEnvInt(logger, "ATHENA_TAB_MEMORY_BUDGET_MB", 0, 1024 * 1024)) {
+    window_config.tab_memory_budget_mb = static_cast<size_t>(*budget_mb);
+  }
+
   core::BrowserWindowCallbacks window_callbacks;
   window_callbacks.on_url_changed = [&logger](const std::string& url) {
     logger.Debug("URL changed: {}", url);
@@ -235,8 +297,11 @@ int main(int argc, char* argv[]) {
   window_callbacks.on_title_changed = [&logger](const std::string& title) {
     logger.Debug("Title changed: {}", title);
   };
-  window_callbacks.on_loading_state_changed = [&logger](bool is_loading) {
+  window_callbacks.on_loading_state_changed = [&logger, &startup_timeline](bool is_loading) {
     logger.Debug("Loading: {}", (is_loading ? "true" : "false"));
+    if (!is_loading) {
+      startup_timeline.Mark("first_load_end");
+    }
   };
 
   auto window_result = application->CreateWindow(window_config, window_callbacks);
@@ -255,6 +320,7 @@ int main(int argc, char* argv[]) {
   }
 
   logger.Info("Browser window created and shown");
+  startup_timeline.Mark("window_shown");
 
   // ============================================================================
   // Run Main Event Loop
@@ -269,7 +335,7 @@ int main(int argc, char* argv[]) {
     if (shutdown_requested.load()) {
       logger.Info("Shutdown requested by signal, exiting event loop...");
       application->Shutdown();
-      QApplication::quit();
+      QCoreApplication::quit();
       shutdown_timer->stop();
     }
   });
@@ -0,0 +1,134 @@
+#include "platform/chat_list_layout.h"
+
+#include <algorithm>
+
+namespace athena {
+namespace platform {
+
+namespace {
+
+size_t LowBit(size_t i) {
+  return i & (~i + 1);
+}
+
+}  // namespace
+
+ChatListLayout::ChatListLayout(int estimated_height)
+    : estimated_height_(std::max(estimated_height, 0)), tree_(1, 0) {}
+
+size_t ChatListLayout::Append(int spacing) {
+  Item item{estimated_height_, std::max(spacing, 0), 0};
+  items_.push_back(item);
+
+  // The new node covers the slots (p - lowbit(p), p]
+  const size_t p = items_.size();
+  tree_.push_back(item.spacing + item.height + Prefix(p - 1) - Prefix(p - LowBit(p)));
+  return Count() - 1;
+}
+
+void ChatListLayout::RemoveFront(size_t count) {
+  count = std::min(count, Count());
+  for (size_t i = 0; i < count; ++i, ++first_) {
+    const Item& item = items_[first_];
+    Add(first_, -(item.spacing + item.height));
+  }
+
+  // Removed slots are zero-extent placeholders; drop them once they are
+  // half the storage so the cost stays amortized O(1) per removal
+  if (first_ > 0 && first_ * 2 >= items_.size()) {
+    items_.erase(items_.begin(), items_.begin() + static_cast<std::ptrdiff_t>(first_));
+    first_ = 0;
+    Rebuild();
+  }
+}
+
+void ChatListLayout::Clear() {
+  items_.clear();
+  tree_.assign(1, 0);
+  first_ = 0;
+}
+
+int ChatListLayout::SetHeight(size_t index, int height) {
+  Item& item = items_[first_ + index];
+  height = std::max(height, 0);
+  const int delta = height - item.height;
+  item.generation = generation_;
+  if (delta != 0) {
+    item.height = height;
+    Add(first_ + index, delta);
+  }
+  return delta;
+}
+
+bool ChatListLayout::IsMeasured(size_t index) const {
+  return items_[first_ + index].generation == generation_;
+}
+
+void ChatListLayout::InvalidateHeights() {
+  ++generation_;
+}
+
+int ChatListLayout::Top(size_t index) const {
+  return Prefix(first_ + index) + items_[first_ + index].spacing;
+}
+
+size_t ChatListLayout::IndexAt(int y) const {
+  const size_t n = items_.size();
+  size_t step = 1;
+  while (step * 2 <= n) {
+    step *= 2;
+  }
+
+  // Count the slots that end at or above y; y lies in the next one
+  size_t pos = 0;
+  int remaining = std::max(y, 0);
+  for (; step > 0; step /= 2) {
+    if (pos + step <= n && tree_[pos + step] <= remaining) {
+      pos += step;
+      remaining -= tree_[pos];
+    }
+  }
+
+  pos = std::max(std::min(pos, n - 1), first_);
+  return pos - first_;
+}
+
+ChatListLayout::Range ChatListLayout::VisibleRange(int top, int bottom) const {
+  Range range;
+  if (IsEmpty() || bottom <= top || top >= TotalHeight() || bottom <= 0) {
+    return range;
+  }
+  range.first = IndexAt(top);
+  range.last = IndexAt(bottom - 1) + 1;
+  return range;
+}
+
+int ChatListLayout::Prefix(size_t slots) const {
+  int sum = 0;
+  for (size_t i = slots; i > 0; i -= LowBit(i)) {
+    sum += tree_[i];
+  }
+  return sum;
+}
+
+void ChatListLayout::Add(size_t slot, int delta) {
+  for (size_t i = slot + 1; i < tree_.size(); i += LowBit(i)) {
+    tree_[i] += delta;
+  }
+}
+
+void ChatListLayout::Rebuild() {
+  const size_t n = items_.size();
+  tree_.assign(n + 1, 0);
+  for (size_t i = 1; i <= n; ++i) {
+    const Item& item = items_[i - 1];
+    tree_[i] += item.spacing + item.height;
+    const size_t parent = i + LowBit(i);
+    if (parent <= n) {
+      tree_[parent] += tree_[i];
+    }
+  }
+}
+
+}  // namespace platform
+}  // namespace athena
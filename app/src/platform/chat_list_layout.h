@@ -0,0 +1,110 @@
+#ifndef ATHENA_PLATFORM_CHAT_LIST_LAYOUT_H_
+#define ATHENA_PLATFORM_CHAT_LIST_LAYOUT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace athena {
+namespace platform {
+
+/**
+ * Vertical layout of a virtualized chat message list.
+ *
+ * Keeps one cached height per message and answers "where is message i" and
+ * "which message is at offset y" in O(log n) through a Fenwick tree of item
+ * extents (gap above the item + its height), so the agent panel only has to
+ * create widgets for the messages in view, however long the conversation.
+ *
+ * Messages that have not been laid out yet use an estimated height until
+ * the view measures them; InvalidateHeights() marks every measurement stale
+ * (e.g. after a width change) but keeps the old values as estimates, so the
+ * scroll range stays close while visible messages are measured again.
+ *
+ * Indices are logical: after RemoveFront() the new first message is index 0.
+ * Not thread-safe: call from the UI thread.
+ */
+class ChatListLayout {
+ public:
+  struct Range {
+    size_t first = 0;  // First message in range
+    size_t last = 0;   // One past the last message in range
+  };
+
+  explicit ChatListLayout(int estimated_height = 80);
+
+  /**
+   * Add a message at the end, with |spacing| pixels above it.
+   * @return Index of the new message
+   */
+  size_t Append(int spacing);
+
+  /**
+   * Drop the |count| oldest messages (amortized O(1) each).
+   */
+  void RemoveFront(size_t count = 1);
+
+  void Clear();
+
+  size_t Count() const { return items_.size() - first_; }
+  bool IsEmpty() const { return Count() == 0; }
+
+  /**
+   * Record the measured height of a message.
+   * @return Change in the message's height (what content below it moves by)
+   */
+  int SetHeight(size_t index, int height);
+
+  int Height(size_t index) const { return items_[first_ + index].height; }
+  bool IsMeasured(size_t index) const;
+
+  /**
+   * Mark one message's height stale (its content changed while not laid out).
+   */
+  void Invalidate(size_t index) { items_[first_ + index].generation = 0; }
+
+  /**
+   * Mark all heights stale; they stay in use as estimates until re-measured.
+   */
+  void InvalidateHeights();
+
+  /**
+   * Offset of a message's top edge, below the gap above it.
+   */
+  int Top(size_t index) const;
+  int Bottom(size_t index) const { return Top(index) + Height(index); }
+  int TotalHeight() const { return Prefix(items_.size()); }
+
+  /**
+   * Message whose extent (gap included) contains offset |y|; offsets past
+   * the end map to the last message. Requires a non-empty list.
+   */
+  size_t IndexAt(int y) const;
+
+  /**
+   * Messages overlapping the offsets [top, bottom).
+   */
+  Range VisibleRange(int top, int bottom) const;
+
+ private:
+  struct Item {
+    int height;
+    int spacing;
+    uint32_t generation;  // Matches generation_ once measured at current width
+  };
+
+  int Prefix(size_t slots) const;  // Sum of the first |slots| extents
+  void Add(size_t slot, int delta);
+  void Rebuild();
+
+  int estimated_height_;
+  uint32_t generation_ = 1;
+  std::vector<Item> items_;  // Slots before first_ are removed (zero extent)
+  std::vector<int> tree_;    // 1-based Fenwick tree over slot extents
+  size_t first_ = 0;
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_CHAT_LIST_LAYOUT_H_
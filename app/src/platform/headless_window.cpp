@@ -0,0 +1,1023 @@
+/**
+ * HeadlessWindow Implementation
+ *
+ * Windowless tab host: CEF renders every tab into CPU memory and the browser
+ * control server drives tabs exactly as it does in the Qt window.
+ */
+
+#include "platform/headless_window.h"
+
+#include "browser/browser_engine.h"
+#include "browser/cef_client.h"
+#include "browser/cef_engine.h"
+#include "browser/thread_safety.h"
+#include "include/cef_browser.h"
+#include "platform/tab_operations.h"
+#include "rendering/gl_renderer.h"
+#include "utils/logging.h"
+#include "utils/process_memory.h"
+
+#include <algorithm>
+#include <chrono>
+#include <QCoreApplication>
+#include <QTimer>
+
+namespace athena {
+namespace platform {
+
+using namespace browser;
+using namespace rendering;
+using namespace utils;
+
+static Logger logger("HeadlessWindow");
+
+// Delay before replacing an adopted spare browser
+constexpr int kSpareRefillDelayMs = 1000;
+
+// How often background tabs are checked against the discard policy
+constexpr int kDiscardCheckIntervalMs = 5000;
+
+HeadlessWindow::HeadlessWindow(const WindowConfig& config,
+                               const WindowCallbacks& callbacks,
+                               BrowserEngine* engine)
+    : config_(config),
+      callbacks_(callbacks),
+      engine_(engine),
+      closed_(false),
+      shown_(false),
+      active_tab_index_(0),
+      discard_policy_(DiscardPolicyFromConfig(config)),
+      discard_timer_(nullptr) {
+  logger.Info("Creating headless window ({})", config_.size.ToString());
+
+  if (engine_ && config_.spare_browsers > 0) {
+    SpareBrowserPool::Config pool_config;
+    pool_config.size = config_.spare_browsers;
+    pool_config.width = config_.size.width;
+    pool_config.height = config_.size.height;
+    spare_pool_ = std::make_unique<SpareBrowserPool>(engine_, pool_config);
+  }
+
+  if (discard_policy_.IsEnabled()) {
+    discard_timer_ = new QTimer(this);
+    connect(discard_timer_, &QTimer::timeout, this, &HeadlessWindow::enforceDiscardPolicy);
+    discard_timer_->start(kDiscardCheckIntervalMs);
+  }
+}
+
+HeadlessWindow::~HeadlessWindow() {
+  logger.Info("Destroying headless window");
+  closed_ = true;
+
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  tabs_.clear();
+}
+
+// ============================================================================
+// Window Interface Implementation
+// ============================================================================
+
+std::string HeadlessWindow::GetTitle() const {
+  return config_.title;
+}
+
+void HeadlessWindow::SetTitle(const std::string& title) {
+  config_.title = title;
+}
+
+core::Size HeadlessWindow::GetSize() const {
+  return config_.size;
+}
+
+void HeadlessWindow::SetSize(const core::Size& size) {
+  std::vector<CefClient*> clients;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    config_.size = size;
+    for (auto& tab : tabs_) {
+      if (tab.cef_client) {
+        clients.push_back(tab.cef_client);
+      }
+    }
+  }
+
+  // Resize outside the lock (CEF may call back into GetViewRect)
+  for (auto* client : clients) {
+    client->SetSize(size.width, size.height);
+  }
+}
+
+float HeadlessWindow::GetScaleFactor() const {
+  return 1.0f;
+}
+
+void* HeadlessWindow::GetNativeHandle() const {
+  return nullptr;
+}
+
+void* HeadlessWindow::GetRenderWidget() const {
+  return nullptr;
+}
+
+GLRenderer* HeadlessWindow::GetGLRenderer() const {
+  return nullptr;
+}
+
+bool HeadlessWindow::IsVisible() const {
+  return shown_;
+}
+
+void HeadlessWindow::Show() {
+  if (shown_) {
+    return;
+  }
+  shown_ = true;
+
+  if (CreateTab(QString::fromStdString(config_.url)) < 0) {
+    logger.Error("Failed to create initial tab");
+  }
+}
+
+void HeadlessWindow::Hide() {
+  shown_ = false;
+}
+
+bool HeadlessWindow::HasFocus() const {
+  return false;
+}
+
+void HeadlessWindow::Focus() {}
+
+void HeadlessWindow::SetBrowser(BrowserId browser_id) {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (!findTab(browser_id)) {
+    logger.Warn("Browser ID not found in tabs");
+  }
+}
+
+BrowserId HeadlessWindow::GetBrowser() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  const HeadlessTab* tab = activeTab();
+  return tab ? tab->browser_id : 0;
+}
+
+void HeadlessWindow::Close(bool force) {
+  (void)force;  // Nothing can veto a headless close
+  if (closed_) {
+    return;
+  }
+
+  logger.Info("Closing headless window");
+  closed_ = true;
+
+  if (spare_pool_) {
+    spare_pool_->Clear();
+  }
+
+  std::vector<BrowserId> browsers_to_close;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    for (const auto& tab : tabs_) {
+      if (tab.browser_id != 0) {
+        browsers_to_close.push_back(tab.browser_id);
+      }
+    }
+  }
+
+  // Close browsers outside the lock to avoid deadlock
+  for (BrowserId id : browsers_to_close) {
+    engine_->CloseBrowser(id, false);
+  }
+
+  if (callbacks_.on_close) {
+    callbacks_.on_close();
+  }
+
+  QCoreApplication::quit();
+}
+
+bool HeadlessWindow::IsClosed() const {
+  return closed_;
+}
+
+// ============================================================================
+// Tab Management
+// ============================================================================
+
+int HeadlessWindow::CreateTab(const QString& url) {
+  if (closed_ || !cefEngine()) {
+    logger.Error("CreateTab: window closed or CEF engine not available");
+    return -1;
+  }
+
+  logger.Info("Creating headless tab with URL: " + url.toStdString());
+
+  HeadlessTab tab;
+  tab.browser_id = 0;  // Set by startBrowser()
+  tab.cef_client = nullptr;
+  tab.url = url;
+  tab.title = "New Tab";
+  tab.is_loading = true;
+  tab.can_go_back = false;
+  tab.can_go_forward = false;
+  tab.renderer = std::make_unique<SoftwareRenderer>();
+
+  size_t new_tab_index;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    tabs_.push_back(std::move(tab));
+    new_tab_index = tabs_.size() - 1;
+  }
+
+  // No GL context to wait for: the browser exists as soon as the tab does
+  if (!startBrowser(new_tab_index)) {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    tabs_.erase(tabs_.begin() + new_tab_index);
+    return -1;
+  }
+
+  SwitchToTab(new_tab_index);
+
+  logger.Info("Headless tab created, index: {}", new_tab_index);
+  return static_cast<int>(new_tab_index);
+}
+
+bool HeadlessWindow::startBrowser(size_t tab_index) {
+  auto* cef_engine = cefEngine();
+  if (!cef_engine) {
+    return false;
+  }
+
+  QString url;
+  SoftwareRenderer* renderer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (tab_index >= tabs_.size()) {
+      return false;
+    }
+    url = tabs_[tab_index].url;
+    renderer = tabs_[tab_index].renderer.get();
+  }
+
+  // Adopt a pre-warmed browser when one is ready; it only needs a renderer and a URL
+  std::optional<BrowserId> spare = spare_pool_ ? spare_pool_->Acquire() : std::nullopt;
+  BrowserId browser_id;
+  if (spare) {
+    browser_id = *spare;
+    logger.Info("Adopted spare browser {}", browser_id);
+  } else {
+    BrowserConfig browser_config;
+    browser_config.url = url.toStdString();
+    browser_config.width = config_.size.width;
+    browser_config.height = config_.size.height;
+    browser_config.device_scale_factor = GetScaleFactor();
+    browser_config.software_renderer = renderer;
+
+    auto result = engine_->CreateBrowser(browser_config);
+    if (!result.IsOk()) {
+      logger.Error("Failed to create browser: " + result.GetError().Message());
+      return false;
+    }
+    browser_id = result.Value();
+  }
+
+  CefRefPtr<CefClient> client = cef_engine->GetCefClient(browser_id);
+  if (spare && client) {
+    client->SetDeviceScaleFactor(GetScaleFactor());
+    client->SetSize(config_.size.width, config_.size.height);
+    client->SetSoftwareRenderer(renderer);
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab& tab = tabs_[tab_index];
+    tab.browser_id = browser_id;
+    tab.cef_client = client.get();
+    if (client) {
+      client->SetResourceFilter(tab.resource_filter);
+    }
+    wireCallbacks(tab);
+  }
+
+  // Navigate only once callbacks are in place, so the load's events reach the tab
+  if (spare) {
+    if (client) {
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+    }
+    engine_->LoadURL(browser_id, url.toStdString());
+  }
+
+  discard_policy_.AddTab(browser_id, TabDiscardPolicy::Clock::now());
+  scheduleSpareRefill();
+
+  logger.Info("Browser {} started for tab {}", browser_id, tab_index);
+  return true;
+}
+
+void HeadlessWindow::scheduleSpareRefill() {
+  if (!spare_pool_) {
+    return;
+  }
+
+  QTimer::singleShot(kSpareRefillDelayMs, this, [this]() {
+    if (closed_ || !spare_pool_) {
+      return;
+    }
+    spare_pool_->SetViewport(config_.size.width, config_.size.height, GetScaleFactor());
+    spare_pool_->Refill();
+  });
+}
+
+void HeadlessWindow::wireCallbacks(HeadlessTab& tab) {
+  if (!tab.cef_client) {
+    return;
+  }
+
+  BrowserId bid = tab.browser_id;
+
+  tab.cef_client->SetAddressChangeCallback([this, bid](const std::string& url_str) {
+    SafeInvokeQtCallback(this, [bid, url_str](HeadlessWindow* window) {
+      if (window->closed_) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(window->tabs_mutex_);
+      if (HeadlessTab* t = window->findTab(bid)) {
+        t->url = QString::fromStdString(url_str);
+      }
+    });
+  });
+
+  tab.cef_client->SetLoadingStateChangeCallback(
+      [this, bid](bool is_loading, bool can_go_back, bool can_go_forward) {
+        SafeInvokeQtCallback(
+            this, [bid, is_loading, can_go_back, can_go_forward](HeadlessWindow* window) {
+              if (window->closed_) {
+                return;
+              }
+              std::lock_guard<std::mutex> lock(window->tabs_mutex_);
+              if (HeadlessTab* t = window->findTab(bid)) {
+                t->is_loading = is_loading;
+                t->can_go_back = can_go_back;
+                t->can_go_forward = can_go_forward;
+
+                // A restored tab returns to where it was scrolled when discarded
+                if (!is_loading && t->pending_scroll && t->cef_client) {
+                  core::Point scroll = *t->pending_scroll;
+                  t->pending_scroll.reset();
+                  ScrollMainFrameTo(t->cef_client->GetBrowser(), scroll.x, scroll.y);
+                }
+              }
+            });
+      });
+
+  tab.cef_client->SetTitleChangeCallback([this, bid](const std::string& title_str) {
+    SafeInvokeQtCallback(this, [bid, title_str](HeadlessWindow* window) {
+      if (window->closed_) {
+        return;
+      }
+      std::lock_guard<std::mutex> lock(window->tabs_mutex_);
+      if (HeadlessTab* t = window->findTab(bid)) {
+        t->title = QString::fromStdString(title_str);
+      }
+    });
+  });
+
+  // window.open() and target="_blank" become new tabs, as in the Qt window
+  tab.cef_client->SetCreateTabCallback([this](const std::string& url, bool foreground) {
+    SafeInvokeQtCallback(this, [url, foreground](HeadlessWindow* window) {
+      if (window->closed_) {
+        return;
+      }
+
+      logger.Info("Creating new tab from popup: URL={}, foreground={}", url, foreground);
+
+      size_t previous_index = window->GetActiveTabIndex();
+      int tab_index = window->CreateTab(QString::fromStdString(url));
+      if (!foreground && tab_index >= 0) {
+        window->SwitchToTab(previous_index);
+      }
+    });
+  });
+
+  // Nobody is around to answer a dialog: reload automatically when it is safe
+  tab.cef_client->SetRendererCrashedCallback([this, bid](const std::string& reason,
+                                                         bool should_reload) {
+    SafeInvokeQtCallback(this, [bid, reason, should_reload](HeadlessWindow* window) {
+      if (window->closed_) {
+        return;
+      }
+
+      logger.Error("Renderer crashed for browser_id {}: {}", bid, reason);
+
+      bool tab_exists = false;
+      {
+        std::lock_guard<std::mutex> lock(window->tabs_mutex_);
+        tab_exists = window->findTab(bid) != nullptr;
+      }
+
+      if (should_reload && tab_exists) {
+        logger.Info("Reloading crashed page for browser_id {}", bid);
+        window->engine_->Reload(bid, false);
+      }
+    });
+  });
+}
+
+void HeadlessWindow::CloseTab(size_t index) {
+  BrowserId browser_to_close = 0;
+  std::unique_ptr<SoftwareRenderer> renderer_to_destroy;
+  size_t new_active_index = 0;
+  bool should_close_window = false;
+
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (index >= tabs_.size()) {
+      logger.Error("Invalid tab index: " + std::to_string(index));
+      return;
+    }
+
+    logger.Info("Closing tab: " + std::to_string(index));
+
+    browser_to_close = tabs_[index].browser_id;
+    renderer_to_destroy = std::move(tabs_[index].renderer);
+    tabs_.erase(tabs_.begin() + index);
+
+    should_close_window = tabs_.empty();
+    if (!should_close_window) {
+      active_tab_index_ = std::min(active_tab_index_, tabs_.size() - 1);
+      new_active_index = active_tab_index_;
+    } else {
+      active_tab_index_ = 0;
+    }
+  }
+
+  // Close the browser before its renderer goes away (outside lock)
+  if (browser_to_close != 0) {
+    discard_policy_.RemoveTab(browser_to_close);
+    if (auto* cef_engine = cefEngine()) {
+      if (auto client = cef_engine->GetCefClient(browser_to_close)) {
+        client->SetSoftwareRenderer(nullptr);
+      }
+    }
+    engine_->CloseBrowser(browser_to_close, false);
+  }
+
+  if (should_close_window) {
+    logger.Info("No tabs left, closing window");
+    Close();
+    return;
+  }
+
+  SwitchToTab(new_active_index);
+}
+
+void HeadlessWindow::SwitchToTab(size_t index) {
+  // A discarded tab gets its browser back before it is shown
+  restoreTab(index);
+
+  CefClient* client_to_show = nullptr;
+  CefClient* client_to_hide = nullptr;
+  BrowserId browser_to_show = 0;
+  BrowserId browser_to_hide = 0;
+
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (index >= tabs_.size()) {
+      logger.Error("Invalid tab index: " + std::to_string(index));
+      return;
+    }
+
+    if (active_tab_index_ < tabs_.size() && active_tab_index_ != index) {
+      client_to_hide = tabs_[active_tab_index_].cef_client;
+      browser_to_hide = tabs_[active_tab_index_].browser_id;
+    }
+
+    active_tab_index_ = index;
+    client_to_show = tabs_[index].cef_client;
+    browser_to_show = tabs_[index].browser_id;
+  }
+
+  // Background tabs stop painting, exactly as hidden Qt tabs do
+  if (client_to_hide && client_to_hide->GetBrowser()) {
+    client_to_hide->GetBrowser()->GetHost()->WasHidden(true);
+  }
+  if (engine_ && browser_to_hide != 0) {
+    engine_->SetBrowserVisible(browser_to_hide, false);
+  }
+
+  if (client_to_show && client_to_show->GetBrowser()) {
+    auto host = client_to_show->GetBrowser()->GetHost();
+    host->WasHidden(false);
+    host->Invalidate(PET_VIEW);
+  }
+  if (engine_ && browser_to_show != 0) {
+    engine_->SetBrowserVisible(browser_to_show, true);
+  }
+  discard_policy_.Touch(browser_to_show, TabDiscardPolicy::Clock::now());
+
+  logger.Info("Switched to tab " + std::to_string(index));
+}
+
+// ============================================================================
+// Tab Hibernation
+// ============================================================================
+
+void HeadlessWindow::enforceDiscardPolicy() {
+  if (closed_) {
+    return;
+  }
+
+  BrowserId active = GetBrowser();
+
+  std::optional<uint64_t> resident_bytes;
+  if (discard_policy_.GetPolicy().memory_budget_bytes > 0) {
+    resident_bytes = GetProcessTreeResidentBytes();
+  }
+
+  for (BrowserId victim :
+       discard_policy_.SelectVictims(active, TabDiscardPolicy::Clock::now(), resident_bytes)) {
+    if (closed_) {
+      return;
+    }
+    discardTab(victim);
+  }
+}
+
+bool HeadlessWindow::discardTab(BrowserId browser_id) {
+  // Held for the whole snapshot: reading the scroll position pumps the event
+  // loop, which may close the tab and release the engine's reference
+  CefRefPtr<CefClient> client;
+  SoftwareRenderer* renderer = nullptr;
+  QString url;
+  QString title;
+
+  auto find_background_tab = [this, browser_id]() -> HeadlessTab* {
+    HeadlessTab* tab = findTab(browser_id);
+    if (!tab || static_cast<size_t>(tab - tabs_.data()) == active_tab_index_) {
+      return nullptr;
+    }
+    return tab;
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = find_background_tab();
+    if (!tab) {
+      return false;
+    }
+    client = tab->cef_client;
+    renderer = tab->renderer.get();
+    url = tab->url;
+    title = tab->title;
+  }
+
+  // The frame is captured before anything pumps the event loop
+  auto capture = [renderer](std::vector<uint8_t>* rgba, core::Size* size) {
+    return renderer && renderer->CaptureViewPixels(rgba, size);
+  };
+  auto cancelled = [this, &find_background_tab] {
+    if (closed_) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    return find_background_tab() == nullptr;
+  };
+  TabSnapshot snapshot = CaptureTabSnapshot(client.get(), capture, url, title, cancelled);
+
+  // Reading the scroll position pumps the event loop: the tab may have been
+  // closed or activated meanwhile
+  std::unique_ptr<SoftwareRenderer> old_renderer;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = find_background_tab();
+    if (!tab || closed_) {
+      return false;
+    }
+    tab->discarded = std::move(snapshot);
+    tab->browser_id = 0;
+    tab->cef_client = nullptr;
+    tab->is_loading = false;
+    tab->pending_scroll.reset();
+
+    // Frame buffers are most of a headless tab's memory in this process
+    old_renderer = std::move(tab->renderer);
+    tab->renderer = std::make_unique<SoftwareRenderer>();
+  }
+
+  if (client) {
+    client->SetSoftwareRenderer(nullptr);
+  }
+  discard_policy_.RemoveTab(browser_id);
+  engine_->CloseBrowser(browser_id, false);
+
+  logger.Info("Discarded tab (browser_id {}): {}", browser_id, url.toStdString());
+  return true;
+}
+
+void HeadlessWindow::restoreTab(size_t tab_index) {
+  std::optional<TabSnapshot> snapshot;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (tab_index >= tabs_.size() || !tabs_[tab_index].discarded) {
+      return;
+    }
+
+    HeadlessTab& tab = tabs_[tab_index];
+    logger.Info("Restoring discarded tab {}: {}", tab_index, tab.discarded->url);
+
+    tab.url = QString::fromStdString(tab.discarded->url);
+    const core::Point& scroll = tab.discarded->scroll;
+    if (scroll.x != 0 || scroll.y != 0) {
+      tab.pending_scroll = scroll;
+    }
+    tab.is_loading = true;
+    snapshot = std::move(tab.discarded);
+    tab.discarded.reset();
+  }
+
+  if (!startBrowser(tab_index)) {
+    // Keep the placeholder so a later switch can try again
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (tab_index < tabs_.size()) {
+      tabs_[tab_index].discarded = std::move(snapshot);
+      tabs_[tab_index].is_loading = false;
+      tabs_[tab_index].pending_scroll.reset();
+    }
+  }
+}
+
+size_t HeadlessWindow::GetTabCount() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  return tabs_.size();
+}
+
+size_t HeadlessWindow::GetActiveTabIndex() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  return active_tab_index_;
+}
+
+std::vector<BrowserId> HeadlessWindow::GetTabBrowserIds() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  std::vector<BrowserId> ids;
+  ids.reserve(tabs_.size());
+  for (const auto& tab : tabs_) {
+    ids.push_back(tab.browser_id);
+  }
+  return ids;
+}
+
+std::optional<TabSnapshot> HeadlessWindow::GetDiscardedTab(size_t index) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return std::nullopt;
+  }
+  return tabs_[index].discarded;
+}
+
+bool HeadlessWindow::SetResourceFilter(size_t index, std::shared_ptr<const ResourceFilter> filter) {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return false;
+  }
+  HeadlessTab& tab = tabs_[index];
+  tab.resource_filter = std::move(filter);
+  if (tab.cef_client) {
+    tab.cef_client->SetResourceFilter(tab.resource_filter);
+  }
+  return true;
+}
+
+std::shared_ptr<const ResourceFilter> HeadlessWindow::GetResourceFilter(size_t index) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return nullptr;
+  }
+  return tabs_[index].resource_filter;
+}
+
+bool HeadlessWindow::WaitForLoadToComplete(size_t tab_index, int timeout_ms) const {
+  return WaitForLoadState(tab_index, LoadTracker::WaitCondition(), timeout_ms);
+}
+
+bool HeadlessWindow::WaitForLoadState(size_t tab_index,
+                                      const LoadTracker::WaitCondition& condition,
+                                      int timeout_ms) const {
+  auto start = std::chrono::steady_clock::now();
+
+  while (true) {
+    bool ready = false;
+    {
+      std::lock_guard<std::mutex> lock(tabs_mutex_);
+      if (tab_index >= tabs_.size()) {
+        logger.Warn("WaitForLoadToComplete: invalid tab index " + std::to_string(tab_index));
+        return false;
+      }
+
+      // The load event keeps using the loading flag, which is set as soon as
+      // a navigation is requested; finer conditions consult the load tracker
+      const HeadlessTab& tab = tabs_[tab_index];
+      if (tab.cef_client == nullptr) {
+        ready = false;
+      } else if (condition.until == LoadTracker::WaitUntil::kLoad) {
+        ready = !tab.is_loading;
+      } else {
+        ready = tab.cef_client->GetLoadTracker().IsSatisfied(condition, LoadTracker::Clock::now());
+      }
+    }
+
+    if (ready) {
+      return true;
+    }
+
+    if (closed_) {
+      logger.Warn("WaitForLoadToComplete aborted because window is closed");
+      return false;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+    if (elapsed >= timeout_ms) {
+      logger.Warn("Waiting for {} timed out after {}ms for tab {}",
+                  LoadTracker::DescribeWaitCondition(condition),
+                  timeout_ms,
+                  tab_index);
+      return false;
+    }
+
+    PumpEventsOnce(10);
+  }
+}
+
+HeadlessTab* HeadlessWindow::findTab(BrowserId browser_id) {
+  auto it = std::find_if(tabs_.begin(), tabs_.end(), [browser_id](const HeadlessTab& t) {
+    return t.browser_id == browser_id;
+  });
+  return it != tabs_.end() ? &*it : nullptr;
+}
+
+HeadlessTab* HeadlessWindow::activeTab() {
+  if (tabs_.empty() || active_tab_index_ >= tabs_.size()) {
+    return nullptr;
+  }
+  return &tabs_[active_tab_index_];
+}
+
+const HeadlessTab* HeadlessWindow::activeTab() const {
+  return const_cast<HeadlessWindow*>(this)->activeTab();
+}
+
+// ============================================================================
+// Navigation
+// ============================================================================
+
+void HeadlessWindow::LoadURL(const QString& url) {
+  CefClient* client = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = activeTab();
+    if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser()) {
+      logger.Warn("LoadURL: No active browser");
+      return;
+    }
+    client = tab->cef_client;
+    tab->url = url;
+    tab->is_loading = true;
+    client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+  }
+
+  // Call CEF outside the lock to avoid deadlock if CEF calls back into our code
+  logger.Info("Loading URL: " + url.toStdString());
+  client->GetBrowser()->GetMainFrame()->LoadURL(url.toStdString());
+}
+
+void HeadlessWindow::GoBack() {
+  CefClient* client = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = activeTab();
+    if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
+      client = tab->cef_client;
+      tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+    }
+  }
+
+  if (client) {
+    client->GetBrowser()->GoBack();
+  }
+}
+
+void HeadlessWindow::GoForward() {
+  CefClient* client = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = activeTab();
+    if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
+      client = tab->cef_client;
+      tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+    }
+  }
+
+  if (client) {
+    client->GetBrowser()->GoForward();
+  }
+}
+
+void HeadlessWindow::Reload(bool ignore_cache) {
+  CefClient* client = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = activeTab();
+    if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
+      client = tab->cef_client;
+      tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+    }
+  }
+
+  if (!client) {
+    return;
+  }
+  if (ignore_cache) {
+    client->GetBrowser()->ReloadIgnoreCache();
+  } else {
+    client->GetBrowser()->Reload();
+  }
+}
+
+QString HeadlessWindow::GetCurrentUrl() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  const HeadlessTab* tab = activeTab();
+  return tab ? tab->url : QString();
+}
+
+// ============================================================================
+// Browser Content Access
+// ============================================================================
+
+QString HeadlessWindow::GetPageHTML() const {
+  CefRefPtr<CefBrowser> browser;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    const HeadlessTab* tab = activeTab();
+    if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser()) {
+      return QString();
+    }
+    browser = tab->cef_client->GetBrowser();
+  }
+
+  return FetchPageHtml(browser);
+}
+
+QString HeadlessWindow::ExecuteJavaScript(const QString& code) const {
+  CefClient* cef_client = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    const HeadlessTab* tab = activeTab();
+    if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser()) {
+      logger.Error("ExecuteJavaScript: No active CEF client or browser");
+      return QString(R"({"success":false,"error":{"message":"No active browser"}})");
+    }
+    cef_client = tab->cef_client;
+  }
+
+  return EvaluateJavaScript(cef_client, code, [this] { return closed_; });
+}
+
+// ============================================================================
+// Screenshots
+// ============================================================================
+
+QString HeadlessWindow::TakeScreenshot(const core::Rect* region) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+
+  const HeadlessTab* tab = activeTab();
+  if (!tab || !tab->renderer) {
+    logger.Error("TakeScreenshot: No active tab or renderer");
+    return QString();
+  }
+
+  std::vector<uint8_t> pixels;
+  core::Size size;
+  if (!tab->renderer->CaptureViewPixels(&pixels, &size, region)) {
+    logger.Error("TakeScreenshot: No frame painted yet");
+    return QString();
+  }
+
+  std::string base64_png = GLRenderer::EncodePng(pixels.data(), size, GLRenderer::kScreenshotScale);
+  if (base64_png.empty()) {
+    logger.Error("TakeScreenshot: Failed to encode screenshot");
+    return QString();
+  }
+
+  logger.Info("Screenshot captured successfully");
+  return QString::fromStdString(base64_png);
+}
+
+DamageTracker::Capture HeadlessWindow::ConsumeDamage(std::optional<uint64_t> since_token) {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+
+  HeadlessTab* tab = activeTab();
+  if (!tab || !tab->cef_client) {
+    // No tracker to consult; report a full-frame change without a token
+    return DamageTracker::Capture{};
+  }
+
+  return tab->cef_client->GetDamageTracker().Consume(since_token);
+}
+
+QString HeadlessWindow::TakeFullPageScreenshot(int page_height,
+                                               int viewport_height,
+                                               int scroll_x,
+                                               int scroll_y) {
+  // Held for the whole capture: scrolling pumps the event loop, which may
+  // close the tab and release the engine's reference
+  CefRefPtr<CefClient> cef_client;
+  BrowserId browser_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = activeTab();
+    if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser() || !tab->renderer) {
+      logger.Error("TakeFullPageScreenshot: No active tab or renderer");
+      return QString();
+    }
+    cef_client = tab->cef_client;
+    browser_id = tab->browser_id;
+  }
+
+  // The tab may also be closed or discarded between tiles, so its renderer is
+  // looked up again each time
+  auto capture = [this, browser_id](std::vector<uint8_t>* rgba, core::Size* size) {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = findTab(browser_id);
+    return tab && tab->renderer && tab->renderer->CaptureViewPixels(rgba, size);
+  };
+  auto cancelled = [this, browser_id] {
+    if (closed_) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    HeadlessTab* tab = findTab(browser_id);
+    return !tab || !tab->renderer;
+  };
+  return CaptureFullPage(cef_client.get(),
+                         capture,
+                         page_height,
+                         viewport_height,
+                         scroll_x,
+                         scroll_y,
+                         cancelled);
+}
+
+QString HeadlessWindow::TakeAnnotatedScreenshot(const std::vector<Annotation>& annotations,
+                                                int viewport_width) const {
+  std::vector<uint8_t> pixels;
+  core::Size size;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    const HeadlessTab* tab = activeTab();
+    if (!tab || !tab->renderer) {
+      logger.Error("TakeAnnotatedScreenshot: No active tab or renderer");
+      return QString();
+    }
+    if (!tab->renderer->CaptureViewPixels(&pixels, &size)) {
+      logger.Error("TakeAnnotatedScreenshot: Failed to capture frame");
+      return QString();
+    }
+  }
+
+  return EncodeAnnotatedScreenshot(&pixels, size, annotations, viewport_width);
+}
+
+// ============================================================================
+// Frame Rate Governor
+// ============================================================================
+
+CefEngine* HeadlessWindow::cefEngine() const {
+  return dynamic_cast<CefEngine*>(engine_);
+}
+
+void HeadlessWindow::NotifyAgentActivity() {
+  if (!engine_) {
+    return;
+  }
+
+  BrowserId browser_id = GetBrowser();
+  if (browser_id != 0) {
+    engine_->NotifyAgentDemand(browser_id);
+    discard_policy_.Touch(browser_id, TabDiscardPolicy::Clock::now());
+  }
+}
+
+std::optional<FrameRateGovernor::Metrics> HeadlessWindow::GetFrameRateMetrics() const {
+  auto* cef_engine = cefEngine();
+  if (!cef_engine) {
+    return std::nullopt;
+  }
+  return cef_engine->GetFrameRateMetrics();
+}
+
+}  // namespace platform
+}  // namespace athena
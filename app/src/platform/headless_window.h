@@ -0,0 +1,270 @@
+#ifndef ATHENA_PLATFORM_HEADLESS_WINDOW_H_
+#define ATHENA_PLATFORM_HEADLESS_WINDOW_H_
+
+#include "browser/frame_rate_governor.h"
+#include "browser/resource_filter.h"
+#include "browser/spare_browser_pool.h"
+#include "browser/tab_discard_policy.h"
+#include "platform/tab_host.h"
+#include "platform/window_system.h"
+#include "rendering/annotation_compositor.h"
+#include "rendering/damage_tracker.h"
+#include "rendering/software_renderer.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <vector>
+
+namespace athena {
+namespace browser {
+class CefClient;
+class CefEngine;
+class BrowserEngine;
+using BrowserId = uint64_t;
+}  // namespace browser
+
+namespace platform {
+
+/**
+ * Represents a single browser tab (headless version).
+ *
+ * Each tab owns its own SoftwareRenderer; CEF paints land in CPU buffers that
+ * screenshots read directly.
+ */
+struct HeadlessTab {
+  browser::BrowserId browser_id;                          // Browser instance ID
+  browser::CefClient* cef_client;                         // Non-owning pointer to CefClient
+  QString title;                                          // Page title
+  QString url;                                            // Current URL
+  bool is_loading;                                        // Loading state
+  bool can_go_back;                                       // Can navigate back
+  bool can_go_forward;                                    // Can navigate forward
+  std::unique_ptr<rendering::SoftwareRenderer> renderer;  // CPU frame store
+
+  // Set while the browser is discarded (browser_id is 0, cef_client null)
+  std::optional<browser::TabSnapshot> discarded;
+  std::optional<core::Point> pending_scroll;  // Restored once a recreated page loads
+
+  // Applied to every browser this tab gets (created, adopted or restored)
+  std::shared_ptr<const browser::ResourceFilter> resource_filter;
+};
+
+/**
+ * Windowless browser host for agent-driven and CI use.
+ *
+ * Implements the same Window and TabHost interfaces as QtMainWindow, but owns
+ * no widgets, GL contexts or display connection: every tab renders off-screen
+ * into a SoftwareRenderer. Browsers are created as soon as a tab is created
+ * (there is no GL context to wait for), so the control server can drive a tab
+ * immediately.
+ *
+ * Derives from QObject so CEF callbacks can be marshaled onto the main thread
+ * with SafeInvokeQtCallback, exactly like QtMainWindow.
+ *
+ * Thread Safety:
+ *   - All public methods MUST be called from the main (Qt event loop) thread
+ *   - tabs_mutex_ protects tabs_ and active_tab_index_; it is never held while
+ *     calling into CEF
+ */
+class HeadlessWindow : public QObject, public Window, public TabHost {
+  Q_OBJECT
+
+ public:
+  /**
+   * Create a headless window.
+   *
+   * @param config Window configuration (size is the viewport of every tab)
+   * @param callbacks Event callbacks
+   * @param engine Browser engine (non-owning pointer)
+   */
+  HeadlessWindow(const WindowConfig& config,
+                 const WindowCallbacks& callbacks,
+                 browser::BrowserEngine* engine);
+
+  ~HeadlessWindow() override;
+
+  // Disable copy and move
+  HeadlessWindow(const HeadlessWindow&) = delete;
+  HeadlessWindow& operator=(const HeadlessWindow&) = delete;
+  HeadlessWindow(HeadlessWindow&&) = delete;
+  HeadlessWindow& operator=(HeadlessWindow&&) = delete;
+
+  // ============================================================================
+  // Window Properties (Window interface implementation)
+  // ============================================================================
+
+  std::string GetTitle() const override;
+  void SetTitle(const std::string& title) override;
+
+  core::Size GetSize() const override;
+  void SetSize(const core::Size& size) override;
+
+  float GetScaleFactor() const override;
+
+  void* GetNativeHandle() const override;
+  void* GetRenderWidget() const override;
+
+  rendering::GLRenderer* GetGLRenderer() const override;
+
+  // ============================================================================
+  // Window State (Window interface implementation)
+  // ============================================================================
+
+  bool IsVisible() const override;
+
+  /**
+   * "Show" the window: creates the first tab with the configured URL.
+   */
+  void Show() override;
+  void Hide() override;
+
+  bool HasFocus() const override;
+  void Focus() override;
+
+  // ============================================================================
+  // Browser Integration (Window interface implementation)
+  // ============================================================================
+
+  void SetBrowser(browser::BrowserId browser_id) override;
+  browser::BrowserId GetBrowser() const override;
+
+  // ============================================================================
+  // Lifecycle (Window interface implementation)
+  // ============================================================================
+
+  void Close(bool force = false) override;
+  bool IsClosed() const override;
+
+  // ============================================================================
+  // Tabs (TabHost interface implementation)
+  // ============================================================================
+
+  int CreateTab(const QString& url) override;
+  void CloseTab(size_t index) override;
+  void SwitchToTab(size_t index) override;
+  size_t GetTabCount() const override;
+  size_t GetActiveTabIndex() const override;
+  std::vector<browser::BrowserId> GetTabBrowserIds() const override;
+  std::optional<browser::TabSnapshot> GetDiscardedTab(size_t index) const override;
+  bool SetResourceFilter(size_t index,
+                         std::shared_ptr<const browser::ResourceFilter> filter) override;
+  std::shared_ptr<const browser::ResourceFilter> GetResourceFilter(size_t index) const override;
+  bool WaitForLoadToComplete(size_t tab_index, int timeout_ms = 15000) const override;
+  bool WaitForLoadState(size_t tab_index,
+                        const browser::LoadTracker::WaitCondition& condition,
+                        int timeout_ms = 15000) const override;
+
+  // ============================================================================
+  // Navigation and Content (TabHost interface implementation)
+  // ============================================================================
+
+  void LoadURL(const QString& url) override;
+  void GoBack() override;
+  void GoForward() override;
+  void Reload(bool ignore_cache = false) override;
+  QString GetCurrentUrl() const override;
+
+  QString GetPageHTML() const override;
+  QString ExecuteJavaScript(const QString& code) const override;
+
+  // ============================================================================
+  // Screenshots (TabHost interface implementation)
+  // ============================================================================
+
+  QString TakeScreenshot(const core::Rect* region = nullptr) const override;
+  rendering::DamageTracker::Capture ConsumeDamage(std::optional<uint64_t> since_token) override;
+  QString TakeFullPageScreenshot(int page_height,
+                                 int viewport_height,
+                                 int scroll_x,
+                                 int scroll_y) override;
+  QString TakeAnnotatedScreenshot(const std::vector<rendering::Annotation>& annotations,
+                                  int viewport_width) const override;
+
+  // ============================================================================
+  // Frame Rate Governor (TabHost interface implementation)
+  // ============================================================================
+
+  void NotifyAgentActivity() override;
+  std::optional<browser::FrameRateGovernor::Metrics> GetFrameRateMetrics() const override;
+
+ private:
+  /**
+   * Wire CEF callbacks for a freshly created browser.
+   * Caller must hold tabs_mutex_.
+   */
+  void wireCallbacks(HeadlessTab& tab);
+
+  /**
+   * Create (or adopt) the browser for a tab that has none, using the tab's URL
+   * and renderer, and wire its callbacks.
+   * @return false if no browser could be created
+   */
+  bool startBrowser(size_t tab_index);
+
+  /**
+   * Top the spare browser pool back up after a short delay.
+   */
+  void scheduleSpareRefill();
+
+  /**
+   * Discard the tabs the discard policy selects (periodic timer).
+   */
+  void enforceDiscardPolicy();
+
+  /**
+   * Snapshot a background tab, close its browser and free its frame buffers.
+   * @return true if the tab was discarded
+   */
+  bool discardTab(browser::BrowserId browser_id);
+
+  /**
+   * Recreate a discarded tab's browser from its snapshot. No-op for live tabs.
+   */
+  void restoreTab(size_t tab_index);
+
+  /**
+   * Find a tab by browser ID. Caller must hold tabs_mutex_.
+   */
+  HeadlessTab* findTab(browser::BrowserId browser_id);
+
+  /**
+   * Active tab, or nullptr if no tabs exist. Caller must hold tabs_mutex_.
+   */
+  HeadlessTab* activeTab();
+  const HeadlessTab* activeTab() const;
+
+  /**
+   * The engine as a CefEngine (for frame-rate metrics and client lookup), or nullptr.
+   */
+  browser::CefEngine* cefEngine() const;
+
+  // ============================================================================
+  // Member Variables
+  // ============================================================================
+
+  WindowConfig config_;
+  WindowCallbacks callbacks_;
+  browser::BrowserEngine* engine_;  // Non-owning
+  bool closed_;
+  bool shown_;
+
+  std::vector<HeadlessTab> tabs_;  // All open tabs
+  size_t active_tab_index_;        // Index of currently active tab
+  mutable std::mutex tabs_mutex_;  // Protects tabs_ and active_tab_index_
+
+  // Pre-warmed browsers adopted by new tabs (null when disabled)
+  std::unique_ptr<browser::SpareBrowserPool> spare_pool_;
+
+  // Tab hibernation (main thread only)
+  browser::TabDiscardPolicy discard_policy_;
+  QTimer* discard_timer_;  // Owned by this QObject (null when disabled)
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_HEADLESS_WINDOW_H_
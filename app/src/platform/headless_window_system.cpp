@@ -0,0 +1,162 @@
+/**
+ * HeadlessWindowSystem Implementation
+ *
+ * QtCore-only window system for running without a display.
+ * Integrates CEF message loop with a QCoreApplication event loop.
+ */
+
+#include "platform/headless_window_system.h"
+
+#include "browser/browser_engine.h"
+#include "browser/cef_engine.h"
+#include "include/cef_app.h"
+#include "platform/headless_window.h"
+#include "utils/logging.h"
+
+#include <QCoreApplication>
+#include <QTimer>
+
+namespace athena {
+namespace platform {
+
+using namespace utils;
+
+static Logger logger("HeadlessWindowSystem");
+
+HeadlessWindowSystem::HeadlessWindowSystem()
+    : initialized_(false),
+      running_(false),
+      engine_(nullptr),
+      app_(nullptr),
+      cef_timer_(nullptr),
+      frame_rate_timer_(nullptr),
+      window_(nullptr) {}
+
+HeadlessWindowSystem::~HeadlessWindowSystem() {
+  Shutdown();
+}
+
+Result<void> HeadlessWindowSystem::Initialize(int& argc,
+                                              char* argv[],
+                                              browser::BrowserEngine* engine) {
+  if (initialized_) {
+    return Error("WindowSystem already initialized");
+  }
+
+  if (!engine) {
+    return Error("BrowserEngine cannot be null");
+  }
+
+  logger.Info("Initializing headless window system");
+
+  // QCoreApplication needs no display server (no QPA platform plugin)
+  app_ = new QCoreApplication(argc, argv);
+  app_->setApplicationName("Athena Browser");
+  app_->setApplicationVersion("1.0");
+
+  engine_ = engine;
+  initialized_ = true;
+
+  logger.Info("Headless window system initialized");
+  return Ok();
+}
+
+void HeadlessWindowSystem::Shutdown() {
+  if (!initialized_)
+    return;
+
+  logger.Info("Shutting down headless window system");
+
+  if (cef_timer_) {
+    cef_timer_->stop();
+    delete cef_timer_;
+    cef_timer_ = nullptr;
+  }
+
+  if (frame_rate_timer_) {
+    frame_rate_timer_->stop();
+    delete frame_rate_timer_;
+    frame_rate_timer_ = nullptr;
+  }
+
+  window_.reset();
+
+  if (app_) {
+    delete app_;
+    app_ = nullptr;
+  }
+
+  initialized_ = false;
+  running_ = false;
+  engine_ = nullptr;
+
+  logger.Info("Headless window system shut down");
+}
+
+bool HeadlessWindowSystem::IsInitialized() const {
+  return initialized_;
+}
+
+Result<std::shared_ptr<Window>> HeadlessWindowSystem::CreateWindow(
+    const WindowConfig& config, const WindowCallbacks& callbacks) {
+  if (!initialized_) {
+    return Error("WindowSystem not initialized");
+  }
+
+  logger.Info("Creating headless window");
+
+  window_ = std::make_shared<HeadlessWindow>(config, callbacks, engine_);
+
+  return std::static_pointer_cast<Window>(window_);
+}
+
+void HeadlessWindowSystem::Run() {
+  if (!initialized_) {
+    logger.Error("Cannot run: WindowSystem not initialized");
+    return;
+  }
+
+  logger.Info("Starting headless event loop");
+  running_ = true;
+
+  // Same CEF pump as QtWindowSystem: CefDoMessageLoopWork() every 10ms
+  cef_timer_ = new QTimer(app_);
+  QObject::connect(cef_timer_, &QTimer::timeout, []() { CefDoMessageLoopWork(); });
+  cef_timer_->start(10);
+
+  logger.Info("CEF message pump started (10ms interval)");
+
+  // Re-evaluate per-browser frame rates (visibility, agent activity, paint activity)
+  if (auto* cef_engine = dynamic_cast<browser::CefEngine*>(engine_)) {
+    frame_rate_timer_ = new QTimer(app_);
+    QObject::connect(frame_rate_timer_, &QTimer::timeout, [cef_engine]() {
+      cef_engine->UpdateFrameRates();
+    });
+    frame_rate_timer_->start(250);
+  }
+
+  // Creates the first tab if main() has not shown the window yet
+  if (window_) {
+    window_->Show();
+  }
+
+  // Run Qt event loop (blocks until quit)
+  int exitCode = app_->exec();
+
+  running_ = false;
+  logger.Info("Headless event loop exited with code " + std::to_string(exitCode));
+}
+
+void HeadlessWindowSystem::Quit() {
+  if (running_ && app_) {
+    app_->quit();
+    running_ = false;
+  }
+}
+
+bool HeadlessWindowSystem::IsRunning() const {
+  return running_;
+}
+
+}  // namespace platform
+}  // namespace athena
@@ -0,0 +1,77 @@
+#ifndef ATHENA_PLATFORM_HEADLESS_WINDOW_SYSTEM_H_
+#define ATHENA_PLATFORM_HEADLESS_WINDOW_SYSTEM_H_
+
+#include "platform/window_system.h"
+
+#include <memory>
+
+// Forward declarations for Qt classes (in global namespace)
+class QCoreApplication;
+class QTimer;
+
+namespace athena {
+namespace browser {
+class BrowserEngine;
+}
+
+namespace platform {
+
+class HeadlessWindow;
+
+/**
+ * Headless window system implementation.
+ *
+ * Runs a QCoreApplication event loop (QtCore only: no display connection,
+ * widgets or GL) with the same CEF message pump and frame-rate timers as
+ * QtWindowSystem. Windows are HeadlessWindows that render into CPU memory.
+ *
+ * Selected by main() when ATHENA_HEADLESS=1.
+ */
+class HeadlessWindowSystem : public WindowSystem {
+ public:
+  HeadlessWindowSystem();
+  ~HeadlessWindowSystem() override;
+
+  // Disable copy and move
+  HeadlessWindowSystem(const HeadlessWindowSystem&) = delete;
+  HeadlessWindowSystem& operator=(const HeadlessWindowSystem&) = delete;
+  HeadlessWindowSystem(HeadlessWindowSystem&&) = delete;
+  HeadlessWindowSystem& operator=(HeadlessWindowSystem&&) = delete;
+
+  // ============================================================================
+  // Lifecycle Management
+  // ============================================================================
+
+  utils::Result<void> Initialize(int& argc, char* argv[], browser::BrowserEngine* engine) override;
+  void Shutdown() override;
+  bool IsInitialized() const override;
+
+  // ============================================================================
+  // Window Management
+  // ============================================================================
+
+  utils::Result<std::shared_ptr<Window>> CreateWindow(const WindowConfig& config,
+                                                      const WindowCallbacks& callbacks) override;
+
+  // ============================================================================
+  // Event Loop
+  // ============================================================================
+
+  void Run() override;
+  void Quit() override;
+  bool IsRunning() const override;
+
+ private:
+  bool initialized_;
+  bool running_;
+  browser::BrowserEngine* engine_;          // Non-owning
+  QCoreApplication* app_;                   // Qt application instance (owned)
+  QTimer* cef_timer_;                       // CEF message pump timer (owned by app_)
+  QTimer* frame_rate_timer_;                // Frame-rate governor tick (owned by app_)
+  std::shared_ptr<HeadlessWindow> window_;  // Main window instance
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_HEADLESS_WINDOW_SYSTEM_H_
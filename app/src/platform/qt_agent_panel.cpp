@@ -3,20 +3,33 @@
 #include "qt_mainwindow.h"
 #include "runtime/node_runtime.h"
 
+#include <nlohmann/json.hpp>
 #include <QAbstractSlider>
 #include <QApplication>
 #include <QDebug>
 #include <QEvent>
 #include <QGraphicsDropShadowEffect>
-#include <QGraphicsOpacityEffect>
 #include <QPropertyAnimation>
-#include <QResizeEvent>
+#include <QScreen>
 #include <QScrollBar>
 #include <QTimer>
 
 namespace athena {
 namespace platform {
 
+namespace {
+
+// String member of a JSON object, or |fallback| if missing or not a string
+QString JsonString(const nlohmann::json& object, const char* key, const QString& fallback = {}) {
+  auto it = object.find(key);
+  if (it == object.end() || !it->is_string()) {
+    return fallback;
+  }
+  return QString::fromStdString(it->get_ref<const std::string&>());
+}
+
+}  // namespace
+
 // ============================================================================
 // AgentPanel Implementation
 // ============================================================================
@@ -29,7 +42,9 @@ AgentPanel::AgentPanel(QtMainWindow* window, QWidget* parent)
       waiting_for_response_(false),
       userCanceledResponse_(false),
       streaming_socket_(nullptr),
-      headers_received_(false),
+      response_parser_([this](std::string_view fragment) { sse_decoder_.Feed(fragment); }),
+      sse_decoder_([this](const runtime::SseEvent& event) { handleStreamEvent(event); }),
+      render_scheduled_(false),
       current_session_id_(),
       palette_(),
       autoScrollEnabled_(true),
@@ -52,30 +67,19 @@ void AgentPanel::setupUI() {
   // Header
   // ============================================================================
 
-  scrollArea_ = new QScrollArea(this);
-  scrollArea_->setWidgetResizable(true);
-  scrollArea_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  scrollArea_ = new ChatListView(this);
+  scrollArea_->setObjectName(QStringLiteral("agentChatList"));
   scrollArea_->setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
   scrollArea_->setFrameShape(QFrame::NoFrame);  // Remove frame border
 
-  messagesContainer_ = new QWidget();
-  messagesContainer_->setSizePolicy(QSizePolicy::Expanding, QSizePolicy::Maximum);
-  messagesLayout_ = new QVBoxLayout(messagesContainer_);
-  messagesLayout_->setContentsMargins(12, 12, 12, 16);
-  messagesLayout_->setSpacing(10);  // Spacing handled dynamically per message
-  messagesLayout_->setAlignment(Qt::AlignTop | Qt::AlignLeft);  // Align bubbles to left
-  messagesLayout_->addStretch();                                // Push messages to top
-
-  scrollArea_->setWidget(messagesContainer_);
   mainLayout_->addWidget(scrollArea_, 1);  // Stretch factor 1
 
   // ============================================================================
   // Thinking Indicator
   // ============================================================================
 
-  thinkingIndicator_ = new ThinkingIndicator(messagesContainer_);
+  thinkingIndicator_ = new ThinkingIndicator(scrollArea_->viewport());
   thinkingIndicator_->hide();
-  // Don't add to layout yet - we'll dynamically add it before stretch when showing
 
   // ============================================================================
   // Input Area (Footer)
@@ -255,11 +259,8 @@ void AgentPanel::applyPalette() {
 }
 
 void AgentPanel::applyPaletteToScrollArea() {
-  messagesContainer_->setStyleSheet(QStringLiteral("QWidget { background-color: %1; }")
-                                        .arg(ColorToCss(palette_.messageAreaBackground)));
-
   scrollArea_->setStyleSheet(QStringLiteral(R"(
-    QScrollArea {
+    QAbstractScrollArea#agentChatList {
       border: none;
       background-color: %1;
     }
@@ -338,11 +339,7 @@ void AgentPanel::applyPaletteToButtons() {
 }
 
 void AgentPanel::applyPaletteToMessages() {
-  for (auto* bubble : messageBubbles_) {
-    if (bubble) {
-      bubble->ApplyTheme(palette_);
-    }
-  }
+  scrollArea_->ApplyTheme(palette_);
 }
 
 void AgentPanel::applyPaletteToThinkingIndicator() {
@@ -384,31 +381,6 @@ void AgentPanel::changeEvent(QEvent* event) {
   QWidget::changeEvent(event);
 }
 
-void AgentPanel::resizeEvent(QResizeEvent* event) {
-  QWidget::resizeEvent(event);
-
-  // Update maximum width constraints for all chat bubbles when panel is resized
-  // This ensures text wraps properly at any panel width
-  if (scrollArea_ && scrollArea_->viewport()) {
-    // Calculate available width: viewport width minus container margins
-    int viewportWidth = scrollArea_->viewport()->width();
-    int containerMargins = 24;  // 12px left + 12px right from messagesLayout_
-    int maxBubbleWidth = viewportWidth - containerMargins;
-
-    // Update all existing chat bubbles
-    for (int i = 0; i < messagesLayout_->count(); ++i) {
-      QLayoutItem* item = messagesLayout_->itemAt(i);
-      if (item && item->widget()) {
-        ChatBubble* bubble = qobject_cast<ChatBubble*>(item->widget());
-        if (bubble) {
-          bubble->setMaximumWidth(maxBubbleWidth);
-          bubble->updateGeometry();
-        }
-      }
-    }
-  }
-}
-
 void AgentPanel::connectSignals() {
   connect(sendButton_, &QPushButton::clicked, this, &AgentPanel::onSendClicked);
   connect(stopButton_, &QPushButton::clicked, this, &AgentPanel::onStopClicked);
@@ -455,10 +427,15 @@ void AgentPanel::SendMessage(const QString& message) {
   if (!node_runtime_ || !node_runtime_->IsReady()) {
     qWarning() << "[AgentPanel] Node runtime not available";
     showThinkingIndicator(false);
-    addMessage("assistant",
-               "❌ **Error:** Agent is not available. Please ensure the Node.js runtime is "
-               "running.",
-               true);
+    // Node boots alongside the browser; a message sent in the first seconds can beat it
+    if (node_runtime_ && node_runtime_->GetState() == runtime::RuntimeState::STARTING) {
+      addMessage("assistant", "⏳ Agent is still starting. Please try again in a moment.", true);
+    } else {
+      addMessage("assistant",
+                 "❌ **Error:** Agent is not available. Please ensure the Node.js runtime is "
+                 "running.",
+                 true);
+    }
     waiting_for_response_ = false;
     updateActionButtons();
     return;
@@ -467,37 +444,22 @@ void AgentPanel::SendMessage(const QString& message) {
   qDebug() << "[AgentPanel] Sending message to Agent:" << message;
 
   // Add an empty assistant message bubble that we'll update as chunks arrive
-  // IMPORTANT: Don't animate for streaming responses (would interfere with real-time updates)
+  // IMPORTANT: Don't animate for streaming responses (would interfere with real-time updates);
+  // bubbles shown without animation are fully opaque
   addMessage("assistant", "", false);
 
-  // Manually set opacity to 1.0 immediately (skip animation for streaming)
-  if (!messageBubbles_.empty()) {
-    ChatBubble* lastBubble = messageBubbles_.back();
-    if (lastBubble->GetRole() == ChatBubble::Role::Assistant) {
-      // Get the opacity effect and set it to fully visible immediately
-      auto* opacityEffect = qobject_cast<QGraphicsOpacityEffect*>(lastBubble->graphicsEffect());
-      if (opacityEffect) {
-        opacityEffect->setOpacity(1.0);
-      }
-    }
-  }
-
   // Build JSON request body
-  QString escaped_message = message;
-  escaped_message.replace("\\", "\\\\");  // Escape backslashes first
-  escaped_message.replace("\"", "\\\"");  // Escape quotes
-  escaped_message.replace("\n", "\\n");   // Escape newlines
+  nlohmann::json request = {{"message", message.toStdString()}};
 
   // Include sessionId if we have one for conversation continuity
-  QString json_body;
   if (!current_session_id_.isEmpty()) {
-    json_body = QString("{\"message\":\"%1\",\"sessionId\":\"%2\"}")
-                    .arg(escaped_message, current_session_id_);
+    request["sessionId"] = current_session_id_.toStdString();
     qDebug() << "[AgentPanel] Sending message with session ID:" << current_session_id_;
   } else {
-    json_body = QString("{\"message\":\"%1\"}").arg(escaped_message);
     qDebug() << "[AgentPanel] Sending message (new session)";
   }
+  QString json_body = QString::fromStdString(
+      request.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace));
 
   // Create streaming socket connection
   if (streaming_socket_) {
@@ -505,9 +467,10 @@ void AgentPanel::SendMessage(const QString& message) {
   }
 
   streaming_socket_ = new QLocalSocket(this);
-  response_buffer_.clear();
+  response_parser_.Reset();
+  sse_decoder_.Reset();
   accumulated_text_.clear();
-  headers_received_ = false;
+  pending_text_.clear();
 
   // Connect socket signals
   connect(streaming_socket_, &QLocalSocket::connected, this, &AgentPanel::onSocketConnected);
@@ -528,36 +491,8 @@ void AgentPanel::addMessage(const QString& role, const QString& message, bool an
   ChatBubble::Role bubbleRole =
       (role == "user") ? ChatBubble::Role::User : ChatBubble::Role::Assistant;
 
-  auto* bubble = new ChatBubble(bubbleRole, message, palette_, messagesContainer_);
-
-  // Set maximum width constraint to prevent overflow
-  // This ensures text wraps properly within the panel
-  if (scrollArea_ && scrollArea_->viewport()) {
-    int viewportWidth = scrollArea_->viewport()->width();
-    int containerMargins = 24;  // 12px left + 12px right from messagesLayout_
-    int maxBubbleWidth = viewportWidth - containerMargins;
-    bubble->setMaximumWidth(maxBubbleWidth);
-  }
-
-  // Insert before the stretch spacer
-  int insertIndex = messagesLayout_->count() - 1;
-
-  // Add spacing before the bubble based on previous message
-  if (!messageBubbles_.empty()) {
-    ChatBubble* lastBubble = messageBubbles_.back();
-    bool sameRole = (lastBubble->GetRole() == bubbleRole);
-
-    int spacing = sameRole ? 4 : 14;
-    messagesLayout_->insertSpacing(insertIndex, spacing);
-    insertIndex++;
-  }
-
-  messagesLayout_->insertWidget(insertIndex, bubble);
-  messageBubbles_.push_back(bubble);
-
-  if (animate) {
-    bubble->AnimateIn();
-  }
+  // The list creates a bubble once the message scrolls into view
+  scrollArea_->AddMessage(bubbleRole, message, animate);
 
   scrollToBottom(animate);
 
@@ -570,15 +505,17 @@ void AgentPanel::replaceLastAssistantMessage(const QString& message) {
            << message.length();
   qDebug() << "[AgentPanel::replaceLastAssistantMessage] Message preview:" << message.left(100);
 
+  // The full text supersedes chunks still waiting for the next frame
+  pending_text_.clear();
+
   // Find the last assistant message
-  for (auto it = messageBubbles_.rbegin(); it != messageBubbles_.rend(); ++it) {
-    if ((*it)->GetRole() == ChatBubble::Role::Assistant) {
-      qDebug()
-          << "[AgentPanel::replaceLastAssistantMessage] Found assistant bubble, updating message";
-      (*it)->SetMessage(message);
-      scrollToBottom(true);
-      return;
-    }
+  uint64_t id = scrollArea_->LastMessage(ChatBubble::Role::Assistant);
+  if (id != ChatListView::kNoMessage) {
+    qDebug()
+        << "[AgentPanel::replaceLastAssistantMessage] Found assistant bubble, updating message";
+    scrollArea_->SetMessage(id, message);
+    scrollToBottom(true);
+    return;
   }
 
   // If no assistant message found, add a new one
@@ -586,6 +523,36 @@ void AgentPanel::replaceLastAssistantMessage(const QString& message) {
   addMessage("assistant", message, true);
 }
 
+void AgentPanel::scheduleStreamRender() {
+  if (render_scheduled_) {
+    return;
+  }
+  render_scheduled_ = true;
+
+  // Chunks often arrive many per frame; render them once per display refresh
+  QScreen* currentScreen = screen();
+  qreal refreshRate = currentScreen ? currentScreen->refreshRate() : 60.0;
+  int intervalMs = qBound(4, qRound(1000.0 / qMax<qreal>(refreshRate, 1.0)), 50);
+  QTimer::singleShot(intervalMs, this, &AgentPanel::flushStreamRender);
+}
+
+void AgentPanel::flushStreamRender() {
+  render_scheduled_ = false;
+  if (pending_text_.isEmpty()) {
+    return;
+  }
+
+  uint64_t id = scrollArea_->LastMessage(ChatBubble::Role::Assistant);
+  if (id == ChatListView::kNoMessage) {
+    replaceLastAssistantMessage(accumulated_text_);
+    return;
+  }
+
+  scrollArea_->AppendToMessage(id, pending_text_);
+  pending_text_.clear();
+  scrollToBottom(true);
+}
+
 void AgentPanel::showThinkingIndicator(bool show) {
   if (!thinkingIndicator_) {
     return;
@@ -752,21 +719,13 @@ bool AgentPanel::isNearBottom() const {
 }
 
 void AgentPanel::trimHistory() {
-  while (messageBubbles_.size() > MAX_MESSAGES) {
-    auto* bubble = messageBubbles_.front();
-    messageBubbles_.pop_front();
-    messagesLayout_->removeWidget(bubble);
-    bubble->deleteLater();
+  if (scrollArea_->MessageCount() > MAX_MESSAGES) {
+    scrollArea_->RemoveOldest(scrollArea_->MessageCount() - MAX_MESSAGES);
   }
 }
 
 void AgentPanel::ClearHistory() {
-  // Remove all message bubbles
-  for (auto* bubble : messageBubbles_) {
-    messagesLayout_->removeWidget(bubble);
-    bubble->deleteLater();
-  }
-  messageBubbles_.clear();
+  scrollArea_->Clear();
 
   qDebug() << "[AgentPanel] Chat history cleared";
 
@@ -853,31 +812,30 @@ void AgentPanel::onSocketConnected() {
 void AgentPanel::onSocketReadyRead() {
   // Read all available data
   QByteArray data = streaming_socket_->readAll();
-  response_buffer_.append(QString::fromUtf8(data));
+  qDebug() << "[AgentPanel] Received" << data.size() << "bytes";
 
-  qDebug() << "[AgentPanel] Received" << data.size()
-           << "bytes (total buffer size:" << response_buffer_.size() << ")";
+  // The parser hands each de-chunked body fragment, as a view into |data|, to the SSE decoder
+  bool had_headers = response_parser_.HeadersComplete();
+  response_parser_.Feed(std::string_view(data.constData(), static_cast<size_t>(data.size())));
 
-  // Parse HTTP headers if not yet received
-  if (!headers_received_) {
-    int header_end = response_buffer_.indexOf("\r\n\r\n");
-    if (header_end != -1) {
-      headers_received_ = true;
-      qDebug() << "[AgentPanel] HTTP headers received, body starts at position" << (header_end + 4);
-
-      // Extract body and start parsing SSE
-      QString body = response_buffer_.mid(header_end + 4);
-      response_buffer_ = body;  // Keep only body in buffer
+  if (response_parser_.HasError()) {
+    qWarning() << "[AgentPanel] Malformed HTTP response:"
+               << QString::fromStdString(response_parser_.GetError());
+    streaming_socket_->abort();
+    return;
+  }
+  if (sse_decoder_.HasError()) {
+    qWarning() << "[AgentPanel] Event stream exceeded" << runtime::SseDecoder::kMaxEventBytes
+               << "bytes per event";
+    streaming_socket_->abort();
+    return;
+  }
 
-      // Hide thinking indicator now that we're receiving data
-      showThinkingIndicator(false);
+  if (!had_headers && response_parser_.HeadersComplete()) {
+    qDebug() << "[AgentPanel] HTTP headers received, status" << response_parser_.StatusCode();
 
-      // Parse any SSE chunks in the initial body
-      parseSSEChunks(body);
-    }
-  } else {
-    // Headers already received, parse new SSE chunks
-    parseSSEChunks(data);
+    // Hide thinking indicator now that we're receiving data
+    showThinkingIndicator(false);
   }
 }
 
@@ -931,103 +889,40 @@ void AgentPanel::onSocketDisconnected() {
   }
 }
 
-void AgentPanel::parseSSEChunks(const QString& data) {
-  // Parse SSE format: lines starting with "data: " contain JSON chunks
-  QStringList lines = data.split('\n');
-
-  for (const QString& line : lines) {
-    if (!line.startsWith("data: ")) {
-      continue;
-    }
-
-    // Extract JSON from "data: {...}"
-    QString json_str = line.mid(6).trimmed();  // Skip "data: "
-
-    if (json_str.isEmpty()) {
-      continue;
-    }
-
-    qDebug() << "[AgentPanel] Parsing SSE chunk:" << json_str;
-
-    // Parse JSON manually (simple parser for our known format)
-    // Format: {"type":"chunk","content":"text"} or {"type":"done"} or
-    // {"type":"error","error":"msg"}
-
-    // Extract type
-    int type_start = json_str.indexOf("\"type\":\"") + 8;
-    int type_end = json_str.indexOf("\"", type_start);
-    if (type_start < 8 || type_end == -1) {
-      continue;
-    }
-    QString chunk_type = json_str.mid(type_start, type_end - type_start);
-
-    if (chunk_type == "chunk") {
-      // Extract content
-      int content_start = json_str.indexOf("\"content\":\"");
-      if (content_start == -1) {
-        continue;
-      }
-      content_start += 11;  // Skip "content":""
-
-      // Find end of content (handling escaped quotes)
-      int content_end = content_start;
-      while (content_end < json_str.length()) {
-        if (json_str[content_end] == '\\' && content_end + 1 < json_str.length()) {
-          content_end += 2;  // Skip escaped character
-          continue;
-        }
-        if (json_str[content_end] == '\"') {
-          break;
-        }
-        content_end++;
-      }
-
-      QString chunk_content = json_str.mid(content_start, content_end - content_start);
+void AgentPanel::handleStreamEvent(const runtime::SseEvent& event) {
+  // Payloads: {"type":"chunk","content":"text","sessionId":"..."}, {"type":"done"} or
+  // {"type":"error","error":"msg"}
+  nlohmann::json payload = nlohmann::json::parse(event.data, nullptr, false);
+  if (payload.is_discarded() || !payload.is_object()) {
+    qWarning() << "[AgentPanel] Ignoring malformed stream event:"
+               << QString::fromStdString(event.data).left(200);
+    return;
+  }
 
-      // Unescape JSON sequences (order matters: backslashes must be first!)
-      chunk_content.replace("\\\\", "\x01");  // Temp placeholder for escaped backslash
-      chunk_content.replace("\\n", "\n");
-      chunk_content.replace("\\r", "\r");
-      chunk_content.replace("\\t", "\t");
-      chunk_content.replace("\\\"", "\"");
-      chunk_content.replace("\x01", "\\");  // Restore escaped backslashes
+  // The payload carries its type; an "event:" field stands in when it does not
+  QString chunk_type = JsonString(payload, "type", QString::fromStdString(event.type));
 
-      qDebug() << "[AgentPanel] Chunk content:" << chunk_content;
+  // Chunks and the final "done" carry the session ID (for session continuity)
+  QString session_id = JsonString(payload, "sessionId");
+  if (!session_id.isEmpty() && current_session_id_ != session_id) {
+    current_session_id_ = session_id;
+    qDebug() << "[AgentPanel] Received session ID:" << session_id;
+  }
 
-      // Accumulate text
+  if (chunk_type == "chunk") {
+    QString chunk_content = JsonString(payload, "content");
+    if (!chunk_content.isEmpty()) {
+      // Accumulate text; the bubble catches up on the next frame
       accumulated_text_ += chunk_content;
-
-      // Update UI immediately
-      replaceLastAssistantMessage(accumulated_text_);
-
-      // Extract session ID from chunk if present (for session continuity)
-      int session_id_start = json_str.indexOf("\"sessionId\":\"");
-      if (session_id_start != -1) {
-        session_id_start += 13;  // Skip "sessionId":"
-        int session_id_end = json_str.indexOf("\"", session_id_start);
-        QString session_id = json_str.mid(session_id_start, session_id_end - session_id_start);
-
-        // Only update if we don't have a session ID yet or if it changed
-        if (current_session_id_ != session_id) {
-          current_session_id_ = session_id;
-          qDebug() << "[AgentPanel] Received session ID from chunk:" << session_id;
-        }
-      }
-
-    } else if (chunk_type == "error") {
-      // Extract error message
-      int error_start = json_str.indexOf("\"error\":\"");
-      if (error_start != -1) {
-        error_start += 9;
-        int error_end = json_str.indexOf("\"", error_start);
-        QString error_msg = json_str.mid(error_start, error_end - error_start);
-
-        qWarning() << "[AgentPanel] Received error:" << error_msg;
-        replaceLastAssistantMessage(QString("❌ **Error:** %1").arg(error_msg));
-      }
-    } else if (chunk_type == "done") {
-      qDebug() << "[AgentPanel] Stream complete";
+      pending_text_ += chunk_content;
+      scheduleStreamRender();
     }
+  } else if (chunk_type == "error") {
+    QString error_msg = JsonString(payload, "error", tr("Unknown error"));
+    qWarning() << "[AgentPanel] Received error:" << error_msg;
+    replaceLastAssistantMessage(QString("❌ **Error:** %1").arg(error_msg));
+  } else if (chunk_type == "done") {
+    qDebug() << "[AgentPanel] Stream complete";
   }
 }
 
@@ -4,14 +4,15 @@
 #include "qt_agent_panel_theme.h"
 #include "qt_chat_bubble.h"
 #include "qt_chat_input_widget.h"
+#include "qt_chat_list_view.h"
 #include "qt_thinking_indicator.h"
+#include "runtime/http_response_parser.h"
+#include "runtime/sse_decoder.h"
 
-#include <deque>
 #include <QFrame>
 #include <QLocalSocket>
 #include <QPointer>
 #include <QPushButton>
-#include <QScrollArea>
 #include <QVBoxLayout>
 #include <QWidget>
 
@@ -107,7 +108,6 @@ class AgentPanel : public QWidget {
 
  protected:
   void changeEvent(QEvent* event) override;
-  void resizeEvent(QResizeEvent* event) override;
 
  private:
   // ============================================================================
@@ -146,6 +146,13 @@ class AgentPanel : public QWidget {
    */
   void replaceLastAssistantMessage(const QString& message);
 
+  /**
+   * Streamed chunks are appended to the last assistant bubble at most once
+   * per display frame; flushStreamRender() appends what arrived since.
+   */
+  void scheduleStreamRender();
+  void flushStreamRender();
+
   /**
    * Show or hide the thinking indicator.
    */
@@ -172,10 +179,9 @@ class AgentPanel : public QWidget {
   void trimHistory();
 
   /**
-   * Parse and process SSE (Server-Sent Events) chunks from streaming response.
-   * @param data Raw SSE data to parse
+   * Process one event of the streaming response (a JSON payload).
    */
-  void parseSSEChunks(const QString& data);
+  void handleStreamEvent(const runtime::SseEvent& event);
 
   // ============================================================================
   // Member Variables
@@ -186,13 +192,11 @@ class AgentPanel : public QWidget {
 
   // State
   bool panel_visible_;
-  static constexpr size_t MAX_MESSAGES = 100;  // Maximum message history
+  static constexpr size_t MAX_MESSAGES = 50000;  // Maximum message history
 
   // UI Components
   QVBoxLayout* mainLayout_;
-  QScrollArea* scrollArea_;
-  QWidget* messagesContainer_;
-  QVBoxLayout* messagesLayout_;
+  ChatListView* scrollArea_;  // Virtualized: bubbles only for messages in view
 
   // Footer / Input area
   QFrame* inputFrame_;
@@ -206,15 +210,16 @@ class AgentPanel : public QWidget {
   ThinkingIndicator* thinkingIndicator_;
 
   // Message tracking
-  std::deque<ChatBubble*> messageBubbles_;
   bool waiting_for_response_;
   bool userCanceledResponse_;
 
   // Streaming HTTP connection
   QLocalSocket* streaming_socket_;
-  QString response_buffer_;   // Buffers incomplete HTTP data
+  runtime::HttpResponseParser response_parser_;  // De-chunks the body into sse_decoder_
+  runtime::SseDecoder sse_decoder_;              // Dispatches to handleStreamEvent
   QString accumulated_text_;  // Accumulated SSE content for current response
-  bool headers_received_;     // Track if HTTP headers have been parsed
+  QString pending_text_;      // Chunks not yet appended to the bubble
+  bool render_scheduled_;     // flushStreamRender() is queued
 
   // Session management
   QString current_session_id_;  // Current agent session ID for continuity
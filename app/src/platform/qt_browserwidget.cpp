@@ -226,6 +226,8 @@ void BrowserWidget::mouseMoveEvent(QMouseEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefMouseEvent mouseEvent;
   mouseEvent.x = event->pos().x();
   mouseEvent.y = event->pos().y();
@@ -245,6 +247,8 @@ void BrowserWidget::mousePressEvent(QMouseEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefMouseEvent mouseEvent;
   mouseEvent.x = event->pos().x();
   mouseEvent.y = event->pos().y();
@@ -281,6 +285,8 @@ void BrowserWidget::mouseReleaseEvent(QMouseEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefMouseEvent mouseEvent;
   mouseEvent.x = event->pos().x();
   mouseEvent.y = event->pos().y();
@@ -312,6 +318,8 @@ void BrowserWidget::wheelEvent(QWheelEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefMouseEvent mouseEvent;
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
   mouseEvent.x = event->position().x();
@@ -338,6 +346,8 @@ void BrowserWidget::keyPressEvent(QKeyEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefKeyEvent keyEvent;
   keyEvent.type = KEYEVENT_RAWKEYDOWN;
   keyEvent.modifiers = getCefModifiers(event->modifiers(), Qt::NoButton);
@@ -376,6 +386,8 @@ void BrowserWidget::keyReleaseEvent(QKeyEvent* event) {
     return;
   }
 
+  window_->OnBrowserInput(tab_index_);
+
   CefKeyEvent keyEvent;
   keyEvent.type = KEYEVENT_KEYUP;
   keyEvent.modifiers = getCefModifiers(event->modifiers(), Qt::NoButton);
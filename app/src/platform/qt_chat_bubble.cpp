@@ -14,6 +14,7 @@
 #include <QTextBlockFormat>
 #include <QTextCursor>
 #include <QTextDocument>
+#include <QTextDocumentFragment>
 #include <QTextEdit>
 #include <QTextOption>
 #include <QTimer>
@@ -42,7 +43,14 @@ ChatBubble::ChatBubble(Role role,
                        const QString& message,
                        const AgentPanelPalette& palette,
                        QWidget* parent)
-    : QFrame(parent), role_(role), message_(message), geometryUpdateScheduled_(false) {
+    : QFrame(parent),
+      role_(role),
+      message_(message),
+      geometryUpdateScheduled_(false),
+      lastTextWidth_(-1),
+      streaming_(false),
+      renderedStableEnd_(0),
+      tailPosition_(0) {
   setupUI();
   ApplyTheme(palette);
 
@@ -80,6 +88,7 @@ void ChatBubble::setupUI() {
   contentWidget_->setWordWrapMode(QTextOption::WrapAtWordBoundaryOrAnywhere);
   contentWidget_->setLineWrapMode(QTextEdit::WidgetWidth);
   contentWidget_->setAutoFillBackground(false);
+  contentWidget_->setUndoRedoEnabled(false);  // Streaming edits need no undo history
 
   QFont contentFont = contentWidget_->font();
   contentFont.setPixelSize(14);
@@ -147,6 +156,9 @@ void ChatBubble::applyPalette(const AgentPanelPalette& palette) {
 }
 
 void ChatBubble::renderMarkdown(const QString& markdown) {
+  streaming_ = false;
+  lastTextWidth_ = -1;
+
   // Normalize markdown spacing before rendering
   // Fix: Ensure headers have proper line breaks before them
   QString normalized = normalizeMarkdownSpacing(markdown);
@@ -180,10 +192,79 @@ void ChatBubble::SetMessage(const QString& message) {
   renderMarkdown(message_);
 }
 
+void ChatBubble::AppendMessage(const QString& text) {
+  QTextDocument* document = contentWidget_->document();
+  if (!streaming_) {
+    // Start over from an empty document; what is already in message_ is
+    // rendered below like streamed text
+    contentWidget_->clear();
+    document->setDocumentMargin(8);
+    splitter_.Reset();
+    renderedStableEnd_ = 0;
+    tailPosition_ = 0;
+    streaming_ = true;
+  }
+  message_ += text;
+  splitter_.Scan(message_);
+
+  // Drop the old rendering of the unfinished block
+  QTextCursor cursor(document);
+  cursor.setPosition(tailPosition_);
+  cursor.movePosition(QTextCursor::End, QTextCursor::KeepAnchor);
+  cursor.removeSelectedText();
+
+  // Blocks completed since the last update are rendered for good
+  const int stableEnd = splitter_.StableEnd();
+  if (stableEnd > renderedStableEnd_) {
+    insertMarkdown(cursor, message_.mid(renderedStableEnd_, stableEnd - renderedStableEnd_));
+    renderedStableEnd_ = stableEnd;
+    tailPosition_ = cursor.position();
+  }
+
+  insertMarkdown(cursor, message_.mid(stableEnd));
+  updateContentGeometry();
+}
+
+void ChatBubble::insertMarkdown(QTextCursor& cursor, const QString& markdown) {
+  if (markdown.trimmed().isEmpty()) {
+    return;
+  }
+
+  const int start = cursor.position();
+  if (start > 0) {
+    // New top-level block, without the list or code format of the previous one
+    cursor.insertBlock(QTextBlockFormat(), QTextCharFormat());
+  }
+  cursor.insertFragment(QTextDocumentFragment::fromMarkdown(normalizeMarkdownSpacing(markdown)));
+
+  // Same block spacing as renderMarkdown(), for the inserted blocks only
+  QTextCursor range(cursor.document());
+  range.setPosition(start);
+  range.setPosition(cursor.position(), QTextCursor::KeepAnchor);
+  QTextBlockFormat blockFormat;
+  blockFormat.setBottomMargin(12);
+  blockFormat.setLineHeight(140, QTextBlockFormat::ProportionalHeight);
+  range.mergeBlockFormat(blockFormat);
+}
+
 QString ChatBubble::GetMessage() const {
   return message_;
 }
 
+void ChatBubble::Rebind(Role role, const QString& message, const AgentPanelPalette& palette) {
+  fadeInAnimation_->stop();
+  opacityEffect_->setOpacity(1.0);
+
+  message_ = message;
+  if (role == role_) {
+    renderMarkdown(message_);  // Palette is kept current by ApplyTheme()
+    return;
+  }
+  role_ = role;
+  roleLabel_->setText(role_ == Role::User ? QObject::tr("You") : QObject::tr("Agent"));
+  ApplyTheme(palette);
+}
+
 void ChatBubble::AnimateIn() {
   fadeInAnimation_->start();
 }
@@ -210,8 +291,8 @@ void ChatBubble::updateContentGeometry() {
   }
 
   // Get the actual width available for content
-  // The parent (AgentPanel) sets our maximum width via resizeEvent,
-  // so we use our current width minus internal margins
+  // The chat list sets our geometry, so we use our current width minus
+  // internal margins
   const QMargins margins = layout_ ? layout_->contentsMargins() : QMargins();
   int availableWidth = width() - margins.left() - margins.right();
 
@@ -227,10 +308,26 @@ void ChatBubble::updateContentGeometry() {
     return;
   }
 
+  layoutContent(availableWidth);
+}
+
+int ChatBubble::HeightForWidth(int width) {
+  const QMargins margins = layout_->contentsMargins();
+  return layoutContent(qMax(width - margins.left() - margins.right(), 1));
+}
+
+int ChatBubble::layoutContent(int availableWidth) {
+  QTextDocument* document = contentWidget_->document();
+
   // Set the document's text width to match the available width
-  // This ensures text wraps properly within the visible area
-  document->setTextWidth(availableWidth);
-  document->adjustSize();
+  // This ensures text wraps properly within the visible area. Either call
+  // lays out the whole document again, so skip them when the width is the
+  // same and only content changed (QTextDocument re-lays out edited blocks)
+  if (availableWidth != lastTextWidth_) {
+    lastTextWidth_ = availableWidth;
+    document->setTextWidth(availableWidth);
+    document->adjustSize();
+  }
 
   const qreal docHeight = document->documentLayout()->documentSize().height();
   const int frameWidth = contentWidget_->frameWidth();
@@ -251,6 +348,7 @@ void ChatBubble::updateContentGeometry() {
 
   contentWidget_->updateGeometry();
   updateGeometry();
+  return bubbleHeight;
 }
 
 QSize ChatBubble::sizeHint() const {
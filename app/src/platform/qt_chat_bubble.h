@@ -2,6 +2,7 @@
 #define ATHENA_PLATFORM_QT_CHAT_BUBBLE_H_
 
 #include "qt_agent_panel_theme.h"
+#include "qt_markdown_stream.h"
 
 #include <QFrame>
 #include <QString>
@@ -12,6 +13,7 @@ class QPropertyAnimation;
 class QTextEdit;
 class QVBoxLayout;
 class QResizeEvent;
+class QTextCursor;
 
 namespace athena {
 namespace platform {
@@ -43,6 +45,15 @@ class ChatBubble : public QFrame {
    */
   void SetMessage(const QString& message);
 
+  /**
+   * Append streamed text to the message.
+   * Only the block still being written is re-rendered; completed blocks stay
+   * in the document as they are, so a long answer costs O(new text) per
+   * update instead of a full re-render. SetMessage() with the final text
+   * renders it once more as a whole.
+   */
+  void AppendMessage(const QString& text);
+
   /**
    * Get the message content.
    */
@@ -53,6 +64,18 @@ class ChatBubble : public QFrame {
    */
   Role GetRole() const { return role_; }
 
+  /**
+   * Reuse the bubble for another message (ChatListView recycles bubbles as
+   * they scroll out of view). Any fade-in is stopped; the bubble is opaque.
+   */
+  void Rebind(Role role, const QString& message, const AgentPanelPalette& palette);
+
+  /**
+   * Lay out the content for a bubble |width| pixels wide, shown or not.
+   * @return Bubble height at that width
+   */
+  int HeightForWidth(int width);
+
   /**
    * Animate the bubble appearing.
    */
@@ -72,13 +95,23 @@ class ChatBubble : public QFrame {
  private:
   void setupUI();
   void renderMarkdown(const QString& markdown);
+  void insertMarkdown(QTextCursor& cursor, const QString& markdown);
   void applyPalette(const AgentPanelPalette& palette);
   void updateContentGeometry();
+  int layoutContent(int availableWidth);
 
   Role role_;
   QString message_;
   BubblePalette bubblePalette_;
   bool geometryUpdateScheduled_;
+  int lastTextWidth_;
+
+  // Streaming: message_ up to renderedStableEnd_ is in the document up to
+  // tailPosition_; the rest of the document is the re-rendered tail
+  bool streaming_;
+  MarkdownStreamSplitter splitter_;
+  int renderedStableEnd_;
+  int tailPosition_;
 
   // UI Components
   QVBoxLayout* layout_;
@@ -0,0 +1,302 @@
+#include "qt_chat_list_view.h"
+
+#include <QResizeEvent>
+#include <QScrollBar>
+#include <QTimer>
+
+namespace athena {
+namespace platform {
+
+namespace {
+
+// Content margins around the messages
+constexpr int kSideMargin = 12;
+constexpr int kTopMargin = 12;
+constexpr int kBottomMargin = 16;
+
+// Gap above a message: tighter between consecutive messages of one speaker
+constexpr int kSameRoleGap = 24;
+constexpr int kRoleChangeGap = 34;
+
+// Messages this far outside the viewport keep their bubbles, so small
+// scrolls do not rebind anything
+constexpr int kOverscanPx = 400;
+
+constexpr int kScrollStep = 20;
+constexpr size_t kMaxSpareBubbles = 6;
+
+// Measuring can bring more messages into view (when they turn out shorter
+// than estimated); a few passes settle it
+constexpr int kMaxMeasurePasses = 4;
+
+constexpr int kEstimatedMessageHeight = 80;
+
+}  // namespace
+
+ChatListView::ChatListView(QWidget* parent)
+    : QAbstractScrollArea(parent),
+      firstId_(1),
+      layout_(kEstimatedMessageHeight),
+      palette_(),
+      measuredWidth_(-1),
+      layoutScheduled_(false),
+      inLayout_(false) {
+  setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+  verticalScrollBar()->setSingleStep(kScrollStep);
+}
+
+ChatListView::~ChatListView() = default;
+
+uint64_t ChatListView::AddMessage(ChatBubble::Role role, const QString& text, bool animate) {
+  int gap = 0;
+  if (!messages_.empty()) {
+    gap = messages_.back().role == role ? kSameRoleGap : kRoleChangeGap;
+  }
+
+  messages_.push_back({role, text, animate});
+  layout_.Append(gap);
+  scheduleLayout();
+  return firstId_ + messages_.size() - 1;
+}
+
+void ChatListView::SetMessage(uint64_t id, const QString& text) {
+  if (!contains(id)) {
+    return;
+  }
+
+  messages_[id - firstId_].text = text;
+  if (ChatBubble* bubble = boundBubble(id)) {
+    bubble->SetMessage(text);
+  }
+  layout_.Invalidate(id - firstId_);
+  scheduleLayout();
+}
+
+void ChatListView::AppendToMessage(uint64_t id, const QString& text) {
+  if (!contains(id)) {
+    return;
+  }
+
+  // Out of view, the text is only stored; binding renders it in full
+  messages_[id - firstId_].text += text;
+  if (ChatBubble* bubble = boundBubble(id)) {
+    bubble->AppendMessage(text);
+  }
+  layout_.Invalidate(id - firstId_);
+  scheduleLayout();
+}
+
+uint64_t ChatListView::LastMessage(ChatBubble::Role role) const {
+  for (size_t i = messages_.size(); i > 0; --i) {
+    if (messages_[i - 1].role == role) {
+      return firstId_ + i - 1;
+    }
+  }
+  return kNoMessage;
+}
+
+void ChatListView::RemoveOldest(size_t count) {
+  count = qMin(count, messages_.size());
+  if (count == 0) {
+    return;
+  }
+
+  for (uint64_t id = firstId_; id < firstId_ + count; ++id) {
+    auto it = bound_.find(id);
+    if (it != bound_.end()) {
+      releaseBubble(it->second);
+      bound_.erase(it);
+    }
+  }
+
+  // Keep what is on screen in place while the content above it goes away
+  const int removedHeight = layout_.TotalHeight();
+  messages_.erase(messages_.begin(), messages_.begin() + static_cast<std::ptrdiff_t>(count));
+  layout_.RemoveFront(count);
+  firstId_ += count;
+
+  QScrollBar* bar = verticalScrollBar();
+  const int value = bar->value() - (removedHeight - layout_.TotalHeight());
+  updateScrollRange();
+  bar->setValue(value);
+  scheduleLayout();
+}
+
+void ChatListView::Clear() {
+  releaseAll();
+  firstId_ += messages_.size();
+  messages_.clear();
+  layout_.Clear();
+  updateScrollRange();
+  viewport()->update();
+}
+
+void ChatListView::ApplyTheme(const AgentPanelPalette& palette) {
+  palette_ = palette;
+  for (auto& entry : bound_) {
+    entry.second->ApplyTheme(palette_);
+  }
+  for (ChatBubble* bubble : spare_) {
+    bubble->ApplyTheme(palette_);
+  }
+}
+
+void ChatListView::resizeEvent(QResizeEvent* event) {
+  QAbstractScrollArea::resizeEvent(event);
+  updateScrollRange();
+  layoutVisible();
+}
+
+void ChatListView::scrollContentsBy(int /*dx*/, int /*dy*/) {
+  // Bubbles are positioned from the scroll value, not moved by the delta
+  layoutVisible();
+}
+
+void ChatListView::scheduleLayout() {
+  if (layoutScheduled_) {
+    return;
+  }
+  layoutScheduled_ = true;
+  QTimer::singleShot(0, this, &ChatListView::layoutVisible);
+}
+
+void ChatListView::layoutVisible() {
+  if (inLayout_) {
+    return;  // Scroll value adjusted by the pass below
+  }
+  layoutScheduled_ = false;
+
+  const int width = bubbleWidth();
+  if (width <= 0) {
+    return;
+  }
+  inLayout_ = true;
+
+  if (width != measuredWidth_) {
+    measuredWidth_ = width;
+    layout_.InvalidateHeights();
+  }
+
+  QScrollBar* bar = verticalScrollBar();
+  const int viewportHeight = viewport()->height();
+  const bool atBottom = bar->value() >= bar->maximum();
+
+  // Offsets below are in layout coordinates: content minus the top margin
+  size_t anchor = 0;
+  int anchorOffset = 0;
+  if (!layout_.IsEmpty()) {
+    anchor = layout_.IndexAt(bar->value() - kTopMargin);
+    anchorOffset = layout_.Top(anchor) - (bar->value() - kTopMargin);
+  }
+
+  ChatListLayout::Range range;
+  for (int pass = 0; pass < kMaxMeasurePasses; ++pass) {
+    const int top = bar->value() - kTopMargin;
+    range = layout_.VisibleRange(top - kOverscanPx, top + viewportHeight + kOverscanPx);
+
+    bool changed = false;
+    for (size_t i = range.first; i < range.last; ++i) {
+      if (!layout_.IsMeasured(i)) {
+        ChatBubble* bubble = bindBubble(firstId_ + i);
+        changed = layout_.SetHeight(i, bubble->HeightForWidth(width)) != 0 || changed;
+      }
+    }
+    if (!changed) {
+      break;
+    }
+
+    updateScrollRange();
+    if (atBottom) {
+      bar->setValue(bar->maximum());
+    } else {
+      bar->setValue(layout_.Top(anchor) - anchorOffset + kTopMargin);
+    }
+  }
+
+  for (auto it = bound_.begin(); it != bound_.end();) {
+    const uint64_t index = it->first - firstId_;
+    if (index < range.first || index >= range.last) {
+      releaseBubble(it->second);
+      it = bound_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  const int top = bar->value() - kTopMargin;
+  for (size_t i = range.first; i < range.last; ++i) {
+    ChatBubble* bubble = bindBubble(firstId_ + i);
+    if (!layout_.IsMeasured(i)) {
+      layout_.SetHeight(i, bubble->HeightForWidth(width));
+    }
+    bubble->setGeometry(kSideMargin, layout_.Top(i) - top, width, layout_.Height(i));
+    bubble->show();
+  }
+
+  updateScrollRange();
+  inLayout_ = false;
+}
+
+void ChatListView::updateScrollRange() {
+  const int viewportHeight = viewport()->height();
+  const int contentHeight = kTopMargin + layout_.TotalHeight() + kBottomMargin;
+
+  QScrollBar* bar = verticalScrollBar();
+  bar->setPageStep(viewportHeight);
+  bar->setRange(0, qMax(0, contentHeight - viewportHeight));
+}
+
+ChatBubble* ChatListView::bindBubble(uint64_t id) {
+  if (ChatBubble* bubble = boundBubble(id)) {
+    return bubble;
+  }
+
+  Message& message = messages_[id - firstId_];
+  ChatBubble* bubble = nullptr;
+  if (!spare_.empty()) {
+    bubble = spare_.back();
+    spare_.pop_back();
+  } else {
+    bubble = new ChatBubble(message.role, QString(), palette_, viewport());
+  }
+
+  bubble->Rebind(message.role, message.text, palette_);
+  if (message.animate) {
+    message.animate = false;
+    bubble->AnimateIn();
+  }
+  bound_.emplace(id, bubble);
+  return bubble;
+}
+
+void ChatListView::releaseBubble(ChatBubble* bubble) {
+  bubble->hide();
+  if (spare_.size() < kMaxSpareBubbles) {
+    spare_.push_back(bubble);
+  } else {
+    bubble->deleteLater();
+  }
+}
+
+void ChatListView::releaseAll() {
+  for (auto& entry : bound_) {
+    releaseBubble(entry.second);
+  }
+  bound_.clear();
+}
+
+ChatBubble* ChatListView::boundBubble(uint64_t id) const {
+  auto it = bound_.find(id);
+  return it != bound_.end() ? it->second : nullptr;
+}
+
+bool ChatListView::contains(uint64_t id) const {
+  return id >= firstId_ && id - firstId_ < messages_.size();
+}
+
+int ChatListView::bubbleWidth() const {
+  return viewport()->width() - 2 * kSideMargin;
+}
+
+}  // namespace platform
+}  // namespace athena
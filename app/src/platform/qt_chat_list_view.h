@@ -0,0 +1,121 @@
+#ifndef ATHENA_PLATFORM_QT_CHAT_LIST_VIEW_H_
+#define ATHENA_PLATFORM_QT_CHAT_LIST_VIEW_H_
+
+#include "chat_list_layout.h"
+#include "qt_agent_panel_theme.h"
+#include "qt_chat_bubble.h"
+
+#include <cstdint>
+#include <deque>
+#include <QAbstractScrollArea>
+#include <QString>
+#include <unordered_map>
+#include <vector>
+
+class QResizeEvent;
+
+namespace athena {
+namespace platform {
+
+/**
+ * Virtualized list of chat messages for the agent panel.
+ *
+ * Messages are stored as text; ChatBubble widgets exist only for the
+ * messages in view plus a small margin above and below, and are recycled
+ * as they scroll out. Heights come from a ChatListLayout: a message is
+ * measured when it first comes into view (or when the width changes) and
+ * its cached height is used for the scroll range from then on, so memory and
+ * relayout cost stay flat however long the conversation gets.
+ *
+ * While heights above the viewport settle, the first visible message keeps
+ * its place on screen; a view scrolled to the bottom stays at the bottom.
+ */
+class ChatListView : public QAbstractScrollArea {
+  Q_OBJECT
+
+ public:
+  static constexpr uint64_t kNoMessage = 0;
+
+  explicit ChatListView(QWidget* parent = nullptr);
+  ~ChatListView() override;
+
+  /**
+   * Append a message.
+   * @param animate Fade the bubble in when it is first shown
+   * @return ID of the message, valid until it is trimmed or cleared
+   */
+  uint64_t AddMessage(ChatBubble::Role role, const QString& text, bool animate);
+
+  /**
+   * Replace a message's text.
+   */
+  void SetMessage(uint64_t id, const QString& text);
+
+  /**
+   * Append streamed text to a message; only the bubble's unfinished block
+   * is re-rendered (see ChatBubble::AppendMessage()).
+   */
+  void AppendToMessage(uint64_t id, const QString& text);
+
+  /**
+   * Most recent message with |role|, or kNoMessage.
+   */
+  uint64_t LastMessage(ChatBubble::Role role) const;
+
+  size_t MessageCount() const { return messages_.size(); }
+
+  /**
+   * Drop the |count| oldest messages.
+   */
+  void RemoveOldest(size_t count);
+
+  void Clear();
+
+  /**
+   * Apply theme colors to the bubbles (in view and recycled).
+   */
+  void ApplyTheme(const AgentPanelPalette& palette);
+
+ protected:
+  void resizeEvent(QResizeEvent* event) override;
+  void scrollContentsBy(int dx, int dy) override;
+
+ private:
+  struct Message {
+    ChatBubble::Role role;
+    QString text;
+    bool animate;  // Fade in on first show
+  };
+
+  /**
+   * Measure what comes into view, bind bubbles to it, release the rest and
+   * position the bound bubbles.
+   */
+  void layoutVisible();
+  void scheduleLayout();
+  void updateScrollRange();
+
+  ChatBubble* bindBubble(uint64_t id);
+  void releaseBubble(ChatBubble* bubble);
+  void releaseAll();
+  ChatBubble* boundBubble(uint64_t id) const;
+  bool contains(uint64_t id) const;
+  int bubbleWidth() const;
+
+  std::deque<Message> messages_;
+  uint64_t firstId_;  // ID of messages_.front(); IDs are never reused
+  ChatListLayout layout_;
+
+  std::unordered_map<uint64_t, ChatBubble*> bound_;  // Message ID -> bubble in view
+  std::vector<ChatBubble*> spare_;                   // Hidden, ready for reuse
+
+  AgentPanelPalette palette_;
+  int measuredWidth_;  // Bubble width the cached heights were measured at
+  bool layoutScheduled_;
+  bool inLayout_;
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_QT_CHAT_LIST_VIEW_H_
@@ -14,6 +14,7 @@
 #include "include/cef_browser.h"
 #include "platform/qt_agent_panel.h"
 #include "platform/qt_browserwidget.h"
+#include "platform/tab_operations.h"
 #include "rendering/gl_renderer.h"
 #include "utils/logging.h"
 
@@ -41,6 +42,9 @@ using namespace utils;
 
 static Logger logger("QtMainWindow");
 
+// How often background tabs are checked against the discard policy
+constexpr int kDiscardCheckIntervalMs = 5000;
+
 // ============================================================================
 // QtMainWindow Implementation
 // ============================================================================
@@ -71,6 +75,8 @@ QtMainWindow::QtMainWindow(const WindowConfig& config,
       splitter_(nullptr),
       agent_panel_last_width_(360),
       active_tab_index_(0),
+      discard_policy_(DiscardPolicyFromConfig(config)),
+      discard_timer_(nullptr),
       current_url_(QString::fromStdString(config.url)) {
   logger.Info("Creating Qt main window");
 
@@ -80,6 +86,20 @@ QtMainWindow::QtMainWindow(const WindowConfig& config,
   setupUI();
   connectSignals();
 
+  if (engine_ && config_.spare_browsers > 0) {
+    browser::SpareBrowserPool::Config pool_config;
+    pool_config.size = config_.spare_browsers;
+    pool_config.width = config_.size.width;
+    pool_config.height = config_.size.height;
+    spare_pool_ = std::make_unique<browser::SpareBrowserPool>(engine_, pool_config);
+  }
+
+  if (discard_policy_.IsEnabled()) {
+    discard_timer_ = new QTimer(this);
+    connect(discard_timer_, &QTimer::timeout, this, &QtMainWindow::enforceDiscardPolicy);
+    discard_timer_->start(kDiscardCheckIntervalMs);
+  }
+
   logger.Info("Qt main window created successfully");
 }
 
@@ -230,6 +250,10 @@ void QtMainWindow::closeEvent(QCloseEvent* event) {
   logger.Info("Window close event");
   closed_ = true;
 
+  if (spare_pool_) {
+    spare_pool_->Clear();
+  }
+
   // Collect all CEF clients while holding the lock
   std::vector<CefClient*> clients_to_close;
   {
@@ -1,15 +1,25 @@
 #ifndef ATHENA_PLATFORM_QT_MAINWINDOW_H_
 #define ATHENA_PLATFORM_QT_MAINWINDOW_H_
 
+#include "browser/frame_rate_governor.h"
+#include "browser/resource_filter.h"
+#include "browser/spare_browser_pool.h"
+#include "browser/tab_discard_policy.h"
+#include "platform/tab_host.h"
 #include "platform/window_system.h"
+#include "rendering/annotation_compositor.h"
+#include "rendering/damage_tracker.h"
 
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <QLineEdit>
 #include <QMainWindow>
 #include <QPushButton>
 #include <QSplitter>
 #include <QTabWidget>
+#include <QTimer>
 #include <QToolBar>
 #include <vector>
 
@@ -20,6 +30,7 @@ class GLRenderer;
 
 namespace browser {
 class CefClient;
+class CefEngine;
 class BrowserEngine;
 using BrowserId = uint64_t;
 }  // namespace browser
@@ -52,6 +63,14 @@ struct QtTab {
   bool can_go_back;                                 // Can navigate back
   bool can_go_forward;                              // Can navigate forward
   std::unique_ptr<rendering::GLRenderer> renderer;  // Dedicated renderer surface
+
+  // Set while the browser is discarded (browser_id is 0, cef_client and
+  // renderer null); the widget draws its background until restored.
+  std::optional<browser::TabSnapshot> discarded;
+  std::optional<core::Point> pending_scroll;  // Restored once a recreated page loads
+
+  // Applied to every browser this tab gets (created, adopted or restored)
+  std::shared_ptr<const browser::ResourceFilter> resource_filter;
 };
 
 /**
@@ -87,7 +106,7 @@ struct QtTab {
  *   - Lock scope minimization: extract data while holding lock, then release before
  *     calling external code (CEF, Qt widgets) to avoid deadlocks
  */
-class QtMainWindow : public QMainWindow, public Window {
+class QtMainWindow : public QMainWindow, public Window, public TabHost {
   Q_OBJECT
 
  public:
@@ -189,7 +208,7 @@ class QtMainWindow : public QMainWindow, public Window {
   /**
    * Load a URL in the browser.
    */
-  void LoadURL(const QString& url);
+  void LoadURL(const QString& url) override;
 
   /**
    * Update the address bar with the current URL.
@@ -206,17 +225,17 @@ class QtMainWindow : public QMainWindow, public Window {
   /**
    * Navigate back in browser history.
    */
-  void GoBack();
+  void GoBack() override;
 
   /**
    * Navigate forward in browser history.
    */
-  void GoForward();
+  void GoForward() override;
 
   /**
    * Reload the current page.
    */
-  void Reload(bool ignore_cache = false);
+  void Reload(bool ignore_cache = false) override;
 
   /**
    * Stop loading the current page.
@@ -232,14 +251,14 @@ class QtMainWindow : public QMainWindow, public Window {
   /**
    * Get the current URL.
    */
-  QString GetCurrentUrl() const;
+  QString GetCurrentUrl() const override;
 
   /**
    * Get the HTML source of the current page.
    * This method blocks until the HTML is retrieved from CEF (with 5s timeout).
    * @return HTML source as string, or empty string on error
    */
-  QString GetPageHTML() const;
+  QString GetPageHTML() const override;
 
   /**
    * Execute JavaScript code in the current page and return the result.
@@ -247,15 +266,81 @@ class QtMainWindow : public QMainWindow, public Window {
    * @param code JavaScript code to execute
    * @return JSON-encoded result, or error message on failure
    */
-  QString ExecuteJavaScript(const QString& code) const;
+  QString ExecuteJavaScript(const QString& code) const override;
 
   /**
    * Take a screenshot of the current page.
    * Captures the current GL framebuffer and encodes as base64 PNG.
    * Screenshots are automatically scaled to 50% resolution for optimal AI analysis.
+   * @param region Optional sub-rectangle to capture (physical pixels); nullptr for the viewport
    * @return Base64-encoded PNG image data
    */
-  QString TakeScreenshot() const;
+  QString TakeScreenshot(const core::Rect* region = nullptr) const override;
+
+  /**
+   * Consume the damage accumulated by the active tab since its last capture.
+   * Used for change-aware screenshots: a matching token with no damage means the
+   * page has not repainted, so the capture can be skipped entirely.
+   * @param since_token Change token returned by a previous capture, if any
+   * @return Capture description (changed flag, damage bounds, new token)
+   */
+  rendering::DamageTracker::Capture ConsumeDamage(std::optional<uint64_t> since_token) override;
+
+  /**
+   * Take a screenshot of the whole page by scrolling the active tab viewport by
+   * viewport and stitching the tiles (scaled to 50% like TakeScreenshot()).
+   * Scroll position is restored afterwards. All sizes are CSS pixels.
+   * @param page_height Height to capture (callers apply their own cap)
+   * @param viewport_height Current viewport (window.innerHeight) height
+   * @param scroll_x Current horizontal scroll offset (kept while tiling)
+   * @param scroll_y Current vertical scroll offset (restored afterwards)
+   * @return Base64-encoded PNG image data, or empty string on failure
+   */
+  QString TakeFullPageScreenshot(int page_height,
+                                 int viewport_height,
+                                 int scroll_x,
+                                 int scroll_y) override;
+
+  /**
+   * Take a screenshot of the current page with numbered element boxes drawn
+   * onto the captured pixels. The page itself is never modified.
+   * @param annotations Boxes to draw, in CSS pixels relative to the viewport
+   * @param viewport_width Viewport width in CSS pixels (maps CSS to physical pixels)
+   * @return Base64-encoded PNG image data (scaled to 50%), or empty string on failure
+   */
+  QString TakeAnnotatedScreenshot(const std::vector<rendering::Annotation>& annotations,
+                                  int viewport_width) const override;
+
+  // ============================================================================
+  // Frame Rate Governor
+  // ============================================================================
+
+  /**
+   * Report user input on a tab's browser widget (raises its frame rate).
+   * Repeats on the same tab are reported at most every 250 ms.
+   * @param tab_index Index of the tab that received the input
+   */
+  void OnBrowserInput(size_t tab_index);
+
+  /**
+   * Report a control-server request for the active tab (keeps it rendering at
+   * the active frame rate even if the window is in the background).
+   */
+  void NotifyAgentActivity() override;
+
+  /**
+   * Current frame-rate decisions, or nullopt if the engine has no governor.
+   */
+  std::optional<browser::FrameRateGovernor::Metrics> GetFrameRateMetrics() const override;
+
+  /**
+   * Browser IDs of all tabs, indexed by tab index (0 for tabs still being created).
+   */
+  std::vector<browser::BrowserId> GetTabBrowserIds() const override;
+  std::optional<browser::TabSnapshot> GetDiscardedTab(size_t index) const override;
+  bool SetResourceFilter(size_t index,
+                         std::shared_ptr<const browser::ResourceFilter> filter) override;
+  std::shared_ptr<const browser::ResourceFilter> GetResourceFilter(size_t index) const override;
 
   // ============================================================================
   // Tab Management (Phase 2: Full Multi-Tab Support)
@@ -266,14 +351,14 @@ class QtMainWindow : public QMainWindow, public Window {
    * @param url URL to load in the new tab
    * @return Index of created tab, or -1 on error
    */
-  int CreateTab(const QString& url = "https://www.google.com");
+  int CreateTab(const QString& url = "https://www.google.com") override;
 
   /**
    * Close a tab by index.
    * If this is the last tab, closes the window.
    * @param index Tab index to close
    */
-  void CloseTab(size_t index);
+  void CloseTab(size_t index) override;
 
   /**
    * Close a tab by browser ID (safer than index-based closing).
@@ -286,17 +371,17 @@ class QtMainWindow : public QMainWindow, public Window {
    * Hides the current tab's browser and shows the new tab's browser.
    * @param index Tab index to switch to
    */
-  void SwitchToTab(size_t index);
+  void SwitchToTab(size_t index) override;
 
   /**
    * Get the number of tabs.
    */
-  size_t GetTabCount() const;
+  size_t GetTabCount() const override;
 
   /**
    * Get the active tab index.
    */
-  size_t GetActiveTabIndex() const;
+  size_t GetActiveTabIndex() const override;
 
   /**
    * Get the active tab.
@@ -310,7 +395,18 @@ class QtMainWindow : public QMainWindow, public Window {
    * @param timeout_ms Maximum time to wait
    * @return true if load completed, false on timeout or invalid tab
    */
-  bool WaitForLoadToComplete(size_t tab_index, int timeout_ms = 15000) const;
+  bool WaitForLoadToComplete(size_t tab_index, int timeout_ms = 15000) const override;
+
+  /**
+   * Wait until a tab reaches a load state (load, DOMContentLoaded or network idle).
+   * @param tab_index Tab index to monitor
+   * @param condition State to wait for
+   * @param timeout_ms Maximum time to wait
+   * @return true if the state was reached, false on timeout or invalid tab
+   */
+  bool WaitForLoadState(size_t tab_index,
+                        const browser::LoadTracker::WaitCondition& condition,
+                        int timeout_ms = 15000) const override;
 
   /**
    * Handle tab switch event from QTabWidget.
@@ -372,6 +468,33 @@ class QtMainWindow : public QMainWindow, public Window {
    */
   void createBrowserForTab(size_t tab_index);
 
+  /**
+   * Top the spare browser pool back up after a short delay, so spare creation
+   * does not compete with the navigation that just consumed one.
+   */
+  void scheduleSpareRefill();
+
+  /**
+   * Discard the tabs the discard policy selects (periodic timer).
+   */
+  void enforceDiscardPolicy();
+
+  /**
+   * Snapshot a background tab and close its browser, keeping a placeholder.
+   * @return true if the tab was discarded
+   */
+  bool discardTab(browser::BrowserId browser_id);
+
+  /**
+   * Recreate a discarded tab's browser from its snapshot. No-op for live tabs.
+   */
+  void restoreTab(size_t tab_index);
+
+  /**
+   * The engine as a CefEngine (for frame-rate metrics), or nullptr.
+   */
+  browser::CefEngine* cefEngine() const;
+
   // ============================================================================
   // Member Variables
   // ============================================================================
@@ -405,6 +528,18 @@ class QtMainWindow : public QMainWindow, public Window {
   size_t active_tab_index_;        // Index of currently active tab
   mutable std::mutex tabs_mutex_;  // Protects tabs_ and active_tab_index_
 
+  // Pre-warmed browsers adopted by new tabs (null when disabled)
+  std::unique_ptr<browser::SpareBrowserPool> spare_pool_;
+
+  // Last input reported to the engine and its tab, so OnBrowserInput() can
+  // drop repeats before looking up the tab (main thread only)
+  browser::TabDiscardPolicy::Clock::time_point last_input_report_;
+  size_t last_input_tab_ = SIZE_MAX;
+
+  // Tab hibernation (main thread only)
+  browser::TabDiscardPolicy discard_policy_;
+  QTimer* discard_timer_;  // Owned by Qt parent-child system (null when disabled)
+
   QString current_url_;
 };
 
@@ -6,16 +6,14 @@
  */
 
 #include "browser/cef_client.h"
-#include "include/cef_app.h"
 #include "platform/qt_mainwindow.h"
+#include "platform/tab_operations.h"
 #include "rendering/gl_renderer.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
-#include <atomic>
+#include <algorithm>
 #include <chrono>
-#include <QCoreApplication>
-#include <QEventLoop>
-#include <thread>
 
 namespace athena {
 namespace platform {
@@ -65,83 +63,26 @@ GLRenderer* QtMainWindow::GetGLRenderer() const {
 // ============================================================================
 
 QString QtMainWindow::GetPageHTML() const {
-  QtTab* tab = nullptr;
+  ATHENA_TRACE_SCOPE("browser", "GetPageHtml");
+
   CefRefPtr<CefBrowser> browser;
 
   {
     std::lock_guard<std::mutex> lock(tabs_mutex_);
-    tab = const_cast<QtMainWindow*>(this)->GetActiveTab();
+    QtTab* tab = const_cast<QtMainWindow*>(this)->GetActiveTab();
     if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser()) {
       return QString();
     }
     browser = tab->cef_client->GetBrowser();
   }
 
-  auto main_frame = browser->GetMainFrame();
-  if (!main_frame) {
-    logger.Error("No main frame available");
-    return QString();
-  }
-
-  // Helper class for synchronous HTML retrieval
-  class HtmlVisitor : public CefStringVisitor {
-   public:
-    HtmlVisitor() : complete_(false) {}
-
-    void Visit(const CefString& string) override {
-      std::lock_guard<std::mutex> lock(mutex_);
-      html_ = string.ToString();
-      complete_.store(true, std::memory_order_release);
-    }
-
-    bool WaitForHtml(std::string& html, int timeout_ms = 5000) {
-      auto start = std::chrono::steady_clock::now();
-
-      // Poll and pump CEF message loop instead of blocking
-      while (!complete_.load(std::memory_order_acquire)) {
-        // Check timeout
-        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                           std::chrono::steady_clock::now() - start)
-                           .count();
-        if (elapsed >= timeout_ms) {
-          return false;
-        }
-
-        // Pump CEF message loop to allow callbacks to run
-        CefDoMessageLoopWork();
-
-        // Small sleep to avoid busy-waiting
-        std::this_thread::sleep_for(std::chrono::milliseconds(10));
-      }
-
-      std::lock_guard<std::mutex> lock(mutex_);
-      html = html_;
-      return true;
-    }
-
-   private:
-    std::mutex mutex_;
-    std::string html_;
-    std::atomic<bool> complete_;
-    IMPLEMENT_REFCOUNTING(HtmlVisitor);
-  };
-
-  // Request HTML source
-  CefRefPtr<HtmlVisitor> visitor = new HtmlVisitor();
-  main_frame->GetSource(visitor);
-
-  // Wait for result
-  std::string html;
-  if (visitor->WaitForHtml(html, 5000)) {
-    logger.Info("Retrieved HTML (" + std::to_string(html.length()) + " bytes)");
-    return QString::fromStdString(html);
-  } else {
-    logger.Error("Timeout waiting for HTML");
-    return QString();
-  }
+  return FetchPageHtml(browser);
 }
 
 QString QtMainWindow::ExecuteJavaScript(const QString& code) const {
+  TraceSpan span("browser", "ExecuteJavaScript");
+  span.AddArg("length", static_cast<int64_t>(code.size()));
+
   browser::CefClient* cef_client = nullptr;
 
   {
@@ -156,48 +97,12 @@ QString QtMainWindow::ExecuteJavaScript(const QString& code) const {
     cef_client = tab->cef_client;
   }
 
-  auto request_id_opt = cef_client->RequestJavaScriptEvaluation(code.toStdString());
-  if (!request_id_opt.has_value()) {
-    logger.Error("ExecuteJavaScript: Failed to dispatch request");
-    return QString(
-        R"({"success":false,"error":{"message":"Failed to dispatch JavaScript to renderer"}})");
-  }
-
-  const std::string request_id = request_id_opt.value();
-  const int timeout_ms = 5000;
-  auto start = std::chrono::steady_clock::now();
-
-  while (true) {
-    auto result = cef_client->TryConsumeJavaScriptResult(request_id);
-    if (result.has_value()) {
-      logger.Info("JavaScript executed ({} bytes)", result->size());
-      return QString::fromStdString(result.value());
-    }
-
-    if (closed_) {
-      logger.Error("ExecuteJavaScript aborted: window closed while waiting");
-      cef_client->CancelJavaScriptEvaluation(request_id);
-      return QString(
-          R"({"success":false,"error":{"message":"Window closed while waiting for result"}})");
-    }
-
-    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
-                       std::chrono::steady_clock::now() - start)
-                       .count();
-    if (elapsed >= timeout_ms) {
-      logger.Error("ExecuteJavaScript timed out after {}ms", timeout_ms);
-      cef_client->CancelJavaScriptEvaluation(request_id);
-      return QString(
-          R"({"success":false,"error":{"message":"Timeout waiting for JavaScript result"},"type":"timeout"})");
-    }
-
-    CefDoMessageLoopWork();
-    QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
-    std::this_thread::sleep_for(std::chrono::milliseconds(5));
-  }
+  return EvaluateJavaScript(cef_client, code, [this] { return closed_; });
 }
 
-QString QtMainWindow::TakeScreenshot() const {
+QString QtMainWindow::TakeScreenshot(const core::Rect* region) const {
+  ATHENA_TRACE_SCOPE("browser", "TakeScreenshot");
+
   std::lock_guard<std::mutex> lock(tabs_mutex_);
 
   QtTab* tab = const_cast<QtMainWindow*>(this)->GetActiveTab();
@@ -207,7 +112,7 @@ QString QtMainWindow::TakeScreenshot() const {
   }
 
   // Call the GLRenderer's TakeScreenshot method (automatically scaled to 0.5 for AI analysis)
-  std::string base64_png = tab->renderer->TakeScreenshot();
+  std::string base64_png = tab->renderer->TakeScreenshot(region);
   if (base64_png.empty()) {
     logger.Error("TakeScreenshot: Failed to capture screenshot");
     return QString();
@@ -217,11 +122,105 @@ QString QtMainWindow::TakeScreenshot() const {
   return QString::fromStdString(base64_png);
 }
 
+QString QtMainWindow::TakeAnnotatedScreenshot(const std::vector<Annotation>& annotations,
+                                              int viewport_width) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+
+  QtTab* tab = const_cast<QtMainWindow*>(this)->GetActiveTab();
+  if (!tab || !tab->renderer) {
+    logger.Error("TakeAnnotatedScreenshot: No active tab or renderer");
+    return QString();
+  }
+
+  std::vector<uint8_t> pixels;
+  core::Size size;
+  if (!tab->renderer->CaptureViewPixels(&pixels, &size)) {
+    logger.Error("TakeAnnotatedScreenshot: Failed to capture frame");
+    return QString();
+  }
+
+  return EncodeAnnotatedScreenshot(&pixels, size, annotations, viewport_width);
+}
+
+rendering::DamageTracker::Capture QtMainWindow::ConsumeDamage(std::optional<uint64_t> since_token) {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+
+  QtTab* tab = GetActiveTab();
+  if (!tab || !tab->cef_client) {
+    // No tracker to consult; report a full-frame change without a token
+    return rendering::DamageTracker::Capture{};
+  }
+
+  return tab->cef_client->GetDamageTracker().Consume(since_token);
+}
+
+QString QtMainWindow::TakeFullPageScreenshot(int page_height,
+                                             int viewport_height,
+                                             int scroll_x,
+                                             int scroll_y) {
+  ATHENA_TRACE_SCOPE("browser", "TakeFullPageScreenshot");
+
+  // Held for the whole capture: scrolling pumps the event loop, which may
+  // close the tab and release the engine's reference
+  CefRefPtr<CefClient> cef_client;
+  BrowserId browser_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    QtTab* tab = GetActiveTab();
+    if (!tab || !tab->cef_client || !tab->cef_client->GetBrowser() || !tab->renderer) {
+      logger.Error("TakeFullPageScreenshot: No active tab or renderer");
+      return QString();
+    }
+    cef_client = tab->cef_client;
+    browser_id = tab->browser_id;
+  }
+
+  // The tab may also be closed or discarded between tiles, so its renderer is
+  // looked up again each time. Caller holds tabs_mutex_.
+  auto find_renderer = [this, browser_id]() -> GLRenderer* {
+    auto it = std::find_if(tabs_.begin(), tabs_.end(), [browser_id](const QtTab& t) {
+      return t.browser_id == browser_id;
+    });
+    return it != tabs_.end() ? it->renderer.get() : nullptr;
+  };
+  auto capture = [this, &find_renderer](std::vector<uint8_t>* rgba, core::Size* size) {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    GLRenderer* renderer = find_renderer();
+    return renderer && renderer->CaptureViewPixels(rgba, size);
+  };
+  auto cancelled = [this, &find_renderer] {
+    if (closed_) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    return find_renderer() == nullptr;
+  };
+  return CaptureFullPage(cef_client.get(),
+                         capture,
+                         page_height,
+                         viewport_height,
+                         scroll_x,
+                         scroll_y,
+                         cancelled);
+}
+
 // ============================================================================
 // Wait Utilities
 // ============================================================================
 
 bool QtMainWindow::WaitForLoadToComplete(size_t tab_index, int timeout_ms) const {
+  return WaitForLoadState(tab_index, LoadTracker::WaitCondition(), timeout_ms);
+}
+
+bool QtMainWindow::WaitForLoadState(size_t tab_index,
+                                    const LoadTracker::WaitCondition& condition,
+                                    int timeout_ms) const {
+  TraceSpan span("browser", "LoadWait");
+  span.AddArg("tabIndex", static_cast<int64_t>(tab_index));
+  if (span.IsRecording()) {
+    span.AddArg("until", LoadTracker::DescribeWaitCondition(condition));
+  }
+
   auto start = std::chrono::steady_clock::now();
 
   while (true) {
@@ -233,8 +232,16 @@ bool QtMainWindow::WaitForLoadToComplete(size_t tab_index, int timeout_ms) const
         return false;
       }
 
+      // The load event keeps using the loading flag, which is set as soon as
+      // a navigation is requested; finer conditions consult the load tracker
       const QtTab& tab = tabs_[tab_index];
-      ready = (tab.cef_client != nullptr) && !tab.is_loading;
+      if (tab.cef_client == nullptr) {
+        ready = false;
+      } else if (condition.until == LoadTracker::WaitUntil::kLoad) {
+        ready = !tab.is_loading;
+      } else {
+        ready = tab.cef_client->GetLoadTracker().IsSatisfied(condition, LoadTracker::Clock::now());
+      }
     }
 
     if (ready) {
@@ -250,14 +257,14 @@ bool QtMainWindow::WaitForLoadToComplete(size_t tab_index, int timeout_ms) const
                        std::chrono::steady_clock::now() - start)
                        .count();
     if (elapsed >= timeout_ms) {
-      logger.Warn("WaitForLoadToComplete timed out after " + std::to_string(timeout_ms) +
-                  "ms for tab " + std::to_string(tab_index));
+      logger.Warn("Waiting for {} timed out after {}ms for tab {}",
+                  LoadTracker::DescribeWaitCondition(condition),
+                  timeout_ms,
+                  tab_index);
       return false;
     }
 
-    CefDoMessageLoopWork();
-    QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    PumpEventsOnce(10);
   }
 }
 
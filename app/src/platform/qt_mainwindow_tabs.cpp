@@ -13,16 +13,20 @@
 #include "platform/qt_agent_panel.h"
 #include "platform/qt_browserwidget.h"
 #include "platform/qt_mainwindow.h"
+#include "platform/tab_operations.h"
 #include "rendering/gl_renderer.h"
 #include "utils/logging.h"
+#include "utils/process_memory.h"
 
 #include <algorithm>
+#include <chrono>
 #include <QApplication>
 #include <QMessageBox>
 #include <QMetaObject>
 #include <QPointer>
 #include <QSignalBlocker>
 #include <QTabBar>
+#include <QTimer>
 
 namespace athena {
 namespace platform {
@@ -33,6 +37,13 @@ using namespace utils;
 
 static Logger logger("QtMainWindow::Tabs");
 
+// Delay before replacing an adopted spare browser
+constexpr int kSpareRefillDelayMs = 1000;
+
+// Minimum time between input reports for the same tab; well below the
+// governor's input hold, so a tab being used stays at the active rate
+constexpr auto kInputReportInterval = std::chrono::milliseconds(250);
+
 // ============================================================================
 // Tab Creation
 // ============================================================================
@@ -122,27 +133,38 @@ void QtMainWindow::createBrowserForTab(size_t tab_index) {
     return;
   }
 
-  logger.Info("Creating CEF browser for tab " + std::to_string(tab_index));
-
-  // Create CEF browser instance
   float scale_factor = devicePixelRatioF();
+  int view_width = browserWidget->width() > 0 ? browserWidget->width() : width();
+  int view_height = browserWidget->height() > 0 ? browserWidget->height() : height();
+
+  // Adopt a pre-warmed browser when one is ready; it only needs a renderer and a URL
+  std::optional<BrowserId> spare = spare_pool_ ? spare_pool_->Acquire() : std::nullopt;
+  if (spare) {
+    tab.browser_id = *spare;
+    logger.Info("Adopted spare browser {} for tab {}", tab.browser_id, tab_index);
+  } else {
+    logger.Info("Creating CEF browser for tab " + std::to_string(tab_index));
+
+    // Create CEF browser instance
+    browser::BrowserConfig browser_config;
+    browser_config.url = tab.url.toStdString();
+    browser_config.width = view_width;
+    browser_config.height = view_height;
+    browser_config.device_scale_factor = scale_factor;
+    browser_config.gl_renderer = tab.renderer.get();
+    browser_config.native_window_handle = browserWidget;
+
+    auto result = engine_->CreateBrowser(browser_config);
+    if (!result.IsOk()) {
+      logger.Error("Failed to create browser: " + result.GetError().Message());
+      return;
+    }
 
-  browser::BrowserConfig browser_config;
-  browser_config.url = tab.url.toStdString();
-  browser_config.width = browserWidget->width() > 0 ? browserWidget->width() : width();
-  browser_config.height = browserWidget->height() > 0 ? browserWidget->height() : height();
-  browser_config.device_scale_factor = scale_factor;
-  browser_config.gl_renderer = tab.renderer.get();
-  browser_config.native_window_handle = browserWidget;
-
-  auto result = engine_->CreateBrowser(browser_config);
-  if (!result.IsOk()) {
-    logger.Error("Failed to create browser: " + result.GetError().Message());
-    return;
+    tab.browser_id = result.Value();
+    logger.Info("Browser created with ID: " + std::to_string(tab.browser_id));
   }
-
-  tab.browser_id = result.Value();
-  logger.Info("Browser created with ID: " + std::to_string(tab.browser_id));
+  discard_policy_.AddTab(tab.browser_id, TabDiscardPolicy::Clock::now());
+  scheduleSpareRefill();
 
   // Get the CEF client
   auto* cef_engine = dynamic_cast<browser::CefEngine*>(engine_);
@@ -150,6 +172,7 @@ void QtMainWindow::createBrowserForTab(size_t tab_index) {
     auto client = cef_engine->GetCefClient(tab.browser_id);
     if (client) {
       tab.cef_client = client.get();
+      tab.cef_client->SetResourceFilter(tab.resource_filter);
 
       // Wire up CEF callbacks for this tab with thread-safe marshaling
       browser::BrowserId bid = tab.browser_id;
@@ -200,6 +223,13 @@ void QtMainWindow::createBrowserForTab(size_t tab_index) {
                     if (tab_idx == window->active_tab_index_) {
                       window->UpdateNavigationButtons(is_loading, can_go_back, can_go_forward);
                     }
+
+                    // A restored tab returns to where it was scrolled when discarded
+                    if (!is_loading && it->pending_scroll && it->cef_client) {
+                      core::Point scroll = *it->pending_scroll;
+                      it->pending_scroll.reset();
+                      ScrollMainFrameTo(it->cef_client->GetBrowser(), scroll.x, scroll.y);
+                    }
                   }
                 });
           });
@@ -333,7 +363,198 @@ void QtMainWindow::createBrowserForTab(size_t tab_index) {
       });
 
       logger.Info("Callbacks wired for browser_id: " + std::to_string(bid));
+
+      if (spare) {
+        // Callbacks are in place, so the navigation's events reach this tab
+        tab.cef_client->SetDeviceScaleFactor(scale_factor);
+        tab.cef_client->SetSize(view_width, view_height);
+        tab.cef_client->SetGLRenderer(tab.renderer.get());
+        engine_->SetBrowserVisible(bid, true);
+        tab.cef_client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
+        engine_->LoadURL(bid, tab.url.toStdString());
+      }
+    }
+  }
+}
+
+void QtMainWindow::scheduleSpareRefill() {
+  if (!spare_pool_) {
+    return;
+  }
+
+  QTimer::singleShot(kSpareRefillDelayMs, this, [this]() {
+    if (closed_ || !spare_pool_) {
+      return;
+    }
+    spare_pool_->SetViewport(width(), height(), devicePixelRatioF());
+    spare_pool_->Refill();
+  });
+}
+
+// ============================================================================
+// Tab Hibernation
+// ============================================================================
+
+void QtMainWindow::enforceDiscardPolicy() {
+  if (closed_) {
+    return;
+  }
+
+  BrowserId active = 0;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (active_tab_index_ < tabs_.size()) {
+      active = tabs_[active_tab_index_].browser_id;
+    }
+  }
+
+  std::optional<uint64_t> resident_bytes;
+  if (discard_policy_.GetPolicy().memory_budget_bytes > 0) {
+    resident_bytes = GetProcessTreeResidentBytes();
+  }
+
+  for (BrowserId victim :
+       discard_policy_.SelectVictims(active, TabDiscardPolicy::Clock::now(), resident_bytes)) {
+    if (closed_) {
+      return;
+    }
+    discardTab(victim);
+  }
+}
+
+bool QtMainWindow::discardTab(BrowserId browser_id) {
+  // Held for the whole snapshot: reading the scroll position pumps the event
+  // loop, which may close the tab and release the engine's reference
+  CefRefPtr<CefClient> client;
+  GLRenderer* renderer = nullptr;
+  QString url;
+  QString title;
+
+  auto find_background_tab = [this, browser_id]() -> QtTab* {
+    auto it = std::find_if(tabs_.begin(), tabs_.end(), [browser_id](const QtTab& t) {
+      return t.browser_id == browser_id;
+    });
+    if (it == tabs_.end() || static_cast<size_t>(it - tabs_.begin()) == active_tab_index_) {
+      return nullptr;
+    }
+    return &*it;
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    QtTab* tab = find_background_tab();
+    if (!tab) {
+      return false;
+    }
+    client = tab->cef_client;
+    renderer = tab->renderer.get();
+    url = tab->url;
+    title = tab->title;
+  }
+
+  // The frame is captured before anything pumps the event loop
+  auto capture = [renderer](std::vector<uint8_t>* rgba, core::Size* size) {
+    return renderer && renderer->CaptureViewPixels(rgba, size);
+  };
+  auto cancelled = [this, &find_background_tab] {
+    if (closed_) {
+      return true;
+    }
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    return find_background_tab() == nullptr;
+  };
+  TabSnapshot snapshot = CaptureTabSnapshot(client.get(), capture, url, title, cancelled);
+
+  // Reading the scroll position pumps the event loop: the tab may have been
+  // closed or activated meanwhile
+  std::unique_ptr<GLRenderer> old_renderer;
+  BrowserWidget* widget = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    QtTab* tab = find_background_tab();
+    if (!tab || closed_) {
+      return false;
+    }
+    client = tab->cef_client;
+    tab->discarded = std::move(snapshot);
+    tab->browser_id = 0;
+    tab->cef_client = nullptr;
+    tab->is_loading = false;
+    tab->pending_scroll.reset();
+
+    // Textures and the last frame are most of a tab's memory in this
+    // process; restoreTab() creates a fresh renderer
+    old_renderer = std::move(tab->renderer);
+    widget = tab->browser_widget;
+  }
+
+  if (client) {
+    client->SetGLRenderer(nullptr);
+  }
+  if (widget) {
+    widget->InitializeBrowser(nullptr);  // Draws the background until restored
+    widget->update();
+  }
+  if (old_renderer) {
+    old_renderer->Cleanup();
+  }
+
+  discard_policy_.RemoveTab(browser_id);
+  engine_->CloseBrowser(browser_id, false);
+
+  logger.Info("Discarded tab (browser_id {}): {}", browser_id, url.toStdString());
+  return true;
+}
+
+void QtMainWindow::restoreTab(size_t tab_index) {
+  std::optional<TabSnapshot> snapshot;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (tab_index >= tabs_.size() || !tabs_[tab_index].discarded) {
+      return;
+    }
+
+    QtTab& tab = tabs_[tab_index];
+
+    // The renderer was released on discard (and is kept if an earlier restore
+    // failed to create a browser). The widget's GL context already exists, so
+    // a new renderer is initialized here rather than in initializeGL(). If
+    // that fails the tab stays discarded, so a later switch can retry.
+    if (!tab.renderer && tab.browser_widget) {
+      auto renderer = std::make_unique<GLRenderer>();
+      auto init = renderer->Initialize(tab.browser_widget);
+      if (!init) {
+        logger.Error("Failed to initialize renderer for restored tab {}: {}",
+                     tab_index,
+                     init.GetError().Message());
+        return;
+      }
+      renderer->SetViewSize(tab.browser_widget->width(), tab.browser_widget->height());
+      tab.renderer = std::move(renderer);
+      tab.browser_widget->InitializeBrowser(tab.renderer.get());
     }
+
+    logger.Info("Restoring discarded tab {}: {}", tab_index, tab.discarded->url);
+
+    tab.url = QString::fromStdString(tab.discarded->url);
+    const core::Point& scroll = tab.discarded->scroll;
+    if (scroll.x != 0 || scroll.y != 0) {
+      tab.pending_scroll = scroll;
+    }
+    tab.is_loading = true;
+    snapshot = std::move(tab.discarded);
+    tab.discarded.reset();
+  }
+
+  // Adopts a spare when one is ready
+  createBrowserForTab(tab_index);
+
+  // Keep the placeholder if no browser could be created, so a later switch can retry
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (tab_index < tabs_.size() && tabs_[tab_index].browser_id == 0) {
+    tabs_[tab_index].discarded = std::move(snapshot);
+    tabs_[tab_index].is_loading = false;
+    tabs_[tab_index].pending_scroll.reset();
   }
 }
 
@@ -410,6 +631,7 @@ void QtMainWindow::CloseTab(size_t index) {
 
   // Close the browser instance (outside lock)
   if (engine_ && browser_to_close != 0) {
+    discard_policy_.RemoveTab(browser_to_close);
     engine_->CloseBrowser(browser_to_close, false);
   }
 
@@ -455,8 +677,13 @@ void QtMainWindow::CloseTabByBrowserId(browser::BrowserId browser_id) {
 // ============================================================================
 
 void QtMainWindow::SwitchToTab(size_t index) {
+  // A discarded tab gets its browser back before it is shown
+  restoreTab(index);
+
   CefClient* client_to_show = nullptr;
   CefClient* client_to_hide = nullptr;
+  BrowserId browser_to_show = 0;
+  BrowserId browser_to_hide = 0;
   BrowserWidget* widget_to_update = nullptr;
   QString url;
   bool is_loading = false;
@@ -474,6 +701,7 @@ void QtMainWindow::SwitchToTab(size_t index) {
     size_t previous_index = active_tab_index_;
     if (previous_index < tabs_.size()) {
       client_to_hide = tabs_[previous_index].cef_client;
+      browser_to_hide = tabs_[previous_index].browser_id;
     }
 
     logger.Info("Switching to tab: " + std::to_string(index));
@@ -482,6 +710,7 @@ void QtMainWindow::SwitchToTab(size_t index) {
     QtTab& tab = tabs_[index];
 
     client_to_show = tab.cef_client;
+    browser_to_show = tab.browser_id;
     widget_to_update = tab.browser_widget;
     url = tab.url;
     is_loading = tab.is_loading;
@@ -500,6 +729,9 @@ void QtMainWindow::SwitchToTab(size_t index) {
     if (auto browser = client_to_hide->GetBrowser()) {
       browser->GetHost()->WasHidden(true);
     }
+    if (engine_ && browser_to_hide != 0) {
+      engine_->SetBrowserVisible(browser_to_hide, false);
+    }
   }
 
   // Show new browser
@@ -511,6 +743,10 @@ void QtMainWindow::SwitchToTab(size_t index) {
     // Force CEF to send a paint event immediately
     host->Invalidate(PET_VIEW);
   }
+  if (engine_ && browser_to_show != 0) {
+    engine_->SetBrowserVisible(browser_to_show, true);
+  }
+  discard_policy_.Touch(browser_to_show, TabDiscardPolicy::Clock::now());
 
   // Trigger repaint (use the widget pointer we saved inside the lock)
   if (widget_to_update) {
@@ -611,5 +847,107 @@ QtTab* QtMainWindow::GetActiveTab() {
   return &tabs_[active_tab_index_];
 }
 
+// ============================================================================
+// Frame Rate Governor
+// ============================================================================
+
+browser::CefEngine* QtMainWindow::cefEngine() const {
+  return dynamic_cast<browser::CefEngine*>(engine_);
+}
+
+void QtMainWindow::OnBrowserInput(size_t tab_index) {
+  if (!engine_) {
+    return;
+  }
+
+  // Mouse moves arrive hundreds of times per second; only the first in each
+  // interval looks up the tab
+  const auto now = TabDiscardPolicy::Clock::now();
+  if (last_input_tab_ == tab_index && now - last_input_report_ < kInputReportInterval) {
+    return;
+  }
+  last_input_report_ = now;
+  last_input_tab_ = tab_index;
+
+  BrowserId browser_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (tab_index < tabs_.size()) {
+      browser_id = tabs_[tab_index].browser_id;
+    }
+  }
+
+  if (browser_id != 0) {
+    engine_->NotifyUserInput(browser_id);
+    discard_policy_.Touch(browser_id, now);
+  }
+}
+
+void QtMainWindow::NotifyAgentActivity() {
+  if (!engine_) {
+    return;
+  }
+
+  BrowserId browser_id = 0;
+  {
+    std::lock_guard<std::mutex> lock(tabs_mutex_);
+    if (active_tab_index_ < tabs_.size()) {
+      browser_id = tabs_[active_tab_index_].browser_id;
+    }
+  }
+
+  if (browser_id != 0) {
+    engine_->NotifyAgentDemand(browser_id);
+    discard_policy_.Touch(browser_id, TabDiscardPolicy::Clock::now());
+  }
+}
+
+std::optional<FrameRateGovernor::Metrics> QtMainWindow::GetFrameRateMetrics() const {
+  auto* cef_engine = cefEngine();
+  if (!cef_engine) {
+    return std::nullopt;
+  }
+  return cef_engine->GetFrameRateMetrics();
+}
+
+std::vector<BrowserId> QtMainWindow::GetTabBrowserIds() const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  std::vector<BrowserId> ids;
+  ids.reserve(tabs_.size());
+  for (const auto& tab : tabs_) {
+    ids.push_back(tab.browser_id);
+  }
+  return ids;
+}
+
+std::optional<TabSnapshot> QtMainWindow::GetDiscardedTab(size_t index) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return std::nullopt;
+  }
+  return tabs_[index].discarded;
+}
+
+bool QtMainWindow::SetResourceFilter(size_t index, std::shared_ptr<const ResourceFilter> filter) {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return false;
+  }
+  QtTab& tab = tabs_[index];
+  tab.resource_filter = std::move(filter);
+  if (tab.cef_client) {
+    tab.cef_client->SetResourceFilter(tab.resource_filter);
+  }
+  return true;
+}
+
+std::shared_ptr<const ResourceFilter> QtMainWindow::GetResourceFilter(size_t index) const {
+  std::lock_guard<std::mutex> lock(tabs_mutex_);
+  if (index >= tabs_.size()) {
+    return nullptr;
+  }
+  return tabs_[index].resource_filter;
+}
+
 }  // namespace platform
 }  // namespace athena
@@ -148,6 +148,7 @@ void QtMainWindow::GoBack() {
     if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
       client = tab->cef_client;
       tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
     }
   }
 
@@ -166,6 +167,7 @@ void QtMainWindow::GoForward() {
     if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
       client = tab->cef_client;
       tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
     }
   }
 
@@ -184,6 +186,7 @@ void QtMainWindow::Reload(bool ignore_cache) {
     if (tab && tab->cef_client && tab->cef_client->GetBrowser()) {
       client = tab->cef_client;
       tab->is_loading = true;
+      client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
     }
   }
 
@@ -267,6 +270,7 @@ void QtMainWindow::LoadURL(const QString& url) {
     client = tab->cef_client;
     tab->url = url;
     tab->is_loading = true;
+    client->GetLoadTracker().OnNavigationRequested(LoadTracker::Clock::now());
     tab_index = active_tab_index_;
   }
 
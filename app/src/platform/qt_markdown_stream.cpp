@@ -0,0 +1,96 @@
+#include "qt_markdown_stream.h"
+
+namespace athena {
+namespace platform {
+
+namespace {
+
+// Up to three spaces of indentation are allowed before a fence or heading
+int skipIndent(const QString& text, int start, int end) {
+  int pos = start;
+  while (pos < end && pos - start < 3 && text.at(pos) == QLatin1Char(' ')) {
+    ++pos;
+  }
+  return pos;
+}
+
+int countRun(const QString& text, int pos, int end, QChar c) {
+  int count = 0;
+  while (pos + count < end && text.at(pos + count) == c) {
+    ++count;
+  }
+  return count;
+}
+
+bool isBlank(const QString& text, int start, int end) {
+  for (int pos = start; pos < end; ++pos) {
+    QChar c = text.at(pos);
+    if (c != QLatin1Char(' ') && c != QLatin1Char('\t') && c != QLatin1Char('\r')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+void MarkdownStreamSplitter::Scan(const QString& message) {
+  while (scanPos_ < message.size()) {
+    int newline = message.indexOf(QLatin1Char('\n'), scanPos_);
+    if (newline < 0) {
+      break;  // Last line is still being written
+    }
+    scanLine(message, scanPos_, newline);
+    scanPos_ = newline + 1;
+  }
+}
+
+void MarkdownStreamSplitter::Reset() {
+  stableEnd_ = 0;
+  scanPos_ = 0;
+  fenceChar_ = QChar();
+  fenceLength_ = 0;
+}
+
+void MarkdownStreamSplitter::scanLine(const QString& message, int start, int end) {
+  const int lineEnd = end + 1;  // Including the newline
+  const int pos = skipIndent(message, start, end);
+  const QChar first = pos < end ? message.at(pos) : QChar();
+
+  if (fenceLength_ > 0) {
+    // Only a fence of the same kind, at least as long, closes it
+    int run = countRun(message, pos, end, fenceChar_);
+    if (run >= fenceLength_ && isBlank(message, pos + run, end)) {
+      fenceLength_ = 0;
+      stableEnd_ = lineEnd;
+    }
+    return;
+  }
+
+  if (first == QLatin1Char('`') || first == QLatin1Char('~')) {
+    int run = countRun(message, pos, end, first);
+    if (run >= 3) {
+      // The code block starts a block of its own, even right after a paragraph
+      fenceChar_ = first;
+      fenceLength_ = run;
+      stableEnd_ = start;
+      return;
+    }
+  }
+
+  if (isBlank(message, start, end)) {
+    stableEnd_ = lineEnd;
+    return;
+  }
+
+  if (first == QLatin1Char('#')) {
+    int level = countRun(message, pos, end, first);
+    if (level <= 6 && (pos + level == end || message.at(pos + level) == QLatin1Char(' '))) {
+      // A heading is a whole block on one line
+      stableEnd_ = lineEnd;
+    }
+  }
+}
+
+}  // namespace platform
+}  // namespace athena
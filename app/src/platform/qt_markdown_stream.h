@@ -0,0 +1,51 @@
+#ifndef ATHENA_PLATFORM_QT_MARKDOWN_STREAM_H_
+#define ATHENA_PLATFORM_QT_MARKDOWN_STREAM_H_
+
+#include <QString>
+
+namespace athena {
+namespace platform {
+
+/**
+ * Finds where a markdown message that is still streaming in can be split:
+ * everything before StableEnd() is made of complete top-level blocks that
+ * later text cannot change, so it only has to be rendered once; only the
+ * text after it (the block still being written) is re-rendered per update.
+ *
+ * Blocks end at blank lines, after ATX headings and after closing code
+ * fences; blank lines inside a fenced code block do not end it. Scanning is
+ * incremental: each Scan() looks only at lines completed since the last one.
+ */
+class MarkdownStreamSplitter {
+ public:
+  /**
+   * Scan the newly completed lines of |message|, which must extend the text
+   * passed to the previous call (or Reset()).
+   */
+  void Scan(const QString& message);
+
+  /**
+   * Length of the stable prefix of the message.
+   */
+  int StableEnd() const { return stableEnd_; }
+
+  /**
+   * Whether the scanned text ends inside an open code fence.
+   */
+  bool InCodeFence() const { return fenceLength_ > 0; }
+
+  void Reset();
+
+ private:
+  void scanLine(const QString& message, int start, int end);
+
+  int stableEnd_ = 0;
+  int scanPos_ = 0;      // Start of the first line not yet scanned
+  QChar fenceChar_;      // '`' or '~' while in a fence
+  int fenceLength_ = 0;  // Length of the opening fence; 0 outside fences
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_QT_MARKDOWN_STREAM_H_
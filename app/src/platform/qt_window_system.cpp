@@ -8,6 +8,7 @@
 #include "platform/qt_window_system.h"
 
 #include "browser/browser_engine.h"
+#include "browser/cef_engine.h"
 #include "include/cef_app.h"
 #include "platform/qt_mainwindow.h"
 #include "utils/logging.h"
@@ -28,6 +29,7 @@ QtWindowSystem::QtWindowSystem()
       engine_(nullptr),
       app_(nullptr),
       cef_timer_(nullptr),
+      frame_rate_timer_(nullptr),
       window_(nullptr) {}
 
 QtWindowSystem::~QtWindowSystem() {
@@ -72,6 +74,12 @@ void QtWindowSystem::Shutdown() {
     cef_timer_ = nullptr;
   }
 
+  if (frame_rate_timer_) {
+    frame_rate_timer_->stop();
+    delete frame_rate_timer_;
+    frame_rate_timer_ = nullptr;
+  }
+
   window_.reset();
 
   if (app_) {
@@ -130,6 +138,15 @@ void QtWindowSystem::Run() {
 
   logger.Info("CEF message pump started (10ms interval)");
 
+  // Re-evaluate per-browser frame rates (visibility, input, paint activity)
+  if (auto* cef_engine = dynamic_cast<browser::CefEngine*>(engine_)) {
+    frame_rate_timer_ = new QTimer(app_);
+    QObject::connect(frame_rate_timer_, &QTimer::timeout, [cef_engine]() {
+      cef_engine->UpdateFrameRates();
+    });
+    frame_rate_timer_->start(250);
+  }
+
   // Show window (InitializeBrowser will be called from showEvent)
   if (window_) {
     window_->Show();
@@ -64,6 +64,7 @@ class QtWindowSystem : public WindowSystem {
   browser::BrowserEngine* engine_;        // Non-owning
   QApplication* app_;                     // Qt application instance (owned)
   QTimer* cef_timer_;                     // CEF message pump timer (owned by app_)
+  QTimer* frame_rate_timer_;              // Frame-rate governor tick (owned by app_)
   std::shared_ptr<QtMainWindow> window_;  // Main window instance
 };
 
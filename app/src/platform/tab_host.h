@@ -0,0 +1,174 @@
+#ifndef ATHENA_PLATFORM_TAB_HOST_H_
+#define ATHENA_PLATFORM_TAB_HOST_H_
+
+#include "browser/frame_rate_governor.h"
+#include "browser/load_tracker.h"
+#include "browser/resource_filter.h"
+#include "browser/tab_discard_policy.h"
+#include "core/types.h"
+#include "rendering/annotation_compositor.h"
+#include "rendering/damage_tracker.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <QString>
+#include <vector>
+
+namespace athena {
+namespace platform {
+
+/**
+ * Tabbed browser surface driven by the browser control server.
+ *
+ * Implemented by QtMainWindow (widgets and GL) and HeadlessWindow (CPU frames
+ * only), so every control-server endpoint works in both modes. Operations
+ * without a tab index act on the active tab.
+ *
+ * Threading: all methods must be called from the main thread. Methods that
+ * wait on CEF (JavaScript, HTML, page loads, full-page capture) pump the CEF
+ * and Qt event loops while waiting.
+ */
+class TabHost {
+ public:
+  virtual ~TabHost() = default;
+
+  // ============================================================================
+  // Tabs
+  // ============================================================================
+
+  /**
+   * Create a tab and make it active.
+   * @return Index of the created tab, or -1 on error
+   */
+  virtual int CreateTab(const QString& url) = 0;
+
+  /**
+   * Close a tab. Closing the last tab closes the window.
+   */
+  virtual void CloseTab(size_t index) = 0;
+
+  virtual void SwitchToTab(size_t index) = 0;
+  virtual size_t GetTabCount() const = 0;
+  virtual size_t GetActiveTabIndex() const = 0;
+
+  /**
+   * Browser IDs of all tabs, indexed by tab index (0 for tabs still being created).
+   */
+  virtual std::vector<browser::BrowserId> GetTabBrowserIds() const = 0;
+
+  /**
+   * What is kept of a discarded (hibernated) tab, or nullopt if the tab is
+   * live or the index is invalid. Discarded tabs are restored when switched to.
+   */
+  virtual std::optional<browser::TabSnapshot> GetDiscardedTab(size_t index) const = 0;
+
+  /**
+   * Wait until a tab has finished loading.
+   * @return true if load completed, false on timeout or invalid tab
+   */
+  virtual bool WaitForLoadToComplete(size_t tab_index, int timeout_ms = 15000) const = 0;
+
+  /**
+   * Wait until a tab reaches a load state: the load event, DOMContentLoaded
+   * or network idle. A navigation requested just before counts as pending.
+   * @return true if the state was reached, false on timeout or invalid tab
+   */
+  virtual bool WaitForLoadState(size_t tab_index,
+                                const browser::LoadTracker::WaitCondition& condition,
+                                int timeout_ms = 15000) const = 0;
+
+  // ============================================================================
+  // Navigation
+  // ============================================================================
+
+  virtual void LoadURL(const QString& url) = 0;
+  virtual void GoBack() = 0;
+  virtual void GoForward() = 0;
+  virtual void Reload(bool ignore_cache = false) = 0;
+  virtual QString GetCurrentUrl() const = 0;
+
+  // ============================================================================
+  // Content
+  // ============================================================================
+
+  /**
+   * HTML source of the active page (5s timeout), or empty string on error.
+   */
+  virtual QString GetPageHTML() const = 0;
+
+  /**
+   * Execute JavaScript in the active page (5s timeout).
+   * @return JSON-encoded result envelope
+   */
+  virtual QString ExecuteJavaScript(const QString& code) const = 0;
+
+  // ============================================================================
+  // Screenshots
+  // ============================================================================
+  // All captures are base64 PNGs scaled to 50%, or empty strings on failure.
+
+  /**
+   * @param region Optional sub-rectangle (physical pixels); nullptr for the viewport
+   */
+  virtual QString TakeScreenshot(const core::Rect* region = nullptr) const = 0;
+
+  /**
+   * Consume the active tab's damage since its last capture (change-aware screenshots).
+   */
+  virtual rendering::DamageTracker::Capture ConsumeDamage(std::optional<uint64_t> since_token) = 0;
+
+  /**
+   * Scroll-and-stitch capture of the whole page. Sizes are CSS pixels.
+   */
+  virtual QString TakeFullPageScreenshot(int page_height,
+                                         int viewport_height,
+                                         int scroll_x,
+                                         int scroll_y) = 0;
+
+  /**
+   * Viewport capture with numbered boxes drawn onto the pixels.
+   * @param annotations Boxes in CSS pixels relative to the viewport
+   * @param viewport_width Viewport width in CSS pixels
+   */
+  virtual QString TakeAnnotatedScreenshot(const std::vector<rendering::Annotation>& annotations,
+                                          int viewport_width) const = 0;
+
+  // ============================================================================
+  // Frame Rate Governor
+  // ============================================================================
+
+  /**
+   * Report a control-server request for the active tab.
+   */
+  virtual void NotifyAgentActivity() = 0;
+
+  /**
+   * Current frame-rate decisions, or nullopt if the engine has no governor.
+   */
+  virtual std::optional<browser::FrameRateGovernor::Metrics> GetFrameRateMetrics() const = 0;
+
+  // ============================================================================
+  // Resource Blocking
+  // ============================================================================
+
+  /**
+   * Set the subresource filter of a tab. It applies to requests started from
+   * now on and survives navigation and hibernation.
+   * @param filter Filter to apply, or nullptr to allow everything
+   * @return false if the index is invalid
+   */
+  virtual bool SetResourceFilter(size_t index,
+                                 std::shared_ptr<const browser::ResourceFilter> filter) = 0;
+
+  /**
+   * A tab's subresource filter, or nullptr if it has none or the index is invalid.
+   */
+  virtual std::shared_ptr<const browser::ResourceFilter> GetResourceFilter(size_t index) const = 0;
+};
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_TAB_HOST_H_
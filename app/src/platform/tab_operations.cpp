@@ -0,0 +1,385 @@
+/**
+ * Tab Operations Implementation
+ *
+ * Browser operations shared by the Qt and headless windows.
+ */
+
+#include "platform/tab_operations.h"
+
+#include "browser/cef_client.h"
+#include "include/cef_app.h"
+#include "rendering/gl_renderer.h"
+#include "rendering/tile_stitcher.h"
+#include "runtime/js_execution_utils.h"
+#include "utils/logging.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <nlohmann/json.hpp>
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <string>
+#include <thread>
+
+namespace athena {
+namespace platform {
+
+using namespace browser;
+using namespace rendering;
+using namespace utils;
+
+static Logger logger("TabOperations");
+
+namespace {
+
+// Time to wait for the frame produced by scrolling to a tile
+constexpr int kTilePaintTimeoutMs = 1000;
+
+int64_t ElapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                               start)
+      .count();
+}
+
+}  // namespace
+
+void PumpEventsOnce(int sleep_ms) {
+  CefDoMessageLoopWork();
+  QCoreApplication::processEvents(QEventLoop::AllEvents, 5);
+  std::this_thread::sleep_for(std::chrono::milliseconds(sleep_ms));
+}
+
+void ScrollMainFrameTo(CefRefPtr<CefBrowser> browser, int x, int y) {
+  CefRefPtr<CefFrame> frame = browser ? browser->GetMainFrame() : nullptr;
+  if (!frame) {
+    return;
+  }
+  std::string code = "window.scrollTo(" + std::to_string(x) + ", " + std::to_string(y) + ");";
+  frame->ExecuteJavaScript(code, frame->GetURL(), 0);
+}
+
+// ============================================================================
+// Browser Content Access
+// ============================================================================
+
+QString FetchPageHtml(CefRefPtr<CefBrowser> browser) {
+  auto main_frame = browser ? browser->GetMainFrame() : nullptr;
+  if (!main_frame) {
+    logger.Error("No main frame available");
+    return QString();
+  }
+
+  // Helper class for synchronous HTML retrieval
+  class HtmlVisitor : public CefStringVisitor {
+   public:
+    HtmlVisitor() : complete_(false) {}
+
+    void Visit(const CefString& string) override {
+      std::lock_guard<std::mutex> lock(mutex_);
+      html_ = string.ToString();
+      complete_.store(true, std::memory_order_release);
+    }
+
+    bool WaitForHtml(std::string& html, int timeout_ms = 5000) {
+      auto start = std::chrono::steady_clock::now();
+
+      // Poll and pump CEF message loop instead of blocking
+      while (!complete_.load(std::memory_order_acquire)) {
+        // Check timeout
+        if (ElapsedMs(start) >= timeout_ms) {
+          return false;
+        }
+
+        // Pump CEF message loop to allow callbacks to run
+        CefDoMessageLoopWork();
+
+        // Small sleep to avoid busy-waiting
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      html = html_;
+      return true;
+    }
+
+   private:
+    std::mutex mutex_;
+    std::string html_;
+    std::atomic<bool> complete_;
+    IMPLEMENT_REFCOUNTING(HtmlVisitor);
+  };
+
+  // Request HTML source
+  CefRefPtr<HtmlVisitor> visitor = new HtmlVisitor();
+  main_frame->GetSource(visitor);
+
+  // Wait for result
+  std::string html;
+  if (visitor->WaitForHtml(html, 5000)) {
+    logger.Info("Retrieved HTML (" + std::to_string(html.length()) + " bytes)");
+    return QString::fromStdString(html);
+  } else {
+    logger.Error("Timeout waiting for HTML");
+    return QString();
+  }
+}
+
+QString EvaluateJavaScript(CefClient* cef_client,
+                           const QString& code,
+                           const CancelCheck& cancelled) {
+  auto request_id_opt = cef_client->RequestJavaScriptEvaluation(code.toStdString());
+  if (!request_id_opt.has_value()) {
+    logger.Error("ExecuteJavaScript: Failed to dispatch request");
+    return QString(
+        R"({"success":false,"error":{"message":"Failed to dispatch JavaScript to renderer"}})");
+  }
+
+  const std::string request_id = request_id_opt.value();
+  const int timeout_ms = 5000;
+  auto start = std::chrono::steady_clock::now();
+
+  while (true) {
+    auto result = cef_client->TryConsumeJavaScriptResult(request_id);
+    if (result.has_value()) {
+      logger.Info("JavaScript executed ({} bytes)", result->size());
+      return QString::fromStdString(result.value());
+    }
+
+    if (cancelled()) {
+      logger.Error("ExecuteJavaScript aborted: window closed while waiting");
+      cef_client->CancelJavaScriptEvaluation(request_id);
+      return QString(
+          R"({"success":false,"error":{"message":"Window closed while waiting for result"}})");
+    }
+
+    if (ElapsedMs(start) >= timeout_ms) {
+      logger.Error("ExecuteJavaScript timed out after {}ms", timeout_ms);
+      cef_client->CancelJavaScriptEvaluation(request_id);
+      return QString(
+          R"({"success":false,"error":{"message":"Timeout waiting for JavaScript result"},"type":"timeout"})");
+    }
+
+    PumpEventsOnce(5);
+  }
+}
+
+// ============================================================================
+// Tab Discarding
+// ============================================================================
+
+TabDiscardPolicy::Policy DiscardPolicyFromConfig(const WindowConfig& config) {
+  TabDiscardPolicy::Policy policy;
+  policy.max_live_tabs = config.max_live_tabs;
+  policy.idle_timeout = std::chrono::minutes(std::max(0, config.tab_idle_discard_minutes));
+  policy.memory_budget_bytes = static_cast<uint64_t>(config.tab_memory_budget_mb) * 1024 * 1024;
+  return policy;
+}
+
+std::optional<core::Point> ReadScrollPosition(CefClient* client, const CancelCheck& cancelled) {
+  QString result = EvaluateJavaScript(
+      client, "return {x: Math.round(window.scrollX), y: Math.round(window.scrollY)};", cancelled);
+
+  std::string parse_error;
+  auto exec = runtime::ParseJsExecutionResultString(result.toStdString(), parse_error);
+  if (!exec.has_value() || !exec->success) {
+    return std::nullopt;
+  }
+
+  nlohmann::json value = exec->value;
+  if (value.is_string() && runtime::JsonStringLooksLikeObject(value)) {
+    value = nlohmann::json::parse(value.get<std::string>(), nullptr, false);
+  }
+  if (!value.is_object()) {
+    return std::nullopt;
+  }
+  return core::Point(value.value("x", 0), value.value("y", 0));
+}
+
+TabSnapshot CaptureTabSnapshot(CefClient* client,
+                               const FrameCapture& capture,
+                               const QString& url,
+                               const QString& title,
+                               const CancelCheck& cancelled) {
+  TabSnapshot snapshot;
+  snapshot.url = url.toStdString();
+  snapshot.title = title.toStdString();
+
+  // Capture the frame first: reading the scroll position pumps the event loop
+  std::vector<uint8_t> pixels;
+  core::Size size;
+  if (capture && capture(&pixels, &size)) {
+    snapshot.thumbnail_png =
+        GLRenderer::EncodePng(pixels.data(), size, TabDiscardPolicy::kThumbnailScale);
+  }
+
+  if (client) {
+    if (auto scroll = ReadScrollPosition(client, cancelled)) {
+      snapshot.scroll = *scroll;
+    }
+  }
+  return snapshot;
+}
+
+// ============================================================================
+// Screenshots
+// ============================================================================
+
+bool WaitForViewPaint(CefClient* client,
+                      uint64_t paint_count,
+                      int timeout_ms,
+                      const CancelCheck& cancelled) {
+  auto start = std::chrono::steady_clock::now();
+
+  while (client->GetViewPaintCount() == paint_count) {
+    if (cancelled()) {
+      return false;
+    }
+
+    if (ElapsedMs(start) >= timeout_ms) {
+      return false;
+    }
+
+    PumpEventsOnce(5);
+  }
+
+  return true;
+}
+
+QString CaptureFullPage(CefClient* cef_client,
+                        const FrameCapture& capture,
+                        int page_height,
+                        int viewport_height,
+                        int scroll_x,
+                        int scroll_y,
+                        const CancelCheck& cancelled) {
+  if (page_height <= 0 || viewport_height <= 0) {
+    logger.Error("TakeFullPageScreenshot: invalid page height {} / viewport height {}",
+                 page_height,
+                 viewport_height);
+    return QString();
+  }
+
+  CefRefPtr<CefBrowser> browser = cef_client->GetBrowser();
+  const int last_offset = std::max(0, page_height - viewport_height);
+
+  TileStitcher stitcher;
+  double physical_per_css = 0.0;
+  int current_offset = scroll_y;
+  int tiles = 0;
+  bool failed = false;
+
+  // Scroll viewport by viewport; each tile is folded into the scaled output
+  // immediately so at most one full-resolution viewport is held at a time.
+  for (int css_y = 0;; css_y += viewport_height) {
+    const int offset = std::min(css_y, last_offset);
+
+    if (offset != current_offset) {
+      uint64_t paint_count = cef_client->GetViewPaintCount();
+      ScrollMainFrameTo(browser, scroll_x, offset);
+      if (!WaitForViewPaint(cef_client, paint_count, kTilePaintTimeoutMs, cancelled)) {
+        logger.Warn("TakeFullPageScreenshot: no repaint after scrolling to {}", offset);
+      }
+      current_offset = offset;
+    }
+
+    if (cancelled()) {
+      failed = true;
+      break;
+    }
+
+    std::vector<uint8_t> pixels;
+    core::Size tile_size;
+    if (!capture(&pixels, &tile_size)) {
+      failed = true;
+      break;
+    }
+
+    if (tiles == 0) {
+      physical_per_css = static_cast<double>(tile_size.height) / viewport_height;
+      core::Size page_size(tile_size.width,
+                           static_cast<int>(std::lround(page_height * physical_per_css)));
+      auto begin = stitcher.Begin(page_size, GLRenderer::kScreenshotScale);
+      if (!begin) {
+        logger.Error("TakeFullPageScreenshot: {}", begin.GetError().Message());
+        failed = true;
+        break;
+      }
+    }
+
+    int page_y = static_cast<int>(std::lround(offset * physical_per_css));
+    auto added = stitcher.AddTile(pixels.data(), tile_size, page_y);
+    if (!added) {
+      logger.Error("TakeFullPageScreenshot: {}", added.GetError().Message());
+      failed = true;
+      break;
+    }
+    tiles++;
+
+    if (stitcher.IsComplete() || offset == last_offset) {
+      break;
+    }
+  }
+
+  // Put the page back where the user left it
+  if (current_offset != scroll_y && !cancelled()) {
+    uint64_t paint_count = cef_client->GetViewPaintCount();
+    ScrollMainFrameTo(browser, scroll_x, scroll_y);
+    WaitForViewPaint(cef_client, paint_count, kTilePaintTimeoutMs, cancelled);
+  }
+
+  if (failed || !stitcher.IsComplete()) {
+    logger.Error("TakeFullPageScreenshot: Failed to capture page ({} tiles)", tiles);
+    return QString();
+  }
+
+  std::string base64_png = GLRenderer::EncodePng(stitcher.Pixels().data(), stitcher.OutputSize());
+  if (base64_png.empty()) {
+    logger.Error("TakeFullPageScreenshot: Failed to encode screenshot");
+    return QString();
+  }
+
+  logger.Info("Full page screenshot captured ({} tiles, {})",
+              tiles,
+              stitcher.OutputSize().ToString());
+  return QString::fromStdString(base64_png);
+}
+
+QString EncodeAnnotatedScreenshot(std::vector<uint8_t>* rgba,
+                                  const core::Size& size,
+                                  const std::vector<Annotation>& annotations,
+                                  int viewport_width) {
+  // Element bounds come from the page in CSS pixels
+  const double physical_per_css =
+      viewport_width > 0 ? static_cast<double>(size.width) / viewport_width : 1.0;
+  std::vector<Annotation> physical;
+  physical.reserve(annotations.size());
+  for (const auto& annotation : annotations) {
+    const core::Rect& css = annotation.bounds;
+    int left = static_cast<int>(std::lround(css.x * physical_per_css));
+    int top = static_cast<int>(std::lround(css.y * physical_per_css));
+    int right = static_cast<int>(std::lround(css.Right() * physical_per_css));
+    int bottom = static_cast<int>(std::lround(css.Bottom() * physical_per_css));
+    physical.push_back({core::Rect(left, top, right - left, bottom - top), annotation.label});
+  }
+
+  // Labels must stay legible after the 50% downscale
+  int font_scale = std::max(2, static_cast<int>(std::lround(3 * physical_per_css)));
+
+  AnnotationCompositor compositor(rgba->data(), size);
+  compositor.DrawAnnotations(physical, font_scale);
+
+  std::string base64_png = GLRenderer::EncodePng(rgba->data(), size, GLRenderer::kScreenshotScale);
+  if (base64_png.empty()) {
+    logger.Error("TakeAnnotatedScreenshot: Failed to encode screenshot");
+    return QString();
+  }
+
+  logger.Info("Annotated screenshot captured ({} elements)", annotations.size());
+  return QString::fromStdString(base64_png);
+}
+
+}  // namespace platform
+}  // namespace athena
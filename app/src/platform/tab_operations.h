@@ -0,0 +1,131 @@
+/**
+ * Tab Operations
+ *
+ * Browser operations shared by QtMainWindow and HeadlessWindow: blocking
+ * JavaScript/HTML retrieval, paint waits, full-page tiling and annotated
+ * screenshot encoding. Each window resolves the tab and its frame source;
+ * these helpers do the CEF work.
+ *
+ * All functions must be called from the main thread. Blocking helpers pump
+ * the CEF and Qt event loops while waiting and stop early once |cancelled|
+ * returns true (e.g. the window was closed).
+ */
+
+#ifndef ATHENA_PLATFORM_TAB_OPERATIONS_H_
+#define ATHENA_PLATFORM_TAB_OPERATIONS_H_
+
+#include "browser/tab_discard_policy.h"
+#include "core/types.h"
+#include "include/cef_browser.h"
+#include "platform/window_system.h"
+#include "rendering/annotation_compositor.h"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <QString>
+#include <vector>
+
+namespace athena {
+namespace browser {
+class CefClient;
+}
+
+namespace platform {
+
+// Returns true when a blocking operation should give up
+using CancelCheck = std::function<bool()>;
+
+// Reads the tab's current view as top-down RGBA
+using FrameCapture = std::function<bool(std::vector<uint8_t>* rgba, core::Size* size)>;
+
+/**
+ * Run one round of CEF and Qt event processing, then sleep briefly.
+ */
+void PumpEventsOnce(int sleep_ms);
+
+/**
+ * Fetch the HTML source of a browser's main frame (5s timeout).
+ * @return HTML source, or empty string on error
+ */
+QString FetchPageHtml(CefRefPtr<CefBrowser> browser);
+
+/**
+ * Execute JavaScript through the client's renderer bridge and wait for the
+ * result (5s timeout).
+ * @return JSON-encoded result envelope (errors are encoded in the envelope)
+ */
+QString EvaluateJavaScript(browser::CefClient* client,
+                           const QString& code,
+                           const CancelCheck& cancelled);
+
+/**
+ * Scroll the main frame to a position in CSS pixels (asynchronous).
+ */
+void ScrollMainFrameTo(CefRefPtr<CefBrowser> browser, int x, int y);
+
+/**
+ * Read the main frame's scroll position in CSS pixels through the renderer bridge.
+ * @return Scroll position, or nullopt if the page did not answer
+ */
+std::optional<core::Point> ReadScrollPosition(browser::CefClient* client,
+                                              const CancelCheck& cancelled);
+
+/**
+ * Tab discard policy configured by a window's settings.
+ */
+browser::TabDiscardPolicy::Policy DiscardPolicyFromConfig(const WindowConfig& config);
+
+/**
+ * Capture what is kept of a tab before its browser is discarded: URL, title,
+ * scroll position and a thumbnail of the last frame (scaled to 25%).
+ */
+browser::TabSnapshot CaptureTabSnapshot(browser::CefClient* client,
+                                        const FrameCapture& capture,
+                                        const QString& url,
+                                        const QString& title,
+                                        const CancelCheck& cancelled);
+
+/**
+ * Wait until the client paints a new main-view frame.
+ * @param paint_count View paint count observed before the triggering action
+ * @return true if a new frame was painted, false on timeout or cancellation
+ */
+bool WaitForViewPaint(browser::CefClient* client,
+                      uint64_t paint_count,
+                      int timeout_ms,
+                      const CancelCheck& cancelled);
+
+/**
+ * Capture the whole page by scrolling viewport by viewport and stitching the
+ * tiles (scaled to 50%). The scroll position is restored afterwards. Sizes
+ * are CSS pixels.
+ *
+ * Pumps the event loop between tiles: the caller must keep |client| alive,
+ * and |cancelled| should report the tab being closed or discarded.
+ * @return Base64-encoded PNG image data, or empty string on failure
+ */
+QString CaptureFullPage(browser::CefClient* client,
+                        const FrameCapture& capture,
+                        int page_height,
+                        int viewport_height,
+                        int scroll_x,
+                        int scroll_y,
+                        const CancelCheck& cancelled);
+
+/**
+ * Draw numbered element boxes onto captured pixels and encode them (scaled to 50%).
+ * @param rgba Viewport pixels, modified in place
+ * @param annotations Boxes in CSS pixels relative to the viewport
+ * @param viewport_width Viewport width in CSS pixels (maps CSS to physical pixels)
+ * @return Base64-encoded PNG image data, or empty string on failure
+ */
+QString EncodeAnnotatedScreenshot(std::vector<uint8_t>* rgba,
+                                  const core::Size& size,
+                                  const std::vector<rendering::Annotation>& annotations,
+                                  int viewport_width);
+
+}  // namespace platform
+}  // namespace athena
+
+#endif  // ATHENA_PLATFORM_TAB_OPERATIONS_H_
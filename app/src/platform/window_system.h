@@ -4,6 +4,7 @@
 #include "core/types.h"
 #include "utils/error.h"
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -37,6 +38,10 @@ struct WindowConfig {
   bool enable_input = true;
   std::string url = "about:blank";               // Initial URL to load
   runtime::NodeRuntime* node_runtime = nullptr;  // Optional Node runtime for Agent chat
+  size_t spare_browsers = 1;                     // Pre-warmed browsers for new tabs (0 = off)
+  size_t max_live_tabs = 0;                      // Discard LRU tabs beyond this many (0 = no limit)
+  int tab_idle_discard_minutes = 0;              // Discard tabs unused this long (0 = never)
+  size_t tab_memory_budget_mb = 0;               // Discard LRU tabs above this RSS (0 = no budget)
 };
 
 /**
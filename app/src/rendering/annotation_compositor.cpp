@@ -0,0 +1,229 @@
+#include "rendering/annotation_compositor.h"
+
+#include <algorithm>
+
+namespace athena {
+namespace rendering {
+
+namespace {
+
+// 5x7 bitmap font, one byte per row, bit 4 = leftmost column
+constexpr uint8_t kDigitGlyphs[10][AnnotationCompositor::kGlyphHeight] = {
+    {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E},  // 0
+    {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E},  // 1
+    {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F},  // 2
+    {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E},  // 3
+    {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02},  // 4
+    {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E},  // 5
+    {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E},  // 6
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08},  // 7
+    {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E},  // 8
+    {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C},  // 9
+};
+
+constexpr uint8_t kLetterGlyphs[26][AnnotationCompositor::kGlyphHeight] = {
+    {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},  // A
+    {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E},  // B
+    {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E},  // C
+    {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C},  // D
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F},  // E
+    {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10},  // F
+    {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F},  // G
+    {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11},  // H
+    {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E},  // I
+    {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C},  // J
+    {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11},  // K
+    {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F},  // L
+    {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11},  // M
+    {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11},  // N
+    {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},  // O
+    {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10},  // P
+    {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D},  // Q
+    {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11},  // R
+    {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E},  // S
+    {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04},  // T
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E},  // U
+    {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04},  // V
+    {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A},  // W
+    {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11},  // X
+    {0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04},  // Y
+    {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F},  // Z
+};
+
+constexpr uint8_t kDashGlyph[] = {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00};
+constexpr uint8_t kDotGlyph[] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C};
+constexpr uint8_t kColonGlyph[] = {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00};
+constexpr uint8_t kHashGlyph[] = {0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A};
+constexpr uint8_t kSlashGlyph[] = {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00};
+
+// High-contrast colors that stay distinguishable after downscaling
+constexpr AnnotationCompositor::Color kPalette[] = {
+    {230, 25, 75, 255},   // Red
+    {0, 130, 200, 255},   // Blue
+    {60, 180, 75, 255},   // Green
+    {245, 130, 48, 255},  // Orange
+    {145, 30, 180, 255},  // Purple
+    {0, 128, 128, 255},   // Teal
+    {240, 50, 230, 255},  // Magenta
+    {128, 0, 0, 255},     // Maroon
+};
+
+constexpr AnnotationCompositor::Color kLabelTextColor = {255, 255, 255, 255};
+
+}  // namespace
+
+AnnotationCompositor::AnnotationCompositor(uint8_t* frame, const core::Size& size)
+    : frame_(frame), size_(size) {}
+
+const uint8_t* AnnotationCompositor::Glyph(char c) {
+  if (c >= '0' && c <= '9') {
+    return kDigitGlyphs[c - '0'];
+  }
+  if (c >= 'A' && c <= 'Z') {
+    return kLetterGlyphs[c - 'A'];
+  }
+  if (c >= 'a' && c <= 'z') {
+    return kLetterGlyphs[c - 'a'];
+  }
+  switch (c) {
+    case '-':
+      return kDashGlyph;
+    case '.':
+      return kDotGlyph;
+    case ':':
+      return kColonGlyph;
+    case '#':
+      return kHashGlyph;
+    case '/':
+      return kSlashGlyph;
+    default:
+      return nullptr;
+  }
+}
+
+AnnotationCompositor::Color AnnotationCompositor::PaletteColor(size_t index) {
+  return kPalette[index % (sizeof(kPalette) / sizeof(kPalette[0]))];
+}
+
+void AnnotationCompositor::BlendPixel(int x, int y, const Color& color) {
+  uint8_t* px = frame_ + (static_cast<size_t>(y) * size_.width + x) * 4;
+  if (color.a == 255) {
+    px[0] = color.r;
+    px[1] = color.g;
+    px[2] = color.b;
+    px[3] = 255;
+    return;
+  }
+
+  // Source-over blend with integer rounding
+  const uint32_t a = color.a;
+  const uint32_t inv = 255 - a;
+  px[0] = static_cast<uint8_t>((color.r * a + px[0] * inv + 127) / 255);
+  px[1] = static_cast<uint8_t>((color.g * a + px[1] * inv + 127) / 255);
+  px[2] = static_cast<uint8_t>((color.b * a + px[2] * inv + 127) / 255);
+  px[3] = static_cast<uint8_t>(a + (px[3] * inv + 127) / 255);
+}
+
+void AnnotationCompositor::FillRect(const core::Rect& rect, const Color& color) {
+  if (!frame_ || color.a == 0) {
+    return;
+  }
+
+  core::Rect clipped = rect.Intersection(core::Rect(0, 0, size_.width, size_.height));
+  if (clipped.IsEmpty()) {
+    return;
+  }
+
+  for (int y = clipped.y; y < clipped.Bottom(); y++) {
+    for (int x = clipped.x; x < clipped.Right(); x++) {
+      BlendPixel(x, y, color);
+    }
+  }
+}
+
+void AnnotationCompositor::StrokeRect(const core::Rect& rect, const Color& color, int thickness) {
+  if (rect.IsEmpty() || thickness <= 0) {
+    return;
+  }
+
+  // Thick strokes on small boxes degenerate into a filled box
+  const int t = std::min(thickness, std::min(rect.width, rect.height) / 2 + 1);
+
+  // Top and bottom edges span the full width; sides fill the gap between them
+  FillRect(core::Rect(rect.x, rect.y, rect.width, t), color);
+  FillRect(core::Rect(rect.x, rect.Bottom() - t, rect.width, t), color);
+  FillRect(core::Rect(rect.x, rect.y + t, t, rect.height - 2 * t), color);
+  FillRect(core::Rect(rect.Right() - t, rect.y + t, t, rect.height - 2 * t), color);
+}
+
+core::Size AnnotationCompositor::MeasureText(const std::string& text, int scale) {
+  if (text.empty() || scale <= 0) {
+    return core::Size(0, 0);
+  }
+  // No trailing spacing column after the last glyph
+  int width = (static_cast<int>(text.size()) * kGlyphAdvance - 1) * scale;
+  return core::Size(width, kGlyphHeight * scale);
+}
+
+void AnnotationCompositor::DrawText(const core::Point& origin,
+                                    const std::string& text,
+                                    const Color& color,
+                                    int scale) {
+  if (scale <= 0) {
+    return;
+  }
+
+  int pen_x = origin.x;
+  for (char c : text) {
+    const uint8_t* glyph = Glyph(c);
+    if (glyph) {
+      for (int row = 0; row < kGlyphHeight; row++) {
+        for (int col = 0; col < kGlyphWidth; col++) {
+          if (glyph[row] & (0x10 >> col)) {
+            FillRect(core::Rect(pen_x + col * scale, origin.y + row * scale, scale, scale), color);
+          }
+        }
+      }
+    }
+    pen_x += kGlyphAdvance * scale;
+  }
+}
+
+void AnnotationCompositor::DrawAnnotations(const std::vector<Annotation>& annotations,
+                                           int font_scale) {
+  font_scale = std::max(1, font_scale);
+  const int padding = font_scale;
+  const int thickness = std::max(2, font_scale);
+
+  for (size_t i = 0; i < annotations.size(); i++) {
+    const Annotation& annotation = annotations[i];
+    const Color color = PaletteColor(i);
+
+    StrokeRect(annotation.bounds, color, thickness);
+
+    if (annotation.label.empty()) {
+      continue;
+    }
+
+    core::Size text_size = MeasureText(annotation.label, font_scale);
+    core::Rect tag(annotation.bounds.x,
+                   annotation.bounds.y,
+                   text_size.width + 2 * padding,
+                   text_size.height + 2 * padding);
+
+    // Place the tag above the box when there is room, inside it otherwise
+    if (tag.y >= tag.height) {
+      tag.y -= tag.height;
+    }
+    tag.x = std::max(0, std::min(tag.x, size_.width - tag.width));
+
+    FillRect(tag, color);
+    DrawText(core::Point(tag.x + padding, tag.y + padding),
+             annotation.label,
+             kLabelTextColor,
+             font_scale);
+  }
+}
+
+}  // namespace rendering
+}  // namespace athena
@@ -0,0 +1,80 @@
+#ifndef ATHENA_RENDERING_ANNOTATION_COMPOSITOR_H_
+#define ATHENA_RENDERING_ANNOTATION_COMPOSITOR_H_
+
+#include "core/types.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace athena {
+namespace rendering {
+
+// Annotation is a labelled box drawn over a captured frame.
+struct Annotation {
+  core::Rect bounds;  // Physical pixels, top-left origin
+  std::string label;  // Drawn in the box's top-left corner (digits render best)
+};
+
+// AnnotationCompositor draws element overlays straight into a captured RGBA
+// frame, so annotated screenshots never touch the page DOM and need no extra
+// layout, repaint or cleanup.
+//
+// All drawing is clipped to the frame. Pixels are tightly packed top-down RGBA
+// (4 bytes per pixel).
+//
+// The built-in font is a 5x7 bitmap covering digits, uppercase letters and a
+// few punctuation marks; lowercase letters are drawn as uppercase and other
+// characters as blanks.
+class AnnotationCompositor {
+ public:
+  struct Color {
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+    uint8_t a;
+  };
+
+  // Glyph cell size in font pixels (including one column of spacing)
+  static constexpr int kGlyphWidth = 5;
+  static constexpr int kGlyphHeight = 7;
+  static constexpr int kGlyphAdvance = kGlyphWidth + 1;
+
+  // frame: RGBA pixels of the given size (non-owning, must outlive this object)
+  AnnotationCompositor(uint8_t* frame, const core::Size& size);
+
+  // Fill a rectangle, alpha-blending the color over the frame.
+  void FillRect(const core::Rect& rect, const Color& color);
+
+  // Draw a rectangle outline of the given thickness inside |rect|.
+  void StrokeRect(const core::Rect& rect, const Color& color, int thickness);
+
+  // Draw text with its top-left corner at |origin|; each font pixel becomes a
+  // scale x scale block.
+  void DrawText(const core::Point& origin, const std::string& text, const Color& color, int scale);
+
+  // Size of |text| in frame pixels at the given scale.
+  static core::Size MeasureText(const std::string& text, int scale);
+
+  // Draw numbered boxes for all annotations. Box colors cycle through a
+  // palette; each label sits on a filled tag at the box's top-left corner.
+  // font_scale controls label size (frame pixels per font pixel).
+  void DrawAnnotations(const std::vector<Annotation>& annotations, int font_scale);
+
+  // Palette used by DrawAnnotations().
+  static Color PaletteColor(size_t index);
+
+ private:
+  // Rows of a 5x7 glyph (bit 4 = leftmost column); nullptr for blanks.
+  static const uint8_t* Glyph(char c);
+
+  void BlendPixel(int x, int y, const Color& color);
+
+  uint8_t* frame_;
+  core::Size size_;
+};
+
+}  // namespace rendering
+}  // namespace athena
+
+#endif  // ATHENA_RENDERING_ANNOTATION_COMPOSITOR_H_
@@ -8,30 +8,35 @@ namespace rendering {
 
 // Buffer implementation
 BufferManager::Buffer::Buffer(const core::Size& size)
+    : Buffer(size, BufferPool::Shared(), BufferInit::kZeroed) {}
+
+BufferManager::Buffer::Buffer(const core::Size& size, BufferPool& pool, BufferInit init)
     : physical_size(size), stride(BufferManager::CalculateStride(size.width)) {
   if (size.IsEmpty()) {
-    data = nullptr;
     return;
   }
 
-  size_t buffer_size = stride * size.height;
-  data = std::make_unique<uint8_t[]>(buffer_size);
+  size_t buffer_size = static_cast<size_t>(stride) * size.height;
+  memory = pool.Acquire(buffer_size);
 
-  // Initialize buffer to transparent black (BGRA format)
-  if (data) {
-    std::memset(data.get(), 0, buffer_size);
+  // Initialize buffer to transparent black (BGRA format); fresh pages from
+  // the system already are
+  if (memory && init == BufferInit::kZeroed && !memory.IsZeroed()) {
+    std::memset(memory.data(), 0, buffer_size);
   }
 }
 
 // BufferManager implementation
 int BufferManager::CalculateStride(int width) {
-  // Each pixel is 4 bytes (BGRA), and we want 4-byte alignment
+  // Each pixel is 4 bytes (BGRA)
   int stride = width * 4;
 
-  // Ensure stride is 4-byte aligned (should already be, but be explicit)
-  int remainder = stride % 4;
+  // Pad rows to whole cache lines so row copies never straddle a line shared
+  // with the previous row
+  constexpr int kRowAlignment = static_cast<int>(BufferPool::kAlignment);
+  int remainder = stride % kRowAlignment;
   if (remainder != 0) {
-    stride += (4 - remainder);
+    stride += (kRowAlignment - remainder);
   }
 
   return stride;
@@ -66,14 +71,14 @@ bool BufferManager::IsValidSize(const core::Size& size) {
 }
 
 utils::Result<std::unique_ptr<BufferManager::Buffer>> BufferManager::AllocateBuffer(
-    const core::Size& physical_size) {
+    const core::Size& physical_size, BufferInit init) {
   // Validate size
   if (!IsValidSize(physical_size)) {
     return utils::Error("Invalid buffer size: " + physical_size.ToString());
   }
 
   try {
-    auto buffer = std::make_unique<Buffer>(physical_size);
+    auto buffer = std::make_unique<Buffer>(physical_size, *pool_, init);
 
     if (!buffer || !buffer->IsValid()) {
       return utils::Error("Failed to allocate buffer: out of memory");
@@ -153,15 +158,17 @@ utils::Result<void> BufferManager::CopyFromCEFDirty(Buffer& dest,
   uint8_t* dest_ptr = dest.GetData();
 
   try {
-    // Copy only dirty rectangles
-    for (const auto& rect : dirty_rects) {
-      // Validate rect is within bounds
-      if (rect.x < 0 || rect.y < 0 || rect.x + rect.width > size.width ||
-          rect.y + rect.height > size.height) {
-        continue;  // Skip invalid rects
-      }
-
-      if (rect.IsEmpty()) {
+    // Coalesce overlapping rects and clip them to the buffer so every pixel
+    // is copied exactly once
+    core::Region damage =
+        core::Region::FromRects(dirty_rects).Intersect(core::Rect(0, 0, size.width, size.height));
+
+    for (const auto& rect : damage.Rects()) {
+      // Full-width rects are contiguous in both buffers when strides match
+      if (rect.x == 0 && rect.width == size.width && dest.stride == src_stride) {
+        std::memcpy(dest_ptr + rect.y * dest.stride,
+                    src_ptr + rect.y * src_stride,
+                    static_cast<size_t>(src_stride) * rect.height);
         continue;
       }
 
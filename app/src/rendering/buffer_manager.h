@@ -2,6 +2,7 @@
 #define ATHENA_RENDERING_BUFFER_MANAGER_H_
 
 #include "core/types.h"
+#include "rendering/buffer_pool.h"
 #include "utils/error.h"
 
 #include <cstdint>
@@ -13,38 +14,51 @@ namespace rendering {
 
 // BufferManager handles memory management for pixel buffers using RAII principles.
 // This eliminates manual memory management and ensures exception-safe buffer handling.
+//
+// Buffer memory comes from a BufferPool (the process-wide one by default), so
+// buffers freed on resize or tab close are reused by the next allocation of a
+// similar size instead of going back to the system.
 class BufferManager {
  public:
+  // How a newly allocated buffer's contents are initialized
+  enum class BufferInit {
+    kZeroed,         // Transparent black
+    kUninitialized,  // Unspecified; use when the caller overwrites every row
+  };
+
   // Buffer represents a pixel buffer with automatic memory management (RAII)
   struct Buffer {
-    std::unique_ptr<uint8_t[]> data;  // Automatic cleanup, no manual delete needed
-    core::Size physical_size;         // Size in physical pixels
-    int stride;                       // Bytes per row (may be padded)
+    BufferPool::Block memory;   // Returned to the pool on destruction
+    core::Size physical_size;  // Size in physical pixels
+    int stride;                // Bytes per row (padded to a 64-byte multiple)
 
-    // Construct a buffer with the given size
-    // Stride is calculated to be 4-byte aligned (width * 4 bytes per pixel)
+    // Construct a zeroed buffer with the given size from the shared pool
     explicit Buffer(const core::Size& size);
 
+    // Construct a buffer from a specific pool
+    Buffer(const core::Size& size, BufferPool& pool, BufferInit init);
+
     // Move-only (no copying large buffers)
     Buffer(Buffer&&) = default;
     Buffer& operator=(Buffer&&) = default;
     Buffer(const Buffer&) = delete;
     Buffer& operator=(const Buffer&) = delete;
 
-    // Destructor is automatic - std::unique_ptr handles cleanup
+    // Destructor is automatic - the pool block handles cleanup
 
-    // Get raw pointer to buffer data
-    uint8_t* GetData() { return data.get(); }
-    const uint8_t* GetData() const { return data.get(); }
+    // Get raw pointer to buffer data (64-byte aligned)
+    uint8_t* GetData() { return memory.data(); }
+    const uint8_t* GetData() const { return memory.data(); }
 
     // Get buffer size in bytes
     size_t GetSizeInBytes() const { return stride * physical_size.height; }
 
     // Check if buffer is valid
-    bool IsValid() const { return data != nullptr && !physical_size.IsEmpty(); }
+    bool IsValid() const { return memory && !physical_size.IsEmpty(); }
   };
 
   BufferManager() = default;
+  explicit BufferManager(BufferPool& pool) : pool_(&pool) {}
   ~BufferManager() = default;
 
   // Move-only
@@ -54,8 +68,14 @@ class BufferManager {
   BufferManager& operator=(const BufferManager&) = delete;
 
   // Allocate a new buffer with the given physical size
+  // Pass BufferInit::kUninitialized when the buffer is about to be filled by
+  // CopyFromCEF() to skip a redundant clear of recycled memory.
   // Returns Error if size is invalid or allocation fails
-  utils::Result<std::unique_ptr<Buffer>> AllocateBuffer(const core::Size& physical_size);
+  utils::Result<std::unique_ptr<Buffer>> AllocateBuffer(
+      const core::Size& physical_size, BufferInit init = BufferInit::kZeroed);
+
+  // Pool backing this manager's buffers
+  BufferPool& GetPool() const { return *pool_; }
 
   // Copy data from CEF buffer to our buffer
   // src: Source buffer (from CEF OnPaint)
@@ -65,18 +85,23 @@ class BufferManager {
   utils::Result<void> CopyFromCEF(Buffer& dest, const void* src, const core::Size& size);
 
   // Copy data from CEF buffer with dirty rects optimization
-  // Only copies the specified dirty rectangles instead of the entire buffer
+  // Only copies the specified dirty rectangles instead of the entire buffer.
+  // Rects are coalesced into a region first, so overlapping areas are copied
+  // once and rects extending past the buffer are clipped rather than dropped.
   utils::Result<void> CopyFromCEFDirty(Buffer& dest,
                                        const void* src,
                                        const core::Size& size,
                                        const std::vector<core::Rect>& dirty_rects);
 
  private:
-  // Calculate stride (bytes per row) with 4-byte alignment
+  // Calculate stride (bytes per row), padded so every row starts on a
+  // cache line
   static int CalculateStride(int width);
 
   // Validate that a size is valid for buffer allocation
   static bool IsValidSize(const core::Size& size);
+
+  BufferPool* pool_ = &BufferPool::Shared();
 };
 
 }  // namespace rendering
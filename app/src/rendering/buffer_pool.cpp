@@ -0,0 +1,269 @@
+#include "rendering/buffer_pool.h"
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace athena {
+namespace rendering {
+
+namespace {
+
+struct Allocation {
+  uint8_t* data = nullptr;
+  size_t capacity = 0;
+  bool mapped = false;  // From mmap (zero-filled, freed with munmap)
+};
+
+size_t RoundUp(size_t value, size_t multiple) {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+Allocation AllocateFromSystem(size_t capacity, bool use_huge_pages) {
+  Allocation allocation;
+  allocation.capacity = capacity;
+
+#if defined(__linux__)
+  if (use_huge_pages && capacity >= BufferPool::kHugePageSize) {
+    void* ptr =
+        mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr != MAP_FAILED) {
+#if defined(MADV_HUGEPAGE)
+      // Advisory only: fewer TLB misses when copying whole frames
+      madvise(ptr, capacity, MADV_HUGEPAGE);
+#endif
+      allocation.data = static_cast<uint8_t*>(ptr);
+      allocation.mapped = true;
+      return allocation;
+    }
+  }
+#else
+  (void)use_huge_pages;
+#endif
+
+  allocation.data = static_cast<uint8_t*>(
+      ::operator new(capacity, std::align_val_t(BufferPool::kAlignment), std::nothrow));
+  return allocation;
+}
+
+void FreeToSystem(const Allocation& allocation) {
+#if defined(__linux__)
+  if (allocation.mapped) {
+    munmap(allocation.data, allocation.capacity);
+    return;
+  }
+#endif
+  ::operator delete(allocation.data, std::align_val_t(BufferPool::kAlignment));
+}
+
+}  // namespace
+
+// Cache holds released blocks. It is shared between the pool and every block
+// it handed out, so blocks can be released after the pool is gone.
+class BufferPool::Cache {
+ public:
+  explicit Cache(const Options& options) : options_(options) {}
+
+  ~Cache() {
+    for (const auto& allocation : free_) {
+      FreeToSystem(allocation);
+    }
+  }
+
+  Cache(const Cache&) = delete;
+  Cache& operator=(const Cache&) = delete;
+
+  bool use_huge_pages() const { return options_.use_huge_pages; }
+
+  // Take a cached block of exactly |capacity| bytes, most recent first.
+  bool Take(size_t capacity, Allocation* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = free_.rbegin(); it != free_.rend(); ++it) {
+      if (it->capacity == capacity) {
+        *out = *it;
+        free_.erase(std::next(it).base());
+        stats_.hits++;
+        stats_.cached_blocks--;
+        stats_.cached_bytes -= capacity;
+        stats_.in_use_bytes += capacity;
+        return true;
+      }
+    }
+    stats_.misses++;
+    return false;
+  }
+
+  void Track(size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.in_use_bytes += capacity;
+  }
+
+  void Give(const Allocation& allocation) {
+    std::vector<Allocation> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.in_use_bytes -= allocation.capacity;
+
+      if (allocation.capacity > options_.max_cached_bytes) {
+        stats_.evictions++;
+        evicted.push_back(allocation);
+      } else {
+        free_.push_back(allocation);
+        stats_.cached_blocks++;
+        stats_.cached_bytes += allocation.capacity;
+
+        while (stats_.cached_bytes > options_.max_cached_bytes) {
+          evicted.push_back(free_.front());
+          stats_.cached_blocks--;
+          stats_.cached_bytes -= free_.front().capacity;
+          stats_.evictions++;
+          free_.pop_front();
+        }
+      }
+    }
+
+    // Unmapping can be slow; don't hold the lock for it
+    for (const auto& old : evicted) {
+      FreeToSystem(old);
+    }
+  }
+
+  void Trim() {
+    std::deque<Allocation> released;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      released.swap(free_);
+      stats_.cached_blocks = 0;
+      stats_.cached_bytes = 0;
+    }
+    for (const auto& allocation : released) {
+      FreeToSystem(allocation);
+    }
+  }
+
+  Stats GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  const Options options_;
+  mutable std::mutex mutex_;
+  std::deque<Allocation> free_;  // Oldest release at the front
+  Stats stats_;
+};
+
+// Block implementation
+BufferPool::Block::~Block() {
+  Reset();
+}
+
+BufferPool::Block::Block(Block&& other) noexcept
+    : cache_(std::move(other.cache_)),
+      data_(std::exchange(other.data_, nullptr)),
+      capacity_(std::exchange(other.capacity_, 0)),
+      mapped_(std::exchange(other.mapped_, false)),
+      zeroed_(std::exchange(other.zeroed_, false)) {}
+
+BufferPool::Block& BufferPool::Block::operator=(Block&& other) noexcept {
+  if (this != &other) {
+    Reset();
+    cache_ = std::move(other.cache_);
+    data_ = std::exchange(other.data_, nullptr);
+    capacity_ = std::exchange(other.capacity_, 0);
+    mapped_ = std::exchange(other.mapped_, false);
+    zeroed_ = std::exchange(other.zeroed_, false);
+  }
+  return *this;
+}
+
+void BufferPool::Block::Reset() {
+  if (data_ && cache_) {
+    cache_->Give(Allocation{data_, capacity_, mapped_});
+  }
+  cache_.reset();
+  data_ = nullptr;
+  capacity_ = 0;
+  mapped_ = false;
+  zeroed_ = false;
+}
+
+// BufferPool implementation
+BufferPool::BufferPool() : BufferPool(Options()) {}
+
+BufferPool::BufferPool(const Options& options) : cache_(std::make_shared<Cache>(options)) {}
+
+BufferPool::~BufferPool() = default;
+
+BufferPool& BufferPool::Shared() {
+  static BufferPool pool;
+  return pool;
+}
+
+size_t BufferPool::SizeClass(size_t bytes) {
+  if (bytes == 0) {
+    return 0;
+  }
+  if (bytes <= kPageSize) {
+    return kPageSize;
+  }
+
+  // Largest power of two not above |bytes|; four classes per doubling
+  size_t power = kPageSize;
+  while (power <= bytes / 2) {
+    power <<= 1;
+  }
+  size_t step = std::max(kPageSize, power / 4);
+  size_t capacity = RoundUp(bytes, step);
+
+  // Keep huge-page-backed blocks a whole number of huge pages
+  if (capacity >= kHugePageSize) {
+    capacity = RoundUp(capacity, kHugePageSize);
+  }
+  return capacity;
+}
+
+BufferPool::Block BufferPool::Acquire(size_t bytes) {
+  Block block;
+  size_t capacity = SizeClass(bytes);
+  if (capacity == 0) {
+    return block;
+  }
+
+  Allocation allocation;
+  if (cache_->Take(capacity, &allocation)) {
+    block.zeroed_ = false;
+  } else {
+    allocation = AllocateFromSystem(capacity, cache_->use_huge_pages());
+    if (!allocation.data) {
+      return block;
+    }
+    cache_->Track(capacity);
+    block.zeroed_ = allocation.mapped;
+  }
+
+  block.cache_ = cache_;
+  block.data_ = allocation.data;
+  block.capacity_ = allocation.capacity;
+  block.mapped_ = allocation.mapped;
+  return block;
+}
+
+void BufferPool::Trim() {
+  cache_->Trim();
+}
+
+BufferPool::Stats BufferPool::GetStats() const {
+  return cache_->GetStats();
+}
+
+}  // namespace rendering
+}  // namespace athena
@@ -0,0 +1,114 @@
+#ifndef ATHENA_RENDERING_BUFFER_POOL_H_
+#define ATHENA_RENDERING_BUFFER_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace athena {
+namespace rendering {
+
+// BufferPool recycles large pixel allocations.
+//
+// Window resizes and tab switches allocate and free frame-sized buffers in
+// quick succession. Going to the system allocator each time means fresh
+// mmaps and page faults on every resize step; the pool instead keeps released
+// blocks around and hands them back out for requests of the same size class.
+//
+// Size classes step four times per power of two, so a block is reused for
+// any request within ~20% of its size. Blocks are 64-byte aligned; blocks of
+// at least kHugePageSize are mapped directly and advised for transparent huge
+// pages on Linux. Cached blocks beyond max_cached_bytes are freed, oldest
+// first.
+//
+// Blocks return to the pool when destroyed and may outlive the BufferPool
+// object itself. All methods are thread-safe.
+class BufferPool {
+ public:
+  static constexpr size_t kAlignment = 64;
+  static constexpr size_t kPageSize = 4096;
+  static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+  // Enough for a few 4K frames (~32 MB each) in flight during a resize
+  static constexpr size_t kDefaultMaxCachedBytes = 128 * 1024 * 1024;
+
+  struct Options {
+    size_t max_cached_bytes = kDefaultMaxCachedBytes;
+    bool use_huge_pages = true;  // Only honored on Linux
+  };
+
+  struct Stats {
+    uint64_t hits = 0;         // Acquires served from the cache
+    uint64_t misses = 0;       // Acquires that went to the system allocator
+    uint64_t evictions = 0;    // Released blocks freed to stay under the limit
+    size_t cached_blocks = 0;  // Blocks waiting for reuse
+    size_t cached_bytes = 0;
+    size_t in_use_bytes = 0;  // Capacity of blocks currently handed out
+  };
+
+  class Cache;
+
+  // Block is a move-only handle to pooled memory.
+  class Block {
+   public:
+    Block() = default;
+    ~Block();
+
+    Block(Block&& other) noexcept;
+    Block& operator=(Block&& other) noexcept;
+    Block(const Block&) = delete;
+    Block& operator=(const Block&) = delete;
+
+    uint8_t* data() const { return data_; }
+    size_t capacity() const { return capacity_; }
+
+    // True if the memory came straight from the system and is still
+    // zero-filled (callers can then skip clearing it).
+    bool IsZeroed() const { return zeroed_; }
+
+    explicit operator bool() const { return data_ != nullptr; }
+
+    // Return the memory to the pool early.
+    void Reset();
+
+   private:
+    friend class BufferPool;
+
+    std::shared_ptr<Cache> cache_;
+    uint8_t* data_ = nullptr;
+    size_t capacity_ = 0;
+    bool mapped_ = false;
+    bool zeroed_ = false;
+  };
+
+  BufferPool();
+  explicit BufferPool(const Options& options);
+  ~BufferPool();
+
+  BufferPool(const BufferPool&) = delete;
+  BufferPool& operator=(const BufferPool&) = delete;
+
+  // Process-wide pool shared by all tabs.
+  static BufferPool& Shared();
+
+  // Get a block of at least |bytes| bytes. Contents are unspecified unless
+  // the block reports IsZeroed(). Returns an empty block if |bytes| is zero
+  // or the allocation fails.
+  Block Acquire(size_t bytes);
+
+  // Free every cached block (blocks in use are unaffected).
+  void Trim();
+
+  Stats GetStats() const;
+
+  // Capacity actually allocated for a request of |bytes|.
+  static size_t SizeClass(size_t bytes);
+
+ private:
+  std::shared_ptr<Cache> cache_;
+};
+
+}  // namespace rendering
+}  // namespace athena
+
+#endif  // ATHENA_RENDERING_BUFFER_POOL_H_
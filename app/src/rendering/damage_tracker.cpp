@@ -0,0 +1,95 @@
+#include "rendering/damage_tracker.h"
+
+#include <atomic>
+
+namespace athena {
+namespace rendering {
+
+uint64_t DamageTracker::NextToken() {
+  // Shared across trackers so tokens from different tabs never collide
+  static std::atomic<uint64_t> next_token{1};
+  return next_token.fetch_add(1, std::memory_order_relaxed);
+}
+
+void DamageTracker::AddDamage(const core::Size& frame_size,
+                              const std::vector<core::Rect>& dirty_rects) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (frame_size != frame_size_) {
+    // Resized frames invalidate everything captured so far
+    frame_size_ = frame_size;
+    full_damage_ = true;
+    damage_.Clear();
+    return;
+  }
+
+  if (full_damage_) {
+    return;
+  }
+
+  const core::Rect frame_rect(0, 0, frame_size.width, frame_size.height);
+
+  // An empty list from CEF means the whole view was repainted
+  if (dirty_rects.empty()) {
+    damage_ = core::Region(frame_rect);
+    return;
+  }
+
+  damage_.UnionWith(core::Region::FromRects(dirty_rects).Intersect(frame_rect));
+}
+
+void DamageTracker::InvalidateAll() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  full_damage_ = true;
+  damage_.Clear();
+}
+
+DamageTracker::Capture DamageTracker::Consume(std::optional<uint64_t> since_token) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  Capture capture;
+  capture.frame_size = frame_size_;
+
+  const core::Rect frame_rect(0, 0, frame_size_.width, frame_size_.height);
+  const bool token_matches = since_token.has_value() && token_ != kInvalidToken &&
+                             *since_token == token_;
+
+  if (token_matches && !full_damage_ && damage_.IsEmpty()) {
+    capture.changed = false;
+    capture.full_frame = false;
+    capture.token = token_;
+    return capture;
+  }
+
+  capture.changed = true;
+  if (token_matches && !full_damage_) {
+    capture.region = damage_;
+    capture.bounds = damage_.Bounds();
+    capture.full_frame = damage_.Contains(frame_rect);
+  } else {
+    capture.region = core::Region(frame_rect);
+    capture.bounds = frame_rect;
+    capture.full_frame = true;
+  }
+
+  // Start accumulating afresh for the next capture
+  token_ = NextToken();
+  full_damage_ = false;
+  damage_.Clear();
+
+  capture.token = token_;
+  return capture;
+}
+
+uint64_t DamageTracker::CurrentToken() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return token_;
+}
+
+bool DamageTracker::HasDamage() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return full_damage_ || !damage_.IsEmpty();
+}
+
+}  // namespace rendering
+}  // namespace athena
@@ -0,0 +1,85 @@
+#ifndef ATHENA_RENDERING_DAMAGE_TRACKER_H_
+#define ATHENA_RENDERING_DAMAGE_TRACKER_H_
+
+#include "core/types.h"
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+namespace athena {
+namespace rendering {
+
+// DamageTracker accumulates the regions CEF repainted since the last capture.
+//
+// Every capture (screenshot) consumes the accumulated damage and hands out a
+// change token. A later capture that presents the same token learns whether
+// anything was painted in between and, if so, the bounding box of the change.
+// Tokens are unique across all trackers, so a token issued for one tab never
+// matches another tab's state.
+//
+// Coordinates are physical pixels of the view buffer (same as CEF dirty rects).
+//
+// Thread safety: all methods are safe to call from any thread.
+class DamageTracker {
+ public:
+  // Token value that never matches a capture (no capture taken yet).
+  static constexpr uint64_t kInvalidToken = 0;
+
+  // Result of consuming the accumulated damage.
+  struct Capture {
+    bool changed = true;             // False if nothing was painted since the token
+    bool full_frame = true;          // True if the whole frame must be captured
+    core::Rect bounds;               // Damage bounding box (whole frame if full_frame)
+    core::Region region;             // Exact damaged pixels (whole frame if full_frame)
+    core::Size frame_size;           // Frame size the damage refers to
+    uint64_t token = kInvalidToken;  // Token identifying this capture
+  };
+
+  DamageTracker() = default;
+  ~DamageTracker() = default;
+
+  // Non-copyable, non-movable (owns a mutex)
+  DamageTracker(const DamageTracker&) = delete;
+  DamageTracker& operator=(const DamageTracker&) = delete;
+
+  // Record rectangles repainted in a frame of the given size.
+  // A frame size change invalidates the whole frame.
+  void AddDamage(const core::Size& frame_size, const std::vector<core::Rect>& dirty_rects);
+
+  // Mark the whole frame as changed (popups, resizes, renderer swaps).
+  void InvalidateAll();
+
+  // Consume the accumulated damage.
+  //
+  // since_token: token from a previous capture. If it matches the current
+  //   token and nothing was painted since, returns changed=false and keeps the
+  //   token. If it matches and something was painted, returns the damaged
+  //   region and its bounding box. A missing or stale token yields a
+  //   full-frame capture.
+  //
+  // Every capture that reports changed=true resets the damage and issues a
+  // new token.
+  Capture Consume(std::optional<uint64_t> since_token);
+
+  // Token of the most recent capture (kInvalidToken if never captured).
+  uint64_t CurrentToken() const;
+
+  // Check whether anything was painted since the last capture.
+  bool HasDamage() const;
+
+ private:
+  static uint64_t NextToken();
+
+  mutable std::mutex mutex_;
+  core::Size frame_size_;
+  core::Region damage_;
+  bool full_damage_ = true;
+  uint64_t token_ = kInvalidToken;
+};
+
+}  // namespace rendering
+}  // namespace athena
+
+#endif  // ATHENA_RENDERING_DAMAGE_TRACKER_H_
@@ -5,10 +5,14 @@
 
 #include "include/base/cef_logging.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
 #include <GL/gl.h>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <vector>
 
 // Platform-specific includes
 #include <QBuffer>
@@ -142,6 +146,10 @@ void GLRenderer::OnPaint(CefRefPtr<CefBrowser> browser,
     return;
   }
 
+  utils::TraceSpan span("render", "TextureUpload");
+  span.AddArg("width", static_cast<int64_t>(width));
+  span.AddArg("height", static_cast<int64_t>(height));
+
   ScopedGLContext context(gl_widget_);
   if (!context.IsValid()) {
     logger.Warn("Unable to make GL context current during OnPaint");
@@ -152,19 +160,42 @@ void GLRenderer::OnPaint(CefRefPtr<CefBrowser> browser,
   // CEF's OsrRenderer automatically uses dirty_rects to optimize texture updates:
   // - Full update (glTexImage2D): When size changes or full-screen dirty rect
   // - Partial update (glTexSubImage2D): Only updates changed regions (~2x FPS improvement)
-  // This provides significant performance gains by avoiding unnecessary texture uploads.
-  if (logger.IsDebugEnabled() && !dirty_rects.empty()) {
-    bool is_full_update =
-        (dirty_rects.size() == 1 && dirty_rects[0] == CefRect(0, 0, width, height));
+  // CEF may report overlapping or out-of-bounds rects, so coalesce them into a
+  // disjoint, clipped region first; no pixel is uploaded twice.
+  const core::Rect frame(0, 0, width, height);
+  CefRenderHandler::RectList upload_rects;
+  if (!dirty_rects.empty()) {
+    std::vector<core::Rect> rects;
+    rects.reserve(dirty_rects.size());
+    for (const auto& rect : dirty_rects) {
+      rects.emplace_back(rect.x, rect.y, rect.width, rect.height);
+    }
+
+    // An empty result still goes through: OsrRenderer re-uploads on resize
+    core::Region damage = core::Region::FromRects(rects).Intersect(frame);
+    if (damage.Contains(frame)) {
+      upload_rects.push_back(ToCefRect(frame));
+    } else {
+      upload_rects.reserve(damage.Rects().size());
+      for (const auto& rect : damage.Rects()) {
+        upload_rects.push_back(ToCefRect(rect));
+      }
+    }
+  }
+
+  if (logger.IsDebugEnabled() && !upload_rects.empty()) {
+    bool is_full_update = (upload_rects.size() == 1 && upload_rects[0] == ToCefRect(frame));
     if (is_full_update) {
       logger.Debug("OnPaint: Full texture update ({}x{})", width, height);
     } else {
-      logger.Debug("OnPaint: Partial update ({} dirty rects)", dirty_rects.size());
+      logger.Debug("OnPaint: Partial update ({} dirty rects coalesced into {})",
+                   dirty_rects.size(),
+                   upload_rects.size());
     }
   }
 
   // Forward to CEF's OsrRenderer which will update the GL texture
-  osr_renderer_->OnPaint(browser, type, dirty_rects, buffer, width, height);
+  osr_renderer_->OnPaint(browser, type, upload_rects, buffer, width, height);
 }
 
 void GLRenderer::OnPopupShow(CefRefPtr<CefBrowser> browser, bool show) {
@@ -196,6 +227,8 @@ utils::Result<void> GLRenderer::Render() {
   // The GL context is automatically current when this is called
   // Qt: from QOpenGLWidget::paintGL()
 
+  ATHENA_TRACE_SCOPE("render", "Render");
+
   // Let CEF's renderer do the actual OpenGL rendering
   osr_renderer_->Render();
 
@@ -238,15 +271,12 @@ CefRect GLRenderer::ToCefRect(const core::Rect& rect) {
   return CefRect(rect.x, rect.y, rect.width, rect.height);
 }
 
-std::string GLRenderer::TakeScreenshot() const {
+std::string GLRenderer::TakeScreenshot(const core::Rect* region) const {
   if (!initialized_ || !osr_renderer_ || !gl_widget_) {
     logger.Warn("Cannot take screenshot - renderer not initialized");
     return "";
   }
 
-  // Fixed scale for optimal AI analysis (50% of original resolution)
-  const float scale = 0.5f;
-
   // Make GL context current
   ScopedGLContext context(gl_widget_);
   if (!context.IsValid()) {
@@ -254,33 +284,105 @@ std::string GLRenderer::TakeScreenshot() const {
     return "";
   }
 
-  int width = GetViewWidth();
-  int height = GetViewHeight();
+  const int view_width = GetViewWidth();
+  const int view_height = GetViewHeight();
 
-  if (width <= 0 || height <= 0) {
+  if (view_width <= 0 || view_height <= 0) {
     logger.Warn("Invalid view size for screenshot");
     return "";
   }
 
-  // Read pixels from the framebuffer
-  std::vector<unsigned char> pixels(width * height * 4);  // RGBA
-  glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+  // Resolve the capture rectangle (top-left origin)
+  core::Rect capture(0, 0, view_width, view_height);
+  if (region) {
+    capture = region->Intersection(capture);
+    if (capture.IsEmpty()) {
+      logger.Warn("Screenshot region {} lies outside the view", region->ToString());
+      return "";
+    }
+  }
+
+  ATHENA_TRACE_SCOPE("render", "Screenshot");
+
+  std::vector<uint8_t> pixels;
+  if (!ReadFramebuffer(capture, view_height, &pixels)) {
+    return "";
+  }
+
+  // Fixed scale for optimal AI analysis (50% of original resolution)
+  return EncodePng(pixels.data(), capture.GetSize(), kScreenshotScale);
+}
+
+bool GLRenderer::CaptureViewPixels(std::vector<uint8_t>* rgba, core::Size* size) {
+  if (!initialized_ || !osr_renderer_ || !gl_widget_ || !rgba || !size) {
+    logger.Warn("Cannot capture view pixels - renderer not initialized");
+    return false;
+  }
+
+  ScopedGLContext context(gl_widget_);
+  if (!context.IsValid()) {
+    logger.Warn("Unable to make GL context current for capture");
+    return false;
+  }
+
+  const int view_width = GetViewWidth();
+  const int view_height = GetViewHeight();
+  if (view_width <= 0 || view_height <= 0) {
+    logger.Warn("Invalid view size for capture");
+    return false;
+  }
+
+  // Draw the latest CEF texture so the capture does not wait for the next paintGL()
+  osr_renderer_->Render();
+
+  if (!ReadFramebuffer(core::Rect(0, 0, view_width, view_height), view_height, rgba)) {
+    return false;
+  }
+
+  *size = core::Size(view_width, view_height);
+  return true;
+}
+
+bool GLRenderer::ReadFramebuffer(const core::Rect& rect,
+                                 int view_height,
+                                 std::vector<uint8_t>* rgba) {
+  const int width = rect.width;
+  const int height = rect.height;
+  const size_t row_bytes = static_cast<size_t>(width) * 4;
+
+  // Read pixels from the framebuffer (OpenGL uses a bottom-left origin)
+  std::vector<uint8_t> pixels(row_bytes * height);  // RGBA
+  glReadPixels(
+      rect.x, view_height - rect.Bottom(), width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
 
   // Check for GL errors
   GLenum gl_error = glGetError();
   if (gl_error != GL_NO_ERROR) {
     logger.Error("OpenGL error during screenshot: {}", gl_error);
-    return "";
+    return false;
   }
 
   // Flip image vertically (OpenGL bottom-left origin -> PNG top-left origin)
-  std::vector<unsigned char> flipped(width * height * 4);
+  rgba->resize(row_bytes * height);
   for (int y = 0; y < height; y++) {
-    memcpy(&flipped[y * width * 4], &pixels[(height - 1 - y) * width * 4], width * 4);
+    memcpy(rgba->data() + y * row_bytes, pixels.data() + (height - 1 - y) * row_bytes, row_bytes);
   }
 
+  return true;
+}
+
+std::string GLRenderer::EncodePng(const uint8_t* rgba, const core::Size& size, float scale) {
+  if (!rgba || size.IsEmpty()) {
+    return "";
+  }
+
+  const int width = size.width;
+  const int height = size.height;
+
+  ATHENA_TRACE_SCOPE("render", "EncodePng");
+
   // Use Qt to encode as PNG and convert to base64
-  QImage image(flipped.data(), width, height, width * 4, QImage::Format_RGBA8888);
+  QImage image(rgba, width, height, width * 4, QImage::Format_RGBA8888);
 
   // Scale down the image if requested (scale < 1.0)
   if (scale < 1.0f) {
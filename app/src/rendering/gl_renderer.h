@@ -11,7 +11,9 @@
 #include "tests/cefclient/browser/osr_renderer_settings.h"
 #include "utils/error.h"
 
+#include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 // Platform-specific: Qt doesn't need forward declarations (widget passed as void*)
@@ -115,13 +117,35 @@ class GLRenderer {
   // Capture the current framebuffer as a PNG image.
   // Returns base64-encoded PNG data, or empty string on failure.
   // Screenshots are automatically scaled to 50% resolution for optimal AI analysis.
+  // @param region Optional sub-rectangle to capture (physical pixels, top-left
+  //               origin). Clipped to the view; nullptr captures the whole view.
   // @return Base64-encoded PNG image data
-  std::string TakeScreenshot() const;
+  std::string TakeScreenshot(const core::Rect* region = nullptr) const;
+
+  // Draw the latest CEF frame and read back the whole view.
+  // Unlike TakeScreenshot(), this does not depend on Qt having repainted the
+  // widget since the last OnPaint, which makes it suitable for capturing
+  // several frames in a row (e.g. full-page tiling).
+  // @param rgba Receives top-down RGBA pixels (4 bytes per pixel, no padding)
+  // @param size Receives the view size in physical pixels
+  // @return true on success
+  bool CaptureViewPixels(std::vector<uint8_t>* rgba, core::Size* size);
+
+  // Encode top-down RGBA pixels as a base64 PNG, optionally scaling down first.
+  // @return Base64-encoded PNG image data, or empty string on failure
+  static std::string EncodePng(const uint8_t* rgba, const core::Size& size, float scale = 1.0f);
+
+  // Scale applied to screenshots (50% of the physical resolution)
+  static constexpr float kScreenshotScale = 0.5f;
 
  private:
   // Convert core::Rect to CefRect
   static CefRect ToCefRect(const core::Rect& rect);
 
+  // Read a region of the current framebuffer as top-down RGBA.
+  // Requires the GL context to be current. |rect| uses a top-left origin.
+  static bool ReadFramebuffer(const core::Rect& rect, int view_height, std::vector<uint8_t>* rgba);
+
   // The GL widget we're rendering to (QOpenGLWidget* stored as void*)
   void* gl_widget_;
 
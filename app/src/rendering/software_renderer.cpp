@@ -0,0 +1,143 @@
+#include "rendering/software_renderer.h"
+
+#include <cmath>
+
+namespace athena {
+namespace rendering {
+
+namespace {
+
+// Copy |rect| of the BGRA buffer |src|, whose top-left pixel sits at
+// |src_origin|, into the top-down RGBA image covering |dest_bounds|.
+void CopyBgraToRgba(const BufferManager::Buffer& src,
+                    const core::Rect& rect,
+                    const core::Point& src_origin,
+                    const core::Rect& dest_bounds,
+                    uint8_t* dest) {
+  const size_t dest_stride = static_cast<size_t>(dest_bounds.width) * 4;
+  for (int y = rect.y; y < rect.Bottom(); ++y) {
+    const uint8_t* in = src.GetData() + static_cast<size_t>(y - src_origin.y) * src.stride +
+                        static_cast<size_t>(rect.x - src_origin.x) * 4;
+    uint8_t* out = dest + static_cast<size_t>(y - dest_bounds.y) * dest_stride +
+                   static_cast<size_t>(rect.x - dest_bounds.x) * 4;
+    for (int x = 0; x < rect.width; ++x) {
+      out[0] = in[2];
+      out[1] = in[1];
+      out[2] = in[0];
+      out[3] = in[3];
+      in += 4;
+      out += 4;
+    }
+  }
+}
+
+}  // namespace
+
+utils::Result<void> SoftwareRenderer::OnPaint(Layer layer,
+                                              const std::vector<core::Rect>& dirty_rects,
+                                              const void* bgra,
+                                              const core::Size& size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return StoreFrame(layer == Layer::kView ? view_ : popup_, dirty_rects, bgra, size);
+}
+
+utils::Result<void> SoftwareRenderer::StoreFrame(BufferPtr& layer,
+                                                 const std::vector<core::Rect>& dirty_rects,
+                                                 const void* bgra,
+                                                 const core::Size& size) {
+  if (!bgra) {
+    return utils::Error("Source buffer is null");
+  }
+
+  if (!layer || layer->physical_size != size) {
+    // Every row is overwritten by the full copy below
+    auto allocated = buffers_.AllocateBuffer(size, BufferManager::BufferInit::kUninitialized);
+    if (!allocated) {
+      layer.reset();
+      return utils::Error(allocated.GetError().Message());
+    }
+    layer = std::move(allocated.Value());
+    return buffers_.CopyFromCEF(*layer, bgra, size);
+  }
+
+  return buffers_.CopyFromCEFDirty(*layer, bgra, size, dirty_rects);
+}
+
+void SoftwareRenderer::SetPopupVisible(bool visible) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  popup_visible_ = visible;
+  if (!visible) {
+    popup_.reset();
+    popup_rect_ = core::Rect();
+  }
+}
+
+void SoftwareRenderer::SetPopupRect(const core::Rect& rect) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  popup_rect_ = rect;
+}
+
+void SoftwareRenderer::SetDeviceScaleFactor(float scale_factor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  scale_factor_ = scale_factor > 0.0f ? scale_factor : 1.0f;
+}
+
+core::Rect SoftwareRenderer::PopupBounds() const {
+  if (!popup_visible_ || !popup_ || !popup_->IsValid()) {
+    return core::Rect();
+  }
+  int x = static_cast<int>(std::lround(popup_rect_.x * scale_factor_));
+  int y = static_cast<int>(std::lround(popup_rect_.y * scale_factor_));
+  return core::Rect(core::Point(x, y), popup_->physical_size);
+}
+
+bool SoftwareRenderer::CaptureViewPixels(std::vector<uint8_t>* rgba,
+                                         core::Size* size,
+                                         const core::Rect* region) const {
+  if (!rgba || !size) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!view_ || !view_->IsValid()) {
+    return false;
+  }
+
+  const core::Rect view_bounds(core::Point(0, 0), view_->physical_size);
+  core::Rect capture = region ? region->Intersection(view_bounds) : view_bounds;
+  if (capture.IsEmpty()) {
+    return false;
+  }
+
+  rgba->resize(static_cast<size_t>(capture.width) * capture.height * 4);
+  CopyBgraToRgba(*view_, capture, core::Point(0, 0), capture, rgba->data());
+
+  core::Rect popup_bounds = PopupBounds();
+  core::Rect popup_area = popup_bounds.Intersection(capture);
+  if (!popup_area.IsEmpty()) {
+    CopyBgraToRgba(*popup_, popup_area, popup_bounds.Origin(), capture, rgba->data());
+  }
+
+  *size = capture.GetSize();
+  return true;
+}
+
+core::Size SoftwareRenderer::GetViewSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return view_ ? view_->physical_size : core::Size();
+}
+
+size_t SoftwareRenderer::GetMemoryUsage() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t bytes = 0;
+  if (view_) {
+    bytes += view_->memory.capacity();
+  }
+  if (popup_) {
+    bytes += popup_->memory.capacity();
+  }
+  return bytes;
+}
+
+}  // namespace rendering
+}  // namespace athena
@@ -0,0 +1,99 @@
+#ifndef ATHENA_RENDERING_SOFTWARE_RENDERER_H_
+#define ATHENA_RENDERING_SOFTWARE_RENDERER_H_
+
+#include "core/types.h"
+#include "rendering/buffer_manager.h"
+#include "utils/error.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace athena {
+namespace rendering {
+
+// SoftwareRenderer keeps the latest CEF frame in CPU memory.
+//
+// Headless tabs have no GL context to upload frames into, so the BGRA pixels
+// CEF hands to OnPaint are copied into pooled BufferManager buffers instead.
+// Once a frame size is established only the dirty rects are copied. Popup
+// widgets (e.g. <select> dropdowns) are kept in a second buffer and
+// composited over the view when pixels are read back, the same way the GL
+// renderer draws them.
+//
+// Coordinates are physical pixels except the popup rect, which CEF reports in
+// view (logical) coordinates.
+//
+// Thread safety: all methods are safe to call from any thread.
+class SoftwareRenderer {
+ public:
+  // Which CEF paint element a frame belongs to
+  enum class Layer {
+    kView,
+    kPopup,
+  };
+
+  SoftwareRenderer() = default;
+  explicit SoftwareRenderer(BufferPool& pool) : buffers_(pool) {}
+  ~SoftwareRenderer() = default;
+
+  // Non-copyable, non-movable (owns a mutex)
+  SoftwareRenderer(const SoftwareRenderer&) = delete;
+  SoftwareRenderer& operator=(const SoftwareRenderer&) = delete;
+
+  // Store a frame painted by CEF (top-down BGRA, width * 4 bytes per row).
+  // A size change reallocates the layer and copies the whole frame.
+  utils::Result<void> OnPaint(Layer layer,
+                              const std::vector<core::Rect>& dirty_rects,
+                              const void* bgra,
+                              const core::Size& size);
+
+  // Show or hide the popup layer. Hiding drops the popup frame.
+  void SetPopupVisible(bool visible);
+
+  // Position of the popup in view (logical) coordinates.
+  void SetPopupRect(const core::Rect& rect);
+
+  // Scale between view coordinates and physical pixels (maps the popup rect).
+  void SetDeviceScaleFactor(float scale_factor);
+
+  // Read the view, with any visible popup composited over it.
+  // @param rgba Receives top-down RGBA pixels (4 bytes per pixel, no padding)
+  // @param size Receives the size of the captured area
+  // @param region Optional sub-rectangle to capture; nullptr for the whole view
+  // @return false if no frame has been painted or the region misses the view
+  bool CaptureViewPixels(std::vector<uint8_t>* rgba,
+                         core::Size* size,
+                         const core::Rect* region = nullptr) const;
+
+  // Size of the last view frame (empty before the first paint).
+  core::Size GetViewSize() const;
+
+  // Bytes held by the view and popup buffers.
+  size_t GetMemoryUsage() const;
+
+ private:
+  using BufferPtr = std::unique_ptr<BufferManager::Buffer>;
+
+  utils::Result<void> StoreFrame(BufferPtr& layer,
+                                 const std::vector<core::Rect>& dirty_rects,
+                                 const void* bgra,
+                                 const core::Size& size);
+
+  // Popup position in physical pixels
+  core::Rect PopupBounds() const;
+
+  mutable std::mutex mutex_;
+  BufferManager buffers_;
+  BufferPtr view_;
+  BufferPtr popup_;
+  bool popup_visible_ = false;
+  core::Rect popup_rect_;
+  float scale_factor_ = 1.0f;
+};
+
+}  // namespace rendering
+}  // namespace athena
+
+#endif  // ATHENA_RENDERING_SOFTWARE_RENDERER_H_
@@ -0,0 +1,162 @@
+#include "rendering/tile_stitcher.h"
+
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <string>
+
+namespace athena {
+namespace rendering {
+
+core::Size TileStitcher::ScaledSize(const core::Size& page_size, float scale) {
+  int width = static_cast<int>(std::floor(page_size.width * static_cast<double>(scale)));
+  int height = static_cast<int>(std::floor(page_size.height * static_cast<double>(scale)));
+  return core::Size(std::max(1, width), std::max(1, height));
+}
+
+utils::Result<void> TileStitcher::Begin(const core::Size& page_size,
+                                        float scale,
+                                        size_t max_output_bytes) {
+  if (page_size.IsEmpty()) {
+    return utils::Error("Invalid page size: " + page_size.ToString());
+  }
+
+  if (!(scale > 0.0f && scale <= 1.0f)) {
+    return utils::Error("Invalid stitch scale: " + std::to_string(scale));
+  }
+
+  core::Size output_size = ScaledSize(page_size, scale);
+  size_t output_bytes = static_cast<size_t>(output_size.width) * output_size.height * 4;
+  if (output_bytes > max_output_bytes) {
+    return utils::Error("Full page image too large: " + output_size.ToString());
+  }
+
+  page_size_ = page_size;
+  output_size_ = output_size;
+  scale_ = scale;
+  next_output_row_ = 0;
+
+  column_begin_.resize(output_size_.width);
+  column_end_.resize(output_size_.width);
+  for (int x = 0; x < output_size_.width; x++) {
+    SourceSpan(x, page_size_.width, &column_begin_[x], &column_end_[x]);
+  }
+
+  try {
+    pixels_.assign(output_bytes, 0);
+  } catch (const std::bad_alloc&) {
+    return utils::Error("Failed to allocate full page image: out of memory");
+  }
+
+  return utils::Ok();
+}
+
+void TileStitcher::SourceSpan(int i, int source_extent, int* begin, int* end) const {
+  int b = static_cast<int>(std::floor(i / static_cast<double>(scale_)));
+  int e = static_cast<int>(std::floor((i + 1) / static_cast<double>(scale_)));
+  b = std::min(b, source_extent - 1);
+  e = std::min(std::max(e, b + 1), source_extent);
+  *begin = b;
+  *end = e;
+}
+
+int TileStitcher::NextPageRow() const {
+  if (IsComplete()) {
+    return page_size_.height;
+  }
+  int begin = 0;
+  int end = 0;
+  SourceSpan(next_output_row_, page_size_.height, &begin, &end);
+  return begin;
+}
+
+utils::Result<void> TileStitcher::AddTile(const uint8_t* rgba,
+                                          const core::Size& tile_size,
+                                          int page_y) {
+  if (pixels_.empty()) {
+    return utils::Error("TileStitcher::Begin has not been called");
+  }
+
+  if (!rgba || tile_size.IsEmpty()) {
+    return utils::Error("Invalid tile");
+  }
+
+  if (tile_size.width != page_size_.width) {
+    return utils::Error("Tile width " + std::to_string(tile_size.width) +
+                        " does not match page width " + std::to_string(page_size_.width));
+  }
+
+  if (page_y < 0 || page_y >= page_size_.height) {
+    return utils::Error("Tile offset out of range: " + std::to_string(page_y));
+  }
+
+  if (IsComplete()) {
+    return utils::Ok();
+  }
+
+  if (page_y > NextPageRow()) {
+    return utils::Error("Tile at " + std::to_string(page_y) + " leaves a gap (expected <= " +
+                        std::to_string(NextPageRow()) + ")");
+  }
+
+  // Rows past the bottom of the page are ignored
+  const int tile_end = std::min(page_y + tile_size.height, page_size_.height);
+  const size_t tile_stride = static_cast<size_t>(tile_size.width) * 4;
+  const size_t output_stride = static_cast<size_t>(output_size_.width) * 4;
+
+  std::vector<uint32_t> sums(output_size_.width * 4);
+
+  while (next_output_row_ < output_size_.height) {
+    int row_begin = 0;
+    int row_end = 0;
+    SourceSpan(next_output_row_, page_size_.height, &row_begin, &row_end);
+    if (row_begin >= tile_end) {
+      break;  // Belongs to the next tile
+    }
+
+    // Rows straddling the tile boundary are filtered from what this tile holds
+    row_end = std::min(row_end, tile_end);
+
+    std::fill(sums.begin(), sums.end(), 0);
+    for (int sy = row_begin; sy < row_end; sy++) {
+      const uint8_t* src_row = rgba + (sy - page_y) * tile_stride;
+      for (int x = 0; x < output_size_.width; x++) {
+        uint32_t* sum = &sums[x * 4];
+        for (int sx = column_begin_[x]; sx < column_end_[x]; sx++) {
+          const uint8_t* px = src_row + sx * 4;
+          sum[0] += px[0];
+          sum[1] += px[1];
+          sum[2] += px[2];
+          sum[3] += px[3];
+        }
+      }
+    }
+
+    uint8_t* dst_row = pixels_.data() + next_output_row_ * output_stride;
+    const int rows = row_end - row_begin;
+    for (int x = 0; x < output_size_.width; x++) {
+      const uint32_t count = static_cast<uint32_t>(rows * (column_end_[x] - column_begin_[x]));
+      const uint32_t* sum = &sums[x * 4];
+      uint8_t* dst = dst_row + x * 4;
+      for (int c = 0; c < 4; c++) {
+        dst[c] = static_cast<uint8_t>((sum[c] + count / 2) / count);
+      }
+    }
+
+    next_output_row_++;
+  }
+
+  return utils::Ok();
+}
+
+std::vector<uint8_t> TileStitcher::TakePixels() {
+  std::vector<uint8_t> pixels = std::move(pixels_);
+  pixels_.clear();
+  page_size_ = core::Size();
+  output_size_ = core::Size();
+  next_output_row_ = 0;
+  return pixels;
+}
+
+}  // namespace rendering
+}  // namespace athena
@@ -0,0 +1,89 @@
+#ifndef ATHENA_RENDERING_TILE_STITCHER_H_
+#define ATHENA_RENDERING_TILE_STITCHER_H_
+
+#include "core/types.h"
+#include "utils/error.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace athena {
+namespace rendering {
+
+// TileStitcher assembles a full-page screenshot from viewport-sized tiles.
+//
+// Each tile is box-filtered down to the output scale as soon as it arrives,
+// so only the scaled page image is ever held in memory; the full-resolution
+// page bitmap is never materialized.
+//
+// Tiles must be added top to bottom. Consecutive tiles may overlap (the last
+// tile of a page usually does, because scrolling clamps at the bottom);
+// overlapping rows are taken from the earlier tile.
+//
+// Pixels are tightly packed top-down RGBA (4 bytes per pixel).
+//
+// Usage:
+//   TileStitcher stitcher;
+//   stitcher.Begin(page_size, 0.5f);
+//   for each scroll offset y:
+//     stitcher.AddTile(pixels, tile_size, y);
+//   if (stitcher.IsComplete()) encode(stitcher.Pixels(), stitcher.OutputSize());
+class TileStitcher {
+ public:
+  TileStitcher() = default;
+
+  // Move-only (owns the output image)
+  TileStitcher(TileStitcher&&) = default;
+  TileStitcher& operator=(TileStitcher&&) = default;
+  TileStitcher(const TileStitcher&) = delete;
+  TileStitcher& operator=(const TileStitcher&) = delete;
+
+  // Compute the scaled output size for a page (at least 1x1).
+  static core::Size ScaledSize(const core::Size& page_size, float scale);
+
+  // Start a new page.
+  // page_size: full page size in physical pixels
+  // scale: output scale in (0, 1]
+  // max_output_bytes: refuse pages whose scaled image would exceed this size
+  utils::Result<void> Begin(const core::Size& page_size,
+                            float scale,
+                            size_t max_output_bytes = kDefaultMaxOutputBytes);
+
+  // Add a tile captured at vertical page offset page_y (physical pixels).
+  // The tile width must match the page width.
+  // Returns Error if the tile leaves a gap or does not fit the page.
+  utils::Result<void> AddTile(const uint8_t* rgba, const core::Size& tile_size, int page_y);
+
+  // Page row the next tile must start at (or before) to avoid a gap.
+  int NextPageRow() const;
+
+  // Check whether every output row has been written.
+  bool IsComplete() const { return next_output_row_ >= output_size_.height; }
+
+  core::Size PageSize() const { return page_size_; }
+  core::Size OutputSize() const { return output_size_; }
+  const std::vector<uint8_t>& Pixels() const { return pixels_; }
+
+  // Release the output image (leaves the stitcher empty).
+  std::vector<uint8_t> TakePixels();
+
+  // 64 MB covers a 16k-row page at 1000px output width
+  static constexpr size_t kDefaultMaxOutputBytes = 64 * 1024 * 1024;
+
+ private:
+  // Source range [begin, end) of page pixels covered by output index i.
+  void SourceSpan(int i, int source_extent, int* begin, int* end) const;
+
+  core::Size page_size_;
+  core::Size output_size_;
+  float scale_ = 1.0f;
+  int next_output_row_ = 0;
+  std::vector<int> column_begin_;  // Source column span per output column
+  std::vector<int> column_end_;
+  std::vector<uint8_t> pixels_;
+};
+
+}  // namespace rendering
+}  // namespace athena
+
+#endif  // ATHENA_RENDERING_TILE_STITCHER_H_
@@ -0,0 +1,86 @@
+#include "resources/file_stream.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace athena {
+namespace resources {
+
+std::shared_ptr<const FileStream> FileStream::Open(const std::string& path) {
+  std::shared_ptr<FileStream> file(new FileStream());
+  struct stat info;
+#ifdef _WIN32
+  if (::stat(path.c_str(), &info) != 0 || (info.st_mode & S_IFMT) != S_IFREG) {
+    return nullptr;
+  }
+  file->stream_.open(path, std::ios::binary);
+  if (!file->stream_) {
+    return nullptr;
+  }
+#else
+  file->fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (file->fd_ < 0) {
+    return nullptr;
+  }
+  // Stat the open descriptor, so size and contents belong to the same file
+  if (::fstat(file->fd_, &info) != 0 || !S_ISREG(info.st_mode)) {
+    return nullptr;
+  }
+#endif
+
+  file->size_ = static_cast<uint64_t>(info.st_size);
+  char etag[48];
+  std::snprintf(etag,
+                sizeof(etag),
+                "\"%llx-%llx\"",
+                static_cast<unsigned long long>(file->size_),
+                static_cast<unsigned long long>(info.st_mtime));
+  file->etag_ = etag;
+  return file;
+}
+
+FileStream::~FileStream() {
+#ifndef _WIN32
+  if (fd_ >= 0) {
+    ::close(fd_);
+  }
+#endif
+}
+
+int64_t FileStream::ReadAt(uint64_t offset, char* buffer, size_t size) const {
+  size_t total = 0;
+#ifdef _WIN32
+  std::lock_guard<std::mutex> lock(mutex_);
+  stream_.clear();
+  stream_.seekg(static_cast<std::streamoff>(offset));
+  stream_.read(buffer, static_cast<std::streamsize>(size));
+  if (stream_.bad()) {
+    return -1;
+  }
+  total = static_cast<size_t>(stream_.gcount());
+#else
+  // pread may return less than asked before the end of the file
+  while (total < size) {
+    ssize_t count = ::pread(fd_, buffer + total, size - total, static_cast<off_t>(offset + total));
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -1;
+    }
+    if (count == 0) {
+      break;
+    }
+    total += static_cast<size_t>(count);
+  }
+#endif
+  return static_cast<int64_t>(total);
+}
+
+}  // namespace resources
+}  // namespace athena
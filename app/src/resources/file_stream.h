@@ -0,0 +1,67 @@
+#ifndef ATHENA_RESOURCES_FILE_STREAM_H_
+#define ATHENA_RESOURCES_FILE_STREAM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#ifdef _WIN32
+#include <fstream>
+#include <mutex>
+#endif
+
+namespace athena {
+namespace resources {
+
+/**
+ * Open file read on demand at explicit offsets, for resources too large to
+ * map and hold for the session (videos, wasm, source maps).
+ *
+ * Size and validator come from a single fstat at open, so response headers
+ * never wait on the contents. Reads are positional (pread) and may run on any
+ * thread, concurrently; the caller bounds each one to its own buffer.
+ */
+class FileStream {
+ public:
+  /**
+   * Open a regular file. Returns nullptr if it cannot be opened or is not a
+   * regular file.
+   */
+  static std::shared_ptr<const FileStream> Open(const std::string& path);
+
+  ~FileStream();
+
+  FileStream(const FileStream&) = delete;
+  FileStream& operator=(const FileStream&) = delete;
+
+  uint64_t Size() const { return size_; }
+
+  /**
+   * Strong validator from size and modification time: "<size>-<mtime>" in hex,
+   * quoted. Changes whenever the file is rebuilt, without hashing it.
+   */
+  const std::string& ETag() const { return etag_; }
+
+  /**
+   * Read up to |size| bytes at |offset|, short only at the end of the file.
+   * @return Bytes read, or -1 on an I/O error
+   */
+  int64_t ReadAt(uint64_t offset, char* buffer, size_t size) const;
+
+ private:
+  FileStream() = default;
+
+  uint64_t size_ = 0;
+  std::string etag_;
+#ifdef _WIN32
+  mutable std::mutex mutex_;  // Guards the shared stream position
+  mutable std::ifstream stream_;
+#else
+  int fd_ = -1;
+#endif
+};
+
+}  // namespace resources
+}  // namespace athena
+
+#endif  // ATHENA_RESOURCES_FILE_STREAM_H_
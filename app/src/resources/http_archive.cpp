@@ -0,0 +1,288 @@
+#include "resources/http_archive.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+namespace athena {
+namespace resources {
+
+namespace {
+
+// "ATHAR" followed by the format version
+constexpr std::string_view kMagic("ATHAR\x01", 6);
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+           return std::tolower(static_cast<unsigned char>(x)) ==
+                  std::tolower(static_cast<unsigned char>(y));
+         });
+}
+
+std::string_view StripFragment(std::string_view url) {
+  return url.substr(0, url.find('#'));
+}
+
+void WriteU32(std::string& out, uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+void WriteString(std::string& out, std::string_view value) {
+  WriteU32(out, static_cast<uint32_t>(value.size()));
+  out.append(value);
+}
+
+// Bounds-checked little-endian reader; any overrun sets failed()
+class Reader {
+ public:
+  explicit Reader(std::string_view data) : data_(data) {}
+
+  uint32_t ReadU32() {
+    if (failed_ || data_.size() < 4) {
+      failed_ = true;
+      return 0;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      value |= static_cast<uint32_t>(static_cast<unsigned char>(data_[i])) << (8 * i);
+    }
+    data_.remove_prefix(4);
+    return value;
+  }
+
+  std::string_view ReadBytes(size_t size) {
+    if (failed_ || data_.size() < size) {
+      failed_ = true;
+      return {};
+    }
+    std::string_view bytes = data_.substr(0, size);
+    data_.remove_prefix(size);
+    return bytes;
+  }
+
+  std::string ReadString() { return std::string(ReadBytes(ReadU32())); }
+
+  bool failed() const { return failed_; }
+  bool AtEnd() const { return data_.empty(); }
+
+ private:
+  std::string_view data_;
+  bool failed_ = false;
+};
+
+}  // namespace
+
+bool HttpArchive::ShouldRecordHeader(std::string_view name) {
+  // Bodies are stored decoded and served in one piece
+  static constexpr std::string_view kTransferHeaders[] = {
+      "content-encoding",
+      "content-length",
+      "transfer-encoding",
+      "connection",
+      "keep-alive",
+      "alt-svc",
+  };
+  for (std::string_view header : kTransferHeaders) {
+    if (EqualsIgnoreCase(name, header)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string HttpArchive::MakeKey(std::string_view method, std::string_view url) {
+  std::string key(method);
+  key.push_back(' ');
+  key.append(StripFragment(url));
+  return key;
+}
+
+std::shared_ptr<const std::string> HttpArchive::InternBody(std::string body) {
+  auto it = bodies_.find(body);
+  if (it != bodies_.end()) {
+    return it->second;
+  }
+  auto shared = std::make_shared<const std::string>(std::move(body));
+  bodies_.emplace(*shared, shared);
+  return shared;
+}
+
+void HttpArchive::Add(std::string_view method,
+                      std::string_view url,
+                      int status,
+                      std::string status_text,
+                      std::string mime_type,
+                      Headers headers,
+                      std::string body) {
+  auto is_transfer_header = [](const auto& header) { return !ShouldRecordHeader(header.first); };
+  headers.erase(std::remove_if(headers.begin(), headers.end(), is_transfer_header), headers.end());
+
+  auto entry = std::make_shared<Entry>();
+  entry->status = status;
+  entry->status_text = std::move(status_text);
+  entry->mime_type = std::move(mime_type);
+  entry->headers = std::move(headers);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  entry->body = InternBody(std::move(body));
+  entries_[MakeKey(method, url)] = std::move(entry);
+  // Bodies no longer referenced by any entry stay until the archive is saved and reloaded
+}
+
+std::shared_ptr<const HttpArchive::Entry> HttpArchive::Find(std::string_view method,
+                                                            std::string_view url) const {
+  const std::string key = MakeKey(method, url);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    return it->second;
+  }
+
+  // Same path: without a query, then with the lowest recorded query
+  const std::string path_key = key.substr(0, key.find('?'));
+  it = entries_.find(path_key);
+  if (it != entries_.end()) {
+    return it->second;
+  }
+  const std::string query_prefix = path_key + "?";
+  it = entries_.lower_bound(query_prefix);
+  if (it != entries_.end() && it->first.compare(0, query_prefix.size(), query_prefix) == 0) {
+    return it->second;
+  }
+  return nullptr;
+}
+
+size_t HttpArchive::Size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+HttpArchive::Stats HttpArchive::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats;
+  stats.entries = entries_.size();
+  stats.bodies = bodies_.size();
+  for (const auto& [view, body] : bodies_) {
+    stats.body_bytes += body->size();
+  }
+  return stats;
+}
+
+// ============================================================================
+// Serialization
+// ============================================================================
+
+std::string HttpArchive::Serialize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Only bodies still referenced are written, in first-use order
+  std::unordered_map<const std::string*, uint32_t> body_index;
+  std::vector<const std::string*> bodies;
+  for (const auto& [key, entry] : entries_) {
+    if (body_index.emplace(entry->body.get(), static_cast<uint32_t>(bodies.size())).second) {
+      bodies.push_back(entry->body.get());
+    }
+  }
+
+  std::string out(kMagic);
+  WriteU32(out, static_cast<uint32_t>(bodies.size()));
+  for (const std::string* body : bodies) {
+    WriteString(out, *body);
+  }
+
+  WriteU32(out, static_cast<uint32_t>(entries_.size()));
+  for (const auto& [key, entry] : entries_) {
+    WriteString(out, key);
+    WriteU32(out, static_cast<uint32_t>(entry->status));
+    WriteString(out, entry->status_text);
+    WriteString(out, entry->mime_type);
+    WriteU32(out, static_cast<uint32_t>(entry->headers.size()));
+    for (const auto& [name, value] : entry->headers) {
+      WriteString(out, name);
+      WriteString(out, value);
+    }
+    WriteU32(out, body_index.at(entry->body.get()));
+  }
+  return out;
+}
+
+utils::Result<std::shared_ptr<HttpArchive>> HttpArchive::Parse(std::string_view data) {
+  using ResultType = std::shared_ptr<HttpArchive>;
+  if (data.substr(0, kMagic.size()) != kMagic) {
+    return utils::Err<ResultType>("Not an HTTP archive (bad header)");
+  }
+
+  Reader reader(data.substr(kMagic.size()));
+  auto archive = std::make_shared<HttpArchive>();
+
+  std::vector<std::shared_ptr<const std::string>> bodies;
+  uint32_t body_count = reader.ReadU32();
+  for (uint32_t i = 0; i < body_count && !reader.failed(); ++i) {
+    bodies.push_back(archive->InternBody(reader.ReadString()));
+  }
+
+  uint32_t entry_count = reader.ReadU32();
+  for (uint32_t i = 0; i < entry_count && !reader.failed(); ++i) {
+    std::string key = reader.ReadString();
+    auto entry = std::make_shared<Entry>();
+    entry->status = static_cast<int>(reader.ReadU32());
+    entry->status_text = reader.ReadString();
+    entry->mime_type = reader.ReadString();
+    uint32_t header_count = reader.ReadU32();
+    for (uint32_t h = 0; h < header_count && !reader.failed(); ++h) {
+      std::string name = reader.ReadString();
+      std::string value = reader.ReadString();
+      entry->headers.emplace_back(std::move(name), std::move(value));
+    }
+    uint32_t body = reader.ReadU32();
+    if (reader.failed() || body >= bodies.size()) {
+      return utils::Err<ResultType>("Corrupt HTTP archive entry " + std::to_string(i));
+    }
+    entry->body = bodies[body];
+    archive->entries_[std::move(key)] = std::move(entry);
+  }
+
+  if (reader.failed() || !reader.AtEnd()) {
+    return utils::Err<ResultType>("Corrupt HTTP archive (truncated or trailing data)");
+  }
+  return archive;
+}
+
+utils::Result<void> HttpArchive::SaveToFile(const std::string& path) const {
+  // Write to a temporary file and rename, so a crash never leaves half an archive
+  const std::string temp_path = path + ".tmp";
+  {
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return utils::ErrVoid("Cannot open " + temp_path + " for writing");
+    }
+    const std::string data = Serialize();
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!file) {
+      return utils::ErrVoid("Failed to write " + temp_path);
+    }
+  }
+  if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    return utils::ErrVoid("Failed to rename " + temp_path + " to " + path);
+  }
+  return utils::Ok();
+}
+
+utils::Result<std::shared_ptr<HttpArchive>> HttpArchive::LoadFromFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return utils::Err<std::shared_ptr<HttpArchive>>("Cannot open HTTP archive " + path);
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  return Parse(buffer.str());
+}
+
+}  // namespace resources
+}  // namespace athena
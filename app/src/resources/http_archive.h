@@ -0,0 +1,117 @@
+#ifndef ATHENA_RESOURCES_HTTP_ARCHIVE_H_
+#define ATHENA_RESOURCES_HTTP_ARCHIVE_H_
+
+#include "utils/error.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace athena {
+namespace resources {
+
+/**
+ * Recorded HTTP responses, keyed by method and URL, for offline replay.
+ *
+ * Benchmarks against the live web are not reproducible and CI has no network.
+ * In record mode every browser stores the responses it receives here; in
+ * replay mode a scheme handler for http/https serves them back, so page loads
+ * are deterministic and need no network.
+ *
+ * Bodies are stored decoded (as the renderer sees them), so Content-Encoding
+ * and Content-Length are dropped when recording. Identical bodies are stored
+ * once. Lookups ignore URL fragments; a URL whose exact query was never
+ * recorded falls back to the recorded response for the same path with the
+ * lowest query string, which absorbs cache-busting parameters.
+ *
+ * Thread-safe: responses are added from the CEF IO thread and looked up from
+ * whichever thread creates resource handlers.
+ */
+class HttpArchive {
+ public:
+  using Headers = std::vector<std::pair<std::string, std::string>>;
+
+  struct Entry {
+    int status = 200;
+    std::string status_text;
+    std::string mime_type;
+    Headers headers;
+    std::shared_ptr<const std::string> body;  // Shared by identical responses
+  };
+
+  struct Stats {
+    size_t entries = 0;      // Distinct method + URL keys
+    size_t bodies = 0;       // Distinct bodies after de-duplication
+    uint64_t body_bytes = 0;
+  };
+
+  // Responses larger than this are not recorded (media streams, downloads)
+  static constexpr size_t kMaxBodySize = 32 * 1024 * 1024;
+
+  HttpArchive() = default;
+
+  HttpArchive(const HttpArchive&) = delete;
+  HttpArchive& operator=(const HttpArchive&) = delete;
+
+  /**
+   * False for headers that describe the transfer rather than the content
+   * (Content-Encoding, Content-Length, Transfer-Encoding, Connection, ...).
+   */
+  static bool ShouldRecordHeader(std::string_view name);
+
+  /**
+   * Record a response. A later response for the same method and URL replaces
+   * the earlier one.
+   */
+  void Add(std::string_view method,
+           std::string_view url,
+           int status,
+           std::string status_text,
+           std::string mime_type,
+           Headers headers,
+           std::string body);
+
+  /**
+   * Look up a response: exact URL first, then the same URL without its query.
+   * @return The entry, or nullptr if nothing was recorded for the URL
+   */
+  std::shared_ptr<const Entry> Find(std::string_view method, std::string_view url) const;
+
+  size_t Size() const;
+  Stats GetStats() const;
+
+  // ============================================================================
+  // Serialization
+  // ============================================================================
+
+  /**
+   * Compact binary form: a body table followed by entries that index into it.
+   */
+  std::string Serialize() const;
+  static utils::Result<std::shared_ptr<HttpArchive>> Parse(std::string_view data);
+
+  utils::Result<void> SaveToFile(const std::string& path) const;
+  static utils::Result<std::shared_ptr<HttpArchive>> LoadFromFile(const std::string& path);
+
+ private:
+  // "GET https://example.com/a?b" (fragment removed)
+  static std::string MakeKey(std::string_view method, std::string_view url);
+
+  // Store body once; returns the shared copy. Requires mutex_.
+  std::shared_ptr<const std::string> InternBody(std::string body);
+
+  mutable std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<const Entry>> entries_;  // Sorted for query fallback
+  std::map<std::string_view, std::shared_ptr<const std::string>> bodies_;
+};
+
+}  // namespace resources
+}  // namespace athena
+
+#endif  // ATHENA_RESOURCES_HTTP_ARCHIVE_H_
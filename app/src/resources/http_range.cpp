@@ -0,0 +1,127 @@
+#include "resources/http_range.h"
+
+#include <cctype>
+#include <optional>
+
+namespace athena {
+namespace resources {
+
+namespace {
+
+std::string_view Trim(std::string_view text) {
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) {
+    text.remove_prefix(1);
+  }
+  while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) {
+    text.remove_suffix(1);
+  }
+  return text;
+}
+
+// Decimal byte position; rejects signs, blanks and values that would overflow
+std::optional<uint64_t> ParsePosition(std::string_view text) {
+  if (text.empty() || text.size() > 18) {
+    return std::nullopt;
+  }
+  uint64_t value = 0;
+  for (char c : text) {
+    if (!std::isdigit(static_cast<unsigned char>(c))) {
+      return std::nullopt;
+    }
+    value = value * 10 + static_cast<uint64_t>(c - '0');
+  }
+  return value;
+}
+
+// W/"x" and "x" compare equal under weak comparison
+std::string_view StripWeak(std::string_view tag) {
+  if (tag.size() >= 2 && tag[0] == 'W' && tag[1] == '/') {
+    tag.remove_prefix(2);
+  }
+  return tag;
+}
+
+}  // namespace
+
+RangeStatus ParseRangeHeader(std::string_view header, uint64_t size, ByteRange& range) {
+  header = Trim(header);
+  constexpr std::string_view kBytes = "bytes=";
+  if (header.substr(0, kBytes.size()) != kBytes) {
+    return RangeStatus::kNone;
+  }
+  std::string_view spec = Trim(header.substr(kBytes.size()));
+  if (spec.find(',') != std::string_view::npos) {
+    return RangeStatus::kNone;  // Multipart responses are not worth it for local assets
+  }
+
+  size_t dash = spec.find('-');
+  if (dash == std::string_view::npos) {
+    return RangeStatus::kNone;
+  }
+  std::string_view first_text = Trim(spec.substr(0, dash));
+  std::string_view last_text = Trim(spec.substr(dash + 1));
+
+  if (first_text.empty()) {
+    // Suffix range: the last n bytes
+    auto suffix = ParsePosition(last_text);
+    if (!suffix) {
+      return RangeStatus::kNone;
+    }
+    if (*suffix == 0 || size == 0) {
+      return RangeStatus::kUnsatisfiable;
+    }
+    range.first = *suffix >= size ? 0 : size - *suffix;
+    range.last = size - 1;
+    return RangeStatus::kSatisfiable;
+  }
+
+  auto first = ParsePosition(first_text);
+  if (!first) {
+    return RangeStatus::kNone;
+  }
+  std::optional<uint64_t> last;
+  if (!last_text.empty()) {
+    last = ParsePosition(last_text);
+    if (!last || *last < *first) {
+      return RangeStatus::kNone;
+    }
+  }
+  if (*first >= size) {
+    return RangeStatus::kUnsatisfiable;
+  }
+  range.first = *first;
+  range.last = (last && *last < size) ? *last : size - 1;
+  return RangeStatus::kSatisfiable;
+}
+
+std::string FormatContentRange(const ByteRange& range, uint64_t size) {
+  return "bytes " + std::to_string(range.first) + "-" + std::to_string(range.last) + "/" +
+         std::to_string(size);
+}
+
+std::string FormatUnsatisfiedRange(uint64_t size) {
+  return "bytes */" + std::to_string(size);
+}
+
+bool IfNoneMatchMatches(std::string_view if_none_match, std::string_view etag) {
+  if_none_match = Trim(if_none_match);
+  if (if_none_match == "*") {
+    return true;
+  }
+  etag = StripWeak(etag);
+  while (!if_none_match.empty()) {
+    size_t comma = if_none_match.find(',');
+    std::string_view candidate = Trim(if_none_match.substr(0, comma));
+    if (!candidate.empty() && StripWeak(candidate) == etag) {
+      return true;
+    }
+    if (comma == std::string_view::npos) {
+      break;
+    }
+    if_none_match.remove_prefix(comma + 1);
+  }
+  return false;
+}
+
+}  // namespace resources
+}  // namespace athena
@@ -0,0 +1,50 @@
+#ifndef ATHENA_RESOURCES_HTTP_RANGE_H_
+#define ATHENA_RESOURCES_HTTP_RANGE_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace athena {
+namespace resources {
+
+/**
+ * HTTP conditional and partial request helpers for local resource handlers
+ * (RFC 9110 sections 13 and 14).
+ */
+
+// Inclusive byte range [first, last] of a resource
+struct ByteRange {
+  uint64_t first = 0;
+  uint64_t last = 0;
+
+  uint64_t Length() const { return last - first + 1; }
+};
+
+enum class RangeStatus {
+  kNone,           // No usable Range header: send the whole resource (200)
+  kSatisfiable,    // Send the range (206)
+  kUnsatisfiable,  // Range starts past the end (416)
+};
+
+/**
+ * Parse a Range header against a resource of the given size. Supports
+ * "bytes=a-b", "bytes=a-" and "bytes=-n". Multiple ranges and malformed
+ * headers yield kNone, which RFC 9110 allows servers to answer with 200.
+ */
+RangeStatus ParseRangeHeader(std::string_view header, uint64_t size, ByteRange& range);
+
+// Content-Range values: "bytes 0-99/1234" for a 206, "bytes */1234" for a 416
+std::string FormatContentRange(const ByteRange& range, uint64_t size);
+std::string FormatUnsatisfiedRange(uint64_t size);
+
+/**
+ * True if an If-None-Match header matches an entity tag (weak comparison,
+ * "*" matches anything), i.e. the client's copy is current and a 304 applies.
+ */
+bool IfNoneMatchMatches(std::string_view if_none_match, std::string_view etag);
+
+}  // namespace resources
+}  // namespace athena
+
+#endif  // ATHENA_RESOURCES_HTTP_RANGE_H_
@@ -0,0 +1,290 @@
+#include "resources/resource_bundle.h"
+
+#include "resources/resource_cache.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace athena {
+namespace resources {
+
+namespace {
+
+// "ATHBNDL" followed by the format version
+constexpr std::string_view kMagic("ATHBNDL\x01", 8);
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kEntrySize = 32;
+constexpr size_t kDataAlignment = 16;
+
+// Seeds tried per bucket before giving up; real bundles need a handful
+constexpr int32_t kMaxSeed = 1 << 24;
+
+// Seeded FNV-1a with a final mix: FNV's low bits alone spread poorly under modulo
+uint64_t HashPath(std::string_view path, uint32_t seed) {
+  uint64_t hash = 14695981039346656037ull ^ (seed * 0x9E3779B97F4A7C15ull);
+  for (char c : path) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+  hash ^= hash >> 33;
+  hash *= 0xFF51AFD7ED558CCDull;
+  hash ^= hash >> 33;
+  return hash;
+}
+
+void WriteU32(std::string& out, uint32_t value) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    out.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+void WriteU64(std::string& out, uint64_t value) {
+  for (int shift = 0; shift < 64; shift += 8) {
+    out.push_back(static_cast<char>((value >> shift) & 0xFF));
+  }
+}
+
+void PadTo(std::string& out, size_t alignment) {
+  out.append((alignment - out.size() % alignment) % alignment, '\0');
+}
+
+// Callers have checked that the bytes are in range
+uint64_t LoadLE(std::string_view data, size_t offset, int bytes) {
+  uint64_t value = 0;
+  for (int i = 0; i < bytes; ++i) {
+    value |= static_cast<uint64_t>(static_cast<unsigned char>(data[offset + i])) << (8 * i);
+  }
+  return value;
+}
+
+uint32_t LoadU32(std::string_view data, size_t offset) {
+  return static_cast<uint32_t>(LoadLE(data, offset, 4));
+}
+
+uint64_t LoadU64(std::string_view data, size_t offset) {
+  return LoadLE(data, offset, 8);
+}
+
+}  // namespace
+
+uint64_t HashResourceContents(std::string_view data) {
+  uint64_t hash = 14695981039346656037ull;
+  for (char c : data) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// ============================================================================
+// ResourceBundle
+// ============================================================================
+
+utils::Result<std::shared_ptr<const ResourceBundle>> ResourceBundle::Open(
+    const std::string& path) {
+  using ResultType = std::shared_ptr<const ResourceBundle>;
+  std::shared_ptr<const MappedFile> mapping = MappedFile::Open(path);
+  if (!mapping) {
+    return utils::Err<ResultType>("Cannot open resource bundle " + path);
+  }
+
+  std::shared_ptr<ResourceBundle> bundle(new ResourceBundle());
+  bundle->data_ = mapping->Data();
+  bundle->mapping_ = std::move(mapping);
+  auto valid = bundle->Validate();
+  if (!valid) {
+    return utils::Err<ResultType>(valid.GetError().Message() + ": " + path);
+  }
+  return ResultType(std::move(bundle));
+}
+
+utils::Result<std::shared_ptr<const ResourceBundle>> ResourceBundle::FromMemory(
+    std::string_view data) {
+  using ResultType = std::shared_ptr<const ResourceBundle>;
+  std::shared_ptr<ResourceBundle> bundle(new ResourceBundle());
+  bundle->data_ = data;
+  auto valid = bundle->Validate();
+  if (!valid) {
+    return utils::Err<ResultType>(valid.GetError().Message());
+  }
+  return ResultType(std::move(bundle));
+}
+
+utils::Result<void> ResourceBundle::Validate() {
+  if (data_.size() < kHeaderSize || data_.substr(0, kMagic.size()) != kMagic) {
+    return utils::ErrVoid("Not a resource bundle (bad header)");
+  }
+  count_ = LoadU32(data_, 8);
+
+  // Checked once here so that Find() can read the tables unchecked
+  const uint64_t tables_end = kHeaderSize + (4 + kEntrySize) * static_cast<uint64_t>(count_);
+  if (tables_end > data_.size()) {
+    return utils::ErrVoid("Corrupt resource bundle (truncated index)");
+  }
+  for (uint32_t slot = 0; slot < count_; ++slot) {
+    int32_t displacement = static_cast<int32_t>(LoadU32(data_, kHeaderSize + 4 * slot));
+    if (displacement < 0 && -(static_cast<int64_t>(displacement) + 1) >= count_) {
+      return utils::ErrVoid("Corrupt resource bundle (bad displacement)");
+    }
+
+    const size_t entry = kHeaderSize + 4 * static_cast<size_t>(count_) + kEntrySize * slot;
+    const uint64_t path_offset = LoadU32(data_, entry);
+    const uint64_t path_size = LoadU32(data_, entry + 4);
+    const uint64_t data_offset = LoadU64(data_, entry + 8);
+    const uint64_t data_size = LoadU64(data_, entry + 16);
+    if (path_offset + path_size > data_.size() || data_offset > data_.size() ||
+        data_size > data_.size() - data_offset) {
+      return utils::ErrVoid("Corrupt resource bundle entry " + std::to_string(slot));
+    }
+  }
+  return utils::Ok();
+}
+
+ResourceBundle::Entry ResourceBundle::EntryAt(uint32_t slot) const {
+  const size_t entry = kHeaderSize + 4 * static_cast<size_t>(count_) + kEntrySize * slot;
+  Entry result;
+  result.path = data_.substr(LoadU32(data_, entry), LoadU32(data_, entry + 4));
+  result.data = data_.substr(static_cast<size_t>(LoadU64(data_, entry + 8)),
+                             static_cast<size_t>(LoadU64(data_, entry + 16)));
+  result.content_hash = LoadU64(data_, entry + 24);
+  return result;
+}
+
+std::optional<ResourceBundle::Entry> ResourceBundle::Find(std::string_view path) const {
+  if (count_ == 0) {
+    return std::nullopt;
+  }
+
+  const uint32_t bucket = static_cast<uint32_t>(HashPath(path, 0) % count_);
+  const int32_t displacement = static_cast<int32_t>(LoadU32(data_, kHeaderSize + 4 * bucket));
+  const uint32_t slot =
+      displacement < 0 ? static_cast<uint32_t>(-(static_cast<int64_t>(displacement) + 1))
+                       : static_cast<uint32_t>(HashPath(path, displacement) % count_);
+
+  // Any path hashes to some slot; only the stored path says whether it is ours
+  Entry entry = EntryAt(slot);
+  if (entry.path != path) {
+    return std::nullopt;
+  }
+  return entry;
+}
+
+// ============================================================================
+// ResourceBundleWriter
+// ============================================================================
+
+bool ResourceBundleWriter::Add(std::string path, std::string contents) {
+  for (const File& file : files_) {
+    if (file.path == path) {
+      return false;
+    }
+  }
+  files_.push_back({std::move(path), std::move(contents)});
+  return true;
+}
+
+utils::Result<std::string> ResourceBundleWriter::Build() const {
+  const size_t count = files_.size();
+  if (count > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return utils::Err<std::string>("Too many files for a resource bundle");
+  }
+
+  // Hash and displace: group paths into buckets, then place the largest
+  // buckets first, searching for a seed that sends every path in the bucket
+  // to a free slot. Single-path buckets take any free slot directly.
+  std::vector<std::vector<uint32_t>> buckets(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    buckets[HashPath(files_[i].path, 0) % count].push_back(i);
+  }
+  std::vector<uint32_t> order(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    order[i] = i;
+  }
+  std::stable_sort(order.begin(), order.end(), [&buckets](uint32_t a, uint32_t b) {
+    return buckets[a].size() > buckets[b].size();
+  });
+
+  constexpr uint32_t kFree = std::numeric_limits<uint32_t>::max();
+  std::vector<int32_t> displacements(count, 0);
+  std::vector<uint32_t> slot_files(count, kFree);
+  std::vector<uint32_t> slots;
+  size_t next_free = 0;
+  for (uint32_t bucket : order) {
+    const std::vector<uint32_t>& members = buckets[bucket];
+    if (members.empty()) {
+      break;
+    }
+    if (members.size() == 1) {
+      while (slot_files[next_free] != kFree) {
+        ++next_free;
+      }
+      slot_files[next_free] = members[0];
+      displacements[bucket] = -static_cast<int32_t>(next_free) - 1;
+      continue;
+    }
+
+    int32_t seed = 1;
+    for (; seed < kMaxSeed; ++seed) {
+      slots.clear();
+      for (uint32_t file : members) {
+        uint32_t slot = static_cast<uint32_t>(HashPath(files_[file].path, seed) % count);
+        if (slot_files[slot] != kFree ||
+            std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+          break;
+        }
+        slots.push_back(slot);
+      }
+      if (slots.size() == members.size()) {
+        break;
+      }
+    }
+    if (seed == kMaxSeed) {
+      return utils::Err<std::string>("No perfect hash found for resource bundle");
+    }
+    for (size_t i = 0; i < members.size(); ++i) {
+      slot_files[slots[i]] = members[i];
+    }
+    displacements[bucket] = seed;
+  }
+
+  // Paths follow the index; data starts aligned after them
+  uint64_t paths_size = 0;
+  for (const File& file : files_) {
+    paths_size += file.path.size();
+  }
+  const uint64_t paths_offset = kHeaderSize + (4 + kEntrySize) * static_cast<uint64_t>(count);
+  if (paths_offset + paths_size > std::numeric_limits<uint32_t>::max()) {
+    return utils::Err<std::string>("Resource bundle paths too large");
+  }
+
+  std::string index;
+  std::string paths;
+  std::string data(static_cast<size_t>(paths_offset + paths_size), '\0');
+  PadTo(data, kDataAlignment);
+  for (uint32_t slot = 0; slot < count; ++slot) {
+    const File& file = files_[slot_files[slot]];
+    WriteU32(index, static_cast<uint32_t>(paths_offset + paths.size()));
+    WriteU32(index, static_cast<uint32_t>(file.path.size()));
+    WriteU64(index, data.size());
+    WriteU64(index, file.contents.size());
+    WriteU64(index, HashResourceContents(file.contents));
+    paths.append(file.path);
+    data.append(file.contents);
+    PadTo(data, kDataAlignment);
+  }
+
+  std::string out(kMagic);
+  WriteU32(out, static_cast<uint32_t>(count));
+  WriteU32(out, 0);  // Reserved
+  for (int32_t displacement : displacements) {
+    WriteU32(out, static_cast<uint32_t>(displacement));
+  }
+  out.append(index);
+  out.append(paths);
+  // The placeholder prefix of data covers everything written so far
+  data.replace(0, out.size(), out);
+  return data;
+}
+
+}  // namespace resources
+}  // namespace athena
@@ -0,0 +1,110 @@
+#ifndef ATHENA_RESOURCES_RESOURCE_BUNDLE_H_
+#define ATHENA_RESOURCES_RESOURCE_BUNDLE_H_
+
+#include "utils/error.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace athena {
+namespace resources {
+
+class MappedFile;
+
+/**
+ * Content hash stored in bundles and used for app:// ETags (FNV-1a, 64-bit).
+ */
+uint64_t HashResourceContents(std::string_view data);
+
+/**
+ * Read-only archive of the homepage build, packed at build time.
+ *
+ * The whole homepage ships as one file next to the executable that is mapped
+ * once at startup: no directory scanning and no per-request path resolution
+ * or file system calls. Paths are found through a minimal perfect hash
+ * (hash-and-displace) built by the packer, so a lookup is two hashes, one
+ * table read and one string compare whatever the bundle size.
+ *
+ * Layout (little-endian, offsets from the start of the file):
+ *
+ *   header        "ATHBNDL\x01", u32 count, u32 reserved
+ *   displacement  i32[count]   per hash bucket: seed, or -(slot + 1)
+ *   entries       count x { u32 path_offset, u32 path_size,
+ *                           u64 data_offset, u64 data_size, u64 hash }
+ *   paths         concatenated, unterminated
+ *   data          file contents, each aligned to 16 bytes
+ *
+ * Entries are stored in slot order, so the slot a path hashes to is its
+ * entry. Immutable after Open(); safe to share between threads.
+ */
+class ResourceBundle {
+ public:
+  struct Entry {
+    std::string_view path;
+    std::string_view data;
+    uint64_t content_hash = 0;
+  };
+
+  /**
+   * Map a bundle file and validate its tables.
+   */
+  static utils::Result<std::shared_ptr<const ResourceBundle>> Open(const std::string& path);
+
+  /**
+   * Use bundle bytes owned by the caller (e.g. embedded data); the bytes must
+   * outlive the bundle.
+   */
+  static utils::Result<std::shared_ptr<const ResourceBundle>> FromMemory(std::string_view data);
+
+  ResourceBundle(const ResourceBundle&) = delete;
+  ResourceBundle& operator=(const ResourceBundle&) = delete;
+
+  std::optional<Entry> Find(std::string_view path) const;
+  size_t Size() const { return count_; }
+
+ private:
+  ResourceBundle() = default;
+
+  // Check the header and that every entry lies inside the data
+  utils::Result<void> Validate();
+  Entry EntryAt(uint32_t slot) const;
+
+  std::shared_ptr<const MappedFile> mapping_;  // Null when built from memory
+  std::string_view data_;
+  uint32_t count_ = 0;
+};
+
+/**
+ * Builds bundle bytes at build time (see app/tools/pack_resources.cpp).
+ */
+class ResourceBundleWriter {
+ public:
+  /**
+   * Add a file under a bundle-relative path ("assets/index-BxQ3k2lz.js").
+   * @return false if the path was already added
+   */
+  bool Add(std::string path, std::string contents);
+
+  /**
+   * Serialize all files with a perfect hash index over their paths.
+   */
+  utils::Result<std::string> Build() const;
+
+ private:
+  struct File {
+    std::string path;
+    std::string contents;
+  };
+
+  std::vector<File> files_;
+};
+
+}  // namespace resources
+}  // namespace athena
+
+#endif  // ATHENA_RESOURCES_RESOURCE_BUNDLE_H_
@@ -0,0 +1,318 @@
+#include "resources/resource_cache.h"
+
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace athena {
+namespace resources {
+
+namespace {
+
+struct MimeMapping {
+  const char* extension;
+  const char* mime_type;
+};
+
+constexpr MimeMapping kMimeTypes[] = {
+    {"html", "text/html"},
+    {"htm", "text/html"},
+    {"js", "application/javascript"},
+    {"mjs", "application/javascript"},
+    {"css", "text/css"},
+    {"json", "application/json"},
+    {"map", "application/json"},
+    {"png", "image/png"},
+    {"jpg", "image/jpeg"},
+    {"jpeg", "image/jpeg"},
+    {"gif", "image/gif"},
+    {"webp", "image/webp"},
+    {"svg", "image/svg+xml"},
+    {"ico", "image/x-icon"},
+    {"woff", "font/woff"},
+    {"woff2", "font/woff2"},
+    {"ttf", "font/ttf"},
+    {"wasm", "application/wasm"},
+    {"mp4", "video/mp4"},
+    {"webm", "video/webm"},
+    {"txt", "text/plain"},
+};
+
+// Stable across runs and identical for bundled and loose copies of a file
+std::string MakeETag(uint64_t content_hash) {
+  char buffer[24];
+  std::snprintf(
+      buffer, sizeof(buffer), "\"%016llx\"", static_cast<unsigned long long>(content_hash));
+  return buffer;
+}
+
+std::string GetExecutableDirectory() {
+  char exe_path[1024];
+#ifdef _WIN32
+  DWORD len = GetModuleFileNameA(NULL, exe_path, sizeof(exe_path));
+  if (len == 0 || len >= sizeof(exe_path)) {
+    return "";
+  }
+  std::string path(exe_path, len);
+  return path.substr(0, path.find_last_of("\\/"));
+#else
+  ssize_t len = readlink("/proc/self/exe", exe_path, sizeof(exe_path) - 1);
+  if (len <= 0) {
+    return "";
+  }
+  std::string path(exe_path, static_cast<size_t>(len));
+  return path.substr(0, path.rfind('/'));
+#endif
+}
+
+}  // namespace
+
+// ============================================================================
+// MappedFile
+// ============================================================================
+
+std::unique_ptr<MappedFile> MappedFile::Open(const std::string& path) {
+  std::unique_ptr<MappedFile> file(new MappedFile());
+#ifdef _WIN32
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream) {
+    return nullptr;
+  }
+  std::stringstream buffer;
+  buffer << stream.rdbuf();
+  file->fallback_ = buffer.str();
+  file->data_ = file->fallback_.data();
+  file->size_ = file->fallback_.size();
+#else
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat info;
+  if (::fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+    ::close(fd);
+    return nullptr;
+  }
+
+  // Empty files cannot be mapped, and need not be
+  file->size_ = static_cast<size_t>(info.st_size);
+  if (file->size_ > 0) {
+    void* mapping = ::mmap(nullptr, file->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping == MAP_FAILED) {
+      ::close(fd);
+      return nullptr;
+    }
+    file->data_ = static_cast<const char*>(mapping);
+  }
+  ::close(fd);  // The mapping keeps the file alive
+#endif
+  return file;
+}
+
+MappedFile::~MappedFile() {
+#ifndef _WIN32
+  if (data_ && size_ > 0) {
+    ::munmap(const_cast<char*>(data_), size_);
+  }
+#endif
+}
+
+// ============================================================================
+// ResourceCache
+// ============================================================================
+
+ResourceCache& ResourceCache::Instance() {
+  static ResourceCache cache = [] {
+    std::vector<std::string> roots = {"resources/homepage"};
+    std::shared_ptr<const ResourceBundle> bundle;
+    auto bundle_time = std::filesystem::file_time_type::max();
+    std::string exe_dir = GetExecutableDirectory();
+    if (!exe_dir.empty()) {
+      roots.push_back(exe_dir + "/resources/homepage");
+      // Optional: development builds serve the loose Vite output
+      const std::string bundle_path = exe_dir + "/resources/homepage.bundle";
+      auto opened = ResourceBundle::Open(bundle_path);
+      if (opened) {
+        bundle = std::move(opened).Value();
+        std::error_code error;
+        auto modified = std::filesystem::last_write_time(bundle_path, error);
+        if (!error) {
+          bundle_time = modified;
+        }
+      }
+    }
+    return ResourceCache(std::move(roots), std::move(bundle), bundle_time);
+  }();
+  return cache;
+}
+
+ResourceCache::ResourceCache(std::vector<std::string> roots,
+                             std::shared_ptr<const ResourceBundle> bundle,
+                             std::filesystem::file_time_type bundle_time)
+    : roots_(std::move(roots)), bundle_(std::move(bundle)), bundle_time_(bundle_time) {}
+
+std::shared_ptr<const CachedResource> ResourceCache::Get(const std::string& path) {
+  if (!IsSafePath(path)) {
+    return nullptr;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(path);
+    if (it != entries_.end()) {
+      stats_.hits++;
+      return it->second;
+    }
+    stats_.misses++;
+  }
+
+  // Map and hash outside the lock; if two threads race, the first insert wins
+  std::shared_ptr<const CachedResource> resource = Load(path);
+  if (!resource) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto [it, inserted] = entries_.emplace(path, resource);
+  if (inserted) {
+    stats_.entries = entries_.size();
+    stats_.mapped_bytes += resource->data.size();
+  }
+  return it->second;
+}
+
+std::shared_ptr<const CachedResource> ResourceCache::Load(const std::string& path) const {
+  if (bundle_) {
+    if (auto entry = bundle_->Find(path); entry && !HasNewerLooseFile(path)) {
+      auto resource = std::make_shared<CachedResource>();
+      resource->path = path;
+      resource->mime_type = GetMimeType(path);
+      resource->data = entry->data;
+      resource->etag = MakeETag(entry->content_hash);  // Hashed by the packer
+      resource->immutable = IsFingerprinted(path);
+      resource->storage = bundle_;
+      return resource;
+    }
+  }
+
+  for (const std::string& root : roots_) {
+    const std::string file_path = root + "/" + path;
+
+    // Media, wasm and source maps would pin hundreds of MB for the session
+    std::error_code error;
+    const uint64_t size = std::filesystem::file_size(file_path, error);
+    if (!error && size > kMaxMappedSize) {
+      auto resource = std::make_shared<CachedResource>();
+      resource->path = path;
+      resource->mime_type = GetMimeType(path);
+      resource->immutable = IsFingerprinted(path);
+      resource->file_path = file_path;
+      return resource;
+    }
+
+    std::shared_ptr<const MappedFile> mapping = MappedFile::Open(file_path);
+    if (!mapping) {
+      continue;
+    }
+
+    auto resource = std::make_shared<CachedResource>();
+    resource->path = path;
+    resource->mime_type = GetMimeType(path);
+    resource->data = mapping->Data();
+    resource->etag = MakeETag(HashResourceContents(resource->data));
+    resource->immutable = IsFingerprinted(path);
+    resource->storage = std::move(mapping);
+    return resource;
+  }
+  return nullptr;
+}
+
+bool ResourceCache::HasNewerLooseFile(const std::string& path) const {
+  if (bundle_time_ == std::filesystem::file_time_type::max()) {
+    return false;
+  }
+  for (const std::string& root : roots_) {
+    std::error_code error;
+    auto modified = std::filesystem::last_write_time(root + "/" + path, error);
+    if (!error) {
+      return modified > bundle_time_;
+    }
+  }
+  return false;
+}
+
+ResourceCache::Stats ResourceCache::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+std::string ResourceCache::GetMimeType(std::string_view path) {
+  size_t dot = path.rfind('.');
+  if (dot == std::string_view::npos || path.find('/', dot) != std::string_view::npos) {
+    return "application/octet-stream";
+  }
+  std::string extension(path.substr(dot + 1));
+  for (char& c : extension) {
+    c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+  }
+  for (const auto& mapping : kMimeTypes) {
+    if (extension == mapping.extension) {
+      return mapping.mime_type;
+    }
+  }
+  return "application/octet-stream";
+}
+
+bool ResourceCache::IsFingerprinted(std::string_view path) {
+  // Vite emits hashed files into assets/ as "<name>-<hash>.<ext>"
+  if (path.substr(0, 7) != "assets/") {
+    return false;
+  }
+  std::string_view name = path.substr(path.rfind('/') + 1);
+  std::string_view stem = name.substr(0, name.find('.'));
+  size_t dash = stem.rfind('-');
+  if (dash == std::string_view::npos) {
+    return false;
+  }
+
+  std::string_view hash = stem.substr(dash + 1);
+  bool has_digit = false;
+  for (char c : hash) {
+    if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') {
+      return false;
+    }
+    has_digit = has_digit || std::isdigit(static_cast<unsigned char>(c));
+  }
+  return hash.size() >= 8 && has_digit;
+}
+
+bool ResourceCache::IsSafePath(std::string_view path) {
+  if (path.empty() || path.front() == '/' || path.find('\\') != std::string_view::npos ||
+      path.find('\0') != std::string_view::npos) {
+    return false;
+  }
+  while (!path.empty()) {
+    size_t slash = path.find('/');
+    if (path.substr(0, slash) == "..") {
+      return false;
+    }
+    if (slash == std::string_view::npos) {
+      break;
+    }
+    path.remove_prefix(slash + 1);
+  }
+  return true;
+}
+
+}  // namespace resources
+}  // namespace athena
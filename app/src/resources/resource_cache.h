@@ -0,0 +1,158 @@
+#ifndef ATHENA_RESOURCES_RESOURCE_CACHE_H_
+#define ATHENA_RESOURCES_RESOURCE_CACHE_H_
+
+#include "resources/resource_bundle.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace athena {
+namespace resources {
+
+/**
+ * Read-only memory mapping of a whole file.
+ *
+ * Pages are shared with the OS page cache, so serving a mapped file copies
+ * bytes once (into the caller's buffer) and mapping it twice costs nothing.
+ */
+class MappedFile {
+ public:
+  /**
+   * Map a file. Returns nullptr if it cannot be opened or is not a regular file.
+   */
+  static std::unique_ptr<MappedFile> Open(const std::string& path);
+
+  ~MappedFile();
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  std::string_view Data() const { return std::string_view(data_, size_); }
+
+ private:
+  MappedFile() = default;
+
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+  std::string fallback_;  // Contents read into memory where mapping is unavailable
+};
+
+/**
+ * A cached app:// resource: mapped bytes plus the headers derived from them.
+ */
+struct CachedResource {
+  std::string path;        // Bundle-relative path ("assets/index-BxQ3k2lz.js")
+  std::string mime_type;   // From the extension
+  std::string etag;        // Strong validator: quoted hash of the contents, if mapped
+  bool immutable = false;  // Fingerprinted name: contents never change under it
+  std::string_view data;   // Points into the storage below
+  // Keeps data alive: the file's MappedFile, or the ResourceBundle it came from
+  std::shared_ptr<const void> storage;
+  // Set instead of data for loose files over ResourceCache::kMaxMappedSize,
+  // which are streamed from disk per request (see FileStream)
+  std::string file_path;
+};
+
+/**
+ * Process-wide cache of the homepage bundle served on app://.
+ *
+ * Resources come from the packed bundle when there is one (see
+ * ResourceBundle): a perfect-hash lookup into a single mapping made at
+ * startup. Anything not in the bundle, or every file when there is none
+ * (development builds), is looked up under each root in order, mapped and
+ * hashed on first request. A loose file modified after the bundle was packed
+ * wins over its bundled copy, so a homepage rebuilt without repacking is
+ * still served fresh (at the cost of one stat per root on a path's first
+ * request). Either way a resource is then served from memory for the rest of
+ * the session, so repeated homepage and new-tab loads cost no file I/O at
+ * all. Loose files over kMaxMappedSize are the exception: only their location
+ * is cached, and each request streams them. Misses are not cached, so assets
+ * that appear later are still found; a rebuilt bundle is picked up on the
+ * next start. Rebuilds must replace files (delete or rename, as
+ * scripts/build-homepage.sh and the packer do) rather than truncate them in
+ * place, which would change mapped pages under the cache.
+ *
+ * Thread-safe: scheme handlers run on the CEF IO thread, but any thread may call.
+ */
+class ResourceCache {
+ public:
+  struct Stats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;  // Not cached yet (mapped now) or not found
+    size_t entries = 0;
+    uint64_t mapped_bytes = 0;
+  };
+
+  // Larger loose files are not mapped for the session but streamed on demand
+  static constexpr uint64_t kMaxMappedSize = 4 * 1024 * 1024;
+
+  /**
+   * The cache app:// uses: resources/homepage.bundle next to the executable if
+   * present, then resources/homepage under the working directory and next to
+   * the executable.
+   */
+  static ResourceCache& Instance();
+
+  /**
+   * @param bundle_time When the bundle was packed; loose files modified later
+   *                    are served instead of their bundled copies
+   */
+  explicit ResourceCache(
+      std::vector<std::string> roots,
+      std::shared_ptr<const ResourceBundle> bundle = nullptr,
+      std::filesystem::file_time_type bundle_time = std::filesystem::file_time_type::max());
+
+  ResourceCache(const ResourceCache&) = delete;
+  ResourceCache& operator=(const ResourceCache&) = delete;
+
+  /**
+   * Get a resource by bundle-relative path. Paths that try to leave the
+   * bundle ("..", absolute paths) are rejected.
+   * @return The resource, or nullptr if it does not exist
+   */
+  std::shared_ptr<const CachedResource> Get(const std::string& path);
+
+  Stats GetStats() const;
+
+  /**
+   * MIME type from the file extension (application/octet-stream if unknown).
+   */
+  static std::string GetMimeType(std::string_view path);
+
+  /**
+   * True for build-fingerprinted names such as "assets/index-BxQ3k2lz.js",
+   * whose contents change only together with the name.
+   */
+  static bool IsFingerprinted(std::string_view path);
+
+  /**
+   * True if a relative path stays inside the bundle.
+   */
+  static bool IsSafePath(std::string_view path);
+
+ private:
+  std::shared_ptr<const CachedResource> Load(const std::string& path) const;
+
+  // True if the loose copy of |path| that Load() would find is newer than the bundle
+  bool HasNewerLooseFile(const std::string& path) const;
+
+  const std::vector<std::string> roots_;
+  const std::shared_ptr<const ResourceBundle> bundle_;
+  const std::filesystem::file_time_type bundle_time_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const CachedResource>> entries_;
+  Stats stats_;
+};
+
+}  // namespace resources
+}  // namespace athena
+
+#endif  // ATHENA_RESOURCES_RESOURCE_CACHE_H_
@@ -1,20 +1,66 @@
 #include "resources/scheme_handler.h"
 
 #include "cef_parser.h"
+#include "cef_task.h"
 
 #include <algorithm>
-#include <filesystem>
-#include <fstream>
-#include <sstream>
-#ifdef _WIN32
-#include <windows.h>
-#else
-#include <unistd.h>
-#endif
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
-namespace fs = std::filesystem;
+namespace {
 
-AppSchemeHandler::AppSchemeHandler() : offset_(0) {}
+const char* StatusText(int status) {
+  switch (status) {
+    case 200:
+      return "OK";
+    case 206:
+      return "Partial Content";
+    case 304:
+      return "Not Modified";
+    case 404:
+      return "Not Found";
+    case 416:
+      return "Range Not Satisfiable";
+    default:
+      return "";
+  }
+}
+
+// Fills CEF's buffer from a streamed file on the file thread, then resumes the
+// request. CEF keeps |data_out| valid until the callback runs.
+class StreamReadTask : public CefTask {
+ public:
+  StreamReadTask(std::shared_ptr<const athena::resources::FileStream> stream,
+                 uint64_t position,
+                 void* data_out,
+                 int size,
+                 CefRefPtr<CefResourceReadCallback> callback)
+      : stream_(std::move(stream)),
+        position_(position),
+        data_out_(data_out),
+        size_(size),
+        callback_(callback) {}
+
+  void Execute() override {
+    int64_t count = stream_->ReadAt(position_, static_cast<char*>(data_out_), size_);
+    // A short read means the file shrank under us; the length already went out
+    callback_->Continue(count == size_ ? size_ : ERR_FAILED);
+  }
+
+ private:
+  std::shared_ptr<const athena::resources::FileStream> stream_;
+  uint64_t position_;
+  void* data_out_;
+  int size_;
+  CefRefPtr<CefResourceReadCallback> callback_;
+
+  IMPLEMENT_REFCOUNTING(StreamReadTask);
+};
+
+}  // namespace
+
+AppSchemeHandler::AppSchemeHandler() : status_(200), first_(0), length_(0), offset_(0) {}
 
 bool AppSchemeHandler::Open(CefRefPtr<CefRequest> request,
                             bool& handle_request,
@@ -38,13 +84,71 @@ bool AppSchemeHandler::Open(CefRefPtr<CefRequest> request,
     path = path.substr(1);
   }
 
-  // Load the resource
-  if (!LoadResource(path)) {
+  status_ = 200;
+  content_range_.clear();
+  first_ = 0;
+  offset_ = 0;
+
+  // Mapped once per process; later requests cost no file I/O
+  resource_ = athena::resources::ResourceCache::Instance().Get(path);
+  if (resource_ && !resource_->file_path.empty()) {
+    // Too large to map: length and validator from fstat, contents on demand
+    stream_ = athena::resources::FileStream::Open(resource_->file_path);
+    if (!stream_) {
+      resource_.reset();
+    }
+  }
+  if (!resource_) {
     // Return 404 page
+    status_ = 404;
     mime_type_ = "text/html";
-    data_ = "<!DOCTYPE html><html><head><title>404</title></head>"
-            "<body><h1>404 - Not Found</h1><p>Resource not found: " +
-            path + "</p></body></html>";
+    error_page_ = "<!DOCTYPE html><html><head><title>404</title></head>"
+                  "<body><h1>404 - Not Found</h1><p>Resource not found: " +
+                  path + "</p></body></html>";
+    body_ = error_page_;
+    length_ = body_.size();
+    return true;
+  }
+
+  mime_type_ = resource_->mime_type;
+  if (stream_) {
+    etag_ = stream_->ETag();
+    length_ = stream_->Size();
+  } else {
+    etag_ = resource_->etag;
+    body_ = resource_->data;
+    length_ = body_.size();
+  }
+  const uint64_t size = length_;
+
+  // Revalidation: the page already has this version
+  std::string if_none_match = request->GetHeaderByName("If-None-Match");
+  if (!if_none_match.empty() && athena::resources::IfNoneMatchMatches(if_none_match, etag_)) {
+    status_ = 304;
+    length_ = 0;
+    return true;
+  }
+
+  // Partial content (media seeking); If-Range falls back to the full body once stale
+  std::string range_header = request->GetHeaderByName("Range");
+  std::string if_range = request->GetHeaderByName("If-Range");
+  if (!range_header.empty() && (if_range.empty() || if_range == etag_)) {
+    athena::resources::ByteRange range;
+    switch (athena::resources::ParseRangeHeader(range_header, size, range)) {
+      case athena::resources::RangeStatus::kSatisfiable:
+        status_ = 206;
+        content_range_ = athena::resources::FormatContentRange(range, size);
+        first_ = range.first;
+        length_ = range.Length();
+        break;
+      case athena::resources::RangeStatus::kUnsatisfiable:
+        status_ = 416;
+        content_range_ = athena::resources::FormatUnsatisfiedRange(size);
+        length_ = 0;
+        break;
+      case athena::resources::RangeStatus::kNone:
+        break;
+    }
   }
 
   return true;
@@ -54,7 +158,8 @@ void AppSchemeHandler::GetResponseHeaders(CefRefPtr<CefResponse> response,
                                           int64_t& response_length,
                                           CefString& redirectUrl) {
   response->SetMimeType(mime_type_);
-  response->SetStatus(200);
+  response->SetStatus(status_);
+  response->SetStatusText(StatusText(status_));
 
   // Set strict CSP headers for production
   CefResponse::HeaderMap headers;
@@ -80,114 +185,199 @@ void AppSchemeHandler::GetResponseHeaders(CefRefPtr<CefResponse> response,
                     "frame-ancestors 'none'");
   }
   headers.emplace("X-Content-Type-Options", "nosniff");
-  headers.emplace("Cache-Control", "public, max-age=3600");
+  if (resource_) {
+    // Fingerprinted assets never change under their name; everything else revalidates
+    headers.emplace("Cache-Control",
+                    resource_->immutable ? "public, max-age=31536000, immutable" : "no-cache");
+    headers.emplace("ETag", etag_);
+    headers.emplace("Accept-Ranges", "bytes");
+  } else {
+    headers.emplace("Cache-Control", "no-store");
+  }
+  if (!content_range_.empty()) {
+    headers.emplace("Content-Range", content_range_);
+  }
   response->SetHeaderMap(headers);
 
-  response_length = data_.length();
+  response_length = static_cast<int64_t>(length_);
 }
 
 bool AppSchemeHandler::Read(void* data_out,
                             int bytes_to_read,
                             int& bytes_read,
                             CefRefPtr<CefResourceReadCallback> callback) {
-  bool has_data = false;
   bytes_read = 0;
+  if (offset_ >= length_) {
+    return false;
+  }
 
-  if (offset_ < data_.length()) {
-    int transfer_size = std::min(bytes_to_read, static_cast<int>(data_.length() - offset_));
-    memcpy(data_out, data_.c_str() + offset_, transfer_size);
-    offset_ += transfer_size;
+  // Never more than CEF's buffer, however large the resource
+  const int transfer_size =
+      static_cast<int>(std::min<uint64_t>(static_cast<uint64_t>(bytes_to_read), length_ - offset_));
+  const uint64_t position = first_ + offset_;
+  offset_ += transfer_size;
+
+  if (stream_) {
+    if (CefPostTask(TID_FILE_USER_BLOCKING,
+                    new StreamReadTask(stream_, position, data_out, transfer_size, callback))) {
+      return true;  // Completes through the callback
+    }
+    // File thread gone (shutdown): read inline rather than fail the request
+    int64_t count = stream_->ReadAt(position, static_cast<char*>(data_out), transfer_size);
+    if (count != transfer_size) {
+      bytes_read = ERR_FAILED;
+      return false;
+    }
     bytes_read = transfer_size;
-    has_data = true;
+    return true;
   }
 
-  return has_data;
+  // Straight from the mapping into CEF's buffer
+  memcpy(data_out, body_.data() + position, transfer_size);
+  bytes_read = transfer_size;
+  return true;
 }
 
 void AppSchemeHandler::Cancel() {
-  // Clean up if needed
+  body_ = {};
+  stream_.reset();  // Reads in flight hold their own reference
+  resource_.reset();
 }
 
-std::string AppSchemeHandler::GetMimeType(const std::string& path) {
-  auto ext_pos = path.rfind('.');
-  if (ext_pos != std::string::npos) {
-    std::string ext = path.substr(ext_pos + 1);
-    if (ext == "html" || ext == "htm")
-      return "text/html";
-    if (ext == "js" || ext == "mjs")
-      return "application/javascript";
-    if (ext == "css")
-      return "text/css";
-    if (ext == "json")
-      return "application/json";
-    if (ext == "map")
-      return "application/json";
-    if (ext == "png")
-      return "image/png";
-    if (ext == "jpg" || ext == "jpeg")
-      return "image/jpeg";
-    if (ext == "svg")
-      return "image/svg+xml";
-    if (ext == "ico")
-      return "image/x-icon";
-    if (ext == "woff")
-      return "font/woff";
-    if (ext == "woff2")
-      return "font/woff2";
-    if (ext == "ttf")
-      return "font/ttf";
-    if (ext == "wasm")
-      return "application/wasm";
-    if (ext == "txt")
-      return "text/plain";
-  }
-  return "application/octet-stream";
+// Factory implementation
+CefRefPtr<CefResourceHandler> AppSchemeHandlerFactory::Create(CefRefPtr<CefBrowser> browser,
+                                                              CefRefPtr<CefFrame> frame,
+                                                              const CefString& scheme_name,
+                                                              CefRefPtr<CefRequest> request) {
+  return new AppSchemeHandler();
 }
 
-bool AppSchemeHandler::LoadResource(const std::string& path) {
-  // Look for resources in resources/homepage directory (production build output)
-  fs::path resource_path = fs::path("resources/homepage") / path;
-
-  // Also check executable directory
-  if (!fs::exists(resource_path)) {
-    // Get executable directory and check there
-    char exe_path[1024];
-#ifdef _WIN32
-    GetModuleFileNameA(NULL, exe_path, sizeof(exe_path));
-    fs::path exe_dir = fs::path(exe_path).parent_path();
-#else
-    ssize_t len = readlink("/proc/self/exe", exe_path, sizeof(exe_path) - 1);
-    if (len != -1) {
-      exe_path[len] = '\0';
-      fs::path exe_dir = fs::path(exe_path).parent_path();
-      resource_path = exe_dir / "resources/homepage" / path;
-    }
-#endif
+// ============================================================================
+// Archive Replay
+// ============================================================================
+
+static bool IsLocationHeader(const std::string& name) {
+  static const std::string kLocation = "location";
+  return std::equal(
+      name.begin(), name.end(), kLocation.begin(), kLocation.end(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == b;
+      });
+}
+
+ArchiveReplayHandler::ArchiveReplayHandler(
+    std::shared_ptr<const athena::resources::HttpArchive> archive)
+    : archive_(std::move(archive)), offset_(0) {}
+
+bool ArchiveReplayHandler::Open(CefRefPtr<CefRequest> request,
+                                bool& handle_request,
+                                CefRefPtr<CefCallback> callback) {
+  handle_request = true;
+  url_ = request->GetURL().ToString();
+  entry_ = archive_->Find(request->GetMethod().ToString(), url_);
+  offset_ = 0;
+  return true;
+}
+
+void ArchiveReplayHandler::GetResponseHeaders(CefRefPtr<CefResponse> response,
+                                              int64_t& response_length,
+                                              CefString& redirectUrl) {
+  CefResponse::HeaderMap headers;
+  if (!entry_) {
+    // Offline by design: a miss must not fall through to the live network
+    response->SetStatus(404);
+    response->SetStatusText("Not Found");
+    response->SetMimeType("text/plain");
+    headers.emplace("X-Athena-Replay", "miss");
+    response->SetHeaderMap(headers);
+    response_length = 0;
+    return;
   }
 
-  if (!fs::exists(resource_path)) {
-    return false;
+  response->SetStatus(entry_->status);
+  response->SetStatusText(entry_->status_text);
+  response->SetMimeType(entry_->mime_type);
+  const bool is_redirect = entry_->status >= 300 && entry_->status < 400;
+  for (const auto& [name, value] : entry_->headers) {
+    headers.emplace(name, value);
+    if (is_redirect && IsLocationHeader(name)) {
+      redirectUrl = value;
+    }
   }
+  headers.emplace("X-Athena-Replay", "hit");
+  response->SetHeaderMap(headers);
+
+  response_length = static_cast<int64_t>(entry_->body->size());
+}
 
-  // Read file content
-  std::ifstream file(resource_path, std::ios::binary);
-  if (!file) {
+bool ArchiveReplayHandler::Read(void* data_out,
+                                int bytes_to_read,
+                                int& bytes_read,
+                                CefRefPtr<CefResourceReadCallback> callback) {
+  bytes_read = 0;
+  if (!entry_ || offset_ >= entry_->body->size()) {
     return false;
   }
 
-  std::stringstream buffer;
-  buffer << file.rdbuf();
-  data_ = buffer.str();
-  mime_type_ = GetMimeType(path);
-  offset_ = 0;
+  const std::string& body = *entry_->body;
+  int transfer_size = std::min(bytes_to_read, static_cast<int>(body.size() - offset_));
+  memcpy(data_out, body.data() + offset_, transfer_size);
+  offset_ += transfer_size;
+  bytes_read = transfer_size;
+  return true;
+}
 
+void ArchiveReplayHandler::Cancel() {
+  entry_.reset();
+}
+
+ArchiveSchemeHandlerFactory::ArchiveSchemeHandlerFactory(
+    std::shared_ptr<const athena::resources::HttpArchive> archive)
+    : archive_(std::move(archive)) {}
+
+CefRefPtr<CefResourceHandler> ArchiveSchemeHandlerFactory::Create(
+    CefRefPtr<CefBrowser> browser,
+    CefRefPtr<CefFrame> frame,
+    const CefString& scheme_name,
+    CefRefPtr<CefRequest> request) {
+  return new ArchiveReplayHandler(archive_);
+}
+
+// ============================================================================
+// Archive Recording
+// ============================================================================
+
+RecordingResponseFilter::RecordingResponseFilter() : overflowed_(false) {}
+
+bool RecordingResponseFilter::InitFilter() {
   return true;
 }
 
-// Factory implementation
-CefRefPtr<CefResourceHandler> AppSchemeHandlerFactory::Create(CefRefPtr<CefBrowser> browser,
-                                                              CefRefPtr<CefFrame> frame,
-                                                              const CefString& scheme_name,
-                                                              CefRefPtr<CefRequest> request) {
-  return new AppSchemeHandler();
+CefResponseFilter::FilterStatus RecordingResponseFilter::Filter(void* data_in,
+                                                                size_t data_in_size,
+                                                                size_t& data_in_read,
+                                                                void* data_out,
+                                                                size_t data_out_size,
+                                                                size_t& data_out_written) {
+  if (data_in_size == 0) {
+    data_in_read = 0;
+    data_out_written = 0;
+    return RESPONSE_FILTER_DONE;
+  }
+
+  // Unread input is passed in again on the next call
+  size_t count = std::min(data_in_size, data_out_size);
+  memcpy(data_out, data_in, count);
+  data_in_read = count;
+  data_out_written = count;
+
+  if (!overflowed_) {
+    if (body_.size() + count > athena::resources::HttpArchive::kMaxBodySize) {
+      overflowed_ = true;
+      body_.clear();
+      body_.shrink_to_fit();
+    } else {
+      body_.append(static_cast<const char*>(data_in), count);
+    }
+  }
+  return RESPONSE_FILTER_NEED_MORE_DATA;
 }
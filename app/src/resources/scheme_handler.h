@@ -1,10 +1,23 @@
 #ifndef ATHENA_SCHEME_HANDLER_H_
 #define ATHENA_SCHEME_HANDLER_H_
 
+#include "cef_response_filter.h"
 #include "cef_scheme.h"
+#include "resources/file_stream.h"
+#include "resources/http_archive.h"
+#include "resources/http_range.h"
+#include "resources/resource_cache.h"
 
+#include <memory>
 #include <string>
+#include <string_view>
 
+// Serves the homepage bundle on app:// from the process-wide ResourceCache,
+// with ETag revalidation (304) and single byte ranges (206). Files too large
+// to map are streamed: headers come from fstat, and each Read() is a
+// positional read into CEF's buffer on the file thread, completed through
+// CefResourceReadCallback, so memory stays bounded and the IO thread never
+// blocks on disk.
 class AppSchemeHandler : public CefResourceHandler {
  public:
   AppSchemeHandler();
@@ -26,12 +39,17 @@ class AppSchemeHandler : public CefResourceHandler {
   void Cancel() override;
 
  private:
+  std::shared_ptr<const athena::resources::CachedResource> resource_;  // Null on a miss
+  std::shared_ptr<const athena::resources::FileStream> stream_;         // Streamed resources only
   std::string mime_type_;
-  std::string data_;
-  size_t offset_;
-
-  std::string GetMimeType(const std::string& path);
-  bool LoadResource(const std::string& path);
+  std::string etag_;
+  std::string error_page_;
+  std::string content_range_;
+  std::string_view body_;  // In memory: the mapped resource or the error page
+  int status_;
+  uint64_t first_;   // Start of the bytes to send within the resource
+  uint64_t length_;  // Bytes to send: the whole resource or the requested range
+  uint64_t offset_;  // Bytes sent so far
 
   IMPLEMENT_REFCOUNTING(AppSchemeHandler);
 };
@@ -47,4 +65,78 @@ class AppSchemeHandlerFactory : public CefSchemeHandlerFactory {
   IMPLEMENT_REFCOUNTING(AppSchemeHandlerFactory);
 };
 
+// Serves an http(s) request from a recorded archive (replay mode). Requests
+// that were never recorded get an empty 404 instead of touching the network.
+class ArchiveReplayHandler : public CefResourceHandler {
+ public:
+  explicit ArchiveReplayHandler(std::shared_ptr<const athena::resources::HttpArchive> archive);
+
+  // CefResourceHandler methods
+  bool Open(CefRefPtr<CefRequest> request,
+            bool& handle_request,
+            CefRefPtr<CefCallback> callback) override;
+
+  void GetResponseHeaders(CefRefPtr<CefResponse> response,
+                          int64_t& response_length,
+                          CefString& redirectUrl) override;
+
+  bool Read(void* data_out,
+            int bytes_to_read,
+            int& bytes_read,
+            CefRefPtr<CefResourceReadCallback> callback) override;
+
+  void Cancel() override;
+
+ private:
+  std::shared_ptr<const athena::resources::HttpArchive> archive_;
+  std::shared_ptr<const athena::resources::HttpArchive::Entry> entry_;  // Null on a miss
+  std::string url_;
+  size_t offset_;
+
+  IMPLEMENT_REFCOUNTING(ArchiveReplayHandler);
+};
+
+// Registered for http and https when replaying an archive
+class ArchiveSchemeHandlerFactory : public CefSchemeHandlerFactory {
+ public:
+  explicit ArchiveSchemeHandlerFactory(
+      std::shared_ptr<const athena::resources::HttpArchive> archive);
+
+  CefRefPtr<CefResourceHandler> Create(CefRefPtr<CefBrowser> browser,
+                                       CefRefPtr<CefFrame> frame,
+                                       const CefString& scheme_name,
+                                       CefRefPtr<CefRequest> request) override;
+
+ private:
+  std::shared_ptr<const athena::resources::HttpArchive> archive_;
+
+  IMPLEMENT_REFCOUNTING(ArchiveSchemeHandlerFactory);
+};
+
+// Passes a response body through unchanged while keeping a copy (record mode).
+// Bodies larger than HttpArchive::kMaxBodySize are passed through but not kept.
+class RecordingResponseFilter : public CefResponseFilter {
+ public:
+  RecordingResponseFilter();
+
+  // CefResponseFilter methods
+  bool InitFilter() override;
+  FilterStatus Filter(void* data_in,
+                      size_t data_in_size,
+                      size_t& data_in_read,
+                      void* data_out,
+                      size_t data_out_size,
+                      size_t& data_out_written) override;
+
+  // False if the body outgrew the recording limit
+  bool IsRecordable() const { return !overflowed_; }
+  std::string TakeBody() { return std::move(body_); }
+
+ private:
+  std::string body_;
+  bool overflowed_;
+
+  IMPLEMENT_REFCOUNTING(RecordingResponseFilter);
+};
+
 #endif  // ATHENA_SCHEME_HANDLER_H_
\ No newline at end of file
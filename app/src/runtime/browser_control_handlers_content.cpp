@@ -4,12 +4,14 @@
  * Handlers for basic content operations: HTML retrieval, JavaScript execution, screenshots.
  */
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "runtime/browser_control_server.h"
 #include "runtime/browser_control_server_internal.h"
 #include "runtime/js_execution_utils.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
+#include <algorithm>
 #include <nlohmann/json.hpp>
 
 namespace athena {
@@ -17,6 +19,58 @@ namespace runtime {
 
 static utils::Logger logger("BrowserControlServer");
 
+namespace {
+
+// Page geometry needed for full-page capture (CSS pixels)
+struct PageMetrics {
+  int scroll_height = 0;
+  int viewport_height = 0;
+  int scroll_x = 0;
+  int scroll_y = 0;
+};
+
+std::optional<PageMetrics> MeasurePage(const std::shared_ptr<platform::TabHost>& window) {
+  QString js = R"(
+    return (function() {
+      const doc = document.documentElement;
+      const body = document.body;
+      return {
+        scrollHeight: Math.max(doc.scrollHeight, body ? body.scrollHeight : 0),
+        viewportHeight: window.innerHeight,
+        scrollX: Math.round(window.scrollX),
+        scrollY: Math.round(window.scrollY)
+      };
+    })();
+  )";
+
+  QString result = window->ExecuteJavaScript(js);
+  std::string parse_error;
+  auto exec = ParseJsExecutionResultString(result.toStdString(), parse_error);
+  if (!exec.has_value() || !exec->success) {
+    logger.Warn("Full page measurement failed: {}",
+                exec.has_value() ? exec->error_message : parse_error);
+    return std::nullopt;
+  }
+
+  nlohmann::json value = exec->value;
+  if (value.is_string() && JsonStringLooksLikeObject(value)) {
+    value = nlohmann::json::parse(value.get<std::string>(), nullptr, false);
+  }
+  if (!value.is_object()) {
+    logger.Warn("Full page measurement returned unexpected result");
+    return std::nullopt;
+  }
+
+  PageMetrics metrics;
+  metrics.scroll_height = value.value("scrollHeight", 0);
+  metrics.viewport_height = value.value("viewportHeight", 0);
+  metrics.scroll_x = value.value("scrollX", 0);
+  metrics.scroll_y = value.value("scrollY", 0);
+  return metrics;
+}
+
+}  // namespace
+
 // ============================================================================
 // Content Handlers
 // ============================================================================
@@ -49,6 +103,7 @@ std::string BrowserControlServer::HandleGetPageHtml(std::optional<size_t> tab_in
     nlohmann::json response = {{"success", true},
                                {"html", html.toStdString()},
                                {"tabIndex", static_cast<int>(window->GetActiveTabIndex())}};
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return response.dump();
 
   } catch (const std::exception& e) {
@@ -106,6 +161,7 @@ std::string BrowserControlServer::HandleExecuteJavaScript(const std::string& cod
       response["stringResult"] = exec->string_value;
     }
 
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return response.dump();
 
   } catch (const std::exception& e) {
@@ -114,7 +170,8 @@ std::string BrowserControlServer::HandleExecuteJavaScript(const std::string& cod
 }
 
 std::string BrowserControlServer::HandleTakeScreenshot(std::optional<size_t> tab_index,
-                                                       std::optional<bool> full_page) {
+                                                       std::optional<bool> full_page,
+                                                       std::optional<uint64_t> if_changed_since) {
   auto window = window_.lock();
   if (!running_ || !window) {
     return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
@@ -133,19 +190,78 @@ std::string BrowserControlServer::HandleTakeScreenshot(std::optional<size_t> tab
     }
 
     if (full_page.value_or(false)) {
-      logger.Warn("Full page screenshot requested but not supported; capturing viewport only");
+      auto metrics = MeasurePage(window);
+      if (metrics && metrics->viewport_height > 0 &&
+          metrics->scroll_height > metrics->viewport_height) {
+        const int page_height = std::min(metrics->scroll_height, kMaxFullPageHeight);
+        QString base64_png = window->TakeFullPageScreenshot(
+            page_height, metrics->viewport_height, metrics->scroll_x, metrics->scroll_y);
+        if (base64_png.isEmpty()) {
+          return nlohmann::json{{"success", false},
+                                {"error", "Failed to capture full page screenshot"}}
+              .dump();
+        }
+
+        // Change tokens describe the viewport, so full-page captures don't carry one
+        return nlohmann::json{{"success", true},
+                              {"screenshot", base64_png.toStdString()},
+                              {"fullPage", true},
+                              {"pageHeight", metrics->scroll_height},
+                              {"truncated", metrics->scroll_height > page_height},
+                              {"tabIndex", static_cast<int>(target_tab)},
+                              {"loadWaitTimedOut", !ready}}
+            .dump();
+      }
+
+      if (!metrics) {
+        logger.Warn("Could not measure page; capturing viewport only");
+      }
+      // Page fits in the viewport: a regular capture is the full page
     }
 
-    QString base64_png = window->TakeScreenshot();
+    // Consume damage before reading pixels: anything painted after this point
+    // is attributed to the next capture, so no change is ever lost.
+    auto damage = window->ConsumeDamage(if_changed_since);
+    std::string change_token = std::to_string(damage.token);
+
+    if (!damage.changed) {
+      logger.Debug("HandleTakeScreenshot: no repaint since token {}, skipping capture",
+                   change_token);
+      return nlohmann::json{{"success", true},
+                            {"changed", false},
+                            {"changeToken", change_token},
+                            {"tabIndex", static_cast<int>(target_tab)},
+                            {"loadWaitTimedOut", !ready}}
+          .dump();
+    }
+
+    // Only crop when the caller can reconcile the region with a previous frame
+    const core::Rect* region = damage.full_frame ? nullptr : &damage.bounds;
+
+    QString base64_png = window->TakeScreenshot(region);
     if (base64_png.isEmpty()) {
       return nlohmann::json{{"success", false}, {"error", "Failed to capture screenshot"}}.dump();
     }
 
-    return nlohmann::json{{"success", true},
-                          {"screenshot", base64_png.toStdString()},
-                          {"tabIndex", static_cast<int>(target_tab)},
-                          {"loadWaitTimedOut", !ready}}
-        .dump();
+    nlohmann::json response = {{"success", true},
+                               {"screenshot", base64_png.toStdString()},
+                               {"changed", true},
+                               {"changeToken", change_token},
+                               {"tabIndex", static_cast<int>(target_tab)},
+                               {"loadWaitTimedOut", !ready}};
+
+    if (region) {
+      // Physical pixels within the full frame; the image itself is scaled like any screenshot
+      response["region"] = {{"x", region->x},
+                            {"y", region->y},
+                            {"width", region->width},
+                            {"height", region->height}};
+      response["frameSize"] = {{"width", damage.frame_size.width},
+                               {"height", damage.frame_size.height}};
+    }
+
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
+    return response.dump();
 
   } catch (const std::exception& e) {
     return nlohmann::json{{"success", false}, {"error", e.what()}}.dump();
@@ -9,14 +9,18 @@
  * - Annotated screenshots
  */
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "runtime/browser_control_server.h"
 #include "runtime/browser_control_server_internal.h"
 #include "runtime/js_execution_utils.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
 #include <map>
 #include <nlohmann/json.hpp>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace athena {
 namespace runtime {
@@ -72,10 +76,10 @@ std::string BrowserControlServer::HandleGetPageSummary(std::optional<size_t> tab
       };
     )";
 
-    QString result = window->ExecuteJavaScript(js);
-    logger.Info("Raw JS result: {}", result.toStdString());
+    const std::string result = window->ExecuteJavaScript(js).toStdString();
+    ATHENA_LOG_DEBUG(logger, "Raw JS result: {}", result);
     std::string parse_error;
-    auto exec = ParseJsExecutionResultString(result.toStdString(), parse_error);
+    auto exec = ParseJsExecutionResultString(result, parse_error);
     if (!exec.has_value()) {
       logger.Error("Page summary parsing failed: {}", parse_error);
       return nlohmann::json{
@@ -84,10 +88,11 @@ std::string BrowserControlServer::HandleGetPageSummary(std::optional<size_t> tab
           .dump();
     }
 
-    logger.Info("Parsed exec result - success: {}, type: {}, value: {}",
-                exec->success,
-                exec->type,
-                exec->value.dump());
+    ATHENA_LOG_DEBUG(logger,
+                     "Parsed exec result - success: {}, type: {}, value: {}",
+                     exec->success,
+                     exec->type,
+                     exec->value.dump());
 
     if (!exec->success) {
       logger.Warn("Page summary script execution failed: {}", exec->error_message);
@@ -99,7 +104,7 @@ std::string BrowserControlServer::HandleGetPageSummary(std::optional<size_t> tab
     }
 
     nlohmann::json summary = exec->value;
-    logger.Info("Summary value: {}", summary.dump());
+    ATHENA_LOG_DEBUG(logger, "Summary value: {}", summary.dump());
 
     if (!summary.is_object()) {
       logger.Error("Page summary result is not an object. Type: {}, Value: {}",
@@ -110,6 +115,7 @@ std::string BrowserControlServer::HandleGetPageSummary(std::optional<size_t> tab
           .dump();
     }
 
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return nlohmann::json{
         {"success", true}, {"summary", summary}, {"tabIndex", static_cast<int>(target_tab)}}
         .dump();
@@ -233,6 +239,7 @@ std::string BrowserControlServer::HandleGetInteractiveElements(std::optional<siz
           .dump();
     }
 
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return nlohmann::json{{"success", true},
                           {"elements", elements},
                           {"count", elements.size()},
@@ -356,6 +363,7 @@ std::string BrowserControlServer::HandleGetAccessibilityTree(std::optional<size_
       }
     }
 
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return nlohmann::json{
         {"success", true}, {"tree", tree}, {"tabIndex", static_cast<int>(target_tab)}}
         .dump();
@@ -410,15 +418,17 @@ std::string BrowserControlServer::HandleQueryContent(const std::string& query_ty
     }
 
     QString js = QString::fromStdString("return (function() { return " + it->second + "; })();");
-    logger.Info("Query content ({}) - Executing JS (first 200 chars): {}",
-                query_type,
-                js.toStdString().substr(0, 200));
-    QString result = window->ExecuteJavaScript(js);
-    logger.Info("Query content ({}) - Raw result (first 500 chars): {}",
-                query_type,
-                result.toStdString().substr(0, 500));
+    ATHENA_LOG_DEBUG(logger,
+                     "Query content ({}) - Executing JS (first 200 chars): {}",
+                     query_type,
+                     js.toStdString().substr(0, 200));
+    const std::string result = window->ExecuteJavaScript(js).toStdString();
+    ATHENA_LOG_DEBUG(logger,
+                     "Query content ({}) - Raw result (first 500 chars): {}",
+                     query_type,
+                     std::string_view(result).substr(0, 500));
     std::string parse_error;
-    auto exec = ParseJsExecutionResultString(result.toStdString(), parse_error);
+    auto exec = ParseJsExecutionResultString(result, parse_error);
     if (!exec.has_value()) {
       logger.Error("Query content ({}) parse error: {}", query_type, parse_error);
       return nlohmann::json{
@@ -436,12 +446,14 @@ std::string BrowserControlServer::HandleQueryContent(const std::string& query_ty
     }
 
     nlohmann::json data = exec->value;
-    logger.Info("Query content ({}) - exec->value type: {}, is_string: {}, is_null: {}, dump: {}",
-                query_type,
-                exec->type,
-                data.is_string(),
-                data.is_null(),
-                data.dump().substr(0, 200));
+    ATHENA_LOG_DEBUG(logger,
+                     "Query content ({}) - exec->value type: {}, is_string: {}, is_null: {}, "
+                     "dump: {}",
+                     query_type,
+                     exec->type,
+                     data.is_string(),
+                     data.is_null(),
+                     data.dump().substr(0, 200));
     if (data.is_string() && JsonStringLooksLikeObject(data)) {
       try {
         data = nlohmann::json::parse(data.get<std::string>());
@@ -451,6 +463,7 @@ std::string BrowserControlServer::HandleQueryContent(const std::string& query_ty
       }
     }
 
+    ATHENA_TRACE_SCOPE("control", "JsonDump");
     return nlohmann::json{{"success", true},
                           {"queryType", query_type},
                           {"data", data},
@@ -481,13 +494,8 @@ std::string BrowserControlServer::HandleGetAnnotatedScreenshot(std::optional<siz
           "HandleGetAnnotatedScreenshot: page still reporting loading state, capturing anyway");
     }
 
-    // Get screenshot (automatically scaled to 0.5 for AI analysis)
-    QString screenshot_base64 = window->TakeScreenshot();
-    if (screenshot_base64.isEmpty()) {
-      return nlohmann::json{{"success", false}, {"error", "Failed to capture screenshot"}}.dump();
-    }
-
-    // Get interactive element positions
+    // Collect element bounds only; overlays are drawn natively on the captured
+    // frame, so the page is never mutated and no extra repaint is needed.
     QString js = R"(
       return (function() {
         const elements = [];
@@ -524,12 +532,16 @@ std::string BrowserControlServer::HandleGetAnnotatedScreenshot(std::optional<siz
           }
         });
 
-        return elements.slice(0, 50);  // Return array directly (limited to 50 elements)
+        return {
+          viewportWidth: window.innerWidth,
+          elements: elements.slice(0, 50)  // Limited to 50 elements
+        };
       })();
     )";
 
     QString elements_result = window->ExecuteJavaScript(js);
     nlohmann::json elements_json = nlohmann::json::array();
+    int viewport_width = 0;
 
     std::string parse_error;
     auto exec = ParseJsExecutionResultString(elements_result.toStdString(), parse_error);
@@ -544,17 +556,39 @@ std::string BrowserControlServer::HandleGetAnnotatedScreenshot(std::optional<siz
           tmp = nlohmann::json::parse(tmp.get<std::string>());
         } catch (const nlohmann::json::parse_error& e) {
           logger.Error("Failed to parse annotated screenshot elements JSON: {}", e.what());
-          tmp = nlohmann::json::array();
+          tmp = nlohmann::json::object();
         }
       }
 
-      if (tmp.is_array()) {
-        elements_json = tmp;
+      if (tmp.is_object() && tmp.contains("elements") && tmp["elements"].is_array()) {
+        elements_json = tmp["elements"];
+        viewport_width = tmp.value("viewportWidth", 0);
       } else {
-        logger.Warn("Annotated screenshot elements result is not an array");
+        logger.Warn("Annotated screenshot elements result is not an object with elements");
       }
     }
 
+    std::vector<rendering::Annotation> annotations;
+    annotations.reserve(elements_json.size());
+    for (const auto& element : elements_json) {
+      if (!element.is_object()) {
+        continue;
+      }
+      rendering::Annotation annotation;
+      annotation.bounds = core::Rect(element.value("x", 0),
+                                     element.value("y", 0),
+                                     element.value("width", 0),
+                                     element.value("height", 0));
+      annotation.label = std::to_string(element.value("index", 0));
+      annotations.push_back(std::move(annotation));
+    }
+
+    // Capture with overlays composited in C++ (scaled to 0.5 for AI analysis)
+    QString screenshot_base64 = window->TakeAnnotatedScreenshot(annotations, viewport_width);
+    if (screenshot_base64.isEmpty()) {
+      return nlohmann::json{{"success", false}, {"error", "Failed to capture screenshot"}}.dump();
+    }
+
     return nlohmann::json{{"success", true},
                           {"screenshot", screenshot_base64.toStdString()},
                           {"elements", elements_json},
@@ -4,7 +4,7 @@
  * Handlers for URL navigation, history, reload, and tab count operations.
  */
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "runtime/browser_control_server.h"
 #include "runtime/browser_control_server_internal.h"
 #include "utils/logging.h"
@@ -113,8 +113,10 @@ std::string BrowserControlServer::HandleGetTabCount() {
   }
 }
 
-std::string BrowserControlServer::HandleNavigate(const std::string& url,
-                                                 std::optional<size_t> tab_index) {
+std::string BrowserControlServer::HandleNavigate(
+    const std::string& url,
+    std::optional<size_t> tab_index,
+    const browser::LoadTracker::WaitCondition& wait_until) {
   auto window = window_.lock();
   if (!running_ || !window) {
     return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
@@ -134,7 +136,7 @@ std::string BrowserControlServer::HandleNavigate(const std::string& url,
   const auto start = std::chrono::steady_clock::now();
   window->LoadURL(QString::fromStdString(url));
 
-  bool loaded = window->WaitForLoadToComplete(target_tab, kDefaultNavigationTimeoutMs);
+  bool loaded = window->WaitForLoadState(target_tab, wait_until, kDefaultNavigationTimeoutMs);
   auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                      std::chrono::steady_clock::now() - start)
                      .count();
@@ -143,6 +145,7 @@ std::string BrowserControlServer::HandleNavigate(const std::string& url,
     return nlohmann::json{{"success", false},
                           {"error", "Navigation timed out"},
                           {"tabIndex", static_cast<int>(target_tab)},
+                          {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                           {"loadTimeMs", elapsed}}
         .dump();
   }
@@ -151,12 +154,15 @@ std::string BrowserControlServer::HandleNavigate(const std::string& url,
   return nlohmann::json{{"success", true},
                         {"tabIndex", static_cast<int>(target_tab)},
                         {"finalUrl", final_url.empty() ? url : final_url},
+                        {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                         {"loadTimeMs", elapsed}}
       .dump();
 }
 
-std::string BrowserControlServer::HandleHistory(const std::string& action,
-                                                std::optional<size_t> tab_index) {
+std::string BrowserControlServer::HandleHistory(
+    const std::string& action,
+    std::optional<size_t> tab_index,
+    const browser::LoadTracker::WaitCondition& wait_until) {
   auto window = window_.lock();
   if (!running_ || !window) {
     return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
@@ -183,7 +189,7 @@ std::string BrowserControlServer::HandleHistory(const std::string& action,
   } else {
     return nlohmann::json{{"success", false}, {"error", "Invalid history action"}}.dump();
   }
-  bool loaded = window->WaitForLoadToComplete(target_tab, kDefaultNavigationTimeoutMs);
+  bool loaded = window->WaitForLoadState(target_tab, wait_until, kDefaultNavigationTimeoutMs);
   auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                      std::chrono::steady_clock::now() - start)
                      .count();
@@ -193,6 +199,7 @@ std::string BrowserControlServer::HandleHistory(const std::string& action,
                           {"error", "Navigation timed out"},
                           {"action", action_lower},
                           {"tabIndex", static_cast<int>(target_tab)},
+                          {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                           {"loadTimeMs", elapsed}}
         .dump();
   }
@@ -202,12 +209,15 @@ std::string BrowserControlServer::HandleHistory(const std::string& action,
                         {"action", action_lower},
                         {"tabIndex", static_cast<int>(target_tab)},
                         {"finalUrl", final_url},
+                        {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                         {"loadTimeMs", elapsed}}
       .dump();
 }
 
-std::string BrowserControlServer::HandleReload(std::optional<size_t> tab_index,
-                                               std::optional<bool> ignore_cache) {
+std::string BrowserControlServer::HandleReload(
+    std::optional<size_t> tab_index,
+    std::optional<bool> ignore_cache,
+    const browser::LoadTracker::WaitCondition& wait_until) {
   auto window = window_.lock();
   if (!running_ || !window) {
     return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
@@ -222,7 +232,7 @@ std::string BrowserControlServer::HandleReload(std::optional<size_t> tab_index,
   const auto start = std::chrono::steady_clock::now();
 
   window->Reload(ignore_cache.value_or(false));
-  bool loaded = window->WaitForLoadToComplete(target_tab, kDefaultNavigationTimeoutMs);
+  bool loaded = window->WaitForLoadState(target_tab, wait_until, kDefaultNavigationTimeoutMs);
   auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                      std::chrono::steady_clock::now() - start)
                      .count();
@@ -232,6 +242,7 @@ std::string BrowserControlServer::HandleReload(std::optional<size_t> tab_index,
                           {"error", "Reload timed out"},
                           {"tabIndex", static_cast<int>(target_tab)},
                           {"ignoreCache", ignore_cache.value_or(false)},
+                          {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                           {"loadTimeMs", elapsed}}
         .dump();
   }
@@ -239,9 +250,41 @@ std::string BrowserControlServer::HandleReload(std::optional<size_t> tab_index,
   return nlohmann::json{{"success", true},
                         {"tabIndex", static_cast<int>(target_tab)},
                         {"ignoreCache", ignore_cache.value_or(false)},
+                        {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                         {"loadTimeMs", elapsed}}
       .dump();
 }
 
+std::string BrowserControlServer::HandleWaitForLoadState(
+    std::optional<size_t> tab_index,
+    const browser::LoadTracker::WaitCondition& wait_until,
+    int timeout_ms) {
+  auto window = window_.lock();
+  if (!running_ || !window) {
+    return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
+  }
+
+  size_t target_tab = tab_index.value_or(window->GetActiveTabIndex());
+  if (target_tab >= window->GetTabCount()) {
+    return nlohmann::json{{"success", false}, {"error", "Invalid tab index"}}.dump();
+  }
+
+  // Waiting does not switch tabs: background tabs keep loading
+  const auto start = std::chrono::steady_clock::now();
+  bool reached = window->WaitForLoadState(target_tab, wait_until, timeout_ms);
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+
+  nlohmann::json response{{"success", reached},
+                          {"tabIndex", static_cast<int>(target_tab)},
+                          {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
+                          {"waitTimeMs", elapsed}};
+  if (!reached) {
+    response["error"] = "Wait timed out";
+  }
+  return response.dump();
+}
+
 }  // namespace runtime
 }  // namespace athena
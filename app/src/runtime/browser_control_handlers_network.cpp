@@ -0,0 +1,103 @@
+/**
+ * Browser Control Server - Network Handlers
+ *
+ * Handlers for per-tab resource blocking.
+ */
+
+#include "browser/resource_filter.h"
+#include "platform/tab_host.h"
+#include "runtime/browser_control_server.h"
+#include "runtime/browser_control_server_internal.h"
+#include "utils/logging.h"
+
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+
+namespace athena {
+namespace runtime {
+
+static utils::Logger logger("BrowserControlServer");
+
+namespace {
+
+nlohmann::json DescribeFilter(size_t tab_index, const browser::ResourceFilter* filter) {
+  nlohmann::json types = nlohmann::json::array();
+  nlohmann::json domains = nlohmann::json::array();
+  nlohmann::json patterns = nlohmann::json::array();
+  uint64_t blocked = 0;
+
+  if (filter) {
+    const auto& rules = filter->GetRules();
+    for (auto type : rules.blocked_types) {
+      types.push_back(browser::ResourceFilter::ResourceTypeName(type));
+    }
+    domains = rules.blocked_domains;
+    patterns = rules.blocked_patterns;
+    blocked = filter->GetBlockedCount();
+  }
+
+  return nlohmann::json{{"success", true},
+                        {"tabIndex", tab_index},
+                        {"types", types},
+                        {"domains", domains},
+                        {"patterns", patterns},
+                        {"blockedCount", blocked}};
+}
+
+}  // namespace
+
+// ============================================================================
+// Resource Blocking Handlers
+// ============================================================================
+
+std::string BrowserControlServer::HandleSetResourceFilter(
+    std::optional<size_t> tab_index, const browser::ResourceFilter::Rules& rules) {
+  auto window = window_.lock();
+  if (!running_ || !window) {
+    return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
+  }
+
+  size_t index = tab_index.value_or(window->GetActiveTabIndex());
+  if (index >= window->GetTabCount()) {
+    return nlohmann::json{{"success", false}, {"error", "Invalid tab index"}}.dump();
+  }
+
+  // An empty rule set clears the filter, so the tab skips per-request checks
+  auto filter = std::make_shared<const browser::ResourceFilter>(rules);
+  if (filter->IsEmpty()) {
+    filter.reset();
+  }
+  if (!window->SetResourceFilter(index, filter)) {
+    return nlohmann::json{{"success", false}, {"error", "Invalid tab index"}}.dump();
+  }
+
+  if (filter) {
+    logger.Info("Resource filter set for tab {}: {} types, {} domains, {} patterns",
+                index,
+                filter->GetRules().blocked_types.size(),
+                filter->GetRules().blocked_domains.size(),
+                filter->GetRules().blocked_patterns.size());
+  } else {
+    logger.Info("Resource filter cleared for tab {}", index);
+  }
+  return DescribeFilter(index, filter.get()).dump();
+}
+
+std::string BrowserControlServer::HandleGetResourceFilter(std::optional<size_t> tab_index) {
+  auto window = window_.lock();
+  if (!running_ || !window) {
+    return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
+  }
+
+  size_t index = tab_index.value_or(window->GetActiveTabIndex());
+  if (index >= window->GetTabCount()) {
+    return nlohmann::json{{"success", false}, {"error", "Invalid tab index"}}.dump();
+  }
+
+  auto filter = window->GetResourceFilter(index);
+  return DescribeFilter(index, filter.get()).dump();
+}
+
+}  // namespace runtime
+}  // namespace athena
@@ -4,13 +4,14 @@
  * Handlers for tab creation, closing, switching, and information.
  */
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "runtime/browser_control_server.h"
 #include "runtime/browser_control_server_internal.h"
 #include "utils/logging.h"
 
 #include <chrono>
 #include <nlohmann/json.hpp>
+#include <vector>
 
 namespace athena {
 namespace runtime {
@@ -21,7 +22,8 @@ static utils::Logger logger("BrowserControlServer");
 // Tab Management Handlers
 // ============================================================================
 
-std::string BrowserControlServer::HandleCreateTab(const std::string& url) {
+std::string BrowserControlServer::HandleCreateTab(
+    const std::string& url, const browser::LoadTracker::WaitCondition& wait_until) {
   auto window = window_.lock();
   if (!running_ || !window) {
     return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
@@ -33,8 +35,8 @@ std::string BrowserControlServer::HandleCreateTab(const std::string& url) {
     return nlohmann::json{{"success", false}, {"error", "Failed to create tab"}}.dump();
   }
 
-  bool loaded =
-      window->WaitForLoadToComplete(static_cast<size_t>(tab_index), kDefaultNavigationTimeoutMs);
+  bool loaded = window->WaitForLoadState(
+      static_cast<size_t>(tab_index), wait_until, kDefaultNavigationTimeoutMs);
   auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
                      std::chrono::steady_clock::now() - start)
                      .count();
@@ -43,6 +45,7 @@ std::string BrowserControlServer::HandleCreateTab(const std::string& url) {
     return nlohmann::json{{"success", false},
                           {"error", "Tab creation timed out"},
                           {"tabIndex", tab_index},
+                          {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                           {"loadTimeMs", elapsed}}
         .dump();
   }
@@ -52,6 +55,7 @@ std::string BrowserControlServer::HandleCreateTab(const std::string& url) {
                         {"tabIndex", tab_index},
                         {"url", url},
                         {"finalUrl", final_url.empty() ? url : final_url},
+                        {"waitUntil", browser::LoadTracker::DescribeWaitCondition(wait_until)},
                         {"loadTimeMs", elapsed}}
       .dump();
 }
@@ -96,7 +100,64 @@ std::string BrowserControlServer::HandleTabInfo() {
 
   size_t count = window->GetTabCount();
   size_t active = window->GetActiveTabIndex();
-  return nlohmann::json{{"success", true}, {"count", count}, {"activeTabIndex", active}}.dump();
+
+  // Hibernated tabs: restored on /internal/tab/switch
+  nlohmann::json discarded = nlohmann::json::array();
+  for (size_t i = 0; i < count; ++i) {
+    if (auto snapshot = window->GetDiscardedTab(i)) {
+      discarded.push_back({{"tabIndex", i},
+                           {"url", snapshot->url},
+                           {"title", snapshot->title},
+                           {"thumbnail", snapshot->thumbnail_png}});
+    }
+  }
+
+  return nlohmann::json{{"success", true},
+                        {"count", count},
+                        {"activeTabIndex", active},
+                        {"discardedTabs", discarded}}
+      .dump();
+}
+
+std::string BrowserControlServer::HandleGetFrameRates() {
+  auto window = window_.lock();
+  if (!running_ || !window) {
+    return nlohmann::json{{"success", false}, {"error", "Server is shutting down"}}.dump();
+  }
+
+  auto metrics = window->GetFrameRateMetrics();
+  if (!metrics) {
+    return nlohmann::json{{"success", false}, {"error", "Frame rate governor not available"}}
+        .dump();
+  }
+
+  // Report browsers in tab order
+  std::vector<browser::BrowserId> browser_ids = window->GetTabBrowserIds();
+  nlohmann::json tabs = nlohmann::json::array();
+  for (size_t i = 0; i < browser_ids.size(); ++i) {
+    for (const auto& browser : metrics->browsers) {
+      if (browser.id != browser_ids[i]) {
+        continue;
+      }
+      tabs.push_back({{"tabIndex", i},
+                      {"browserId", browser.id},
+                      {"fps", browser.fps},
+                      {"tier", browser::FrameRateGovernor::TierName(browser.tier)},
+                      {"reason", browser.reason},
+                      {"visible", browser.visible},
+                      {"paintsPerWindow", browser.paints_in_window},
+                      {"rateChanges", browser.rate_changes}});
+    }
+  }
+
+  return nlohmann::json{{"success", true},
+                        {"active", metrics->active},
+                        {"idle", metrics->idle},
+                        {"background", metrics->background},
+                        {"totalFps", metrics->total_fps},
+                        {"rateChanges", metrics->rate_changes},
+                        {"tabs", tabs}}
+      .dump();
 }
 
 }  // namespace runtime
@@ -0,0 +1,44 @@
+/**
+ * Browser Control Server - Trace Handlers
+ *
+ * Handlers for recording spans across control requests and exporting them
+ * as a Chrome trace.
+ */
+
+#include "runtime/browser_control_server.h"
+#include "utils/logging.h"
+#include "utils/trace.h"
+
+#include <nlohmann/json.hpp>
+
+namespace athena {
+namespace runtime {
+
+static utils::Logger logger("BrowserControlServer");
+
+std::string BrowserControlServer::HandleStartTrace(std::optional<size_t> max_events_per_thread) {
+  utils::Tracer& tracer = utils::Tracer::Instance();
+  tracer.Start(max_events_per_thread.value_or(utils::Tracer::kDefaultMaxEventsPerThread));
+
+  // Report the limit actually applied (requests are clamped)
+  const size_t limit = tracer.GetMaxEventsPerThread();
+  logger.Info("Tracing started ({} events per thread)", limit);
+  return nlohmann::json{{"success", true}, {"maxEventsPerThread", limit}}.dump();
+}
+
+std::string BrowserControlServer::HandleStopTrace() {
+  utils::Tracer& tracer = utils::Tracer::Instance();
+  tracer.Stop();
+  const size_t events = tracer.EventCount();
+  const uint64_t dropped = tracer.DroppedCount();
+  logger.Info("Tracing stopped: {} events, {} dropped", events, dropped);
+  return nlohmann::json{{"success", true}, {"events", events}, {"dropped", dropped}}.dump();
+}
+
+std::string BrowserControlServer::HandleGetTrace() {
+  // The body is the trace itself, so it can be saved and opened as is
+  return utils::Tracer::Instance().ExportChromeTrace();
+}
+
+}  // namespace runtime
+}  // namespace athena
@@ -10,9 +10,10 @@
 
 #include "runtime/browser_control_server.h"
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "runtime/browser_control_server_internal.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
 #include <algorithm>
 #include <cstring>
@@ -41,13 +42,15 @@ struct ClientConnection {
   bool headers_complete;
   size_t content_length;
   size_t header_end_pos;  // Cache position where headers end
+  int64_t read_start_us;  // First byte received, when tracing; 0 otherwise
 
   explicit ClientConnection(int client_fd)
       : fd(client_fd),
         notifier(nullptr),
         headers_complete(false),
         content_length(0),
-        header_end_pos(0) {
+        header_end_pos(0),
+        read_start_us(0) {
     // Set non-blocking
     int flags = fcntl(fd, F_GETFL, 0);
     fcntl(fd, F_SETFL, flags | O_NONBLOCK);
@@ -83,7 +86,7 @@ BrowserControlServer::~BrowserControlServer() {
 // Public Methods
 // ============================================================================
 
-void BrowserControlServer::SetBrowserWindow(const std::shared_ptr<platform::QtMainWindow>& window) {
+void BrowserControlServer::SetBrowserWindow(const std::shared_ptr<platform::TabHost>& window) {
   if (window) {
     logger.Debug("Browser window registered with control server");
   } else {
@@ -250,6 +253,11 @@ bool BrowserControlServer::HandleClientData(ClientConnection* client) {
   buffer[bytes_read] = '\0';
   client->buffer.append(buffer, bytes_read);
 
+  utils::Tracer& tracer = utils::Tracer::Instance();
+  if (client->read_start_us == 0 && tracer.IsEnabled()) {
+    client->read_start_us = utils::Tracer::NowMicros();
+  }
+
   // Enforce size limit while reading
   if (client->buffer.size() > MAX_REQUEST_SIZE) {
     logger.Error("Request size exceeds maximum allowed");
@@ -301,11 +309,26 @@ bool BrowserControlServer::HandleClientData(ClientConnection* client) {
     return true;
   }
 
+  // Everything traced from here on, including the renderer's side of any
+  // JavaScript evaluation, is tagged with this request's id
+  utils::ScopedTraceRequest trace_request(tracer.IsEnabled() ? utils::Tracer::NextRequestId() : 0);
+  if (client->read_start_us != 0) {
+    tracer.Record("control",
+                  "SocketRead",
+                  client->read_start_us,
+                  utils::Tracer::NowMicros() - client->read_start_us);
+  }
+
   // We have a complete request - process it on main thread (we're already on it!)
   std::string response = ProcessRequest(client->buffer);
 
   // Send response
-  ssize_t bytes_sent = send(client->fd, response.c_str(), response.size(), 0);
+  ssize_t bytes_sent = 0;
+  {
+    utils::TraceSpan span("control", "Send");
+    span.AddArg("bytes", static_cast<int64_t>(response.size()));
+    bytes_sent = send(client->fd, response.c_str(), response.size(), 0);
+  }
   if (bytes_sent < 0) {
     logger.Error("Failed to send response");
   } else {
@@ -14,12 +14,16 @@
  * - browser_control_handlers_tabs.cpp: Tab management handlers
  * - browser_control_handlers_content.cpp: HTML, JavaScript, screenshot handlers
  * - browser_control_handlers_extraction.cpp: Advanced content extraction handlers
+ * - browser_control_handlers_network.cpp: Per-tab resource blocking handlers
+ * - browser_control_handlers_trace.cpp: Trace recording and export handlers
  * - browser_control_server_internal.h: Shared utilities and constants
  */
 
 #ifndef ATHENA_RUNTIME_BROWSER_CONTROL_SERVER_H_
 #define ATHENA_RUNTIME_BROWSER_CONTROL_SERVER_H_
 
+#include "browser/load_tracker.h"
+#include "browser/resource_filter.h"
 #include "utils/error.h"
 
 #include <functional>
@@ -33,7 +37,7 @@ class QSocketNotifier;
 
 namespace athena {
 namespace platform {
-class QtMainWindow;
+class TabHost;
 }
 }  // namespace athena
 
@@ -106,9 +110,10 @@ class BrowserControlServer {
    * Set the browser window to control.
    * Must be called before Initialize().
    *
-   * @param window Shared pointer to QtMainWindow (server stores a weak reference)
+   * @param window Tab host to drive (QtMainWindow or HeadlessWindow); the server stores a
+   *               weak reference
    */
-  void SetBrowserWindow(const std::shared_ptr<platform::QtMainWindow>& window);
+  void SetBrowserWindow(const std::shared_ptr<platform::TabHost>& window);
 
   /**
    * Initialize the server and start listening.
@@ -138,7 +143,7 @@ class BrowserControlServer {
   BrowserControlServerConfig config_;
 
   // Browser window (weak reference, does not own)
-  std::weak_ptr<platform::QtMainWindow> window_;
+  std::weak_ptr<platform::TabHost> window_;
 
   // Socket file descriptor
   int server_fd_;
@@ -164,14 +169,32 @@ class BrowserControlServer {
   std::string HandleGetTabCount();
   std::string HandleGetPageHtml(std::optional<size_t> tab_index);
   std::string HandleExecuteJavaScript(const std::string& code, std::optional<size_t> tab_index);
-  std::string HandleTakeScreenshot(std::optional<size_t> tab_index, std::optional<bool> full_page);
-  std::string HandleNavigate(const std::string& url, std::optional<size_t> tab_index);
-  std::string HandleHistory(const std::string& action, std::optional<size_t> tab_index);
-  std::string HandleReload(std::optional<size_t> tab_index, std::optional<bool> ignore_cache);
-  std::string HandleCreateTab(const std::string& url);
+  std::string HandleTakeScreenshot(std::optional<size_t> tab_index,
+                                   std::optional<bool> full_page,
+                                   std::optional<uint64_t> if_changed_since);
+  std::string HandleNavigate(const std::string& url,
+                             std::optional<size_t> tab_index,
+                             const browser::LoadTracker::WaitCondition& wait_until);
+  std::string HandleHistory(const std::string& action,
+                            std::optional<size_t> tab_index,
+                            const browser::LoadTracker::WaitCondition& wait_until);
+  std::string HandleReload(std::optional<size_t> tab_index,
+                           std::optional<bool> ignore_cache,
+                           const browser::LoadTracker::WaitCondition& wait_until);
+  std::string HandleWaitForLoadState(std::optional<size_t> tab_index,
+                                     const browser::LoadTracker::WaitCondition& wait_until,
+                                     int timeout_ms);
+  std::string HandleCreateTab(const std::string& url,
+                              const browser::LoadTracker::WaitCondition& wait_until);
   std::string HandleCloseTab(size_t tab_index);
   std::string HandleSwitchTab(size_t tab_index);
   std::string HandleTabInfo();
+  std::string HandleGetFrameRates();
+
+  // Tracing handlers (Chrome trace event format)
+  std::string HandleStartTrace(std::optional<size_t> max_events_per_thread);
+  std::string HandleStopTrace();
+  std::string HandleGetTrace();
 
   // Context-efficient content extraction handlers
   std::string HandleGetPageSummary(std::optional<size_t> tab_index);
@@ -180,6 +203,11 @@ class BrowserControlServer {
   std::string HandleQueryContent(const std::string& query_type, std::optional<size_t> tab_index);
   std::string HandleGetAnnotatedScreenshot(std::optional<size_t> tab_index);
 
+  // Resource blocking handlers
+  std::string HandleSetResourceFilter(std::optional<size_t> tab_index,
+                                      const browser::ResourceFilter::Rules& rules);
+  std::string HandleGetResourceFilter(std::optional<size_t> tab_index);
+
   // HTTP helpers
   static std::string ParseHttpMethod(const std::string& request);
   static std::string ParseHttpPath(const std::string& request);
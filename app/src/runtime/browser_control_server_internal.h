@@ -8,8 +8,9 @@
 #ifndef ATHENA_RUNTIME_BROWSER_CONTROL_SERVER_INTERNAL_H_
 #define ATHENA_RUNTIME_BROWSER_CONTROL_SERVER_INTERNAL_H_
 
-#include "platform/qt_mainwindow.h"
+#include "platform/tab_host.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
 #include <memory>
 #include <optional>
@@ -31,6 +32,9 @@ static constexpr int kDefaultNavigationTimeoutMs = 15000;
 // Default timeout for content extraction operations (5 seconds)
 static constexpr int kDefaultContentTimeoutMs = 5000;
 
+// Maximum page height captured by full-page screenshots (CSS pixels)
+static constexpr int kMaxFullPageHeight = 16384;
+
 // ============================================================================
 // Shared Utilities
 // ============================================================================
@@ -44,7 +48,7 @@ static constexpr int kDefaultContentTimeoutMs = 5000;
  * @param error_message Output parameter for error message
  * @return true on success, false on error (check error_message)
  */
-inline bool SwitchToRequestedTab(const std::shared_ptr<platform::QtMainWindow>& window,
+inline bool SwitchToRequestedTab(const std::shared_ptr<platform::TabHost>& window,
                                  std::optional<size_t> tab_index,
                                  std::string& error_message) {
   if (!tab_index.has_value()) {
@@ -58,7 +62,10 @@ inline bool SwitchToRequestedTab(const std::shared_ptr<platform::QtMainWindow>&
   }
 
   if (window->GetActiveTabIndex() != *tab_index) {
+    utils::TraceSpan span("control", "TabSwitch");
+    span.AddArg("tabIndex", static_cast<int64_t>(*tab_index));
     window->SwitchToTab(*tab_index);
+    window->NotifyAgentActivity();  // The target tab now renders at the active rate
   }
   return true;
 }
@@ -7,10 +7,13 @@
 #include "runtime/browser_control_server.h"
 #include "runtime/browser_control_server_internal.h"
 #include "utils/logging.h"
+#include "utils/trace.h"
 
 #include <algorithm>
 #include <nlohmann/json.hpp>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace athena {
 namespace runtime {
@@ -77,6 +80,18 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
 
   logger.Debug("Processing " + method + " " + path);
 
+  utils::TraceSpan span("control", "ProcessRequest");
+  span.AddArg("method", method);
+  span.AddArg("path", path);
+
+  // Keep the tab the agent is driving at the active frame rate (metrics and
+  // trace requests excluded)
+  if (path != "/internal/frame_rates" && path.rfind("/internal/trace", 0) != 0) {
+    if (auto window = window_.lock()) {
+      window->NotifyAgentActivity();
+    }
+  }
+
   auto parse_json = [&](nlohmann::json& json_out) -> bool {
     try {
       if (body.empty()) {
@@ -91,6 +106,26 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
     }
   };
 
+  // Optional "waitUntil" field; defaults to the load event
+  auto parse_wait_until = [](const nlohmann::json& json,
+                             browser::LoadTracker::WaitCondition& condition_out) -> bool {
+    if (!json.contains("waitUntil")) {
+      return true;
+    }
+    if (!json["waitUntil"].is_string()) {
+      return false;
+    }
+    auto condition =
+        browser::LoadTracker::ParseWaitCondition(json["waitUntil"].get<std::string>());
+    if (!condition) {
+      return false;
+    }
+    condition_out = *condition;
+    return true;
+  };
+  constexpr const char* kInvalidWaitUntil =
+      R"({"success":false,"error":"Invalid waitUntil value"})";
+
   // Route to handlers - all run synchronously on main thread
   if (method == "POST" && path == "/internal/open_url") {
     nlohmann::json json;
@@ -152,6 +187,7 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
   } else if ((method == "GET" || method == "POST") && path == "/internal/screenshot") {
     std::optional<size_t> tab_index;
     std::optional<bool> full_page;
+    std::optional<uint64_t> if_changed_since;
     if (method == "POST") {
       nlohmann::json json;
       if (!parse_json(json)) {
@@ -163,8 +199,23 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
       if (json.contains("fullPage") && json["fullPage"].is_boolean()) {
         full_page = json["fullPage"].get<bool>();
       }
+      // Change tokens are 64-bit; accept them as strings so JS clients don't lose precision
+      if (json.contains("ifChangedSince")) {
+        const auto& token = json["ifChangedSince"];
+        if (token.is_number_unsigned()) {
+          if_changed_since = token.get<uint64_t>();
+        } else if (token.is_string()) {
+          try {
+            if_changed_since = std::stoull(token.get<std::string>());
+          } catch (const std::exception&) {
+            return BuildHttpResponse(
+                400, "Bad Request", R"({"success":false,"error":"Invalid ifChangedSince token"})");
+          }
+        }
+      }
     }
-    return BuildHttpResponse(200, "OK", HandleTakeScreenshot(tab_index, full_page));
+    return BuildHttpResponse(
+        200, "OK", HandleTakeScreenshot(tab_index, full_page, if_changed_since));
 
   } else if (method == "POST" && path == "/internal/navigate") {
     nlohmann::json json;
@@ -179,7 +230,12 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
     if (json.contains("tabIndex") && json["tabIndex"].is_number_unsigned()) {
       tab_index = json["tabIndex"].get<size_t>();
     }
-    return BuildHttpResponse(200, "OK", HandleNavigate(json["url"].get<std::string>(), tab_index));
+    browser::LoadTracker::WaitCondition wait_until;
+    if (!parse_wait_until(json, wait_until)) {
+      return BuildHttpResponse(400, "Bad Request", kInvalidWaitUntil);
+    }
+    return BuildHttpResponse(
+        200, "OK", HandleNavigate(json["url"].get<std::string>(), tab_index, wait_until));
 
   } else if (method == "POST" && path == "/internal/history") {
     nlohmann::json json;
@@ -194,8 +250,12 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
     if (json.contains("tabIndex") && json["tabIndex"].is_number_unsigned()) {
       tab_index = json["tabIndex"].get<size_t>();
     }
+    browser::LoadTracker::WaitCondition wait_until;
+    if (!parse_wait_until(json, wait_until)) {
+      return BuildHttpResponse(400, "Bad Request", kInvalidWaitUntil);
+    }
     return BuildHttpResponse(
-        200, "OK", HandleHistory(json["action"].get<std::string>(), tab_index));
+        200, "OK", HandleHistory(json["action"].get<std::string>(), tab_index, wait_until));
 
   } else if (method == "POST" && path == "/internal/reload") {
     nlohmann::json json;
@@ -210,7 +270,35 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
     if (json.contains("ignoreCache") && json["ignoreCache"].is_boolean()) {
       ignore_cache = json["ignoreCache"].get<bool>();
     }
-    return BuildHttpResponse(200, "OK", HandleReload(tab_index, ignore_cache));
+    browser::LoadTracker::WaitCondition wait_until;
+    if (!parse_wait_until(json, wait_until)) {
+      return BuildHttpResponse(400, "Bad Request", kInvalidWaitUntil);
+    }
+    return BuildHttpResponse(200, "OK", HandleReload(tab_index, ignore_cache, wait_until));
+
+  } else if (method == "POST" && path == "/internal/wait") {
+    nlohmann::json json;
+    if (!parse_json(json)) {
+      return BuildHttpResponse(400, "Bad Request", R"({"success":false,"error":"Invalid JSON"})");
+    }
+    if (!json.contains("waitUntil")) {
+      return BuildHttpResponse(
+          400, "Bad Request", R"({"success":false,"error":"Missing waitUntil parameter"})");
+    }
+    browser::LoadTracker::WaitCondition wait_until;
+    if (!parse_wait_until(json, wait_until)) {
+      return BuildHttpResponse(400, "Bad Request", kInvalidWaitUntil);
+    }
+    std::optional<size_t> tab_index;
+    if (json.contains("tabIndex") && json["tabIndex"].is_number_unsigned()) {
+      tab_index = json["tabIndex"].get<size_t>();
+    }
+    int timeout_ms = kDefaultNavigationTimeoutMs;
+    if (json.contains("timeoutMs") && json["timeoutMs"].is_number_unsigned()) {
+      timeout_ms = static_cast<int>(
+          std::min<uint64_t>(json["timeoutMs"].get<uint64_t>(), kDefaultNavigationTimeoutMs));
+    }
+    return BuildHttpResponse(200, "OK", HandleWaitForLoadState(tab_index, wait_until, timeout_ms));
 
   } else if (method == "POST" && path == "/internal/tab/create") {
     nlohmann::json json;
@@ -221,7 +309,12 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
       return BuildHttpResponse(
           400, "Bad Request", R"({"success":false,"error":"Missing url parameter"})");
     }
-    return BuildHttpResponse(200, "OK", HandleCreateTab(json["url"].get<std::string>()));
+    browser::LoadTracker::WaitCondition wait_until;
+    if (!parse_wait_until(json, wait_until)) {
+      return BuildHttpResponse(400, "Bad Request", kInvalidWaitUntil);
+    }
+    return BuildHttpResponse(
+        200, "OK", HandleCreateTab(json["url"].get<std::string>(), wait_until));
 
   } else if (method == "POST" && path == "/internal/tab/close") {
     nlohmann::json json;
@@ -248,6 +341,26 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
   } else if (method == "GET" && path == "/internal/tab_info") {
     return BuildHttpResponse(200, "OK", HandleTabInfo());
 
+  } else if (method == "GET" && path == "/internal/frame_rates") {
+    return BuildHttpResponse(200, "OK", HandleGetFrameRates());
+
+  } else if (method == "POST" && path == "/internal/trace/start") {
+    nlohmann::json json;
+    if (!parse_json(json)) {
+      return BuildHttpResponse(400, "Bad Request", R"({"success":false,"error":"Invalid JSON"})");
+    }
+    std::optional<size_t> max_events_per_thread;
+    if (json.contains("maxEventsPerThread") && json["maxEventsPerThread"].is_number_unsigned()) {
+      max_events_per_thread = json["maxEventsPerThread"].get<size_t>();
+    }
+    return BuildHttpResponse(200, "OK", HandleStartTrace(max_events_per_thread));
+
+  } else if (method == "POST" && path == "/internal/trace/stop") {
+    return BuildHttpResponse(200, "OK", HandleStopTrace());
+
+  } else if (method == "GET" && path == "/internal/trace") {
+    return BuildHttpResponse(200, "OK", HandleGetTrace());
+
   } else if ((method == "GET" || method == "POST") && path == "/internal/get_page_summary") {
     std::optional<size_t> tab_index;
     if (method == "POST") {
@@ -318,6 +431,66 @@ std::string BrowserControlServer::ProcessRequest(const std::string& request) {
     }
     return BuildHttpResponse(200, "OK", HandleGetAnnotatedScreenshot(tab_index));
 
+  } else if (method == "POST" && path == "/internal/set_resource_filter") {
+    nlohmann::json json;
+    if (!parse_json(json)) {
+      return BuildHttpResponse(400, "Bad Request", R"({"success":false,"error":"Invalid JSON"})");
+    }
+    std::optional<size_t> tab_index;
+    if (json.contains("tabIndex") && json["tabIndex"].is_number_unsigned()) {
+      tab_index = json["tabIndex"].get<size_t>();
+    }
+
+    auto read_strings = [&json](const char* key, std::vector<std::string>& out) -> bool {
+      if (!json.contains(key)) {
+        return true;
+      }
+      if (!json[key].is_array()) {
+        return false;
+      }
+      for (const auto& item : json[key]) {
+        if (!item.is_string()) {
+          return false;
+        }
+        out.push_back(item.get<std::string>());
+      }
+      return true;
+    };
+
+    browser::ResourceFilter::Rules rules;
+    std::vector<std::string> types;
+    if (!read_strings("types", types) || !read_strings("domains", rules.blocked_domains) ||
+        !read_strings("patterns", rules.blocked_patterns)) {
+      return BuildHttpResponse(
+          400,
+          "Bad Request",
+          R"({"success":false,"error":"types, domains and patterns must be arrays of strings"})");
+    }
+    for (const auto& name : types) {
+      auto type = browser::ResourceFilter::ParseResourceType(name);
+      if (!type) {
+        return BuildHttpResponse(
+            400,
+            "Bad Request",
+            nlohmann::json{{"success", false}, {"error", "Unknown resource type: " + name}}.dump());
+      }
+      rules.blocked_types.push_back(*type);
+    }
+    return BuildHttpResponse(200, "OK", HandleSetResourceFilter(tab_index, rules));
+
+  } else if ((method == "GET" || method == "POST") && path == "/internal/get_resource_filter") {
+    std::optional<size_t> tab_index;
+    if (method == "POST") {
+      nlohmann::json json;
+      if (!parse_json(json)) {
+        return BuildHttpResponse(400, "Bad Request", R"({"success":false,"error":"Invalid JSON"})");
+      }
+      if (json.contains("tabIndex") && json["tabIndex"].is_number_unsigned()) {
+        tab_index = json["tabIndex"].get<size_t>();
+      }
+    }
+    return BuildHttpResponse(200, "OK", HandleGetResourceFilter(tab_index));
+
   } else {
     logger.Warn("Unknown endpoint: " + path);
     return BuildHttpResponse(404, "Not Found", R"({"success":false,"error":"Endpoint not found"})");
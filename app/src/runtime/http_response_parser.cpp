@@ -0,0 +1,349 @@
+#include "runtime/http_response_parser.h"
+
+#include <algorithm>
+#include <cctype>
+
+namespace athena {
+namespace runtime {
+
+namespace {
+
+bool EqualsIgnoreCase(std::string_view a, std::string_view b) {
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](char x, char y) {
+           return std::tolower(static_cast<unsigned char>(x)) ==
+                  std::tolower(static_cast<unsigned char>(y));
+         });
+}
+
+// True if a comma-separated header value lists |token| (case-insensitive)
+bool HasToken(std::string_view value, std::string_view token) {
+  while (!value.empty()) {
+    size_t comma = value.find(',');
+    std::string_view item = value.substr(0, comma);
+    size_t first = item.find_first_not_of(" \t");
+    size_t last = item.find_last_not_of(" \t");
+    if (first != std::string_view::npos &&
+        EqualsIgnoreCase(item.substr(first, last - first + 1), token)) {
+      return true;
+    }
+    if (comma == std::string_view::npos) {
+      break;
+    }
+    value.remove_prefix(comma + 1);
+  }
+  return false;
+}
+
+std::string_view Trim(std::string_view value) {
+  size_t first = value.find_first_not_of(" \t");
+  if (first == std::string_view::npos) {
+    return {};
+  }
+  size_t last = value.find_last_not_of(" \t");
+  return value.substr(first, last - first + 1);
+}
+
+// Decimal with overflow check; nullopt if not all digits
+std::optional<uint64_t> ParseDecimal(std::string_view text) {
+  if (text.empty() || text.size() > 19) {
+    return std::nullopt;
+  }
+  uint64_t value = 0;
+  for (char c : text) {
+    if (c < '0' || c > '9') {
+      return std::nullopt;
+    }
+    value = value * 10 + static_cast<uint64_t>(c - '0');
+  }
+  return value;
+}
+
+}  // namespace
+
+HttpResponseParser::HttpResponseParser(BodySink sink) : sink_(std::move(sink)) {}
+
+void HttpResponseParser::Reset() {
+  state_ = State::kStatusLine;
+  error_.clear();
+  line_buffer_.clear();
+  header_bytes_ = 0;
+  version_minor_ = 1;
+  status_code_ = 0;
+  headers_.clear();
+  headers_complete_ = false;
+  content_length_.reset();
+  chunked_ = false;
+  close_delimited_ = false;
+  remaining_ = 0;
+}
+
+size_t HttpResponseParser::Feed(std::string_view data) {
+  size_t pos = 0;
+  while (pos < data.size() && state_ != State::kComplete && state_ != State::kError) {
+    switch (state_) {
+      case State::kBody:
+      case State::kChunkData: {
+        // Straight from the caller's buffer to the sink
+        size_t count = static_cast<size_t>(std::min<uint64_t>(remaining_, data.size() - pos));
+        Emit(data.substr(pos, count));
+        pos += count;
+        remaining_ -= count;
+        if (remaining_ == 0) {
+          state_ = state_ == State::kBody ? State::kComplete : State::kChunkDataEnd;
+        }
+        break;
+      }
+      case State::kBodyUntilClose:
+        Emit(data.substr(pos));
+        pos = data.size();
+        break;
+      default: {
+        std::string_view line;
+        if (!TakeLine(data, pos, line)) {
+          break;
+        }
+        HandleLine(line);
+        line_buffer_.clear();
+        break;
+      }
+    }
+  }
+  return pos;
+}
+
+bool HttpResponseParser::FinishAtEof() {
+  if (state_ == State::kBodyUntilClose) {
+    state_ = State::kComplete;
+  }
+  if (state_ != State::kComplete && state_ != State::kError) {
+    Fail("Connection closed before end of response");
+  }
+  return state_ == State::kComplete;
+}
+
+std::optional<std::string_view> HttpResponseParser::GetHeader(std::string_view name) const {
+  for (const auto& [header, value] : headers_) {
+    if (EqualsIgnoreCase(header, name)) {
+      return std::string_view(value);
+    }
+  }
+  return std::nullopt;
+}
+
+bool HttpResponseParser::KeepAlive() const {
+  if (state_ == State::kError || close_delimited_) {
+    return false;
+  }
+  auto connection = GetHeader("connection");
+  if (version_minor_ == 0) {
+    return connection && HasToken(*connection, "keep-alive");
+  }
+  return !(connection && HasToken(*connection, "close"));
+}
+
+// ============================================================================
+// Framing
+// ============================================================================
+
+bool HttpResponseParser::TakeLine(std::string_view data, size_t& pos, std::string_view& line) {
+  size_t newline = data.find('\n', pos);
+  size_t end = newline == std::string_view::npos ? data.size() : newline;
+  size_t length = end - pos;
+
+  // Bound the header block (and trailers); any single line is bounded too
+  if (state_ == State::kStatusLine || state_ == State::kHeaders || state_ == State::kTrailers) {
+    header_bytes_ += length + (newline == std::string_view::npos ? 0 : 1);
+    if (header_bytes_ > kMaxHeaderBytes) {
+      Fail("Response headers too large");
+      return false;
+    }
+  }
+  if (line_buffer_.size() + length > kMaxHeaderBytes) {
+    Fail("Response line too long");
+    return false;
+  }
+
+  if (newline == std::string_view::npos) {
+    line_buffer_.append(data.substr(pos));
+    pos = data.size();
+    return false;
+  }
+
+  // Whole line in this buffer: no copy
+  if (line_buffer_.empty()) {
+    line = data.substr(pos, length);
+  } else {
+    line_buffer_.append(data.substr(pos, length));
+    line = line_buffer_;
+  }
+  pos = newline + 1;
+  if (!line.empty() && line.back() == '\r') {
+    line.remove_suffix(1);
+  }
+  return true;
+}
+
+void HttpResponseParser::HandleLine(std::string_view line) {
+  switch (state_) {
+    case State::kStatusLine:
+      HandleStatusLine(line);
+      break;
+    case State::kHeaders:
+      HandleHeaderLine(line);
+      break;
+    case State::kChunkSize:
+      HandleChunkSize(line);
+      break;
+    case State::kChunkDataEnd:
+      if (!line.empty()) {
+        Fail("Missing CRLF after chunk data");
+        return;
+      }
+      state_ = State::kChunkSize;
+      break;
+    case State::kTrailers:
+      if (line.empty()) {
+        state_ = State::kComplete;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void HttpResponseParser::HandleStatusLine(std::string_view line) {
+  // Tolerate blank lines before the status line (RFC 9112 section 2.2)
+  if (line.empty()) {
+    return;
+  }
+
+  // "HTTP/1.1 200 OK"; the reason phrase may be empty or missing
+  if (line.size() < 12 || line.substr(0, 7) != "HTTP/1." || line[8] != ' ' ||
+      (line.size() > 12 && line[12] != ' ')) {
+    Fail("Invalid status line");
+    return;
+  }
+  if (line[7] != '0' && line[7] != '1') {
+    Fail("Unsupported HTTP version");
+    return;
+  }
+  auto status = ParseDecimal(line.substr(9, 3));
+  if (!status || *status < 100 || *status > 999) {
+    Fail("Invalid status code");
+    return;
+  }
+  version_minor_ = line[7] - '0';
+  status_code_ = static_cast<int>(*status);
+  state_ = State::kHeaders;
+}
+
+void HttpResponseParser::HandleHeaderLine(std::string_view line) {
+  if (line.empty()) {
+    BeginBody();
+    return;
+  }
+
+  if (line.front() == ' ' || line.front() == '\t') {
+    // Obsolete line folding: continue the previous value
+    if (headers_.empty()) {
+      Fail("Invalid header continuation");
+      return;
+    }
+    headers_.back().second.append(" ").append(Trim(line));
+    return;
+  }
+
+  size_t colon = line.find(':');
+  if (colon == std::string_view::npos || colon == 0) {
+    Fail("Invalid header line");
+    return;
+  }
+  std::string_view name = line.substr(0, colon);
+  std::string_view value = Trim(line.substr(colon + 1));
+
+  if (EqualsIgnoreCase(name, "content-length")) {
+    auto length = ParseDecimal(value);
+    if (!length || (content_length_ && *content_length_ != *length)) {
+      Fail("Invalid Content-Length");
+      return;
+    }
+    content_length_ = length;
+  } else if (EqualsIgnoreCase(name, "transfer-encoding")) {
+    // Chunked must be the final coding (RFC 9112 section 6.1)
+    size_t comma = value.rfind(',');
+    std::string_view last = comma == std::string_view::npos ? value : value.substr(comma + 1);
+    chunked_ = EqualsIgnoreCase(Trim(last), "chunked");
+  }
+  headers_.emplace_back(std::string(name), std::string(value));
+}
+
+void HttpResponseParser::BeginBody() {
+  // Interim responses (100 Continue) are followed by the real one
+  if (status_code_ < 200) {
+    headers_.clear();
+    content_length_.reset();
+    chunked_ = false;
+    state_ = State::kStatusLine;
+    return;
+  }
+
+  headers_complete_ = true;
+  header_bytes_ = 0;  // Trailers get their own allowance
+  if (status_code_ == 204 || status_code_ == 304) {
+    state_ = State::kComplete;
+  } else if (chunked_) {
+    content_length_.reset();  // Transfer-Encoding wins (RFC 9112 section 6.3)
+    state_ = State::kChunkSize;
+  } else if (content_length_) {
+    remaining_ = *content_length_;
+    state_ = remaining_ == 0 ? State::kComplete : State::kBody;
+  } else {
+    close_delimited_ = true;
+    state_ = State::kBodyUntilClose;
+  }
+}
+
+void HttpResponseParser::HandleChunkSize(std::string_view line) {
+  // "1a3f" optionally followed by ";extension"
+  std::string_view digits = Trim(line.substr(0, line.find(';')));
+  if (digits.empty() || digits.size() > 15) {
+    Fail("Invalid chunk size");
+    return;
+  }
+  uint64_t size = 0;
+  for (char c : digits) {
+    int digit;
+    if (c >= '0' && c <= '9') {
+      digit = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      digit = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      digit = c - 'A' + 10;
+    } else {
+      Fail("Invalid chunk size");
+      return;
+    }
+    size = size * 16 + static_cast<uint64_t>(digit);
+  }
+
+  if (size == 0) {
+    state_ = State::kTrailers;
+  } else {
+    remaining_ = size;
+    state_ = State::kChunkData;
+  }
+}
+
+void HttpResponseParser::Emit(std::string_view fragment) {
+  if (sink_ && !fragment.empty()) {
+    sink_(fragment);
+  }
+}
+
+void HttpResponseParser::Fail(std::string message) {
+  state_ = State::kError;
+  error_ = std::move(message);
+}
+
+}  // namespace runtime
+}  // namespace athena
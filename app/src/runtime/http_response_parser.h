@@ -0,0 +1,125 @@
+#ifndef ATHENA_RUNTIME_HTTP_RESPONSE_PARSER_H_
+#define ATHENA_RUNTIME_HTTP_RESPONSE_PARSER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace athena {
+namespace runtime {
+
+/**
+ * Incremental HTTP/1.1 response parser (RFC 9112).
+ *
+ * A state machine fed with whatever a socket read returned: the status line,
+ * headers and chunk framing may be split anywhere across Feed() calls. Body
+ * bytes are never accumulated: each piece is handed to the sink as a view
+ * into the caller's buffer, already de-chunked, as soon as it arrives. Only
+ * framing lines split across reads are buffered, and they are short.
+ *
+ * Supports Content-Length, chunked (extensions and trailers ignored) and
+ * close-delimited bodies, bodiless 1xx/204/304 responses, and keep-alive
+ * detection. One parser handles one response at a time; Reset() it to read
+ * the next response on the same connection.
+ *
+ * Not thread-safe.
+ */
+class HttpResponseParser {
+ public:
+  // Receives body data; the view is only valid during the call
+  using BodySink = std::function<void(std::string_view fragment)>;
+
+  // Longest status line plus headers accepted, as protection against garbage
+  static constexpr size_t kMaxHeaderBytes = 64 * 1024;
+
+  explicit HttpResponseParser(BodySink sink = nullptr);
+
+  /**
+   * Parse the next bytes of the response.
+   * @return Bytes consumed. Less than data.size() only once the response is
+   *         complete (the rest belongs to whatever follows it) or on error.
+   */
+  size_t Feed(std::string_view data);
+
+  /**
+   * The connection closed. Completes a close-delimited body.
+   * @return true if the response is complete, false if it was cut short
+   */
+  bool FinishAtEof();
+
+  /**
+   * Prepare for the next response on the same connection.
+   */
+  void Reset();
+
+  bool HeadersComplete() const { return headers_complete_; }
+  bool IsComplete() const { return state_ == State::kComplete; }
+  bool HasError() const { return state_ == State::kError; }
+  const std::string& GetError() const { return error_; }
+
+  int StatusCode() const { return status_code_; }
+
+  /**
+   * First value of a header (case-insensitive name), if present.
+   */
+  std::optional<std::string_view> GetHeader(std::string_view name) const;
+
+  // Declared Content-Length; unset for chunked and close-delimited bodies
+  std::optional<uint64_t> ContentLength() const { return content_length_; }
+
+  /**
+   * Whether the connection can carry another request once this response is
+   * complete: HTTP/1.1 without "Connection: close" (or HTTP/1.0 with
+   * "Connection: keep-alive"), and a body not delimited by closing.
+   */
+  bool KeepAlive() const;
+
+ private:
+  enum class State {
+    kStatusLine,
+    kHeaders,
+    kBody,  // Content-Length bytes left in remaining_
+    kChunkSize,
+    kChunkData,     // Chunk bytes left in remaining_
+    kChunkDataEnd,  // CRLF after chunk data
+    kTrailers,
+    kBodyUntilClose,
+    kComplete,
+    kError,
+  };
+
+  // Take one line (without CRLF) starting at |pos|; false if it is not complete yet
+  bool TakeLine(std::string_view data, size_t& pos, std::string_view& line);
+  void HandleLine(std::string_view line);
+  void HandleStatusLine(std::string_view line);
+  void HandleHeaderLine(std::string_view line);
+  void HandleChunkSize(std::string_view line);
+  void BeginBody();
+  void Emit(std::string_view fragment);
+  void Fail(std::string message);
+
+  BodySink sink_;
+  State state_ = State::kStatusLine;
+  std::string error_;
+  std::string line_buffer_;  // Line split across Feed() calls
+  size_t header_bytes_ = 0;
+
+  int version_minor_ = 1;
+  int status_code_ = 0;
+  std::vector<std::pair<std::string, std::string>> headers_;
+  bool headers_complete_ = false;
+  std::optional<uint64_t> content_length_;
+  bool chunked_ = false;
+  bool close_delimited_ = false;
+  uint64_t remaining_ = 0;
+};
+
+}  // namespace runtime
+}  // namespace athena
+
+#endif  // ATHENA_RUNTIME_HTTP_RESPONSE_PARSER_H_
@@ -1,10 +1,15 @@
 #include "runtime/js_execution_utils.h"
 
+#include "utils/trace.h"
+
 namespace athena {
 namespace runtime {
 
 std::optional<JsExecutionResult> ParseJsExecutionResultString(const std::string& raw,
                                                               std::string& error_out) {
+  utils::TraceSpan span("control", "ParseJsResult");
+  span.AddArg("bytes", static_cast<int64_t>(raw.size()));
+
   if (raw.empty()) {
     error_out = "Renderer returned empty JavaScript result";
     return std::nullopt;
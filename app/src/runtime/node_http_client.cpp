@@ -0,0 +1,280 @@
+#include "runtime/node_http_client.h"
+
+#include "runtime/http_response_parser.h"
+#include "utils/logging.h"
+
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace athena {
+namespace runtime {
+
+// Static logger for this module
+static utils::Logger logger("NodeHttpClient");
+
+namespace {
+
+std::string BuildRequest(const NodeHttpRequest& request) {
+  std::ostringstream out;
+  out << request.method << " " << request.path << " HTTP/1.1\r\n";
+  out << "Host: localhost\r\n";
+  out << "User-Agent: Athena-Browser/1.0\r\n";
+  out << "Connection: keep-alive\r\n";
+
+  if (!request.request_id.empty()) {
+    out << "X-Request-Id: " << request.request_id << "\r\n";
+  }
+
+  if (!request.body.empty()) {
+    out << "Content-Type: application/json\r\n";
+    out << "Content-Length: " << request.body.size() << "\r\n";
+  }
+
+  out << "\r\n";
+  out << request.body;
+  return out.str();
+}
+
+// A parked socket that is readable has been closed by the server (or holds
+// stray bytes); either way it cannot carry the next request
+bool IsStale(int fd) {
+  struct pollfd entry = {fd, POLLIN, 0};
+  return ::poll(&entry, 1, 0) != 0;
+}
+
+}  // namespace
+
+NodeHttpClient::NodeHttpClient(std::string socket_path, NodeHttpClientOptions options)
+    : socket_path_(std::move(socket_path)), options_(options) {
+  for (int i = 0; i < options_.worker_threads; ++i) {
+    workers_.emplace_back(&NodeHttpClient::WorkerLoop, this);
+  }
+}
+
+NodeHttpClient::~NodeHttpClient() {
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    stopping_ = true;
+  }
+  queue_cv_.notify_all();
+  for (std::thread& worker : workers_) {
+    worker.join();
+  }
+
+  // Workers drain nothing once stopping; fail whatever is left
+  for (PendingRequest& pending : queue_) {
+    pending.callback(utils::Error("Node HTTP client shut down"));
+  }
+
+  for (int fd : idle_) {
+    ::close(fd);
+  }
+}
+
+// ============================================================================
+// Requests
+// ============================================================================
+
+utils::Result<std::string> NodeHttpClient::Send(const NodeHttpRequest& request) {
+  const std::string wire_request = BuildRequest(request);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.requests++;
+  }
+
+  // A reused connection may have been closed just as we picked it up; if it
+  // fails before the server said anything, the request never ran: retry once
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    auto connection = Acquire();
+    if (!connection) {
+      return utils::Error(connection.GetError().Message());
+    }
+    const Connection conn = connection.Value();
+
+    bool keep_alive = false;
+    bool received_any = false;
+    auto response = Exchange(conn.fd, wire_request, keep_alive, received_any);
+    if (response) {
+      Release(conn.fd, keep_alive);
+      return response;
+    }
+
+    ::close(conn.fd);
+    if (!conn.reused || received_any) {
+      return response;
+    }
+    logger.Debug("Reused connection failed before a response, retrying: " +
+                 response.GetError().Message());
+  }
+  return utils::Error("Node request failed after retry");
+}
+
+void NodeHttpClient::SendAsync(NodeHttpRequest request, Callback callback) {
+  {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (!stopping_) {
+      queue_.push_back({std::move(request), std::move(callback)});
+      queue_cv_.notify_one();
+      return;
+    }
+  }
+  callback(utils::Error("Node HTTP client shut down"));
+}
+
+NodeHttpClient::Stats NodeHttpClient::GetStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+void NodeHttpClient::WorkerLoop() {
+  while (true) {
+    PendingRequest pending;
+    {
+      std::unique_lock<std::mutex> lock(queue_mutex_);
+      queue_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+      if (stopping_) {
+        return;
+      }
+      pending = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    pending.callback(Send(pending.request));
+  }
+}
+
+// ============================================================================
+// Connections
+// ============================================================================
+
+utils::Result<NodeHttpClient::Connection> NodeHttpClient::Acquire() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (!idle_.empty()) {
+      int fd = idle_.back();
+      idle_.pop_back();
+      if (IsStale(fd)) {
+        ::close(fd);
+        continue;
+      }
+      stats_.connections_reused++;
+      return Connection{fd, true};
+    }
+  }
+
+  auto fd = Connect();
+  if (!fd) {
+    return utils::Error(fd.GetError().Message());
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_.connections_opened++;
+  return Connection{fd.Value(), false};
+}
+
+void NodeHttpClient::Release(int fd, bool keep_alive) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (keep_alive && idle_.size() < options_.max_idle_connections) {
+      idle_.push_back(fd);
+      return;
+    }
+  }
+  ::close(fd);
+}
+
+utils::Result<int> NodeHttpClient::Connect() {
+  int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+  if (sock < 0) {
+    return utils::Error("Failed to create socket: " + std::string(strerror(errno)));
+  }
+
+  struct sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+
+  if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+    int error = errno;
+    close(sock);
+    return utils::Error("Failed to connect to socket: " + std::string(strerror(error)));
+  }
+
+  struct timeval timeout;
+  timeout.tv_sec = options_.io_timeout_ms / 1000;
+  timeout.tv_usec = (options_.io_timeout_ms % 1000) * 1000;
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+  setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+  return sock;
+}
+
+utils::Result<std::string> NodeHttpClient::Exchange(int fd,
+                                                    const std::string& wire_request,
+                                                    bool& keep_alive,
+                                                    bool& received_any) {
+  keep_alive = false;
+  received_any = false;
+
+  // Send request (no SIGPIPE if the server has gone away)
+  size_t sent = 0;
+  while (sent < wire_request.size()) {
+    ssize_t count = send(fd, wire_request.data() + sent, wire_request.size() - sent, MSG_NOSIGNAL);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return utils::Error("Failed to send request: " + std::string(strerror(errno)));
+    }
+    sent += static_cast<size_t>(count);
+  }
+
+  // Receive response, decoding straight into the body as bytes arrive
+  std::string response_body;
+  HttpResponseParser parser(
+      [&response_body](std::string_view fragment) { response_body.append(fragment); });
+  char buffer[4096];
+
+  while (!parser.IsComplete()) {
+    ssize_t received = recv(fd, buffer, sizeof(buffer), 0);
+    if (received < 0 && errno == EINTR) {
+      continue;
+    }
+    if (received < 0) {
+      return utils::Error("Failed to receive response: " + std::string(strerror(errno)));
+    }
+    if (received == 0) {
+      if (!received_any) {
+        return utils::Error("Failed to receive response: connection closed by server");
+      }
+      if (!parser.FinishAtEof()) {
+        return utils::Error("Incomplete response: " + parser.GetError());
+      }
+      break;
+    }
+
+    received_any = true;
+    size_t count = static_cast<size_t>(received);
+    size_t consumed = parser.Feed(std::string_view(buffer, count));
+    if (parser.HasError()) {
+      return utils::Error("Invalid response: " + parser.GetError());
+    }
+    if (parser.HeadersComplete() && response_body.empty() && parser.ContentLength()) {
+      response_body.reserve(static_cast<size_t>(*parser.ContentLength()));
+    }
+    if (consumed < count) {
+      // Bytes past the response: the connection is out of step, do not reuse it
+      keep_alive = false;
+      return utils::Ok(std::move(response_body));
+    }
+  }
+
+  keep_alive = parser.KeepAlive();
+  return utils::Ok(std::move(response_body));
+}
+
+}  // namespace runtime
+}  // namespace athena
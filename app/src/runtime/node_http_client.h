@@ -0,0 +1,134 @@
+#ifndef ATHENA_RUNTIME_NODE_HTTP_CLIENT_H_
+#define ATHENA_RUNTIME_NODE_HTTP_CLIENT_H_
+
+#include "utils/error.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace athena {
+namespace runtime {
+
+/**
+ * A request to the Node runtime's HTTP API.
+ */
+struct NodeHttpRequest {
+  std::string method = "GET";
+  std::string path;
+  std::string body;        // Sent as application/json when non-empty
+  std::string request_id;  // Optional X-Request-Id for tracing
+};
+
+/**
+ * Options for NodeHttpClient.
+ */
+struct NodeHttpClientOptions {
+  size_t max_idle_connections = 4;  // Kept-alive sockets parked between requests
+  int worker_threads = 2;           // Threads serving SendAsync()
+  int io_timeout_ms = 30000;        // Per send/recv; a stuck sidecar fails the call
+};
+
+/**
+ * HTTP/1.1 client for the Node runtime's Unix socket, with keep-alive
+ * connection pooling and an asynchronous API.
+ *
+ * Connections are reused across requests instead of connecting per call. An
+ * idle connection the server has since closed (Node drops idle keep-alive
+ * sockets after a few seconds) is detected before reuse, and a request that
+ * fails on a reused connection before any response arrives is retried once
+ * on a fresh one.
+ *
+ * Send() blocks the calling thread; SendAsync() queues the request for the
+ * client's worker threads and returns at once, so callers on the UI thread
+ * never wait on the socket.
+ *
+ * Thread-safe.
+ */
+class NodeHttpClient {
+ public:
+  using Callback = std::function<void(utils::Result<std::string>)>;
+
+  struct Stats {
+    uint64_t requests = 0;
+    uint64_t connections_opened = 0;
+    uint64_t connections_reused = 0;
+  };
+
+  explicit NodeHttpClient(std::string socket_path,
+                          NodeHttpClientOptions options = NodeHttpClientOptions());
+
+  /**
+   * Fails queued requests, waits for requests in flight, closes all sockets.
+   */
+  ~NodeHttpClient();
+
+  NodeHttpClient(const NodeHttpClient&) = delete;
+  NodeHttpClient& operator=(const NodeHttpClient&) = delete;
+
+  /**
+   * Send a request and wait for the response.
+   * @return Response body, or an error if the exchange failed
+   */
+  utils::Result<std::string> Send(const NodeHttpRequest& request);
+
+  /**
+   * Queue a request; |callback| runs on a client worker thread when it
+   * completes (or fails, including when the client is destroyed first).
+   */
+  void SendAsync(NodeHttpRequest request, Callback callback);
+
+  Stats GetStats() const;
+
+ private:
+  struct PendingRequest {
+    NodeHttpRequest request;
+    Callback callback;
+  };
+
+  // A connected socket and whether it came from the idle pool
+  struct Connection {
+    int fd = -1;
+    bool reused = false;
+  };
+
+  utils::Result<Connection> Acquire();
+  void Release(int fd, bool keep_alive);
+  utils::Result<int> Connect();
+
+  /**
+   * One request/response exchange on a connection.
+   * @param keep_alive Set when the connection may be reused afterwards
+   * @param received_any Set once any response bytes arrive
+   */
+  utils::Result<std::string> Exchange(int fd,
+                                      const std::string& wire_request,
+                                      bool& keep_alive,
+                                      bool& received_any);
+
+  void WorkerLoop();
+
+  const std::string socket_path_;
+  const NodeHttpClientOptions options_;
+
+  mutable std::mutex mutex_;
+  std::vector<int> idle_;  // Most recently used last
+  Stats stats_;
+
+  std::mutex queue_mutex_;
+  std::condition_variable queue_cv_;
+  std::deque<PendingRequest> queue_;
+  bool stopping_ = false;
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace runtime
+}  // namespace athena
+
+#endif  // ATHENA_RUNTIME_NODE_HTTP_CLIENT_H_
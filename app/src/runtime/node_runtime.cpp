@@ -5,6 +5,7 @@
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
+#include <poll.h>
 #include <signal.h>
 #include <sstream>
 #include <sys/prctl.h>
@@ -18,8 +19,10 @@
 #include <sys/prctl.h>
 #endif
 
-// Platform-specific includes for timers
+// Platform-specific includes for timers and main-thread callbacks
 #ifdef ATHENA_USE_QT
+#include <QCoreApplication>
+#include <QSocketNotifier>
 #include <QTimer>
 #else
 #include <glib.h>
@@ -31,6 +34,35 @@ namespace runtime {
 // Static logger for this module
 static utils::Logger logger("NodeRuntime");
 
+namespace {
+
+// Parse a /health response (simplified - in production use a JSON parser)
+HealthStatus ParseHealth(const std::string& body) {
+  HealthStatus status;
+  status.healthy = body.find("\"status\":\"healthy\"") != std::string::npos;
+  status.ready = body.find("\"ready\":true") != std::string::npos;
+
+  // Extract uptime (basic string search - use JSON parser in production)
+  size_t uptime_pos = body.find("\"uptime\":");
+  if (uptime_pos != std::string::npos) {
+    std::istringstream iss(body.substr(uptime_pos + 9));
+    iss >> status.uptime_ms;
+  }
+  return status;
+}
+
+// Run |task| on the main thread's event loop
+void PostToMainThread(std::function<void()> task) {
+  QCoreApplication* app = QCoreApplication::instance();
+  if (!app) {
+    task();  // No event loop (tools, tests): complete on the calling thread
+    return;
+  }
+  QMetaObject::invokeMethod(app, std::move(task), Qt::QueuedConnection);
+}
+
+}  // namespace
+
 // ============================================================================
 // Constructor / Destructor
 // ============================================================================
@@ -39,7 +71,12 @@ NodeRuntime::NodeRuntime(const NodeRuntimeConfig& config)
     : config_(config),
       pid_(-1),
       state_(RuntimeState::STOPPED),
+      ready_fd_(-1),
+      ready_notifier_handle_(nullptr),
+      ready_timeout_handle_(nullptr),
+      lifetime_token_(std::make_shared<int>(0)),
       health_monitoring_enabled_(false),
+      health_check_in_flight_(false),
       health_check_timer_handle_(nullptr),
       restart_attempts_(0) {
   logger.Debug("NodeRuntime::NodeRuntime - Creating runtime");
@@ -64,53 +101,71 @@ NodeRuntime::~NodeRuntime() {
 utils::Result<void> NodeRuntime::Initialize() {
   logger.Debug("NodeRuntime::Initialize - Initializing runtime");
 
-  if (state_ != RuntimeState::STOPPED) {
-    return utils::Error("Runtime already initialized");
+  auto start_result = Start();
+  if (!start_result) {
+    return start_result;
   }
 
-  // Validate configuration
-  if (config_.runtime_script_path.empty()) {
-    return utils::Error("Runtime script path not specified");
+  // Wait for READY signal
+  auto ready_result = WaitForReady();
+  if (!ready_result) {
+    AbortStartup();
+    return ready_result;
   }
 
-  if (access(config_.runtime_script_path.c_str(), R_OK) != 0) {
-    return utils::Error("Runtime script not found or not readable: " + config_.runtime_script_path);
-  }
+  return FinishStartup();
+}
 
-  // Clean up stale socket file BEFORE spawning
-  if (std::filesystem::exists(config_.socket_path)) {
-    logger.Warn("NodeRuntime::Initialize - Removing stale socket file: " + config_.socket_path);
-    try {
-      std::filesystem::remove(config_.socket_path);
-      logger.Debug("NodeRuntime::Initialize - Stale socket removed successfully");
-    } catch (const std::filesystem::filesystem_error& e) {
-      logger.Warn("NodeRuntime::Initialize - Failed to remove stale socket: " +
-                  std::string(e.what()));
-      // Continue anyway - socket might be in use by another instance
-    }
-  }
+utils::Result<void> NodeRuntime::InitializeAsync(ReadyCallback on_ready) {
+  logger.Debug("NodeRuntime::InitializeAsync - Starting runtime in the background");
 
-  // Spawn the Node process
-  auto spawn_result = SpawnProcess();
-  if (!spawn_result) {
-    return spawn_result;
+  auto start_result = Start();
+  if (!start_result) {
+    return start_result;
   }
 
-  // Wait for READY signal
-  auto ready_result = WaitForReady();
-  if (!ready_result) {
-    TerminateProcess(true);
-    return ready_result;
+  if (!QCoreApplication::instance()) {
+    // No event loop to deliver the READY line: wait here
+    auto ready_result = WaitForReady();
+    if (!ready_result) {
+      AbortStartup();
+      on_ready(ready_result);
+    } else {
+      on_ready(FinishStartup());
+    }
+    return utils::Ok();
   }
 
-  // Verify socket was created
-  if (!std::filesystem::exists(socket_path_)) {
-    TerminateProcess(true);
-    return utils::Error("Socket file was not created: " + socket_path_);
-  }
+  auto* notifier = new QSocketNotifier(ready_fd_, QSocketNotifier::Read);
+  auto* timeout = new QTimer();
+  timeout->setSingleShot(true);
+  ready_notifier_handle_ = static_cast<void*>(notifier);
+  ready_timeout_handle_ = static_cast<void*>(timeout);
 
-  state_ = RuntimeState::READY;
-  logger.Info("NodeRuntime initialized successfully");
+  // Runs once, from whichever fires first
+  auto complete = [this, on_ready](utils::Result<void> result) {
+    StopReadyWatch();
+    if (!result) {
+      AbortStartup();
+      on_ready(result);
+      return;
+    }
+    on_ready(FinishStartup());
+  };
+
+  QObject::connect(notifier, &QSocketNotifier::activated, [this, complete]() {
+    auto ready = ReadReadyLine();
+    if (!ready) {
+      complete(utils::Error(ready.GetError().Message()));
+    } else if (ready.Value()) {
+      complete(utils::Ok());
+    }
+  });
+  QObject::connect(timeout, &QTimer::timeout, [this, complete]() {
+    complete(utils::Error("Timed out after " + std::to_string(config_.startup_timeout_ms) +
+                          "ms waiting for READY from Node process"));
+  });
+  timeout->start(config_.startup_timeout_ms);
 
   return utils::Ok();
 }
@@ -125,12 +180,20 @@ void NodeRuntime::Shutdown() {
   // Mark as stopping to prevent restart attempts
   state_ = RuntimeState::STOPPED;
 
-  // Stop health monitoring
+  // Stop health monitoring (and a startup still waiting for READY)
   StopHealthMonitoring();
+  StopReadyWatch();
+  if (ready_fd_ >= 0) {
+    close(ready_fd_);
+    ready_fd_ = -1;
+  }
 
   // Terminate process (graceful first, then force if needed)
   TerminateProcess(false);
 
+  // Requests still in flight fail fast now that the socket is gone
+  http_client_.reset();
+
   // Clean up socket file (even if Node didn't clean it up)
   if (!socket_path_.empty() && std::filesystem::exists(socket_path_)) {
     logger.Debug("NodeRuntime::Shutdown - Removing socket file: " + socket_path_);
@@ -173,19 +236,22 @@ utils::Result<HealthStatus> NodeRuntime::CheckHealth() {
     return utils::Error("Health check failed: " + response.GetError().Message());
   }
 
-  // Parse response (simplified - in production use a JSON parser)
-  HealthStatus status;
-  status.healthy = response.Value().find("\"status\":\"healthy\"") != std::string::npos;
-  status.ready = response.Value().find("\"ready\":true") != std::string::npos;
+  return utils::Ok(ParseHealth(response.Value()));
+}
 
-  // Extract uptime (basic string search - use JSON parser in production)
-  size_t uptime_pos = response.Value().find("\"uptime\":");
-  if (uptime_pos != std::string::npos) {
-    std::istringstream iss(response.Value().substr(uptime_pos + 9));
-    iss >> status.uptime_ms;
+void NodeRuntime::CheckHealthAsync(std::function<void(utils::Result<HealthStatus>)> callback) {
+  if (!IsProcessAlive()) {
+    callback(utils::Error("Process not running"));
+    return;
   }
 
-  return utils::Ok(std::move(status));
+  CallAsync("GET", "/health", "", [callback](utils::Result<std::string> response) {
+    if (!response) {
+      callback(utils::Error("Health check failed: " + response.GetError().Message()));
+      return;
+    }
+    callback(utils::Ok(ParseHealth(response.Value())));
+  });
 }
 
 void NodeRuntime::StartHealthMonitoring() {
@@ -218,21 +284,30 @@ void NodeRuntime::StartHealthMonitoring() {
       return;
     }
 
-    // Perform health check
-    auto health_result = CheckHealth();
-    if (!health_result) {
-      logger.Warn("NodeRuntime - Health check failed: " + health_result.GetError().Message());
+    // A slow sidecar must not stack up checks
+    if (health_check_in_flight_) {
+      logger.Debug("NodeRuntime - Previous health check still running, skipping");
       return;
     }
 
-    auto health = health_result.Value();
-    if (!health.healthy) {
-      logger.Warn("NodeRuntime - Health check reports unhealthy status");
-      return;
-    }
+    // Perform health check off the UI thread
+    health_check_in_flight_ = true;
+    CheckHealthAsync([this](utils::Result<HealthStatus> health_result) {
+      health_check_in_flight_ = false;
+      if (!health_result) {
+        logger.Warn("NodeRuntime - Health check failed: " + health_result.GetError().Message());
+        return;
+      }
 
-    logger.Debug("NodeRuntime - Health check passed (uptime: " + std::to_string(health.uptime_ms) +
-                 "ms)");
+      auto health = health_result.Value();
+      if (!health.healthy) {
+        logger.Warn("NodeRuntime - Health check reports unhealthy status");
+        return;
+      }
+
+      logger.Debug("NodeRuntime - Health check passed (uptime: " +
+                   std::to_string(health.uptime_ms) + "ms)");
+    });
   });
 
   timer->start();
@@ -270,235 +345,40 @@ utils::Result<std::string> NodeRuntime::Call(const std::string& method,
                                              const std::string& path,
                                              const std::string& body,
                                              const std::string& request_id) {
-  if (state_ != RuntimeState::READY) {
+  if (state_ != RuntimeState::READY || !http_client_) {
     return utils::Error("Runtime not ready");
   }
 
-  if (socket_path_.empty()) {
-    return utils::Error("Socket path not set");
-  }
-
-  // Create Unix socket
-  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
-  if (sock < 0) {
-    return utils::Error("Failed to create socket: " + std::string(strerror(errno)));
-  }
-
-  // Connect to Unix socket
-  struct sockaddr_un addr;
-  memset(&addr, 0, sizeof(addr));
-  addr.sun_family = AF_UNIX;
-  strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
-
-  if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
-    close(sock);
-    return utils::Error("Failed to connect to socket: " + std::string(strerror(errno)));
-  }
-
-  // Build HTTP request
-  std::ostringstream request;
-  request << method << " " << path << " HTTP/1.1\r\n";
-  request << "Host: localhost\r\n";
-  request << "User-Agent: Athena-Browser/1.0\r\n";
-
-  if (!request_id.empty()) {
-    request << "X-Request-Id: " << request_id << "\r\n";
-  }
-
-  if (!body.empty()) {
-    request << "Content-Type: application/json\r\n";
-    request << "Content-Length: " << body.size() << "\r\n";
-  }
-
-  request << "\r\n";
-
-  if (!body.empty()) {
-    request << body;
-  }
-
-  std::string request_str = request.str();
-
-  logger.Debug("NodeRuntime::Call - Sending HTTP request:\n" + request_str);
-
-  // Send request
-  ssize_t sent = send(sock, request_str.c_str(), request_str.size(), 0);
-  if (sent < 0) {
-    close(sock);
-    return utils::Error("Failed to send request: " + std::string(strerror(errno)));
-  }
-
-  logger.Debug("NodeRuntime::Call - Sent " + std::to_string(sent) + " bytes to " + path);
-
-  // Receive response
-  std::string response;
-  char buffer[4096];
-  ssize_t received;
-  int read_attempts = 0;
-
-  // First, read until we have the headers
-  while ((received = recv(sock, buffer, sizeof(buffer) - 1, 0)) > 0) {
-    buffer[received] = '\0';
-    response += buffer;
-    read_attempts++;
-
-    logger.Debug("NodeRuntime::Call - Received " + std::to_string(received) + " bytes (attempt " +
-                 std::to_string(read_attempts) + ")");
-
-    // Check if we got the headers (end with \r\n\r\n)
-    if (response.find("\r\n\r\n") != std::string::npos) {
-      break;
-    }
-  }
-
-  if (received <= 0) {
-    close(sock);
-    std::string error_msg =
-        "Failed to receive response headers after " + std::to_string(read_attempts) + " attempts";
-    if (received < 0) {
-      error_msg += ": " + std::string(strerror(errno));
-    } else {
-      error_msg += ": connection closed by server";
-    }
-    logger.Error("NodeRuntime::Call - " + error_msg);
-    return utils::Error(error_msg);
-  }
-
-  logger.Debug("NodeRuntime::Call - Received full headers (" + std::to_string(response.length()) +
-               " bytes)");
-
-  // Find where the body starts
-  size_t body_start = response.find("\r\n\r\n");
-  if (body_start == std::string::npos) {
-    close(sock);
-    return utils::Error("Invalid HTTP response: no header/body separator");
+  NodeHttpRequest request{method, path, body, request_id};
+  auto response = http_client_->Send(request);
+  if (!response) {
+    logger.Error("NodeRuntime::Call - " + method + " " + path + " failed: " +
+                 response.GetError().Message());
   }
-  body_start += 4;  // Skip past "\r\n\r\n"
-
-  // Check if this is a chunked transfer encoding response
-  bool is_chunked = response.find("Transfer-Encoding: chunked") != std::string::npos;
-
-  std::string response_body;
-
-  if (is_chunked) {
-    logger.Debug("NodeRuntime::Call - Detected chunked transfer encoding");
-
-    // Start with what we already have
-    std::string chunked_data = response.substr(body_start);
-
-    // Continue reading until we get the terminating chunk
-    while (true) {
-      // Check if we have the terminating chunk (0\r\n\r\n or 0\r\n followed by trailers)
-      if (chunked_data.find("0\r\n\r\n") != std::string::npos ||
-          chunked_data.find("\r\n0\r\n\r\n") != std::string::npos) {
-        break;
-      }
-
-      // Read more data
-      received = recv(sock, buffer, sizeof(buffer) - 1, 0);
-      if (received <= 0) {
-        break;
-      }
-      buffer[received] = '\0';
-      chunked_data += buffer;
-    }
-
-    logger.Debug("NodeRuntime::Call - Received full chunked response (" +
-                 std::to_string(chunked_data.length()) + " bytes)");
-
-    // Decode chunked encoding
-    size_t pos = 0;
-    while (pos < chunked_data.length()) {
-      // Find the chunk size line (hex number followed by \r\n)
-      size_t size_end = chunked_data.find("\r\n", pos);
-      if (size_end == std::string::npos) {
-        break;
-      }
-
-      // Parse chunk size (hex)
-      std::string size_str = chunked_data.substr(pos, size_end - pos);
-      // Remove any chunk extensions (after ';')
-      size_t semicolon = size_str.find(';');
-      if (semicolon != std::string::npos) {
-        size_str = size_str.substr(0, semicolon);
-      }
-
-      size_t chunk_size;
-      try {
-        chunk_size = std::stoull(size_str, nullptr, 16);
-      } catch (...) {
-        logger.Error("NodeRuntime::Call - Failed to parse chunk size: " + size_str);
-        break;
-      }
-
-      logger.Debug("NodeRuntime::Call - Chunk size: " + std::to_string(chunk_size) + " bytes");
-
-      if (chunk_size == 0) {
-        // Last chunk
-        break;
-      }
-
-      // Move past the size line
-      pos = size_end + 2;  // Skip \r\n
-
-      // Extract chunk data
-      if (pos + chunk_size <= chunked_data.length()) {
-        response_body += chunked_data.substr(pos, chunk_size);
-        pos += chunk_size;
-
-        // Skip the trailing \r\n after the chunk
-        if (pos + 2 <= chunked_data.length() && chunked_data.substr(pos, 2) == "\r\n") {
-          pos += 2;
-        }
-      } else {
-        logger.Error("NodeRuntime::Call - Incomplete chunk data");
-        break;
-      }
-    }
-
-    logger.Debug("NodeRuntime::Call - Decoded body length: " +
-                 std::to_string(response_body.length()) + " bytes");
-  } else {
-    // Parse Content-Length from headers
-    size_t content_length = 0;
-    size_t cl_pos = response.find("Content-Length:");
-    if (cl_pos != std::string::npos) {
-      size_t cl_start = cl_pos + 15;  // Length of "Content-Length:"
-      size_t cl_end = response.find("\r\n", cl_start);
-      if (cl_end != std::string::npos) {
-        std::string cl_str = response.substr(cl_start, cl_end - cl_start);
-        // Trim whitespace
-        size_t first = cl_str.find_first_not_of(" \t");
-        size_t last = cl_str.find_last_not_of(" \t");
-        if (first != std::string::npos && last != std::string::npos) {
-          cl_str = cl_str.substr(first, last - first + 1);
-          content_length = std::stoull(cl_str);
-        }
-      }
-    }
-
-    // Calculate how much body we already have
-    size_t body_received = response.length() - body_start;
-
-    // Continue reading until we have the full body
-    if (content_length > 0) {
-      while (body_received < content_length) {
-        received = recv(sock, buffer, sizeof(buffer) - 1, 0);
-        if (received <= 0) {
-          break;
-        }
-        buffer[received] = '\0';
-        response += buffer;
-        body_received += received;
-      }
-    }
+  return response;
+}
 
-    // Extract body from response
-    response_body = response.substr(body_start);
+void NodeRuntime::CallAsync(const std::string& method,
+                            const std::string& path,
+                            const std::string& body,
+                            CallCallback callback,
+                            const std::string& request_id) {
+  if (state_ != RuntimeState::READY || !http_client_) {
+    callback(utils::Error("Runtime not ready"));
+    return;
   }
 
-  close(sock);
-
-  return utils::Ok(std::move(response_body));
+  // Hop back to the main thread, unless the runtime is gone by then
+  std::weak_ptr<int> alive = lifetime_token_;
+  http_client_->SendAsync(
+      NodeHttpRequest{method, path, body, request_id},
+      [alive, callback = std::move(callback)](utils::Result<std::string> response) {
+        PostToMainThread([alive, callback, response = std::move(response)]() {
+          if (alive.lock()) {
+            callback(response);
+          }
+        });
+      });
 }
 
 // ============================================================================
@@ -521,6 +401,36 @@ const NodeRuntimeConfig& NodeRuntime::GetConfig() const {
 // Private Methods
 // ============================================================================
 
+utils::Result<void> NodeRuntime::Start() {
+  if (state_ != RuntimeState::STOPPED) {
+    return utils::Error("Runtime already initialized");
+  }
+
+  // Validate configuration
+  if (config_.runtime_script_path.empty()) {
+    return utils::Error("Runtime script path not specified");
+  }
+
+  if (access(config_.runtime_script_path.c_str(), R_OK) != 0) {
+    return utils::Error("Runtime script not found or not readable: " + config_.runtime_script_path);
+  }
+
+  // Clean up stale socket file BEFORE spawning
+  if (std::filesystem::exists(config_.socket_path)) {
+    logger.Warn("NodeRuntime::Start - Removing stale socket file: " + config_.socket_path);
+    try {
+      std::filesystem::remove(config_.socket_path);
+      logger.Debug("NodeRuntime::Start - Stale socket removed successfully");
+    } catch (const std::filesystem::filesystem_error& e) {
+      logger.Warn("NodeRuntime::Start - Failed to remove stale socket: " + std::string(e.what()));
+      // Continue anyway - socket might be in use by another instance
+    }
+  }
+
+  // Spawn the Node process
+  return SpawnProcess();
+}
+
 utils::Result<void> NodeRuntime::SpawnProcess() {
   logger.Debug("NodeRuntime::SpawnProcess - Spawning Node process");
 
@@ -619,173 +529,177 @@ utils::Result<void> NodeRuntime::SpawnProcess() {
   // Close write end
   close(stdout_pipe[1]);
 
-  // Set pipe to non-blocking mode for reading READY line
+  // Non-blocking: the READY line is read as it arrives (poll() or QSocketNotifier)
   int flags = fcntl(stdout_pipe[0], F_GETFL, 0);
   fcntl(stdout_pipe[0], F_SETFL, flags | O_NONBLOCK);
+  ready_fd_ = stdout_pipe[0];
+  ready_output_.clear();
+  spawn_time_ = std::chrono::steady_clock::now();
 
-  // Read READY line (may need multiple reads due to JSON logging)
-  // The athena-agent outputs JSON logs before the READY line, so we need to
-  // keep reading until we find it. Node.js startup takes ~2 seconds.
-  std::string output;
-  char buffer[4096];
-  int attempts = 0;
-  const int max_attempts = 60;  // 60 * 100ms = 6 seconds max wait
+  logger.Debug("NodeRuntime - Process spawned: pid=" + std::to_string(pid_));
+
+  state_ = RuntimeState::STARTING;
+
+  return utils::Ok();
+}
 
-  while (attempts < max_attempts && output.find("READY ") == std::string::npos) {
-    ssize_t n = read(stdout_pipe[0], buffer, sizeof(buffer) - 1);
+utils::Result<bool> NodeRuntime::ReadReadyLine() {
+  // The athena-agent may print other output before the READY line, so keep
+  // reading until a complete "READY <socket path>" line shows up
+  char buffer[4096];
+  while (true) {
+    ssize_t n = read(ready_fd_, buffer, sizeof(buffer));
     if (n > 0) {
-      buffer[n] = '\0';
-      output += buffer;
-      // Reset attempts when we get data
-      attempts = 0;
-    } else if (n < 0 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
-      // No data available yet, wait a bit
-      std::this_thread::sleep_for(std::chrono::milliseconds(100));
-      attempts++;
-    } else if (n == 0) {
-      // EOF - process closed stdout
-      break;
-    } else {
-      // Real error
-      close(stdout_pipe[0]);
-      TerminateProcess(true);
+      ready_output_.append(buffer, static_cast<size_t>(n));
+      continue;
+    }
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n < 0 && errno != EWOULDBLOCK && errno != EAGAIN) {
       return utils::Error("Failed to read from child process: " + std::string(strerror(errno)));
     }
-  }
-
-  logger.Debug("NodeRuntime - Total output length: " + std::to_string(output.length()) +
-               ", attempts: " + std::to_string(attempts));
 
-  // Parse READY line
-  size_t ready_pos = output.find("READY ");
-  if (ready_pos == std::string::npos) {
-    close(stdout_pipe[0]);
-    TerminateProcess(true);
-    return utils::Error("Failed to receive READY signal from Node process");
-  }
-
-  // Extract socket path
-  size_t path_start = ready_pos + 6;  // Length of "READY "
-  size_t path_end = output.find('\n', path_start);
-  if (path_end == std::string::npos) {
-    path_end = output.size();
+    // Drained what is there for now (n < 0) or Node closed stdout (n == 0)
+    size_t ready_pos = ready_output_.find("READY ");
+    size_t path_end =
+        ready_pos == std::string::npos ? std::string::npos : ready_output_.find('\n', ready_pos);
+    if (path_end != std::string::npos) {
+      size_t path_start = ready_pos + 6;  // Length of "READY "
+      socket_path_ = ready_output_.substr(path_start, path_end - path_start);
+
+      // Trim whitespace
+      socket_path_.erase(0, socket_path_.find_first_not_of(" \t\r\n"));
+      socket_path_.erase(socket_path_.find_last_not_of(" \t\r\n") + 1);
+      return true;
+    }
+    if (n == 0) {
+      return utils::Error("Failed to receive READY signal from Node process");
+    }
+    return false;
   }
+}
 
-  socket_path_ = output.substr(path_start, path_end - path_start);
-
-  // Trim whitespace
-  socket_path_.erase(0, socket_path_.find_first_not_of(" \t\r\n"));
-  socket_path_.erase(socket_path_.find_last_not_of(" \t\r\n") + 1);
+utils::Result<void> NodeRuntime::WaitForReady() {
+  logger.Debug("NodeRuntime::WaitForReady - Waiting for READY line");
+
+  // Sleep in poll() until Node writes to stdout, not in fixed steps
+  auto deadline = spawn_time_ + std::chrono::milliseconds(config_.startup_timeout_ms);
+  while (true) {
+    auto ready = ReadReadyLine();
+    if (!ready) {
+      return utils::Error(ready.GetError().Message());
+    }
+    if (ready.Value()) {
+      return utils::Ok();
+    }
 
-  // Read a bit more to capture JSON logs that contain the PID
-  // The JSON log appears shortly after READY, give it 100ms
-  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+        deadline - std::chrono::steady_clock::now());
+    if (remaining.count() <= 0) {
+      return utils::Error("Timed out after " + std::to_string(config_.startup_timeout_ms) +
+                          "ms waiting for READY from Node process");
+    }
 
-  // Read any remaining output from stdout BEFORE closing the pipe
-  char extra_buf[4096];
-  ssize_t extra_bytes;
-  while ((extra_bytes = read(stdout_pipe[0], extra_buf, sizeof(extra_buf) - 1)) > 0) {
-    extra_buf[extra_bytes] = '\0';
-    output += extra_buf;
-    // Break if we found the PID or read less than buffer size (no more data)
-    if (output.find("\"pid\":") != std::string::npos || extra_bytes < static_cast<ssize_t>(sizeof(extra_buf) - 1)) {
-      break;
+    struct pollfd entry = {ready_fd_, POLLIN, 0};
+    if (::poll(&entry, 1, static_cast<int>(remaining.count())) < 0 && errno != EINTR) {
+      return utils::Error("Failed to poll child process: " + std::string(strerror(errno)));
     }
   }
+}
 
-  // Now close our end of the pipe to avoid leaking file descriptors
-  // The child process will keep its stdout open
-  close(stdout_pipe[0]);
-
-  // Extract actual Node process PID from JSON logs
-  // The Node agent logs its PID in JSON format: {"pid":12345,...}
-  // This ensures we track the correct PID even if there are intermediate processes
-  logger.Debug("NodeRuntime - Searching for PID in output buffer (" +
-               std::to_string(output.length()) + " bytes)");
+utils::Result<void> NodeRuntime::FinishStartup() {
+  // Done with stdout; Node writes its logs to stderr
+  close(ready_fd_);
+  ready_fd_ = -1;
 
-  size_t pid_pos = output.find("\"pid\":");
+  // The pid Node reports, if it printed one before READY, wins over fork()'s
+  size_t pid_pos = ready_output_.find("\"pid\":");
   if (pid_pos != std::string::npos) {
     size_t pid_start = pid_pos + 6;  // Length of "\"pid\":"
-    size_t pid_end = output.find_first_of(",}", pid_start);
-    if (pid_end != std::string::npos) {
-      std::string pid_str = output.substr(pid_start, pid_end - pid_start);
-      try {
-        int node_pid = std::stoi(pid_str);
-        logger.Info("NodeRuntime - Updating PID from fork() value " + std::to_string(pid_) +
-                    " to actual Node process PID " + std::to_string(node_pid));
-        pid_ = node_pid;
-      } catch (...) {
-        logger.Warn("NodeRuntime - Failed to parse PID from JSON (pid_str=\"" + pid_str +
-                    "\"), using fork() PID: " + std::to_string(pid_));
-      }
-    } else {
-      logger.Warn("NodeRuntime - Found \"pid\": but no end delimiter, using fork() PID: " +
-                  std::to_string(pid_));
+    size_t pid_end = ready_output_.find_first_of(",}", pid_start);
+    std::string pid_str = ready_output_.substr(pid_start, pid_end - pid_start);
+    try {
+      int node_pid = std::stoi(pid_str);
+      logger.Info("NodeRuntime - Updating PID from fork() value " + std::to_string(pid_) +
+                  " to actual Node process PID " + std::to_string(node_pid));
+      pid_ = node_pid;
+    } catch (...) {
+      logger.Warn("NodeRuntime - Failed to parse PID from JSON (pid_str=\"" + pid_str +
+                  "\"), using fork() PID: " + std::to_string(pid_));
     }
-  } else {
-    logger.Warn("NodeRuntime - No \"pid\": found in output buffer (length=" +
-                std::to_string(output.length()) + "), using fork() PID: " + std::to_string(pid_));
   }
+  ready_output_.clear();
 
-  logger.Debug("NodeRuntime - Process spawned: pid=" + std::to_string(pid_) +
-               ", socket=" + socket_path_);
-
-  state_ = RuntimeState::STARTING;
-
-  return utils::Ok();
-}
-
-utils::Result<std::string> NodeRuntime::ReadReadyLine() {
-  // Already handled in SpawnProcess() for simplicity
-  return utils::Ok(std::string(socket_path_));
-}
-
-utils::Result<void> NodeRuntime::WaitForReady() {
-  logger.Debug("NodeRuntime::WaitForReady - Waiting for runtime to be ready");
-
-  // Give Node a moment to fully initialize
-  std::this_thread::sleep_for(std::chrono::milliseconds(100));
-
-  // Check if process is alive
   if (!IsProcessAlive()) {
+    AbortStartup();
     return utils::Error("Process died during startup");
   }
 
-  // Try to connect to socket (basic readiness check)
-  int sock = socket(AF_UNIX, SOCK_STREAM, 0);
-  if (sock < 0) {
-    return utils::Error("Failed to create socket for readiness check");
-  }
-
-  struct sockaddr_un addr;
-  memset(&addr, 0, sizeof(addr));
-  addr.sun_family = AF_UNIX;
-  strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
-
-  // Retry connection with timeout
-  int max_retries = 10;
+  // Node prints READY from its listen callback, so the socket should accept
+  // right away; allow a few short retries in case it lags behind
   bool connected = false;
-
-  for (int i = 0; i < max_retries; i++) {
-    if (connect(sock, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
-      connected = true;
+  for (int attempt = 0; attempt < 10 && !connected; ++attempt) {
+    int sock = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (sock < 0) {
       break;
     }
-
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+    connected = connect(sock, (struct sockaddr*)&addr, sizeof(addr)) == 0;
+    close(sock);
+    if (!connected) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
   }
-
-  close(sock);
-
   if (!connected) {
-    return utils::Error("Failed to connect to Node runtime socket");
+    AbortStartup();
+    return utils::Error("Failed to connect to Node runtime socket: " + socket_path_);
   }
 
-  logger.Debug("NodeRuntime - Runtime is ready");
+  http_client_ = std::make_unique<NodeHttpClient>(socket_path_);
+  state_ = RuntimeState::READY;
+
+  auto startup_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - spawn_time_);
+  logger.Info("NodeRuntime initialized successfully in " + std::to_string(startup_ms.count()) +
+              "ms (pid=" + std::to_string(pid_) + ", socket=" + socket_path_ + ")");
 
   return utils::Ok();
 }
 
+void NodeRuntime::AbortStartup() {
+  StopReadyWatch();
+  if (ready_fd_ >= 0) {
+    close(ready_fd_);
+    ready_fd_ = -1;
+  }
+  ready_output_.clear();
+
+  TerminateProcess(true);
+  pid_ = -1;
+  socket_path_.clear();
+  state_ = RuntimeState::STOPPED;
+}
+
+void NodeRuntime::StopReadyWatch() {
+  // deleteLater: this may run from the notifier's own signal
+  if (ready_notifier_handle_) {
+    QSocketNotifier* notifier = static_cast<QSocketNotifier*>(ready_notifier_handle_);
+    notifier->setEnabled(false);
+    notifier->deleteLater();
+    ready_notifier_handle_ = nullptr;
+  }
+  if (ready_timeout_handle_) {
+    QTimer* timer = static_cast<QTimer*>(ready_timeout_handle_);
+    timer->stop();
+    timer->deleteLater();
+    ready_timeout_handle_ = nullptr;
+  }
+}
+
 void NodeRuntime::TerminateProcess(bool force) {
   if (pid_ <= 0) {
     logger.Debug("NodeRuntime::TerminateProcess - Skipping, pid=" + std::to_string(pid_));
@@ -1,9 +1,11 @@
 #ifndef ATHENA_RUNTIME_NODE_RUNTIME_H_
 #define ATHENA_RUNTIME_NODE_RUNTIME_H_
 
+#include "runtime/node_http_client.h"
 #include "utils/error.h"
 
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -17,7 +19,7 @@ struct NodeRuntimeConfig {
   std::string node_executable = "node";
   std::string runtime_script_path;  // Path to agent/dist/server/server.js
   std::string socket_path;          // Unix socket path (auto-generated if empty)
-  int startup_timeout_ms = 5000;
+  int startup_timeout_ms = 10000;  // Spawn to READY line
   int health_check_interval_ms = 10000;
   int restart_max_attempts = 3;
   int restart_backoff_ms = 100;  // Initial backoff, doubles each retry
@@ -58,7 +60,8 @@ struct HealthStatus {
  *
  * Responsibilities:
  *   - Spawn Node.js helper process
- *   - Parse READY line to get socket path
+ *   - Parse READY line to get socket path (poll() / QSocketNotifier on the
+ *     stdout pipe, so readiness is seen as soon as Node prints it)
  *   - Monitor process health
  *   - Restart on crash with exponential backoff
  *   - Provide IPC interface to application
@@ -66,7 +69,9 @@ struct HealthStatus {
  *
  * Thread safety:
  *   - Not thread-safe; must be called from main thread
- *   - Health checks run in background but callback on main thread
+ *   - Requests go over pooled keep-alive connections (NodeHttpClient);
+ *     CallAsync() and health checks run on client worker threads and
+ *     call back on the main thread, so the UI never waits on the socket
  *
  * Example:
  * ```cpp
@@ -80,6 +85,9 @@ struct HealthStatus {
  *
  * // Make API calls
  * auto response = runtime->Call("POST", "/v1/echo", R"({"message":"hello"})");
+ * runtime->CallAsync("GET", "/v1/status", "", [](utils::Result<std::string> result) {
+ *   // Runs later on the main thread
+ * });
  *
  * runtime->Shutdown();
  * ```
@@ -116,6 +124,20 @@ class NodeRuntime {
    */
   utils::Result<void> Initialize();
 
+  using ReadyCallback = std::function<void(utils::Result<void>)>;
+
+  /**
+   * Spawn the Node.js runtime and return without waiting for it.
+   * The READY line is picked up by the event loop, so the caller can carry
+   * on with CEF and window startup while Node boots. |on_ready| runs on the
+   * main thread once the runtime is READY, or with the error if it exited or
+   * did not report READY within startup_timeout_ms. Without an event loop
+   * this waits like Initialize() and calls |on_ready| before returning.
+   *
+   * @return Error if the process could not be spawned (|on_ready| not called)
+   */
+  utils::Result<void> InitializeAsync(ReadyCallback on_ready);
+
   /**
    * Shutdown the runtime.
    * Sends SIGTERM, waits for graceful exit, falls back to SIGKILL.
@@ -144,6 +166,11 @@ class NodeRuntime {
    */
   utils::Result<HealthStatus> CheckHealth();
 
+  /**
+   * Check health without blocking; |callback| runs on the main thread.
+   */
+  void CheckHealthAsync(std::function<void(utils::Result<HealthStatus>)> callback);
+
   /**
    * Start periodic health checks in background.
    * Automatically restarts on failure if configured.
@@ -173,6 +200,22 @@ class NodeRuntime {
                                   const std::string& body = "",
                                   const std::string& request_id = "");
 
+  using CallCallback = std::function<void(utils::Result<std::string>)>;
+
+  /**
+   * Make an HTTP call without blocking the calling thread.
+   * The exchange runs on a client worker thread; |callback| is invoked on the
+   * main thread through the Qt event loop. Callbacks still pending when the
+   * runtime is destroyed are dropped.
+   *
+   * @param callback Receives the response body or an error
+   */
+  void CallAsync(const std::string& method,
+                 const std::string& path,
+                 const std::string& body,
+                 CallCallback callback,
+                 const std::string& request_id = "");
+
   // ============================================================================
   // Accessors
   // ============================================================================
@@ -214,8 +257,20 @@ class NodeRuntime {
   RuntimeState state_;
   std::string socket_path_;
 
+  // Startup: stdout pipe carrying the READY line, and what was read from it
+  int ready_fd_;
+  std::string ready_output_;
+  std::chrono::steady_clock::time_point spawn_time_;
+  void* ready_notifier_handle_;  // QSocketNotifier* while InitializeAsync() waits
+  void* ready_timeout_handle_;   // QTimer* enforcing startup_timeout_ms
+
+  // IPC: keep-alive connection pool, created once the socket is ready
+  std::unique_ptr<NodeHttpClient> http_client_;
+  std::shared_ptr<int> lifetime_token_;  // Async callbacks check it before running
+
   // Health monitoring
   bool health_monitoring_enabled_;
+  bool health_check_in_flight_;
   void* health_check_timer_handle_;  // Platform-specific timer handle (GLib source ID or QTimer*)
   std::chrono::steady_clock::time_point last_health_check_;
 
@@ -224,9 +279,13 @@ class NodeRuntime {
   std::chrono::steady_clock::time_point last_restart_time_;
 
   // Internal methods
+  utils::Result<void> Start();
   utils::Result<void> SpawnProcess();
-  utils::Result<std::string> ReadReadyLine();
+  utils::Result<bool> ReadReadyLine();
   utils::Result<void> WaitForReady();
+  utils::Result<void> FinishStartup();
+  void AbortStartup();
+  void StopReadyWatch();
   void TerminateProcess(bool force);
   utils::Result<void> Restart();
   int CalculateBackoff() const;
@@ -0,0 +1,171 @@
+#include "runtime/sse_decoder.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace athena {
+namespace runtime {
+
+namespace {
+
+constexpr std::string_view kByteOrderMark = "\xEF\xBB\xBF";
+
+}  // namespace
+
+SseDecoder::SseDecoder(EventSink sink) : sink_(std::move(sink)) {}
+
+bool SseDecoder::Feed(std::string_view data) {
+  if (error_) {
+    return false;
+  }
+
+  size_t pos = 0;
+  if (skip_lf_ && !data.empty()) {
+    skip_lf_ = false;
+    if (data[0] == '\n') {
+      pos = 1;  // Second half of a CRLF split across reads
+    }
+  }
+
+  // Next CR and LF, each searched for again only once passed, so a buffer
+  // without CRs is not rescanned for one on every line
+  size_t next_cr = data.find('\r', pos);
+  size_t next_lf = data.find('\n', pos);
+  while (pos < data.size()) {
+    if (next_cr < pos) {
+      next_cr = data.find('\r', pos);
+    }
+    if (next_lf < pos) {
+      next_lf = data.find('\n', pos);
+    }
+    size_t end = std::min(next_cr, next_lf);
+    if (end == std::string_view::npos) {
+      if (!CheckSize(line_.size() + data.size() - pos)) {
+        return false;
+      }
+      line_.append(data.substr(pos));
+      break;
+    }
+
+    std::string_view line = data.substr(pos, end - pos);
+    if (line_.empty()) {
+      ProcessLine(line);
+    } else {
+      if (!CheckSize(line_.size() + line.size())) {
+        return false;
+      }
+      line_.append(line);
+      std::string complete = std::move(line_);
+      line_.clear();
+      ProcessLine(complete);
+    }
+    if (error_) {
+      return false;
+    }
+
+    // Lines end with CRLF, LF or CR
+    pos = end + 1;
+    if (data[end] == '\r') {
+      if (pos == data.size()) {
+        skip_lf_ = true;
+      } else if (data[pos] == '\n') {
+        ++pos;
+      }
+    }
+  }
+  return true;
+}
+
+void SseDecoder::Reset() {
+  line_.clear();
+  skip_lf_ = false;
+  at_start_ = true;
+  error_ = false;
+  event_ = SseEvent();
+}
+
+void SseDecoder::ProcessLine(std::string_view line) {
+  if (at_start_) {
+    at_start_ = false;
+    if (line.substr(0, kByteOrderMark.size()) == kByteOrderMark) {
+      line.remove_prefix(kByteOrderMark.size());
+    }
+  }
+
+  if (line.empty()) {
+    Dispatch();
+    return;
+  }
+  if (line[0] == ':') {
+    return;  // Comment (often a keep-alive)
+  }
+
+  size_t colon = line.find(':');
+  if (colon == std::string_view::npos) {
+    ProcessField(line, std::string_view());
+    return;
+  }
+  std::string_view value = line.substr(colon + 1);
+  if (!value.empty() && value[0] == ' ') {
+    value.remove_prefix(1);
+  }
+  ProcessField(line.substr(0, colon), value);
+}
+
+void SseDecoder::ProcessField(std::string_view field, std::string_view value) {
+  if (field == "data") {
+    if (!CheckSize(event_.data.size() + value.size() + 1)) {
+      return;
+    }
+    event_.data.append(value);
+    event_.data.push_back('\n');
+  } else if (field == "event") {
+    event_.type.assign(value);
+  } else if (field == "id") {
+    if (value.find('\0') == std::string_view::npos) {
+      last_event_id_.assign(value);
+    }
+  } else if (field == "retry") {
+    if (value.empty() || value.size() > 9) {
+      return;  // Nine digits always fit; longer values are not sensible delays
+    }
+    uint32_t ms = 0;
+    for (char c : value) {
+      if (c < '0' || c > '9') {
+        return;
+      }
+      ms = ms * 10 + static_cast<uint32_t>(c - '0');
+    }
+    retry_ms_ = ms;
+  }
+  // Other fields are ignored
+}
+
+void SseDecoder::Dispatch() {
+  if (event_.data.empty()) {
+    event_.type.clear();  // No data lines: nothing to dispatch
+    return;
+  }
+
+  event_.data.pop_back();
+  if (event_.type.empty()) {
+    event_.type = "message";
+  }
+  event_.id = last_event_id_;
+  if (sink_) {
+    sink_(event_);
+  }
+  event_.data.clear();
+  event_.type.clear();
+}
+
+bool SseDecoder::CheckSize(size_t pending) {
+  if (pending > kMaxEventBytes) {
+    error_ = true;
+    return false;
+  }
+  return true;
+}
+
+}  // namespace runtime
+}  // namespace athena
@@ -0,0 +1,90 @@
+#ifndef ATHENA_RUNTIME_SSE_DECODER_H_
+#define ATHENA_RUNTIME_SSE_DECODER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace athena {
+namespace runtime {
+
+/**
+ * One dispatched server-sent event.
+ */
+struct SseEvent {
+  std::string type;  // "event:" field, "message" if none was given
+  std::string data;  // "data:" lines joined with '\n' (UTF-8, possibly multi-line)
+  std::string id;    // Last event ID in effect when the event was dispatched
+};
+
+/**
+ * Incremental text/event-stream decoder (WHATWG HTML, "Server-sent events").
+ *
+ * Fed with response body bytes as they arrive (e.g. the fragments an
+ * HttpResponseParser hands out): lines, CRLF pairs and UTF-8 sequences may
+ * be split anywhere across Feed() calls. Complete lines are parsed straight
+ * from the fed bytes; only a trailing partial line is buffered. Events are
+ * dispatched at each blank line, with the data still as bytes, so decoding
+ * text happens once per event rather than once per read.
+ *
+ * Handles comments, multi-line data, "event:", "id:" (the last event ID
+ * persists across events and Reset(), for a client that reconnects with
+ * Last-Event-ID) and "retry:". An event cut off by the end of the stream
+ * is not dispatched.
+ *
+ * Not thread-safe.
+ */
+class SseDecoder {
+ public:
+  // Receives each event; the reference is only valid during the call
+  using EventSink = std::function<void(const SseEvent& event)>;
+
+  // Longest line or event accepted, as protection against a runaway stream
+  static constexpr size_t kMaxEventBytes = 8 * 1024 * 1024;
+
+  explicit SseDecoder(EventSink sink = nullptr);
+
+  /**
+   * Decode the next bytes of the stream.
+   * @return false once the stream is malformed (an event over the size limit)
+   */
+  bool Feed(std::string_view data);
+
+  /**
+   * Start a new stream: pending lines and the event being built are dropped.
+   * LastEventId() and RetryMs() are kept.
+   */
+  void Reset();
+
+  bool HasError() const { return error_; }
+
+  const std::string& LastEventId() const { return last_event_id_; }
+
+  // Reconnection delay requested by the server ("retry:"), if any
+  std::optional<uint32_t> RetryMs() const { return retry_ms_; }
+
+ private:
+  void ProcessLine(std::string_view line);
+  void ProcessField(std::string_view field, std::string_view value);
+  void Dispatch();
+  bool CheckSize(size_t pending);
+
+  EventSink sink_;
+
+  std::string line_;      // Partial line carried over from the last Feed()
+  bool skip_lf_ = false;  // Last Feed() ended on CR; a leading LF belongs to it
+  bool at_start_ = true;  // Nothing processed yet (a BOM may follow)
+  bool error_ = false;
+
+  SseEvent event_;  // Event being built; data has a trailing '\n' per line
+  std::string last_event_id_;
+  std::optional<uint32_t> retry_ms_;
+};
+
+}  // namespace runtime
+}  // namespace athena
+
+#endif  // ATHENA_RUNTIME_SSE_DECODER_H_
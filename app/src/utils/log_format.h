@@ -0,0 +1,168 @@
+#ifndef ATHENA_UTILS_LOG_FORMAT_H_
+#define ATHENA_UTILS_LOG_FORMAT_H_
+
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace athena {
+namespace utils {
+
+/**
+ * Layout of log lines.
+ */
+enum class LogOutputFormat {
+  kText,       // [2025-01-01 12:00:00.123] [Name] [INFO] message
+  kJsonLines,  // One JSON object per line, for log pipelines
+};
+
+namespace log_internal {
+
+template <typename T, typename = void>
+struct IsStreamable : std::false_type {};
+
+template <typename T>
+struct IsStreamable<
+    T,
+    std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>>
+    : std::true_type {};
+
+// Appends one argument. Strings, numbers and enums are written directly;
+// anything else with an operator<< goes through a stream.
+template <typename T>
+void AppendArg(std::string& out, const T& value) {
+  using Type = std::decay_t<T>;
+  if constexpr (std::is_same_v<Type, bool>) {
+    out.append(value ? "true" : "false");
+  } else if constexpr (std::is_same_v<Type, char>) {
+    out.push_back(value);
+  } else if constexpr (std::is_array_v<T>) {
+    out.append(std::string_view(value));  // String literal
+  } else if constexpr (std::is_same_v<Type, const char*> || std::is_same_v<Type, char*>) {
+    out.append(value ? value : "(null)");
+  } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+    out.append(std::string_view(value));
+  } else if constexpr (std::is_integral_v<Type>) {
+    char buffer[24];
+    auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, result.ptr);
+  } else if constexpr (std::is_floating_point_v<Type>) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%g", static_cast<double>(value));
+    out.append(buffer, static_cast<size_t>(length));
+  } else if constexpr (std::is_enum_v<Type>) {
+    AppendArg(out, static_cast<std::underlying_type_t<Type>>(value));
+  } else {
+    static_assert(IsStreamable<Type>::value, "Log argument has no formatter and no operator<<");
+    std::ostringstream stream;
+    stream << value;
+    out.append(stream.str());
+  }
+}
+
+// Copies |format| up to the next "{}" and then |value|; without a "{}" left
+// the argument is ignored
+template <typename T>
+void AppendNext(std::string& out, std::string_view format, size_t& pos, const T& value) {
+  if (pos == std::string_view::npos) {
+    return;
+  }
+  size_t placeholder = format.find("{}", pos);
+  if (placeholder == std::string_view::npos) {
+    out.append(format.substr(pos));
+    pos = std::string_view::npos;
+    return;
+  }
+  out.append(format.substr(pos, placeholder - pos));
+  AppendArg(out, value);
+  pos = placeholder + 2;
+}
+
+constexpr size_t CountPlaceholders(std::string_view format) {
+  size_t count = 0;
+  for (size_t i = 0; i + 1 < format.size(); ++i) {
+    if (format[i] == '{' && format[i + 1] == '}') {
+      ++count;
+      ++i;
+    }
+  }
+  return count;
+}
+
+// Number of arguments after the format, for checks in unevaluated context
+template <typename... Args>
+std::integral_constant<size_t, sizeof...(Args)> ArgCount(std::string_view format,
+                                                         const Args&... args);
+
+}  // namespace log_internal
+
+/**
+ * Append |format| to |out| with each "{}" replaced by the next argument, in
+ * one pass and without temporary strings. Placeholders without an argument
+ * are kept as written; arguments without a placeholder are ignored.
+ */
+template <typename... Args>
+void FormatTo(std::string& out, std::string_view format, const Args&... args) {
+  size_t pos = 0;
+  (log_internal::AppendNext(out, format, pos, args), ...);
+  if (pos != std::string_view::npos) {
+    out.append(format.substr(pos));
+  }
+}
+
+template <typename... Args>
+std::string Format(std::string_view format, const Args&... args) {
+  std::string out;
+  out.reserve(format.size() + 16 * sizeof...(Args));
+  FormatTo(out, format, args...);
+  return out;
+}
+
+/**
+ * Append |text| as the inside of a JSON string. Bytes from 0x80 up are
+ * copied as they are (the text is expected to be UTF-8).
+ */
+inline void AppendJsonEscaped(std::string& out, std::string_view text) {
+  static constexpr char kHex[] = "0123456789abcdef";
+  size_t run = 0;  // Start of the bytes not yet copied
+  for (size_t i = 0; i < text.size(); ++i) {
+    const unsigned char c = static_cast<unsigned char>(text[i]);
+    if (c >= 0x20 && c != '"' && c != '\\') {
+      continue;
+    }
+    out.append(text.substr(run, i - run));
+    run = i + 1;
+    switch (c) {
+      case '"':
+        out.append("\\\"");
+        break;
+      case '\\':
+        out.append("\\\\");
+        break;
+      case '\n':
+        out.append("\\n");
+        break;
+      case '\r':
+        out.append("\\r");
+        break;
+      case '\t':
+        out.append("\\t");
+        break;
+      default: {
+        const char escape[] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+        out.append(escape, sizeof(escape));
+      }
+    }
+  }
+  out.append(text.substr(run));
+}
+
+}  // namespace utils
+}  // namespace athena
+
+#endif  // ATHENA_UTILS_LOG_FORMAT_H_
@@ -0,0 +1,489 @@
+#include "utils/log_writer.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace athena {
+namespace utils {
+
+namespace {
+
+std::atomic<uint64_t> next_writer_id{1};
+
+// Set once this thread's ring table is destroyed at thread exit; a trivially
+// destructible flag stays readable after that
+thread_local bool thread_rings_destroyed = false;
+
+struct RecordHeader {
+  uint64_t time;
+  uint32_t size;
+  int32_t file;
+  uint8_t targets;
+};
+
+constexpr std::string_view kTruncatedSuffix = " [truncated]";
+
+size_t RoundUpToPowerOfTwo(size_t value) {
+  size_t result = 1024;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+
+uint64_t NowNanoseconds() {
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count());
+}
+
+LogFlushPolicy ParseFlushPolicy(const char* policy, LogFlushPolicy fallback) {
+  if (!policy) {
+    return fallback;
+  }
+  std::string value(policy);
+  if (value == "interval") {
+    return LogFlushPolicy::kInterval;
+  }
+  if (value == "urgent") {
+    return LogFlushPolicy::kUrgent;
+  }
+  if (value == "line") {
+    return LogFlushPolicy::kEveryLine;
+  }
+  return fallback;
+}
+
+}  // namespace
+
+LogOutputFormat LogOutputFormatFromEnvironment() {
+  const char* format = std::getenv("ATHENA_LOG_FORMAT");
+  if (format && std::string(format) == "json") {
+    return LogOutputFormat::kJsonLines;
+  }
+  return LogOutputFormat::kText;
+}
+
+// ============================================================================
+// ThreadBuffer
+// ============================================================================
+
+/**
+ * Single-producer, single-consumer byte ring of length-prefixed lines.
+ * The owning thread pushes; the consumer holds the writer's drain_mutex_.
+ * head_ and tail_ only grow; their difference is the bytes in use.
+ */
+class LogWriter::ThreadBuffer {
+ public:
+  explicit ThreadBuffer(size_t capacity)
+      : data_(new char[capacity]), capacity_(capacity), mask_(capacity - 1) {}
+
+  bool Push(uint64_t time, int file, uint8_t targets, std::string_view line) {
+    const size_t needed = sizeof(RecordHeader) + line.size();
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (capacity_ - (tail - cached_head_) < needed) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      if (capacity_ - (tail - cached_head_) < needed) {
+        return false;
+      }
+    }
+
+    RecordHeader header{time, static_cast<uint32_t>(line.size()), file, targets};
+    CopyIn(tail, &header, sizeof(header));
+    CopyIn(tail + sizeof(header), line.data(), line.size());
+    tail_.store(tail + needed, std::memory_order_release);
+    return true;
+  }
+
+  // Producer side: more than half the ring is (or may still be) in use
+  bool IsHalfFull() const {
+    return tail_.load(std::memory_order_relaxed) - cached_head_ > capacity_ / 2;
+  }
+
+  void CountDrop() { dropped_.store(dropped_.load(std::memory_order_relaxed) + 1); }
+
+  uint64_t Dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+  // Consumer side: append every complete line to |out| and free its space
+  void CopyOut(std::string& out, std::vector<Record>& records) {
+    size_t head = head_.load(std::memory_order_relaxed);
+    const size_t tail = tail_.load(std::memory_order_acquire);
+    while (head != tail) {
+      RecordHeader header;
+      CopyOutBytes(head, &header, sizeof(header));
+      const size_t offset = out.size();
+      out.resize(offset + header.size);
+      CopyOutBytes(head + sizeof(header), out.data() + offset, header.size);
+      records.push_back(Record{header.time, header.file, header.targets, offset, header.size});
+      head += sizeof(header) + header.size;
+    }
+    head_.store(head, std::memory_order_release);
+  }
+
+  bool IsEmpty() const {
+    return head_.load(std::memory_order_relaxed) == tail_.load(std::memory_order_acquire);
+  }
+
+  // The writer is gone; the owning thread must not use this ring again
+  void Orphan() { orphaned_.store(true, std::memory_order_relaxed); }
+  bool IsOrphaned() const { return orphaned_.load(std::memory_order_relaxed); }
+
+ private:
+  void CopyIn(size_t position, const void* source, size_t size) {
+    const size_t start = position & mask_;
+    const size_t first = std::min(size, capacity_ - start);
+    std::memcpy(data_.get() + start, source, first);
+    std::memcpy(data_.get(), static_cast<const char*>(source) + first, size - first);
+  }
+
+  void CopyOutBytes(size_t position, void* destination, size_t size) const {
+    const size_t start = position & mask_;
+    const size_t first = std::min(size, capacity_ - start);
+    std::memcpy(destination, data_.get() + start, first);
+    std::memcpy(static_cast<char*>(destination) + first, data_.get(), size - first);
+  }
+
+  const std::unique_ptr<char[]> data_;
+  const size_t capacity_;
+  const size_t mask_;
+
+  alignas(64) std::atomic<size_t> head_{0};  // Written by the consumer
+  alignas(64) std::atomic<size_t> tail_{0};  // Written by the producer
+  size_t cached_head_ = 0;                   // Producer's last view of head_
+  std::atomic<uint64_t> dropped_{0};         // Written by the producer
+  std::atomic<bool> orphaned_{false};
+};
+
+// ============================================================================
+// LogWriter
+// ============================================================================
+
+LogWriter& LogWriter::Instance() {
+  // Never destroyed: Loggers may still log from static destructors, after
+  // the atexit handler has switched the writer to synchronous writes
+  static LogWriter* writer = [] {
+    LogWriterOptions options;
+    options.flush_policy = ParseFlushPolicy(std::getenv("ATHENA_LOG_FLUSH"), options.flush_policy);
+    options.format = LogOutputFormatFromEnvironment();
+    auto* instance = new LogWriter(options);
+    instance->Start();
+    std::atexit([] { Instance().Stop(); });
+    return instance;
+  }();
+  return *writer;
+}
+
+LogWriter::LogWriter(LogWriterOptions options)
+    : options_(options),
+      buffer_bytes_(RoundUpToPowerOfTwo(options.buffer_bytes)),
+      max_line_bytes_(std::min(kMaxLineBytes, buffer_bytes_ / 2 - sizeof(RecordHeader))),
+      id_(next_writer_id.fetch_add(1)) {}
+
+LogWriter::~LogWriter() {
+  Stop();
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const auto& buffer : buffers_) {
+    buffer->Orphan();
+  }
+}
+
+void LogWriter::Start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (running_ || synchronous_.load()) {
+    return;
+  }
+  running_ = true;
+  thread_ = std::thread(&LogWriter::Run, this);
+}
+
+void LogWriter::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wake_cv_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  {
+    std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+    DrainLocked();
+    synchronous_.store(true);
+  }
+
+  // A Flush() that raced with the last pass was covered by the drain above
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+    flushed_ = flush_requested_;
+  }
+  flushed_cv_.notify_all();
+}
+
+int LogWriter::OpenFile(const std::string& path) {
+  std::lock_guard<std::mutex> lock(drain_mutex_);
+  for (auto& [file, sink] : files_) {
+    if (sink.path == path) {
+      ++sink.users;
+      return file;
+    }
+  }
+
+  FileSink sink;
+  sink.path = path;
+  sink.stream.open(path, std::ios::app | std::ios::binary);
+  if (!sink.stream.is_open()) {
+    return kNoFile;
+  }
+  sink.users = 1;
+  int file = next_file_++;
+  files_.emplace(file, std::move(sink));
+  return file;
+}
+
+void LogWriter::CloseFile(int file) {
+  if (file == kNoFile) {
+    return;
+  }
+  Flush();
+
+  std::lock_guard<std::mutex> lock(drain_mutex_);
+  auto it = files_.find(file);
+  if (it != files_.end() && --it->second.users == 0) {
+    files_.erase(it);
+  }
+}
+
+bool LogWriter::Submit(std::string_view line, uint8_t targets, int file, bool urgent) {
+  std::string truncated;
+  if (line.size() > max_line_bytes_) {
+    truncated.assign(line.substr(0, max_line_bytes_ - kTruncatedSuffix.size()));
+    truncated.append(kTruncatedSuffix);
+    line = truncated;
+  }
+
+  ThreadBuffer* buffer = nullptr;
+  if (options_.flush_policy != LogFlushPolicy::kEveryLine && !synchronous_.load()) {
+    buffer = BufferForThread();
+  }
+  if (!buffer) {
+    std::lock_guard<std::mutex> lock(drain_mutex_);
+    DrainLocked();  // Earlier buffered lines first
+    WriteDirectLocked(line, targets, file);
+    return true;
+  }
+
+  const uint64_t time = NowNanoseconds();
+  if (!buffer->Push(time, file, targets, line)) {
+    if (!urgent) {
+      buffer->CountDrop();
+      return false;
+    }
+    Flush();
+    if (!buffer->Push(time, file, targets, line)) {
+      std::lock_guard<std::mutex> lock(drain_mutex_);
+      DrainLocked();
+      WriteDirectLocked(line, targets, file);
+      return true;
+    }
+  }
+
+  if ((urgent && options_.flush_policy == LogFlushPolicy::kUrgent) || buffer->IsHalfFull()) {
+    WakeWriter();
+  }
+  return true;
+}
+
+void LogWriter::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!running_) {
+    lock.unlock();
+    std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+    DrainLocked();
+    return;
+  }
+
+  const uint64_t ticket = ++flush_requested_;
+  wake_ = true;
+  wake_cv_.notify_one();
+  flushed_cv_.wait(lock, [this, ticket] { return flushed_ >= ticket || !running_; });
+}
+
+uint64_t LogWriter::DroppedCount() const {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  uint64_t dropped = retired_dropped_;
+  for (const auto& buffer : buffers_) {
+    dropped += buffer->Dropped();
+  }
+  return dropped;
+}
+
+LogWriter::ThreadBuffer* LogWriter::BufferForThread() {
+  struct ThreadRings {
+    std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>> rings;
+    ~ThreadRings() { thread_rings_destroyed = true; }
+  };
+
+  if (thread_rings_destroyed) {
+    return nullptr;  // Thread is exiting
+  }
+  static thread_local ThreadRings thread_rings;
+  auto& rings = thread_rings.rings;
+  for (const auto& [writer, buffer] : rings) {
+    if (writer == id_) {
+      return buffer.get();
+    }
+  }
+
+  rings.erase(std::remove_if(rings.begin(),
+                             rings.end(),
+                             [](const auto& ring) { return ring.second->IsOrphaned(); }),
+              rings.end());
+  auto buffer = std::make_shared<ThreadBuffer>(buffer_bytes_);
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers_.push_back(buffer);
+  }
+  rings.emplace_back(id_, buffer);
+  return buffer.get();
+}
+
+void LogWriter::WakeWriter() {
+  if (wake_pending_.exchange(true)) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_ = true;
+  }
+  wake_cv_.notify_one();
+}
+
+void LogWriter::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wake_cv_.wait_for(lock, options_.flush_interval, [this] { return wake_ || stop_; });
+    wake_ = false;
+    const uint64_t ticket = flush_requested_;
+    const bool stopping = stop_;
+    lock.unlock();
+
+    wake_pending_.store(false);
+    {
+      std::lock_guard<std::mutex> drain_lock(drain_mutex_);
+      DrainLocked();
+    }
+
+    lock.lock();
+    flushed_ = ticket;
+    flushed_cv_.notify_all();
+    if (stopping) {
+      return;
+    }
+  }
+}
+
+void LogWriter::DrainLocked() {
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers = buffers_;
+  }
+
+  scratch_.clear();
+  records_.clear();
+  uint64_t dropped = 0;
+  for (const auto& buffer : buffers) {
+    buffer->CopyOut(scratch_, records_);
+    dropped += buffer->Dropped();
+  }
+
+  // Release the rings of threads that have exited (held only by buffers_
+  // and the copy above) once they are empty
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    dropped += retired_dropped_;
+    for (auto it = buffers_.begin(); it != buffers_.end();) {
+      if (it->use_count() == 2) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if ((*it)->IsEmpty()) {
+          retired_dropped_ += (*it)->Dropped();
+          it = buffers_.erase(it);
+          continue;
+        }
+      }
+      ++it;
+    }
+  }
+  dropped_seen_ = dropped;
+
+  // Each ring is already in time order; merging keeps every thread's lines
+  // in the order they were logged
+  std::stable_sort(records_.begin(), records_.end(), [](const Record& a, const Record& b) {
+    return a.time < b.time;
+  });
+  WriteRecordsLocked();
+}
+
+void LogWriter::WriteDirectLocked(std::string_view line, uint8_t targets, int file) {
+  scratch_.assign(line);
+  records_.clear();
+  records_.push_back(Record{0, file, targets, 0, line.size()});
+  WriteRecordsLocked();
+}
+
+void LogWriter::WriteRecordsLocked() {
+  stdout_batch_.clear();
+  stderr_batch_.clear();
+  for (const Record& record : records_) {
+    std::string_view line(scratch_.data() + record.offset, record.size);
+    if (record.targets & kStdout) {
+      stdout_batch_.append(line).push_back('\n');
+    }
+    if (record.targets & kStderr) {
+      stderr_batch_.append(line).push_back('\n');
+    }
+    if (record.targets & kFile) {
+      auto it = files_.find(record.file);
+      if (it != files_.end()) {
+        it->second.batch.append(line).push_back('\n');
+      }
+    }
+  }
+
+  if (dropped_seen_ > dropped_reported_) {
+    const std::string note = std::to_string(dropped_seen_ - dropped_reported_) +
+                             " log lines dropped: a thread's log buffer was full";
+    if (options_.format == LogOutputFormat::kJsonLines) {
+      const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch());
+      stderr_batch_ += "{\"ts\":" + std::to_string(now.count()) +
+                       ",\"level\":\"WARN\",\"logger\":\"log\",\"msg\":\"" + note + "\"}\n";
+    } else {
+      stderr_batch_ += "[log] [WARN] " + note + "\n";
+    }
+    dropped_reported_ = dropped_seen_;
+  }
+
+  if (!stdout_batch_.empty()) {
+    std::fwrite(stdout_batch_.data(), 1, stdout_batch_.size(), stdout);
+    std::fflush(stdout);
+  }
+  if (!stderr_batch_.empty()) {
+    std::fwrite(stderr_batch_.data(), 1, stderr_batch_.size(), stderr);
+    std::fflush(stderr);
+  }
+  for (auto& [file, sink] : files_) {
+    if (!sink.batch.empty()) {
+      sink.stream.write(sink.batch.data(), static_cast<std::streamsize>(sink.batch.size()));
+      sink.stream.flush();
+      sink.batch.clear();
+    }
+  }
+}
+
+}  // namespace utils
+}  // namespace athena
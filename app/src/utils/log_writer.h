@@ -0,0 +1,195 @@
+#ifndef ATHENA_UTILS_LOG_WRITER_H_
+#define ATHENA_UTILS_LOG_WRITER_H_
+
+#include "utils/log_format.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace athena {
+namespace utils {
+
+/**
+ * When buffered log lines reach their destinations.
+ */
+enum class LogFlushPolicy {
+  kInterval,   // Every flush interval, and on Flush()
+  kUrgent,     // As kInterval, and straight away for urgent lines (errors)
+  kEveryLine,  // Before Submit() returns (unbuffered; the slowest)
+};
+
+/**
+ * ATHENA_LOG_FORMAT ("text" or "json"); text if unset or unrecognized.
+ */
+LogOutputFormat LogOutputFormatFromEnvironment();
+
+struct LogWriterOptions {
+  size_t buffer_bytes = 1024 * 1024;  // Per logging thread; rounded up to a power of two
+  std::chrono::milliseconds flush_interval{50};
+  LogFlushPolicy flush_policy = LogFlushPolicy::kUrgent;
+  LogOutputFormat format = LogOutputFormat::kText;  // Of the writer's own notes
+};
+
+/**
+ * Asynchronous backend behind Logger: moves formatted lines off the logging
+ * thread and writes them in batches.
+ *
+ * Each thread that logs gets its own bounded single-producer ring buffer, so
+ * Submit() is a copy into memory with no lock and no I/O. A background
+ * thread drains all rings, merges their lines in time order (each thread's
+ * own lines are never reordered) and issues one write per destination per
+ * batch. When a thread's ring is full its lines are dropped and counted
+ * rather than blocking; a note with the count goes to stderr. Urgent lines
+ * are never dropped: the caller waits for the ring to drain instead.
+ *
+ * Once Stop() has run (at exit for the process-wide instance), Submit()
+ * writes synchronously, so logging from static destructors still works.
+ *
+ * Thread-safe.
+ */
+class LogWriter {
+ public:
+  // Destinations of a line (bit mask)
+  static constexpr uint8_t kStdout = 1 << 0;
+  static constexpr uint8_t kStderr = 1 << 1;
+  static constexpr uint8_t kFile = 1 << 2;
+
+  static constexpr int kNoFile = -1;
+
+  // Longer lines are cut short, so one line cannot fill a thread's ring
+  static constexpr size_t kMaxLineBytes = 64 * 1024;
+
+  /**
+   * The process-wide writer, started on first use and stopped at exit.
+   * ATHENA_LOG_FLUSH ("interval", "urgent" or "line") overrides the policy
+   * and ATHENA_LOG_FORMAT the format.
+   */
+  static LogWriter& Instance();
+
+  explicit LogWriter(LogWriterOptions options = LogWriterOptions());
+  ~LogWriter();
+
+  LogWriter(const LogWriter&) = delete;
+  LogWriter& operator=(const LogWriter&) = delete;
+
+  /**
+   * Start the background thread. Until then lines only accumulate in the
+   * rings (and Flush() writes them on the calling thread).
+   */
+  void Start();
+
+  /**
+   * Write everything buffered, stop the background thread and switch to
+   * synchronous writes.
+   */
+  void Stop();
+
+  /**
+   * Open |path| for appending, shared with other users of the same path.
+   * @return File handle for Submit(), or kNoFile if it cannot be opened
+   */
+  int OpenFile(const std::string& path);
+
+  /**
+   * Write what is buffered for |file| and release the handle.
+   */
+  void CloseFile(int file);
+
+  /**
+   * Queue one line (without its newline) for |targets|.
+   * @param urgent Write without waiting for the flush interval, and never drop
+   * @return false if the line was dropped because the ring was full
+   */
+  bool Submit(std::string_view line, uint8_t targets, int file = kNoFile, bool urgent = false);
+
+  /**
+   * Block until every line submitted before the call has been written.
+   */
+  void Flush();
+
+  /**
+   * Lines dropped so far because a ring was full.
+   */
+  uint64_t DroppedCount() const;
+
+  const LogWriterOptions& GetOptions() const { return options_; }
+
+ private:
+  class ThreadBuffer;
+
+  // A line copied out of a ring into scratch_
+  struct Record {
+    uint64_t time;
+    int file;
+    uint8_t targets;
+    size_t offset;
+    size_t size;
+  };
+
+  struct FileSink {
+    std::string path;
+    std::ofstream stream;
+    std::string batch;
+    int users = 0;
+  };
+
+  ThreadBuffer* BufferForThread();
+  void WakeWriter();
+  void Run();
+
+  // Drain every ring and write the lines. drain_mutex_ must be held.
+  void DrainLocked();
+  void WriteDirectLocked(std::string_view line, uint8_t targets, int file);
+  void WriteRecordsLocked();
+
+  const LogWriterOptions options_;
+  const size_t buffer_bytes_;
+  const size_t max_line_bytes_;
+  const uint64_t id_;  // Distinguishes writers in the thread-local ring lookup
+
+  // Rings of every thread that has logged; a ring whose thread has exited
+  // is dropped once drained
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+  uint64_t retired_dropped_ = 0;  // Drops counted by rings already released
+  mutable std::mutex buffers_mutex_;
+
+  // Consumer side: draining, file handles and the actual writes
+  std::mutex drain_mutex_;
+  std::map<int, FileSink> files_;
+  int next_file_ = 0;
+  std::string scratch_;  // Lines copied out of the rings
+  std::vector<Record> records_;
+  std::string stdout_batch_;
+  std::string stderr_batch_;
+  uint64_t dropped_seen_ = 0;
+  uint64_t dropped_reported_ = 0;
+
+  // Background thread
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable wake_cv_;
+  std::condition_variable flushed_cv_;
+  bool wake_ = false;
+  bool stop_ = false;
+  bool running_ = false;
+  uint64_t flush_requested_ = 0;
+  uint64_t flushed_ = 0;
+  std::atomic<bool> wake_pending_{false};  // A wake is already on its way
+  std::atomic<bool> synchronous_{false};   // Stopped: write on the calling thread
+};
+
+}  // namespace utils
+}  // namespace athena
+
+#endif  // ATHENA_UTILS_LOG_WRITER_H_
@@ -1,5 +1,7 @@
 #include "utils/logging.h"
 
+#include "utils/log_writer.h"
+
 #include <cstdlib>
 #include <ctime>
 
@@ -36,13 +38,23 @@ static LogLevel ParseLogLevel(const char* level_str) {
 Logger::Logger(const std::string& name)
     : name_(name),
       level_(ParseLogLevel(std::getenv("LOG_LEVEL"))),
+      format_(LogOutputFormatFromEnvironment()),
       console_output_(true),
-      file_output_(false) {}
+      file_output_(false),
+      file_(LogWriter::kNoFile) {
+  std::string json_name;
+  AppendJsonEscaped(json_name, name_);
+  for (size_t i = 0; i < kLevelCount; ++i) {
+    const std::string level = LevelToString(static_cast<LogLevel>(i));
+    text_prefixes_[i] = "] [" + name_ + "] [" + level + "] ";
+    json_prefixes_[i] =
+        "\",\"level\":\"" + level + "\",\"logger\":\"" + json_name + "\",\"msg\":\"";
+  }
+}
 
 Logger::~Logger() {
-  if (file_stream_ && file_stream_->is_open()) {
-    file_stream_->close();
-  }
+  // Flushes this logger's lines before the file is released
+  LogWriter::Instance().CloseFile(file_);
 }
 
 void Logger::SetLevel(LogLevel level) {
@@ -54,12 +66,14 @@ void Logger::SetOutputFile(const std::string& filepath) {
   std::lock_guard<std::mutex> lock(mutex_);
   output_file_ = filepath;
 
+  LogWriter& writer = LogWriter::Instance();
+  writer.CloseFile(file_.exchange(LogWriter::kNoFile));
   if (!filepath.empty()) {
-    file_stream_ = std::make_unique<std::ofstream>(filepath, std::ios::app);
-    if (!file_stream_->is_open()) {
+    int file = writer.OpenFile(filepath);
+    if (file == LogWriter::kNoFile) {
       std::cerr << "Failed to open log file: " << filepath << std::endl;
-      file_stream_.reset();
     }
+    file_ = file;
   }
 }
 
@@ -73,55 +87,67 @@ void Logger::EnableFileOutput(bool enable) {
   file_output_ = enable;
 }
 
-void Logger::Debug(const std::string& message) {
-  Log(LogLevel::kDebug, message);
-}
-
-void Logger::Info(const std::string& message) {
-  Log(LogLevel::kInfo, message);
-}
-
-void Logger::Warn(const std::string& message) {
-  Log(LogLevel::kWarn, message);
+void Logger::SetFormat(LogOutputFormat format) {
+  format_ = format;
 }
 
-void Logger::Error(const std::string& message) {
-  Log(LogLevel::kError, message);
+std::string& Logger::MessageBuffer() {
+  thread_local std::string buffer;
+  return buffer;
 }
 
-void Logger::Fatal(const std::string& message) {
-  Log(LogLevel::kFatal, message);
+std::string& Logger::LineBuffer() {
+  thread_local std::string buffer;
+  return buffer;
 }
 
-void Logger::Log(LogLevel level, const std::string& message) {
-  if (level < level_) {
-    return;
-  }
-
-  std::string log_line = FormatLogLine(level, message);
-
-  std::lock_guard<std::mutex> lock(mutex_);
-
+void Logger::Log(LogLevel level, std::string_view message) {
+  uint8_t targets = 0;
   if (console_output_) {
-    if (level >= LogLevel::kError) {
-      std::cerr << log_line << std::endl;
-    } else {
-      std::cout << log_line << std::endl;
-    }
+    targets |= level >= LogLevel::kError ? LogWriter::kStderr : LogWriter::kStdout;
+  }
+  const int file = file_;
+  if (file_output_ && file != LogWriter::kNoFile) {
+    targets |= LogWriter::kFile;
+  }
+  if (targets == 0) {
+    return;
   }
 
-  if (file_output_ && file_stream_ && file_stream_->is_open()) {
-    *file_stream_ << log_line << std::endl;
-    file_stream_->flush();
+  // Errors are written without waiting for the next batch; a fatal line
+  // must be out before the caller (likely) terminates the process
+  LogWriter& writer = LogWriter::Instance();
+  std::string& line = LineBuffer();
+  line.clear();
+  AppendLogLine(line, level, message);
+  writer.Submit(line, targets, file, level >= LogLevel::kError);
+  if (level == LogLevel::kFatal) {
+    writer.Flush();
   }
 }
 
-std::string Logger::FormatLogLine(LogLevel level, const std::string& message) {
-  std::ostringstream oss;
-  oss << "[" << CurrentTimestamp() << "] "
-      << "[" << name_ << "] "
-      << "[" << LevelToString(level) << "] " << message;
-  return oss.str();
+void Logger::AppendLogLine(std::string& out, LogLevel level, std::string_view message) const {
+  thread_local LogTimestamp timestamp;
+  const auto now = std::chrono::system_clock::now();
+  const std::string_view stamp = timestamp.Format(now);
+  const size_t index = static_cast<size_t>(level);
+
+  if (format_.load(std::memory_order_relaxed) == LogOutputFormat::kJsonLines) {
+    const auto ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+    out.append("{\"ts\":");
+    log_internal::AppendArg(out, static_cast<int64_t>(ms));
+    out.append(",\"time\":\"");
+    out.append(stamp);
+    out.append(json_prefixes_[index]);
+    AppendJsonEscaped(out, message);
+    out.append("\"}");
+  } else {
+    out.push_back('[');
+    out.append(stamp);
+    out.append(text_prefixes_[index]);
+    out.append(message);
+  }
 }
 
 std::string Logger::LevelToString(LogLevel level) {
@@ -141,23 +167,31 @@ std::string Logger::LevelToString(LogLevel level) {
   }
 }
 
-std::string Logger::CurrentTimestamp() {
-  auto now = std::chrono::system_clock::now();
-  auto now_time_t = std::chrono::system_clock::to_time_t(now);
-  auto now_ms =
-      std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
+// ============================================================================
+// LogTimestamp
+// ============================================================================
 
-  std::tm tm_buf;
+std::string_view LogTimestamp::Format(std::chrono::system_clock::time_point time) {
+  const auto second = std::chrono::floor<std::chrono::seconds>(time);
+  const int64_t seconds = second.time_since_epoch().count();
+  if (seconds != second_) {
+    std::time_t time_t_value = static_cast<std::time_t>(seconds);
+    std::tm tm_buf;
 #if defined(_WIN32)
-  localtime_s(&tm_buf, &now_time_t);
+    localtime_s(&tm_buf, &time_t_value);
 #else
-  localtime_r(&now_time_t, &tm_buf);
+    localtime_r(&time_t_value, &tm_buf);
 #endif
+    std::strftime(text_, sizeof(text_), "%Y-%m-%d %H:%M:%S.000", &tm_buf);
+    second_ = seconds;
+  }
 
-  std::ostringstream oss;
-  oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0') << std::setw(3)
-      << now_ms.count();
-  return oss.str();
+  const int ms = static_cast<int>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(time - second).count());
+  text_[kLength - 3] = static_cast<char>('0' + ms / 100);
+  text_[kLength - 2] = static_cast<char>('0' + ms / 10 % 10);
+  text_[kLength - 1] = static_cast<char>('0' + ms % 10);
+  return std::string_view(text_, kLength);
 }
 
 }  // namespace utils
@@ -1,20 +1,60 @@
 #ifndef ATHENA_UTILS_LOGGING_H_
 #define ATHENA_UTILS_LOGGING_H_
 
+#include "utils/log_format.h"
+
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace athena {
 namespace utils {
 
 enum class LogLevel { kDebug = 0, kInfo = 1, kWarn = 2, kError = 3, kFatal = 4 };
 
+/**
+ * Local time as "YYYY-MM-DD HH:MM:SS.mmm". The date and time are formatted
+ * once per second; within a second only the milliseconds are rewritten.
+ *
+ * Not thread-safe: Logger keeps one per thread.
+ */
+class LogTimestamp {
+ public:
+  static constexpr size_t kLength = 23;
+
+  /**
+   * @return View of the stamp, valid until the next call
+   */
+  std::string_view Format(std::chrono::system_clock::time_point time);
+
+ private:
+  int64_t second_ = std::numeric_limits<int64_t>::min();  // Second text_ was formatted for
+  char text_[kLength + 1] = {};
+};
+
+/**
+ * Named logger. Lines are formatted on the calling thread and handed to the
+ * process-wide LogWriter, which writes them in the background; errors are
+ * written straight away and a fatal line is on disk before Fatal() returns.
+ *
+ * Formatting happens only for enabled levels, in one pass (see FormatTo()).
+ * The arguments themselves are still evaluated; where building them costs
+ * something (toStdString(), dump()), use the ATHENA_LOG_* macros below.
+ *
+ * Lines are plain text by default, or JSON objects (ATHENA_LOG_FORMAT=json):
+ * {"ts":1735732800123,"time":"2025-01-01 12:00:00.123","level":"INFO",
+ *  "logger":"Name","msg":"..."} on one line, with ts in Unix milliseconds.
+ */
 class Logger {
  public:
   explicit Logger(const std::string& name);
@@ -25,83 +65,137 @@ class Logger {
   void SetOutputFile(const std::string& filepath);
   void EnableConsoleOutput(bool enable);
   void EnableFileOutput(bool enable);
+  void SetFormat(LogOutputFormat format);
 
   // Logging methods
-  void Debug(const std::string& message);
-  void Info(const std::string& message);
-  void Warn(const std::string& message);
-  void Error(const std::string& message);
-  void Fatal(const std::string& message);
+  void Debug(std::string_view message) { LogIfEnabled(LogLevel::kDebug, message); }
+  void Info(std::string_view message) { LogIfEnabled(LogLevel::kInfo, message); }
+  void Warn(std::string_view message) { LogIfEnabled(LogLevel::kWarn, message); }
+  void Error(std::string_view message) { LogIfEnabled(LogLevel::kError, message); }
+  void Fatal(std::string_view message) { LogIfEnabled(LogLevel::kFatal, message); }
 
-  // Template methods for formatting
+  // Template methods for formatting ("{}" placeholders)
   template <typename... Args>
-  void Debug(const std::string& format, Args&&... args) {
-    Log(LogLevel::kDebug, Format(format, std::forward<Args>(args)...));
+  void Debug(std::string_view format, const Args&... args) {
+    LogIfEnabled(LogLevel::kDebug, format, args...);
   }
 
   template <typename... Args>
-  void Info(const std::string& format, Args&&... args) {
-    Log(LogLevel::kInfo, Format(format, std::forward<Args>(args)...));
+  void Info(std::string_view format, const Args&... args) {
+    LogIfEnabled(LogLevel::kInfo, format, args...);
   }
 
   template <typename... Args>
-  void Warn(const std::string& format, Args&&... args) {
-    Log(LogLevel::kWarn, Format(format, std::forward<Args>(args)...));
+  void Warn(std::string_view format, const Args&... args) {
+    LogIfEnabled(LogLevel::kWarn, format, args...);
   }
 
   template <typename... Args>
-  void Error(const std::string& format, Args&&... args) {
-    Log(LogLevel::kError, Format(format, std::forward<Args>(args)...));
+  void Error(std::string_view format, const Args&... args) {
+    LogIfEnabled(LogLevel::kError, format, args...);
   }
 
   template <typename... Args>
-  void Fatal(const std::string& format, Args&&... args) {
-    Log(LogLevel::kFatal, Format(format, std::forward<Args>(args)...));
+  void Fatal(std::string_view format, const Args&... args) {
+    LogIfEnabled(LogLevel::kFatal, format, args...);
   }
 
-  LogLevel GetLevel() const { return level_; }
+  /**
+   * Format and log without checking the level; for the ATHENA_LOG_* macros,
+   * which check IsEnabled() first.
+   */
+  template <typename... Args>
+  void LogFormatted(LogLevel level, std::string_view format, const Args&... args) {
+    std::string& message = MessageBuffer();
+    message.clear();
+    FormatTo(message, format, args...);
+    Log(level, message);
+  }
+
+  LogLevel GetLevel() const { return level_.load(std::memory_order_relaxed); }
+  LogOutputFormat GetFormat() const { return format_.load(std::memory_order_relaxed); }
   const std::string& GetName() const { return name_; }
-  bool IsDebugEnabled() const { return level_ <= LogLevel::kDebug; }
+  bool IsEnabled(LogLevel level) const { return level >= GetLevel(); }
+  bool IsDebugEnabled() const { return IsEnabled(LogLevel::kDebug); }
 
  private:
-  void Log(LogLevel level, const std::string& message);
-  std::string FormatLogLine(LogLevel level, const std::string& message);
-  std::string LevelToString(LogLevel level);
-  std::string CurrentTimestamp();
-
-  // Simple format implementation
-  template <typename T>
-  std::string Format(const std::string& format, T&& value) {
-    size_t pos = format.find("{}");
-    if (pos == std::string::npos) {
-      return format;
+  void LogIfEnabled(LogLevel level, std::string_view message) {
+    if (IsEnabled(level)) {
+      Log(level, message);
     }
-    std::ostringstream oss;
-    oss << format.substr(0, pos) << value << format.substr(pos + 2);
-    return oss.str();
   }
 
-  template <typename T, typename... Args>
-  std::string Format(const std::string& format, T&& value, Args&&... args) {
-    size_t pos = format.find("{}");
-    if (pos == std::string::npos) {
-      return format;
+  template <typename... Args>
+  void LogIfEnabled(LogLevel level, std::string_view format, const Args&... args) {
+    if (IsEnabled(level)) {
+      LogFormatted(level, format, args...);
     }
-    std::ostringstream oss;
-    oss << format.substr(0, pos) << value;
-    return oss.str() + Format(format.substr(pos + 2), std::forward<Args>(args)...);
   }
 
+  void Log(LogLevel level, std::string_view message);
+  void AppendLogLine(std::string& out, LogLevel level, std::string_view message) const;
+  static std::string LevelToString(LogLevel level);
+
+  // Per-thread scratch for formatted messages and lines, reused across calls
+  static std::string& MessageBuffer();
+  static std::string& LineBuffer();
+
+  static constexpr size_t kLevelCount = 5;
+
   std::string name_;
-  LogLevel level_;
-  bool console_output_;
-  bool file_output_;
+  // Everything between the timestamp and the message, per level and format:
+  // "] [Name] [INFO] " and ","level":"INFO","logger":"Name","msg":""
+  std::array<std::string, kLevelCount> text_prefixes_;
+  std::array<std::string, kLevelCount> json_prefixes_;
+  std::atomic<LogLevel> level_;
+  std::atomic<LogOutputFormat> format_;
+  std::atomic<bool> console_output_;
+  std::atomic<bool> file_output_;
   std::string output_file_;
-  std::unique_ptr<std::ofstream> file_stream_;
-  mutable std::mutex mutex_;
+  std::atomic<int> file_;    // LogWriter file handle
+  mutable std::mutex mutex_;  // Serializes reconfiguration
 };
 
 }  // namespace utils
 }  // namespace athena
 
+// ============================================================================
+// Logging Macros
+// ============================================================================
+//
+// ATHENA_LOG_INFO(logger, "Loaded {} in {} ms", url, elapsed);
+//
+// Unlike the Logger methods, the arguments are not evaluated at all when the
+// level is disabled, and statements below ATHENA_LOG_MIN_LEVEL (0 = debug ...
+// 4 = fatal) compile to nothing. The format must be a string literal whose
+// "{}" count matches the arguments; a mismatch is a compile error.
+
+#ifndef ATHENA_LOG_MIN_LEVEL
+#define ATHENA_LOG_MIN_LEVEL 0
+#endif
+
+#define ATHENA_LOG_FORMAT_(format, ...) format
+
+#define ATHENA_LOG(logger, level, ...)                                                           \
+  do {                                                                                           \
+    static_assert(::athena::utils::log_internal::CountPlaceholders(                              \
+                      ATHENA_LOG_FORMAT_(__VA_ARGS__, unused)) ==                                \
+                      decltype(::athena::utils::log_internal::ArgCount(__VA_ARGS__))::value,     \
+                  "Log format placeholders do not match the arguments");                         \
+    if (static_cast<int>(level) >= ATHENA_LOG_MIN_LEVEL && (logger).IsEnabled(level)) {          \
+      (logger).LogFormatted(level, __VA_ARGS__);                                                 \
+    }                                                                                            \
+  } while (0)
+
+#define ATHENA_LOG_DEBUG(logger, ...) \
+  ATHENA_LOG(logger, ::athena::utils::LogLevel::kDebug, __VA_ARGS__)
+#define ATHENA_LOG_INFO(logger, ...) \
+  ATHENA_LOG(logger, ::athena::utils::LogLevel::kInfo, __VA_ARGS__)
+#define ATHENA_LOG_WARN(logger, ...) \
+  ATHENA_LOG(logger, ::athena::utils::LogLevel::kWarn, __VA_ARGS__)
+#define ATHENA_LOG_ERROR(logger, ...) \
+  ATHENA_LOG(logger, ::athena::utils::LogLevel::kError, __VA_ARGS__)
+#define ATHENA_LOG_FATAL(logger, ...) \
+  ATHENA_LOG(logger, ::athena::utils::LogLevel::kFatal, __VA_ARGS__)
+
 #endif  // ATHENA_UTILS_LOGGING_H_
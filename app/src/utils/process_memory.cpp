@@ -0,0 +1,101 @@
+#include "utils/process_memory.h"
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#endif
+
+namespace athena {
+namespace utils {
+
+#if defined(__linux__)
+
+namespace {
+
+// Parent PID from /proc/<pid>/stat; the command name may contain spaces and
+// parentheses, so parse from the last ')'
+bool ReadParentPid(const std::string& pid, pid_t* ppid) {
+  std::ifstream stat("/proc/" + pid + "/stat");
+  std::string line;
+  if (!std::getline(stat, line)) {
+    return false;
+  }
+
+  size_t close = line.rfind(')');
+  if (close == std::string::npos || close + 4 > line.size()) {
+    return false;
+  }
+
+  // ") S ppid ..."
+  size_t ppid_start = line.find(' ', close + 2);
+  if (ppid_start == std::string::npos) {
+    return false;
+  }
+  *ppid = static_cast<pid_t>(std::strtol(line.c_str() + ppid_start + 1, nullptr, 10));
+  return true;
+}
+
+uint64_t ReadResidentPages(pid_t pid) {
+  std::ifstream statm("/proc/" + std::to_string(pid) + "/statm");
+  uint64_t size_pages = 0;
+  uint64_t resident_pages = 0;
+  if (!(statm >> size_pages >> resident_pages)) {
+    return 0;
+  }
+  return resident_pages;
+}
+
+}  // namespace
+
+std::optional<uint64_t> GetProcessTreeResidentBytes() {
+  DIR* proc = opendir("/proc");
+  if (!proc) {
+    return std::nullopt;
+  }
+
+  std::map<pid_t, std::vector<pid_t>> children;
+  while (dirent* entry = readdir(proc)) {
+    if (!std::isdigit(static_cast<unsigned char>(entry->d_name[0]))) {
+      continue;
+    }
+    pid_t ppid = 0;
+    if (ReadParentPid(entry->d_name, &ppid)) {
+      children[ppid].push_back(static_cast<pid_t>(std::strtol(entry->d_name, nullptr, 10)));
+    }
+  }
+  closedir(proc);
+
+  const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+  uint64_t resident_pages = 0;
+  std::vector<pid_t> pending = {getpid()};
+  while (!pending.empty()) {
+    pid_t pid = pending.back();
+    pending.pop_back();
+    resident_pages += ReadResidentPages(pid);
+
+    auto it = children.find(pid);
+    if (it != children.end()) {
+      pending.insert(pending.end(), it->second.begin(), it->second.end());
+    }
+  }
+
+  return resident_pages * page_size;
+}
+
+#else
+
+std::optional<uint64_t> GetProcessTreeResidentBytes() {
+  return std::nullopt;
+}
+
+#endif
+
+}  // namespace utils
+}  // namespace athena
@@ -0,0 +1,24 @@
+#ifndef ATHENA_UTILS_PROCESS_MEMORY_H_
+#define ATHENA_UTILS_PROCESS_MEMORY_H_
+
+#include <cstdint>
+#include <optional>
+
+namespace athena {
+namespace utils {
+
+/**
+ * Resident memory of this process plus all of its descendants (CEF's
+ * renderer, GPU and utility processes), in bytes.
+ *
+ * Reads /proc, so it costs a directory scan; call it every few seconds at
+ * most. Shared pages are counted once per process, so this overestimates.
+ *
+ * @return Resident bytes, or nullopt where /proc is unavailable (non-Linux)
+ */
+std::optional<uint64_t> GetProcessTreeResidentBytes();
+
+}  // namespace utils
+}  // namespace athena
+
+#endif  // ATHENA_UTILS_PROCESS_MEMORY_H_
@@ -0,0 +1,118 @@
+#include "utils/startup_timeline.h"
+
+#include "utils/logging.h"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace athena {
+namespace utils {
+
+// Static logger for this module
+static Logger logger("Startup");
+
+StartupTimeline& StartupTimeline::Instance() {
+  static StartupTimeline timeline;
+  return timeline;
+}
+
+StartupTimeline::StartupTimeline(Clock::time_point origin) : origin_(origin) {}
+
+void StartupTimeline::Mark(const std::string& phase, Clock::time_point at) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  for (const auto& mark : marks_) {
+    if (mark.first == phase) {
+      return;
+    }
+  }
+  marks_.emplace_back(phase, at);
+
+  double at_ms = std::chrono::duration<double, std::milli>(at - origin_).count();
+  logger.Debug("{} at {} ms", phase, static_cast<int64_t>(at_ms));
+
+  if (expected_.erase(phase) > 0) {
+    MaybeComplete(lock);
+  }
+}
+
+void StartupTimeline::Expect(const std::string& phase) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (const auto& mark : marks_) {
+    if (mark.first == phase) {
+      return;  // Already happened
+    }
+  }
+  expected_.insert(phase);
+}
+
+void StartupTimeline::Cancel(const std::string& phase) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (expected_.erase(phase) > 0) {
+    MaybeComplete(lock);
+  }
+}
+
+bool StartupTimeline::Has(const std::string& phase) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return std::any_of(
+      marks_.begin(), marks_.end(), [&phase](const auto& mark) { return mark.first == phase; });
+}
+
+std::vector<StartupTimeline::Phase> StartupTimeline::GetPhases() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto marks = marks_;
+  std::stable_sort(marks.begin(), marks.end(), [](const auto& a, const auto& b) {
+    return a.second < b.second;
+  });
+
+  std::vector<Phase> phases;
+  phases.reserve(marks.size());
+  Clock::time_point previous = origin_;
+  for (const auto& [name, at] : marks) {
+    Phase phase;
+    phase.name = name;
+    phase.at_ms = std::chrono::duration<double, std::milli>(at - origin_).count();
+    phase.delta_ms = std::chrono::duration<double, std::milli>(at - previous).count();
+    phases.push_back(std::move(phase));
+    previous = at;
+  }
+  return phases;
+}
+
+bool StartupTimeline::IsComplete() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return complete_;
+}
+
+std::string StartupTimeline::Summary() const {
+  std::string summary;
+  char line[160];
+  for (const Phase& phase : GetPhases()) {
+    std::snprintf(line,
+                  sizeof(line),
+                  "%8.1f ms  (+%.1f ms)  %s\n",
+                  phase.at_ms,
+                  phase.delta_ms,
+                  phase.name.c_str());
+    summary += line;
+  }
+  return summary;
+}
+
+void StartupTimeline::MaybeComplete(std::unique_lock<std::mutex>& lock) {
+  if (complete_ || !expected_.empty()) {
+    return;
+  }
+  complete_ = true;
+
+  // Summary() takes the lock itself
+  lock.unlock();
+  std::string summary = Summary();
+  if (!summary.empty()) {
+    summary.pop_back();
+  }
+  logger.Info("Cold start timeline:\n" + summary);
+}
+
+}  // namespace utils
+}  // namespace athena
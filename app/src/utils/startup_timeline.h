@@ -0,0 +1,90 @@
+#ifndef ATHENA_UTILS_STARTUP_TIMELINE_H_
+#define ATHENA_UTILS_STARTUP_TIMELINE_H_
+
+#include <chrono>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace athena {
+namespace utils {
+
+/**
+ * Timestamps of the phases of a cold start, relative to the start of main().
+ *
+ * Startup code marks each phase as it completes ("cef_initialized",
+ * "node_ready", ...). Phases that finish asynchronously are declared up front
+ * with Expect(); once every expected phase has been marked (or cancelled
+ * because it will never happen), the whole timeline is logged once, so one
+ * log line per phase covers cold start end to end.
+ *
+ * Only the first mark of a phase counts. Thread-safe.
+ */
+class StartupTimeline {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Phase {
+    std::string name;
+    double at_ms = 0;     // Since the origin
+    double delta_ms = 0;  // Since the previous phase
+  };
+
+  /**
+   * The process-wide timeline; its origin is the first call.
+   */
+  static StartupTimeline& Instance();
+
+  explicit StartupTimeline(Clock::time_point origin = Clock::now());
+
+  StartupTimeline(const StartupTimeline&) = delete;
+  StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+  /**
+   * Record that |phase| finished at |at|.
+   */
+  void Mark(const std::string& phase, Clock::time_point at = Clock::now());
+
+  /**
+   * Hold the summary until |phase| is marked or cancelled.
+   */
+  void Expect(const std::string& phase);
+
+  /**
+   * |phase| will not happen (e.g. the Node runtime failed to start).
+   */
+  void Cancel(const std::string& phase);
+
+  bool Has(const std::string& phase) const;
+
+  /**
+   * Phases marked so far, in the order they happened.
+   */
+  std::vector<Phase> GetPhases() const;
+
+  /**
+   * Whether the summary has been logged (every expected phase resolved).
+   */
+  bool IsComplete() const;
+
+  /**
+   * One line per phase: "   812.4 ms  (+301.0 ms)  cef_initialized".
+   */
+  std::string Summary() const;
+
+ private:
+  void MaybeComplete(std::unique_lock<std::mutex>& lock);
+
+  const Clock::time_point origin_;
+  std::vector<std::pair<std::string, Clock::time_point>> marks_;
+  std::set<std::string> expected_;
+  bool complete_ = false;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace utils
+}  // namespace athena
+
+#endif  // ATHENA_UTILS_STARTUP_TIMELINE_H_
@@ -0,0 +1,352 @@
+#include "utils/trace.h"
+
+#include "utils/log_format.h"
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace athena {
+namespace utils {
+
+namespace {
+
+std::atomic<uint64_t> next_tracer_id{1};
+std::atomic<uint64_t> next_thread_id{1};
+std::atomic<uint64_t> next_request_id{1};
+
+thread_local uint64_t current_request_id = 0;
+
+// Set once this thread's buffer table is destroyed at thread exit; a
+// trivially destructible flag stays readable after that
+thread_local bool thread_buffers_destroyed = false;
+
+void AppendEvent(std::string& out, const TraceEvent& event) {
+  out.append("{\"name\":\"");
+  AppendJsonEscaped(out, event.name);
+  out.append("\",\"cat\":\"");
+  AppendJsonEscaped(out, event.category);
+  out.append("\",\"ph\":\"X\",\"ts\":");
+  log_internal::AppendArg(out, event.start_us);
+  out.append(",\"dur\":");
+  log_internal::AppendArg(out, event.duration_us);
+  out.append(",\"pid\":");
+  log_internal::AppendArg(out, event.pid);
+  out.append(",\"tid\":");
+  log_internal::AppendArg(out, event.tid);
+  out.append(",\"args\":{");
+  if (event.request_id != 0) {
+    out.append("\"request_id\":");
+    log_internal::AppendArg(out, event.request_id);
+    if (!event.args.empty()) {
+      out.push_back(',');
+    }
+  }
+  out.append(event.args);
+  out.append("}}");
+}
+
+void AppendProcessName(std::string& out, int pid, std::string_view name) {
+  out.append("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":");
+  log_internal::AppendArg(out, pid);
+  out.append(",\"tid\":0,\"args\":{\"name\":\"");
+  AppendJsonEscaped(out, name);
+  out.append("\"}}");
+}
+
+}  // namespace
+
+// ============================================================================
+// ThreadBuffer
+// ============================================================================
+
+/**
+ * Events of one thread. The owning thread appends; exports and Clear() read
+ * from other threads, so the (uncontended) mutex is nearly free.
+ */
+class Tracer::ThreadBuffer {
+ public:
+  void Push(TraceEvent event, size_t limit) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (events_.size() >= limit) {
+      ++dropped_;
+      return;
+    }
+    events_.push_back(std::move(event));
+  }
+
+  void AppendTo(std::vector<TraceEvent>& out) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out.insert(out.end(), events_.begin(), events_.end());
+  }
+
+  size_t Size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+  }
+
+  uint64_t Dropped() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    events_.shrink_to_fit();
+    dropped_ = 0;
+  }
+
+  // The tracer is gone; the owning thread must not use this buffer again
+  void Orphan() { orphaned_.store(true, std::memory_order_relaxed); }
+  bool IsOrphaned() const { return orphaned_.load(std::memory_order_relaxed); }
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<TraceEvent> events_;
+  uint64_t dropped_ = 0;
+  std::atomic<bool> orphaned_{false};
+};
+
+// ============================================================================
+// Tracer
+// ============================================================================
+
+Tracer& Tracer::Instance() {
+  static Tracer* tracer = new Tracer();
+  return *tracer;
+}
+
+Tracer::Tracer() : id_(next_tracer_id.fetch_add(1)) {}
+
+Tracer::~Tracer() {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const auto& buffer : buffers_) {
+    buffer->Orphan();
+  }
+}
+
+void Tracer::Start(size_t max_events_per_thread) {
+  Clear();
+  max_events_per_thread_ = std::clamp<size_t>(max_events_per_thread, 1, kMaxEventsPerThread);
+  enabled_ = true;
+}
+
+void Tracer::Stop() {
+  enabled_ = false;
+}
+
+void Tracer::Record(TraceEvent event) {
+  if (!IsEnabled()) {
+    return;
+  }
+  ThreadBuffer* buffer = BufferForThread();
+  if (buffer) {
+    buffer->Push(std::move(event), max_events_per_thread_.load(std::memory_order_relaxed));
+  }
+}
+
+void Tracer::Record(const char* category,
+                    const char* name,
+                    int64_t start_us,
+                    int64_t duration_us,
+                    std::string args) {
+  TraceEvent event;
+  event.category = category;
+  event.name = name;
+  event.start_us = start_us;
+  event.duration_us = duration_us;
+  event.request_id = current_request_id;
+  event.pid = ProcessId();
+  event.tid = ThreadId();
+  event.args = std::move(args);
+  Record(std::move(event));
+}
+
+void Tracer::Clear() {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  for (const auto& buffer : buffers_) {
+    buffer->Clear();
+  }
+  // Buffers only the tracer still holds belong to threads that have exited
+  buffers_.erase(std::remove_if(buffers_.begin(),
+                                buffers_.end(),
+                                [](const auto& buffer) { return buffer.use_count() == 1; }),
+                 buffers_.end());
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() const {
+  std::vector<TraceEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (const auto& buffer : buffers_) {
+      buffer->AppendTo(events);
+    }
+  }
+  std::stable_sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+    return a.start_us < b.start_us;
+  });
+  return events;
+}
+
+size_t Tracer::EventCount() const {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  size_t count = 0;
+  for (const auto& buffer : buffers_) {
+    count += buffer->Size();
+  }
+  return count;
+}
+
+uint64_t Tracer::DroppedCount() const {
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  uint64_t dropped = 0;
+  for (const auto& buffer : buffers_) {
+    dropped += buffer->Dropped();
+  }
+  return dropped;
+}
+
+std::string Tracer::ExportChromeTrace() const {
+  const std::vector<TraceEvent> events = GetEvents();
+  const int own_pid = ProcessId();
+
+  std::vector<int> other_pids;
+  for (const TraceEvent& event : events) {
+    if (event.pid != own_pid &&
+        std::find(other_pids.begin(), other_pids.end(), event.pid) == other_pids.end()) {
+      other_pids.push_back(event.pid);
+    }
+  }
+
+  std::string out;
+  out.reserve(128 * (events.size() + 1));
+  out.append("{\"traceEvents\":[");
+  AppendProcessName(out, own_pid, "Browser");
+  for (int pid : other_pids) {
+    out.push_back(',');
+    AppendProcessName(out, pid, "Renderer");
+  }
+  for (const TraceEvent& event : events) {
+    out.push_back(',');
+    AppendEvent(out, event);
+  }
+  out.append("],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":");
+  log_internal::AppendArg(out, DroppedCount());
+  out.append("}}");
+  return out;
+}
+
+int64_t Tracer::NowMicros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+uint64_t Tracer::NextRequestId() {
+  return next_request_id.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t Tracer::CurrentRequestId() {
+  return current_request_id;
+}
+
+int Tracer::ProcessId() {
+#if defined(_WIN32)
+  static const int pid = _getpid();
+#else
+  static const int pid = static_cast<int>(getpid());
+#endif
+  return pid;
+}
+
+uint64_t Tracer::ThreadId() {
+  thread_local const uint64_t id = next_thread_id.fetch_add(1, std::memory_order_relaxed);
+  return id;
+}
+
+Tracer::ThreadBuffer* Tracer::BufferForThread() {
+  struct ThreadBuffers {
+    std::vector<std::pair<uint64_t, std::shared_ptr<ThreadBuffer>>> buffers;
+    ~ThreadBuffers() { thread_buffers_destroyed = true; }
+  };
+
+  if (thread_buffers_destroyed) {
+    return nullptr;  // Thread is exiting
+  }
+  static thread_local ThreadBuffers thread_buffers;
+  auto& buffers = thread_buffers.buffers;
+  for (const auto& [tracer, buffer] : buffers) {
+    if (tracer == id_) {
+      return buffer.get();
+    }
+  }
+
+  buffers.erase(std::remove_if(buffers.begin(),
+                               buffers.end(),
+                               [](const auto& entry) { return entry.second->IsOrphaned(); }),
+                buffers.end());
+  auto buffer = std::make_shared<ThreadBuffer>();
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    buffers_.push_back(buffer);
+  }
+  buffers.emplace_back(id_, buffer);
+  return buffer.get();
+}
+
+// ============================================================================
+// ScopedTraceRequest
+// ============================================================================
+
+ScopedTraceRequest::ScopedTraceRequest(uint64_t request_id) : previous_(current_request_id) {
+  current_request_id = request_id;
+}
+
+ScopedTraceRequest::~ScopedTraceRequest() {
+  current_request_id = previous_;
+}
+
+// ============================================================================
+// TraceSpan
+// ============================================================================
+
+void TraceSpan::AddArg(std::string_view key, std::string_view value) {
+  if (!tracer_) {
+    return;
+  }
+  if (!args_.empty()) {
+    args_.push_back(',');
+  }
+  args_.push_back('"');
+  AppendJsonEscaped(args_, key);
+  args_.append("\":\"");
+  AppendJsonEscaped(args_, value);
+  args_.push_back('"');
+}
+
+void TraceSpan::AddArg(std::string_view key, int64_t value) {
+  if (!tracer_) {
+    return;
+  }
+  if (!args_.empty()) {
+    args_.push_back(',');
+  }
+  args_.push_back('"');
+  AppendJsonEscaped(args_, key);
+  args_.append("\":");
+  log_internal::AppendArg(args_, value);
+}
+
+void TraceSpan::End() {
+  tracer_->Record(category_, name_, start_us_, Tracer::NowMicros() - start_us_, std::move(args_));
+}
+
+}  // namespace utils
+}  // namespace athena
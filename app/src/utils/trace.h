@@ -0,0 +1,207 @@
+#ifndef ATHENA_UTILS_TRACE_H_
+#define ATHENA_UTILS_TRACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace athena {
+namespace utils {
+
+/**
+ * One completed span ("X" event in the Chrome trace format).
+ */
+struct TraceEvent {
+  const char* category = "";  // Static strings: spans never copy them
+  const char* name = "";
+  int64_t start_us = 0;  // Tracer::NowMicros() clock
+  int64_t duration_us = 0;
+  uint64_t request_id = 0;  // Control request the span belongs to; 0 if none
+  int pid = 0;
+  uint64_t tid = 0;
+  std::string args;  // Extra JSON object members ("\"path\":\"/x\""); may be empty
+};
+
+/**
+ * Collects spans for a Chrome trace (chrome://tracing, Perfetto UI).
+ *
+ * Off by default. While off a span costs one relaxed atomic load; while on,
+ * each thread appends to its own bounded buffer, so threads never contend
+ * with each other (only with an export). Spans past a thread's limit are
+ * dropped and counted.
+ *
+ * Control requests are tagged with a request id (ScopedTraceRequest) that
+ * every span on the thread records, and that travels with IPC messages so
+ * spans recorded in a renderer process can be added here with Record().
+ * Timestamps come from the monotonic clock, which is shared by processes on
+ * the same machine.
+ *
+ * Thread-safe.
+ */
+class Tracer {
+ public:
+  static constexpr size_t kDefaultMaxEventsPerThread = 64 * 1024;
+  static constexpr size_t kMaxEventsPerThread = 1024 * 1024;  // Cap on requested limits
+
+  /**
+   * The process-wide tracer. Never destroyed, so spans in static destructors
+   * are safe.
+   */
+  static Tracer& Instance();
+
+  Tracer();
+  ~Tracer();
+
+  Tracer(const Tracer&) = delete;
+  Tracer& operator=(const Tracer&) = delete;
+
+  /**
+   * Discard earlier events and start recording.
+   * @param max_events_per_thread Clamped to [1, kMaxEventsPerThread]
+   */
+  void Start(size_t max_events_per_thread = kDefaultMaxEventsPerThread);
+
+  /**
+   * Stop recording; recorded events are kept for export.
+   */
+  void Stop();
+
+  bool IsEnabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+  // Limit applied by the last Start()
+  size_t GetMaxEventsPerThread() const {
+    return max_events_per_thread_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Add a span. Ignored unless tracing is on.
+   */
+  void Record(TraceEvent event);
+
+  /**
+   * Add a span that ran on this thread, tagged with the current request id.
+   */
+  void Record(const char* category,
+              const char* name,
+              int64_t start_us,
+              int64_t duration_us,
+              std::string args = std::string());
+
+  /**
+   * Discard every recorded event and the drop count.
+   */
+  void Clear();
+
+  /**
+   * Recorded events of all threads, ordered by start time.
+   */
+  std::vector<TraceEvent> GetEvents() const;
+
+  size_t EventCount() const;
+  uint64_t DroppedCount() const;
+
+  /**
+   * Recorded events as a Chrome trace JSON object ({"traceEvents":[...]}).
+   * Events of other processes are labelled as renderers.
+   */
+  std::string ExportChromeTrace() const;
+
+  // Microseconds on the monotonic clock
+  static int64_t NowMicros();
+
+  // New id for a control request (never 0)
+  static uint64_t NextRequestId();
+
+  // Request id set by the innermost ScopedTraceRequest on this thread, or 0
+  static uint64_t CurrentRequestId();
+
+  static int ProcessId();
+
+  // Small per-thread number, stable for the thread's lifetime
+  static uint64_t ThreadId();
+
+ private:
+  class ThreadBuffer;
+
+  ThreadBuffer* BufferForThread();
+
+  std::atomic<bool> enabled_{false};
+  std::atomic<size_t> max_events_per_thread_{kDefaultMaxEventsPerThread};
+  const uint64_t id_;  // Distinguishes tracers in the thread-local buffer lookup
+
+  // Buffers of every thread that has recorded since the last Clear()
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+  mutable std::mutex buffers_mutex_;
+};
+
+/**
+ * Tags the spans of this thread with |request_id| until destroyed.
+ */
+class ScopedTraceRequest {
+ public:
+  explicit ScopedTraceRequest(uint64_t request_id);
+  ~ScopedTraceRequest();
+
+  ScopedTraceRequest(const ScopedTraceRequest&) = delete;
+  ScopedTraceRequest& operator=(const ScopedTraceRequest&) = delete;
+
+ private:
+  uint64_t previous_;
+};
+
+/**
+ * Records the time from construction to destruction as one span.
+ * Does nothing (including AddArg) if tracing was off when it was created.
+ */
+class TraceSpan {
+ public:
+  TraceSpan(const char* category, const char* name, Tracer& tracer = Tracer::Instance())
+      : tracer_(tracer.IsEnabled() ? &tracer : nullptr), category_(category), name_(name) {
+    if (tracer_) {
+      start_us_ = Tracer::NowMicros();
+    }
+  }
+
+  ~TraceSpan() {
+    if (tracer_) {
+      End();
+    }
+  }
+
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan& operator=(const TraceSpan&) = delete;
+
+  bool IsRecording() const { return tracer_ != nullptr; }
+
+  void AddArg(std::string_view key, std::string_view value);
+  void AddArg(std::string_view key, int64_t value);
+
+ private:
+  void End();
+
+  Tracer* tracer_;  // Null when not recording
+  const char* category_;
+  const char* name_;
+  int64_t start_us_ = 0;
+  std::string args_;
+};
+
+}  // namespace utils
+}  // namespace athena
+
+#define ATHENA_TRACE_CONCAT_INNER(a, b) a##b
+#define ATHENA_TRACE_CONCAT(a, b) ATHENA_TRACE_CONCAT_INNER(a, b)
+
+/**
+ * Trace the rest of the enclosing scope: ATHENA_TRACE_SCOPE("control", "Route");
+ * Both arguments must be string literals (or otherwise outlive the trace).
+ */
+#define ATHENA_TRACE_SCOPE(category, name) \
+  ::athena::utils::TraceSpan ATHENA_TRACE_CONCAT(athena_trace_span_, __LINE__)(category, name)
+
+#endif  // ATHENA_UTILS_TRACE_H_
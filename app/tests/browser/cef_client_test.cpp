@@ -3,6 +3,7 @@
 #include "rendering/gl_renderer.h"
 
 #include <gtest/gtest.h>
+#include <memory>
 
 /**
  * CefClient Unit Tests
@@ -16,6 +17,7 @@
  * - Device scale factor management
  * - GetViewRect behavior
  * - GetScreenInfo behavior
+ * - Resource filter storage
  */
 class CefClientTest : public ::testing::Test {
  protected:
@@ -226,6 +228,29 @@ TEST_F(CefClientTest, SetSizeAndScaleFactorTogether) {
   EXPECT_FLOAT_EQ(athena_client.GetDeviceScaleFactor(), 2.0f);
 }
 
+// ============================================================================
+// Resource Filter Tests
+// ============================================================================
+
+TEST_F(CefClientTest, ResourceFilterDefaultsToNone) {
+  athena::browser::CefClient athena_client(window_handle_, nullptr);
+
+  EXPECT_EQ(athena_client.GetResourceFilter(), nullptr);
+}
+
+TEST_F(CefClientTest, SetResourceFilterReplacesAndClears) {
+  athena::browser::CefClient athena_client(window_handle_, nullptr);
+  athena::browser::ResourceFilter::Rules rules;
+  rules.blocked_types = {athena::browser::ResourceFilter::ResourceType::kImage};
+  auto filter = std::make_shared<const athena::browser::ResourceFilter>(rules);
+
+  athena_client.SetResourceFilter(filter);
+  EXPECT_EQ(athena_client.GetResourceFilter(), filter);
+
+  athena_client.SetResourceFilter(nullptr);
+  EXPECT_EQ(athena_client.GetResourceFilter(), nullptr);
+}
+
 // ============================================================================
 // Focus State Tests (CEF #3870 workaround)
 // ============================================================================
@@ -105,16 +105,17 @@ TEST_F(CefEngineTest, CreateBrowserFailsWhenNotInitialized) {
   EXPECT_NE(result.GetError().Message().find("not initialized"), std::string::npos);
 }
 
-TEST_F(CefEngineTest, CreateBrowserRequiresGLRenderer) {
-  // Even though not initialized, should check for null renderer
+TEST_F(CefEngineTest, CreateBrowserWithoutRendererRequiresInitialization) {
+  // Renderers are optional (spare browsers get one on adoption), but the
+  // engine must still be initialized
   BrowserConfig config;
-  config.url = "https://www.google.com";
-  config.gl_renderer = nullptr;  // Missing!
+  config.url = "about:blank";
+  config.gl_renderer = nullptr;
+  config.hidden = true;
 
   auto result = engine_->CreateBrowser(config);
 
   EXPECT_TRUE(result.IsError());
-  // Error could be "not initialized" or "gl_renderer required"
   EXPECT_FALSE(result.GetError().Message().empty());
 }
 
@@ -0,0 +1,224 @@
+#include "browser/frame_rate_governor.h"
+
+#include <gtest/gtest.h>
+
+using namespace athena::browser;
+using namespace std::chrono_literals;
+
+class FrameRateGovernorTest : public ::testing::Test {
+ protected:
+  using Tier = FrameRateGovernor::Tier;
+
+  // Add a browser and let its startup boost expire
+  void AddSettledBrowser(BrowserId id, int max_fps = 60) {
+    governor_.AddBrowser(id, max_fps, now_);
+    Advance(governor_.GetPolicy().startup_hold);
+    governor_.Update(now_);
+  }
+
+  void Advance(std::chrono::milliseconds delta) { now_ += delta; }
+
+  // Simulate paints at |fps| for |duration|, sampling every 250ms
+  void PaintFor(BrowserId id, int fps, std::chrono::milliseconds duration) {
+    for (auto elapsed = 0ms; elapsed < duration; elapsed += 250ms) {
+      Advance(250ms);
+      paint_count_ += static_cast<uint64_t>(fps) / 4;
+      governor_.ObservePaintCount(id, paint_count_, now_);
+    }
+  }
+
+  FrameRateGovernor governor_;
+  FrameRateGovernor::Clock::time_point now_ = FrameRateGovernor::Clock::now();
+  uint64_t paint_count_ = 0;
+};
+
+// ============================================================================
+// Tier Selection Tests
+// ============================================================================
+
+TEST_F(FrameRateGovernorTest, NewBrowserStartsActive) {
+  governor_.AddBrowser(1, 60, now_);
+
+  EXPECT_EQ(governor_.GetFrameRate(1), 60);
+  EXPECT_EQ(governor_.GetMetrics().browsers[0].reason, "startup");
+}
+
+TEST_F(FrameRateGovernorTest, QuietVisibleBrowserDropsToIdle) {
+  governor_.AddBrowser(1, 60, now_);
+  Advance(governor_.GetPolicy().startup_hold);
+
+  auto changes = governor_.Update(now_);
+
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].id, 1u);
+  EXPECT_EQ(changes[0].fps, 10);
+  EXPECT_EQ(changes[0].tier, Tier::kIdle);
+}
+
+TEST_F(FrameRateGovernorTest, HiddenBrowserDropsToBackground) {
+  AddSettledBrowser(1);
+
+  auto change = governor_.SetVisible(1, false, now_);
+
+  ASSERT_TRUE(change.has_value());
+  EXPECT_EQ(change->fps, 1);
+  EXPECT_EQ(change->tier, Tier::kBackground);
+  EXPECT_EQ(change->reason, "hidden");
+}
+
+TEST_F(FrameRateGovernorTest, InputBoostsImmediatelyThenDecays) {
+  AddSettledBrowser(1);
+
+  auto change = governor_.NotifyInput(1, now_);
+  ASSERT_TRUE(change.has_value());
+  EXPECT_EQ(change->fps, 60);
+  EXPECT_EQ(change->reason, "input");
+
+  Advance(governor_.GetPolicy().input_hold - 1ms);
+  EXPECT_TRUE(governor_.Update(now_).empty());
+
+  Advance(1ms);
+  auto changes = governor_.Update(now_);
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].fps, 10);
+}
+
+TEST_F(FrameRateGovernorTest, RepeatedInputDoesNotReportChanges) {
+  AddSettledBrowser(1);
+
+  EXPECT_TRUE(governor_.NotifyInput(1, now_).has_value());
+  EXPECT_FALSE(governor_.NotifyInput(1, now_ + 10ms).has_value());
+}
+
+TEST_F(FrameRateGovernorTest, SustainedPaintingCountsAsAnimation) {
+  AddSettledBrowser(1);
+
+  // Animation painting at the idle rate is enough to be detected
+  PaintFor(1, 10, 1000ms);
+  auto changes = governor_.Update(now_);
+
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].fps, 60);
+  EXPECT_EQ(changes[0].reason, "animating");
+}
+
+TEST_F(FrameRateGovernorTest, CaretBlinkIsNotAnimation) {
+  AddSettledBrowser(1);
+
+  PaintFor(1, 2, 2000ms);
+
+  EXPECT_TRUE(governor_.Update(now_).empty());
+  EXPECT_EQ(governor_.GetFrameRate(1), 10);
+}
+
+TEST_F(FrameRateGovernorTest, AnimationStopsThenIdles) {
+  AddSettledBrowser(1);
+  PaintFor(1, 60, 1000ms);
+  governor_.Update(now_);
+  ASSERT_EQ(governor_.GetFrameRate(1), 60);
+
+  PaintFor(1, 0, 1500ms);
+
+  auto changes = governor_.Update(now_);
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].fps, 10);
+}
+
+TEST_F(FrameRateGovernorTest, HiddenBrowserIgnoresAnimation) {
+  AddSettledBrowser(1);
+  governor_.SetVisible(1, false, now_);
+
+  PaintFor(1, 60, 1000ms);
+
+  EXPECT_TRUE(governor_.Update(now_).empty());
+  EXPECT_EQ(governor_.GetFrameRate(1), 1);
+}
+
+TEST_F(FrameRateGovernorTest, AgentDemandOverridesHidden) {
+  AddSettledBrowser(1);
+  governor_.SetVisible(1, false, now_);
+
+  auto change = governor_.NotifyDemand(1, now_);
+  ASSERT_TRUE(change.has_value());
+  EXPECT_EQ(change->fps, 60);
+  EXPECT_EQ(change->reason, "agent");
+
+  Advance(governor_.GetPolicy().demand_hold);
+  auto changes = governor_.Update(now_);
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].fps, 1);
+}
+
+TEST_F(FrameRateGovernorTest, RatesAreCappedByBrowserMaximum) {
+  governor_.AddBrowser(1, 30, now_);
+  EXPECT_EQ(governor_.GetFrameRate(1), 30);
+
+  governor_.AddBrowser(2, 5, now_);
+  Advance(governor_.GetPolicy().startup_hold);
+  governor_.Update(now_);
+  EXPECT_EQ(governor_.GetFrameRate(2), 5);  // Idle rate above the cap
+}
+
+TEST_F(FrameRateGovernorTest, CustomPolicy) {
+  FrameRateGovernor::Policy policy;
+  policy.active_fps = 30;
+  policy.idle_fps = 5;
+  policy.background_fps = 2;
+  FrameRateGovernor governor(policy);
+
+  governor.AddBrowser(1, 60, now_);
+  EXPECT_EQ(governor.GetFrameRate(1), 30);
+
+  governor.SetVisible(1, false, now_);
+  EXPECT_EQ(governor.GetFrameRate(1), 2);
+}
+
+// ============================================================================
+// Bookkeeping Tests
+// ============================================================================
+
+TEST_F(FrameRateGovernorTest, UnknownBrowserIsIgnored) {
+  EXPECT_FALSE(governor_.NotifyInput(42, now_).has_value());
+  EXPECT_FALSE(governor_.SetVisible(42, false, now_).has_value());
+  governor_.ObservePaintCount(42, 100, now_);
+
+  EXPECT_EQ(governor_.GetFrameRate(42), 0);
+  EXPECT_TRUE(governor_.Update(now_).empty());
+}
+
+TEST_F(FrameRateGovernorTest, RemovedBrowserIsForgotten) {
+  governor_.AddBrowser(1, 60, now_);
+  governor_.RemoveBrowser(1);
+
+  EXPECT_FALSE(governor_.HasBrowser(1));
+  EXPECT_TRUE(governor_.GetMetrics().browsers.empty());
+}
+
+TEST_F(FrameRateGovernorTest, MetricsSummarizeTiers) {
+  AddSettledBrowser(1);
+  AddSettledBrowser(2);
+  AddSettledBrowser(3);
+  governor_.NotifyInput(1, now_);
+  governor_.SetVisible(3, false, now_);
+
+  auto metrics = governor_.GetMetrics();
+
+  EXPECT_EQ(metrics.active, 1u);
+  EXPECT_EQ(metrics.idle, 1u);
+  EXPECT_EQ(metrics.background, 1u);
+  EXPECT_EQ(metrics.total_fps, 60 + 10 + 1);
+  ASSERT_EQ(metrics.browsers.size(), 3u);
+  EXPECT_FALSE(metrics.browsers[2].visible);
+  EXPECT_STREQ(FrameRateGovernor::TierName(metrics.browsers[2].tier), "background");
+}
+
+TEST_F(FrameRateGovernorTest, MetricsCountRateChanges) {
+  AddSettledBrowser(1);  // 60 -> 10
+  governor_.NotifyInput(1, now_);  // 10 -> 60
+  governor_.NotifyInput(1, now_);  // No change
+
+  auto metrics = governor_.GetMetrics();
+
+  EXPECT_EQ(metrics.rate_changes, 2u);
+  EXPECT_EQ(metrics.browsers[0].rate_changes, 2u);
+}
@@ -0,0 +1,156 @@
+#include "browser/load_tracker.h"
+
+#include <gtest/gtest.h>
+
+using namespace athena::browser;
+using std::chrono::milliseconds;
+
+class LoadTrackerTest : public ::testing::Test {
+ protected:
+  using Clock = LoadTracker::Clock;
+  using WaitUntil = LoadTracker::WaitUntil;
+
+  static LoadTracker::WaitCondition Condition(const char* text) {
+    auto condition = LoadTracker::ParseWaitCondition(text);
+    EXPECT_TRUE(condition.has_value()) << text;
+    return condition.value_or(LoadTracker::WaitCondition{});
+  }
+
+  Clock::time_point At(int ms) const { return start_ + milliseconds(ms); }
+
+  Clock::time_point start_ = Clock::now();
+  LoadTracker tracker_;
+};
+
+// ============================================================================
+// Parsing Tests
+// ============================================================================
+
+TEST_F(LoadTrackerTest, ParsesNamedConditions) {
+  EXPECT_EQ(Condition("load").until, WaitUntil::kLoad);
+  EXPECT_EQ(Condition(" domcontentloaded ").until, WaitUntil::kDomContentLoaded);
+
+  auto idle0 = Condition("networkidle");
+  EXPECT_EQ(idle0.until, WaitUntil::kNetworkIdle);
+  EXPECT_EQ(idle0.max_inflight, 0u);
+  EXPECT_EQ(idle0.idle_time, milliseconds(500));
+
+  EXPECT_EQ(Condition("networkidle0").max_inflight, 0u);
+  EXPECT_EQ(Condition("networkidle2").max_inflight, 2u);
+}
+
+TEST_F(LoadTrackerTest, ParsesParameterizedNetworkIdle) {
+  auto condition = Condition("networkidle(3, 250)");
+  EXPECT_EQ(condition.until, WaitUntil::kNetworkIdle);
+  EXPECT_EQ(condition.max_inflight, 3u);
+  EXPECT_EQ(condition.idle_time, milliseconds(250));
+  EXPECT_EQ(LoadTracker::DescribeWaitCondition(condition), "networkidle(3, 250)");
+}
+
+TEST_F(LoadTrackerTest, RejectsMalformedConditions) {
+  for (const char* text : {"", "loaded", "networkidle1", "networkidle(2)", "networkidle(-1, 5)",
+                           "networkidle(99, 500)", "networkidle(2, 5x)", "networkidle 2"}) {
+    EXPECT_FALSE(LoadTracker::ParseWaitCondition(text).has_value()) << text;
+  }
+}
+
+// ============================================================================
+// Load Event Tests
+// ============================================================================
+
+TEST_F(LoadTrackerTest, TracksDocumentLifecycle) {
+  tracker_.OnMainFrameLoadStart(At(0));
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("domcontentloaded"), At(1)));
+
+  tracker_.OnDomContentLoaded();
+  EXPECT_TRUE(tracker_.IsSatisfied(Condition("domcontentloaded"), At(2)));
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("load"), At(2)));
+
+  tracker_.OnMainFrameLoadEnd();
+  EXPECT_TRUE(tracker_.IsSatisfied(Condition("load"), At(3)));
+  EXPECT_EQ(tracker_.GetSnapshot().navigations, 1u);
+}
+
+TEST_F(LoadTrackerTest, LoadEndImpliesDomContentLoaded) {
+  // Error pages and non-HTML documents never report DOMContentLoaded
+  tracker_.OnMainFrameLoadStart(At(0));
+  tracker_.OnMainFrameLoadEnd();
+  EXPECT_TRUE(tracker_.IsSatisfied(Condition("domcontentloaded"), At(1)));
+}
+
+TEST_F(LoadTrackerTest, EventsOfReplacedDocumentAreIgnored) {
+  tracker_.OnMainFrameLoadStart(At(0));
+  tracker_.OnMainFrameLoadEnd();
+
+  tracker_.OnNavigationRequested(At(10));
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("load"), At(11)));
+
+  // Late events from the old page arrive before the new one commits
+  tracker_.OnDomContentLoaded();
+  tracker_.OnMainFrameLoadEnd();
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("domcontentloaded"), At(12)));
+
+  tracker_.OnMainFrameLoadStart(At(20));
+  tracker_.OnDomContentLoaded();
+  EXPECT_TRUE(tracker_.IsSatisfied(Condition("domcontentloaded"), At(21)));
+}
+
+// ============================================================================
+// Network Idle Tests
+// ============================================================================
+
+TEST_F(LoadTrackerTest, NetworkIdleWaitsForQuietPeriod) {
+  auto idle = Condition("networkidle(0, 500)");
+  tracker_.OnMainFrameLoadStart(At(0));
+  tracker_.OnDomContentLoaded();
+
+  tracker_.OnRequestStarted(1, At(100));
+  EXPECT_FALSE(tracker_.IsSatisfied(idle, At(700)));
+
+  tracker_.OnRequestFinished(1, At(800));
+  EXPECT_FALSE(tracker_.IsSatisfied(idle, At(1200)));
+  EXPECT_TRUE(tracker_.IsSatisfied(idle, At(1300)));
+}
+
+TEST_F(LoadTrackerTest, NetworkIdleRequiresDomContentLoaded) {
+  tracker_.OnMainFrameLoadStart(At(0));
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("networkidle"), At(5000)));
+}
+
+TEST_F(LoadTrackerTest, NetworkIdleToleratesLongLivedRequests) {
+  // A polling connection never finishes; networkidle2 ignores up to two
+  auto idle2 = Condition("networkidle2");
+  tracker_.OnMainFrameLoadStart(At(0));
+  tracker_.OnDomContentLoaded();
+  tracker_.OnRequestStarted(1, At(10));
+  tracker_.OnRequestStarted(2, At(20));
+  tracker_.OnRequestStarted(3, At(30));
+  tracker_.OnRequestFinished(3, At(100));
+
+  EXPECT_FALSE(tracker_.IsSatisfied(idle2, At(599)));
+  EXPECT_TRUE(tracker_.IsSatisfied(idle2, At(600)));
+  EXPECT_FALSE(tracker_.IsSatisfied(Condition("networkidle0"), At(5000)));
+}
+
+TEST_F(LoadTrackerTest, NetworkIdleWaitsForSubframes) {
+  auto idle = Condition("networkidle(0, 0)");
+  tracker_.OnMainFrameLoadStart(At(0));
+  tracker_.OnDomContentLoaded();
+  tracker_.OnFrameLoadStart("frame-1");
+  EXPECT_FALSE(tracker_.IsSatisfied(idle, At(10)));
+  EXPECT_EQ(tracker_.GetSnapshot().frames_loading, 1u);
+
+  tracker_.OnFrameLoadEnd("frame-1");
+  EXPECT_TRUE(tracker_.IsSatisfied(idle, At(20)));
+}
+
+TEST_F(LoadTrackerTest, UnknownRequestsDoNotChangeCount) {
+  tracker_.OnRequestFinished(42, At(0));
+  tracker_.OnRequestStarted(1, At(1));
+  tracker_.OnRequestStarted(1, At(2));
+  EXPECT_EQ(tracker_.GetSnapshot().requests_in_flight, 1u);
+
+  tracker_.OnRequestFinished(1, At(3));
+  tracker_.OnRequestFinished(1, At(4));
+  EXPECT_EQ(tracker_.GetSnapshot().requests_in_flight, 0u);
+}
@@ -0,0 +1,136 @@
+#include "browser/resource_filter.h"
+
+#include <gtest/gtest.h>
+
+using namespace athena::browser;
+using Type = ResourceFilter::ResourceType;
+
+// ============================================================================
+// Type Name Tests
+// ============================================================================
+
+TEST(ResourceFilterTest, TypeNamesRoundTrip) {
+  for (size_t i = 0; i < ResourceFilter::kResourceTypeCount; ++i) {
+    auto type = static_cast<Type>(i);
+    EXPECT_EQ(ResourceFilter::ParseResourceType(ResourceFilter::ResourceTypeName(type)), type);
+  }
+  EXPECT_FALSE(ResourceFilter::ParseResourceType("IMAGE").has_value());
+  EXPECT_FALSE(ResourceFilter::ParseResourceType("").has_value());
+}
+
+// ============================================================================
+// Type Rule Tests
+// ============================================================================
+
+TEST(ResourceFilterTest, EmptyRulesBlockNothing) {
+  ResourceFilter filter(ResourceFilter::Rules{});
+  EXPECT_TRUE(filter.IsEmpty());
+  EXPECT_FALSE(filter.ShouldBlock("https://example.com/a.png", Type::kImage));
+  EXPECT_EQ(filter.GetBlockedCount(), 0u);
+}
+
+TEST(ResourceFilterTest, BlocksListedTypes) {
+  ResourceFilter::Rules rules;
+  rules.blocked_types = {Type::kImage, Type::kFont};
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.ShouldBlock("https://example.com/a.png", Type::kImage));
+  EXPECT_TRUE(filter.ShouldBlock("https://example.com/a.woff2", Type::kFont));
+  EXPECT_FALSE(filter.ShouldBlock("https://example.com/app.js", Type::kScript));
+  EXPECT_EQ(filter.GetBlockedCount(), 2u);
+}
+
+TEST(ResourceFilterTest, NeverBlocksTopLevelDocuments) {
+  ResourceFilter::Rules rules;
+  rules.blocked_types = {Type::kDocument};
+  rules.blocked_domains = {"example.com"};
+  rules.blocked_patterns = {"example"};
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.GetRules().blocked_types.empty());
+  EXPECT_FALSE(filter.ShouldBlock("https://example.com/", Type::kDocument));
+  EXPECT_TRUE(filter.ShouldBlock("https://example.com/", Type::kSubFrame));
+}
+
+// ============================================================================
+// Domain Rule Tests
+// ============================================================================
+
+TEST(ResourceFilterTest, DomainRuleBlocksSubdomains) {
+  ResourceFilter::Rules rules;
+  rules.blocked_domains = {"doubleclick.net"};
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.ShouldBlock("https://doubleclick.net/ad.js", Type::kScript));
+  EXPECT_TRUE(filter.ShouldBlock("https://stats.g.doubleclick.net/x", Type::kXhr));
+  EXPECT_FALSE(filter.ShouldBlock("https://notdoubleclick.net/x", Type::kXhr));
+  EXPECT_FALSE(filter.ShouldBlock("https://example.com/doubleclick.net", Type::kXhr));
+}
+
+TEST(ResourceFilterTest, DomainRulesAreNormalized) {
+  ResourceFilter::Rules rules;
+  rules.blocked_domains = {".Tracker.Example", ""};
+  ResourceFilter filter(rules);
+
+  ASSERT_EQ(filter.GetRules().blocked_domains.size(), 1u);
+  EXPECT_EQ(filter.GetRules().blocked_domains[0], "tracker.example");
+  EXPECT_TRUE(filter.ShouldBlock("https://CDN.tracker.example/p.gif", Type::kImage));
+}
+
+TEST(ResourceFilterTest, HostParsingIgnoresUserinfoAndPort) {
+  ResourceFilter::Rules rules;
+  rules.blocked_domains = {"ads.example"};
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.ShouldBlock("https://user:pw@ads.example:8443/x?y#z", Type::kScript));
+  EXPECT_TRUE(filter.ShouldBlock("wss://ads.example", Type::kOther));
+  EXPECT_FALSE(filter.ShouldBlock("https://safe.example/?r=https://ads.example/", Type::kOther));
+  EXPECT_FALSE(filter.ShouldBlock("data:text/plain,ads.example", Type::kOther));
+  EXPECT_FALSE(filter.ShouldBlock("http://[::1]:8080/", Type::kOther));
+}
+
+// ============================================================================
+// Pattern Rule Tests
+// ============================================================================
+
+TEST(ResourceFilterTest, PatternsMatchAnywhereCaseInsensitive) {
+  ResourceFilter::Rules rules;
+  rules.blocked_patterns = {"/analytics.js", "utm_"};
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.ShouldBlock("https://cdn.example/v2/Analytics.JS", Type::kScript));
+  EXPECT_TRUE(filter.ShouldBlock("https://example.com/?utm_source=x", Type::kXhr));
+  EXPECT_FALSE(filter.ShouldBlock("https://example.com/analytics", Type::kScript));
+}
+
+TEST(ResourceFilterTest, OverlappingPatternsUseFailLinks) {
+  // "abcd" fails at 'x' after "abc"; the automaton must still find "bcx"
+  ResourceFilter::Rules rules;
+  rules.blocked_patterns = {"abcd", "bcx"};
+  ResourceFilter filter(rules);
+  EXPECT_TRUE(filter.ShouldBlock("https://h/zabcx", Type::kOther));
+  EXPECT_FALSE(filter.ShouldBlock("https://h/abcbc", Type::kOther));
+}
+
+TEST(ResourceFilterTest, PatternSuffixOfLongerPrefixMatches) {
+  // "he" is a suffix of the path through "ushe"; terminal state is inherited
+  ResourceFilter::Rules rules;
+  rules.blocked_patterns = {"ushers", "he"};
+  ResourceFilter filter(rules);
+  EXPECT_FALSE(filter.ShouldBlock("https://h/ushX", Type::kOther));
+  EXPECT_TRUE(filter.ShouldBlock("https://h/usheX", Type::kOther));
+}
+
+TEST(ResourceFilterTest, LargeBlocklistMatchesEveryEntry) {
+  ResourceFilter::Rules rules;
+  for (int i = 0; i < 5000; ++i) {
+    rules.blocked_domains.push_back("tracker" + std::to_string(i) + ".example");
+    rules.blocked_patterns.push_back("/pixel" + std::to_string(i) + ".gif");
+  }
+  ResourceFilter filter(rules);
+
+  EXPECT_TRUE(filter.ShouldBlock("https://a.tracker4999.example/", Type::kScript));
+  EXPECT_TRUE(filter.ShouldBlock("https://cdn.example/pixel1234.gif?x", Type::kImage));
+  EXPECT_FALSE(filter.ShouldBlock("https://tracker5000.example/", Type::kScript));
+  EXPECT_FALSE(filter.ShouldBlock("https://cdn.example/pixel.gif", Type::kImage));
+}
@@ -0,0 +1,189 @@
+#include "browser/spare_browser_pool.h"
+
+#include "mocks/mock_browser_engine.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace athena::browser;
+using namespace athena::utils;
+using ::testing::_;
+using ::testing::AllOf;
+using ::testing::Field;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class SpareBrowserPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ON_CALL(engine_, IsInitialized()).WillByDefault(Return(true));
+    ON_CALL(engine_, HasBrowser(_)).WillByDefault(Return(true));
+    ON_CALL(engine_, GetURL(_)).WillByDefault(Return("about:blank"));
+    ON_CALL(engine_, CreateBrowser(_)).WillByDefault([this](const BrowserConfig&) {
+      return Result<BrowserId>(next_id_++);
+    });
+  }
+
+  SpareBrowserPool::Config MakeConfig(size_t size) {
+    SpareBrowserPool::Config config;
+    config.size = size;
+    config.width = 800;
+    config.height = 600;
+    config.device_scale_factor = 2.0f;
+    return config;
+  }
+
+  NiceMock<athena::browser::testing::MockBrowserEngine> engine_;
+  BrowserId next_id_ = 1;
+};
+
+// ============================================================================
+// Refill Tests
+// ============================================================================
+
+TEST_F(SpareBrowserPoolTest, RefillCreatesHiddenBlankBrowsers) {
+  SpareBrowserPool pool(&engine_, MakeConfig(2));
+
+  EXPECT_CALL(engine_,
+              CreateBrowser(AllOf(Field(&BrowserConfig::url, "about:blank"),
+                                  Field(&BrowserConfig::hidden, true),
+                                  Field(&BrowserConfig::width, 800),
+                                  Field(&BrowserConfig::height, 600),
+                                  Field(&BrowserConfig::device_scale_factor, 2.0f),
+                                  Field(&BrowserConfig::gl_renderer, nullptr),
+                                  Field(&BrowserConfig::software_renderer, nullptr))))
+      .Times(2);
+
+  EXPECT_EQ(pool.Refill(), 2u);
+  EXPECT_EQ(pool.GetSpareCount(), 2u);
+  EXPECT_EQ(pool.GetStats().created, 2u);
+}
+
+TEST_F(SpareBrowserPoolTest, RefillStopsAtTargetSize) {
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+
+  EXPECT_EQ(pool.Refill(), 1u);
+  EXPECT_EQ(pool.Refill(), 0u);
+  EXPECT_EQ(pool.GetSpareCount(), 1u);
+}
+
+TEST_F(SpareBrowserPoolTest, RefillDoesNothingBeforeEngineIsInitialized) {
+  ON_CALL(engine_, IsInitialized()).WillByDefault(Return(false));
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+
+  EXPECT_CALL(engine_, CreateBrowser(_)).Times(0);
+  EXPECT_EQ(pool.Refill(), 0u);
+}
+
+TEST_F(SpareBrowserPoolTest, RefillGivesUpAfterRepeatedFailures) {
+  ON_CALL(engine_, CreateBrowser(_)).WillByDefault(Return(Err<BrowserId>("no CEF")));
+  SpareBrowserPool pool(&engine_, MakeConfig(5));
+
+  EXPECT_EQ(pool.Refill(), 0u);
+  EXPECT_EQ(pool.GetStats().failed, 3u);
+
+  // Further refills do not hammer a failing engine
+  EXPECT_CALL(engine_, CreateBrowser(_)).Times(0);
+  EXPECT_EQ(pool.Refill(), 0u);
+}
+
+// ============================================================================
+// Acquire Tests
+// ============================================================================
+
+TEST_F(SpareBrowserPoolTest, AcquireReturnsOldestReadySpare) {
+  SpareBrowserPool pool(&engine_, MakeConfig(2));
+  pool.Refill();
+
+  auto first = pool.Acquire();
+  ASSERT_TRUE(first.has_value());
+  EXPECT_EQ(*first, 1u);
+  EXPECT_EQ(pool.GetSpareCount(), 1u);
+  EXPECT_EQ(pool.GetStats().hits, 1u);
+}
+
+TEST_F(SpareBrowserPoolTest, AcquireMissesWhenEmpty) {
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+
+  EXPECT_FALSE(pool.Acquire().has_value());
+  EXPECT_EQ(pool.GetStats().misses, 1u);
+}
+
+TEST_F(SpareBrowserPoolTest, AcquireSkipsSparesStillBeingCreated) {
+  SpareBrowserPool pool(&engine_, MakeConfig(2));
+  pool.Refill();
+
+  // Browser 1 has no CEF browser yet (empty URL), browser 2 does
+  EXPECT_CALL(engine_, GetURL(1)).WillRepeatedly(Return(""));
+  EXPECT_CALL(engine_, GetURL(2)).WillRepeatedly(Return("about:blank"));
+
+  auto spare = pool.Acquire();
+  ASSERT_TRUE(spare.has_value());
+  EXPECT_EQ(*spare, 2u);
+
+  EXPECT_FALSE(pool.Acquire().has_value());
+  EXPECT_EQ(pool.GetSpareCount(), 1u);
+}
+
+TEST_F(SpareBrowserPoolTest, AcquireDropsSparesTheEngineNoLongerHas) {
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+  pool.Refill();
+
+  EXPECT_CALL(engine_, HasBrowser(1)).WillRepeatedly(Return(false));
+
+  EXPECT_FALSE(pool.Acquire().has_value());
+  EXPECT_EQ(pool.GetSpareCount(), 0u);
+}
+
+TEST_F(SpareBrowserPoolTest, RefillReplacesAcquiredSpare) {
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+  pool.Refill();
+  pool.Acquire();
+
+  EXPECT_EQ(pool.Refill(), 1u);
+  auto spare = pool.Acquire();
+  ASSERT_TRUE(spare.has_value());
+  EXPECT_EQ(*spare, 2u);
+}
+
+// ============================================================================
+// Sizing and Cleanup Tests
+// ============================================================================
+
+TEST_F(SpareBrowserPoolTest, ShrinkingTargetClosesSurplusSpares) {
+  SpareBrowserPool pool(&engine_, MakeConfig(3));
+  pool.Refill();
+
+  EXPECT_CALL(engine_, CloseBrowser(3, true));
+  EXPECT_CALL(engine_, CloseBrowser(2, true));
+
+  pool.SetTargetSize(1);
+  EXPECT_EQ(pool.GetSpareCount(), 1u);
+  EXPECT_EQ(pool.GetTargetSize(), 1u);
+
+  // The remaining spare is closed with the pool
+  EXPECT_CALL(engine_, CloseBrowser(1, true));
+}
+
+TEST_F(SpareBrowserPoolTest, SetViewportAppliesToNewSpares) {
+  SpareBrowserPool pool(&engine_, MakeConfig(1));
+  pool.SetViewport(1920, 1080, 1.5f);
+
+  EXPECT_CALL(engine_,
+              CreateBrowser(AllOf(Field(&BrowserConfig::width, 1920),
+                                  Field(&BrowserConfig::height, 1080),
+                                  Field(&BrowserConfig::device_scale_factor, 1.5f))));
+  pool.Refill();
+}
+
+TEST_F(SpareBrowserPoolTest, DestructorClosesUnadoptedSpares) {
+  {
+    SpareBrowserPool pool(&engine_, MakeConfig(2));
+    pool.Refill();
+    pool.Acquire();
+
+    // Only the spare still in the pool is closed; the adopted one belongs to a tab
+    EXPECT_CALL(engine_, CloseBrowser(2, true));
+    EXPECT_CALL(engine_, CloseBrowser(1, _)).Times(0);
+  }
+}
@@ -1,6 +1,8 @@
 #include "core/types.h"
 
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
 
 using namespace athena::core;
 
@@ -333,3 +335,200 @@ TEST(ScaleFactorTest, ToString) {
   ScaleFactor sf(2.0f);
   EXPECT_EQ(sf.ToString(), "ScaleFactor(2)");
 }
+
+// Region Tests
+TEST(RegionTest, DefaultIsEmpty) {
+  Region r;
+  EXPECT_TRUE(r.IsEmpty());
+  EXPECT_EQ(r.Area(), 0);
+  EXPECT_EQ(r.Bounds(), Rect());
+}
+
+TEST(RegionTest, EmptyRectIsIgnored) {
+  EXPECT_TRUE(Region(Rect(10, 10, 0, 5)).IsEmpty());
+  EXPECT_TRUE(Region::FromRects({Rect(0, 0, -1, 5), Rect()}).IsEmpty());
+}
+
+TEST(RegionTest, OverlappingRectsAreCountedOnce) {
+  Region r = Region::FromRects({Rect(0, 0, 10, 10), Rect(5, 5, 10, 10)});
+
+  EXPECT_EQ(r.Area(), 100 + 100 - 25);
+  EXPECT_EQ(r.Bounds(), Rect(0, 0, 15, 15));
+  // Three bands: top-only, overlap rows, bottom-only
+  EXPECT_EQ(r.Rects().size(), 3u);
+}
+
+TEST(RegionTest, DuplicateRectsCollapse) {
+  Region r = Region::FromRects({Rect(1, 2, 3, 4), Rect(1, 2, 3, 4), Rect(2, 3, 1, 1)});
+  EXPECT_EQ(r, Region(Rect(1, 2, 3, 4)));
+}
+
+TEST(RegionTest, AdjacentRectsCoalesce) {
+  // Side by side merge horizontally, stacked merge vertically
+  EXPECT_EQ(Region::FromRects({Rect(0, 0, 5, 5), Rect(5, 0, 5, 5)}), Region(Rect(0, 0, 10, 5)));
+  EXPECT_EQ(Region::FromRects({Rect(0, 0, 5, 5), Rect(0, 5, 5, 5)}), Region(Rect(0, 0, 5, 10)));
+}
+
+TEST(RegionTest, Intersect) {
+  Region a = Region::FromRects({Rect(0, 0, 10, 10), Rect(20, 0, 10, 10)});
+  Region result = a.Intersect(Rect(5, 5, 20, 20));
+
+  EXPECT_EQ(result, Region::FromRects({Rect(5, 5, 5, 5), Rect(20, 5, 5, 5)}));
+  EXPECT_EQ(result.Area(), 50);
+}
+
+TEST(RegionTest, SubtractPunchesHole) {
+  Region r = Region(Rect(0, 0, 30, 30)).Subtract(Rect(10, 10, 10, 10));
+
+  EXPECT_EQ(r.Area(), 900 - 100);
+  EXPECT_FALSE(r.Contains(Point(15, 15)));
+  EXPECT_TRUE(r.Contains(Point(5, 15)));
+  EXPECT_EQ(r.Bounds(), Rect(0, 0, 30, 30));
+}
+
+TEST(RegionTest, ContainsRect) {
+  Region r = Region::FromRects({Rect(0, 0, 10, 10), Rect(10, 0, 10, 10)});
+
+  EXPECT_TRUE(r.Contains(Rect(5, 2, 10, 5)));
+  EXPECT_FALSE(r.Contains(Rect(15, 5, 10, 2)));
+  EXPECT_TRUE(r.Contains(Rect()));
+}
+
+TEST(RegionTest, ToString) {
+  EXPECT_EQ(Region(Rect(1, 2, 3, 4)).ToString(), "Region(Rect(1, 2, 3x4))");
+}
+
+// Region Property Tests
+//
+// Random regions on a small grid are checked against a brute-force pixel
+// bitmap, and every result is checked for canonical banded form.
+namespace {
+
+constexpr int kGrid = 24;
+
+using Bitmap = std::vector<bool>;
+
+Bitmap Rasterize(const std::vector<Rect>& rects) {
+  Bitmap bitmap(kGrid * kGrid, false);
+  for (const auto& rect : rects) {
+    for (int y = std::max(0, rect.y); y < std::min(kGrid, rect.Bottom()); y++) {
+      for (int x = std::max(0, rect.x); x < std::min(kGrid, rect.Right()); x++) {
+        bitmap[y * kGrid + x] = true;
+      }
+    }
+  }
+  return bitmap;
+}
+
+std::vector<Rect> RandomRects(std::mt19937& rng) {
+  std::uniform_int_distribution<int> count(0, 6);
+  std::uniform_int_distribution<int> pos(-2, kGrid - 2);
+  std::uniform_int_distribution<int> len(0, kGrid / 2);
+  std::vector<Rect> rects(count(rng));
+  for (auto& rect : rects) {
+    rect = Rect(pos(rng), pos(rng), len(rng), len(rng));
+  }
+  return rects;
+}
+
+// Checks band ordering, non-overlap and maximal coalescing.
+::testing::AssertionResult IsCanonical(const Region& region) {
+  const auto& rects = region.Rects();
+  for (size_t i = 0; i < rects.size(); i++) {
+    if (rects[i].IsEmpty()) {
+      return ::testing::AssertionFailure() << "empty rect in " << region;
+    }
+    if (i == 0) {
+      continue;
+    }
+    const Rect& prev = rects[i - 1];
+    const Rect& cur = rects[i];
+    if (cur.y == prev.y) {
+      if (cur.height != prev.height || cur.x <= prev.Right()) {
+        return ::testing::AssertionFailure() << "bad band " << region;
+      }
+    } else if (cur.y < prev.Bottom()) {
+      return ::testing::AssertionFailure() << "overlapping bands " << region;
+    }
+  }
+
+  // Touching bands must differ in their spans (otherwise they should merge)
+  size_t band_start = 0;
+  std::vector<std::pair<int, int>> previous;
+  int previous_bottom = -1;
+  while (band_start < rects.size()) {
+    size_t band_end = band_start;
+    std::vector<std::pair<int, int>> spans;
+    while (band_end < rects.size() && rects[band_end].y == rects[band_start].y) {
+      spans.emplace_back(rects[band_end].x, rects[band_end].Right());
+      band_end++;
+    }
+    if (rects[band_start].y == previous_bottom && spans == previous) {
+      return ::testing::AssertionFailure() << "uncoalesced bands " << region;
+    }
+    previous = spans;
+    previous_bottom = rects[band_start].Bottom();
+    band_start = band_end;
+  }
+  return ::testing::AssertionSuccess();
+}
+
+}  // namespace
+
+TEST(RegionPropertyTest, FromRectsMatchesBitmap) {
+  std::mt19937 rng(1234);
+  for (int iteration = 0; iteration < 500; iteration++) {
+    auto rects = RandomRects(rng);
+    Region region = Region::FromRects(rects);
+
+    ASSERT_TRUE(IsCanonical(region));
+    ASSERT_EQ(Rasterize(region.Rects()), Rasterize(rects)) << region;
+  }
+}
+
+TEST(RegionPropertyTest, SetOperationsMatchBitmap) {
+  std::mt19937 rng(5678);
+  for (int iteration = 0; iteration < 500; iteration++) {
+    // Keep inputs on the grid so the bitmap sees every pixel
+    Region a = Region::FromRects(RandomRects(rng)).Intersect(Rect(0, 0, kGrid, kGrid));
+    Region b = Region::FromRects(RandomRects(rng)).Intersect(Rect(0, 0, kGrid, kGrid));
+    Bitmap bits_a = Rasterize(a.Rects());
+    Bitmap bits_b = Rasterize(b.Rects());
+
+    Region u = a.Union(b);
+    Region i = a.Intersect(b);
+    Region d = a.Subtract(b);
+    ASSERT_TRUE(IsCanonical(u));
+    ASSERT_TRUE(IsCanonical(i));
+    ASSERT_TRUE(IsCanonical(d));
+
+    Bitmap bits_u = Rasterize(u.Rects());
+    Bitmap bits_i = Rasterize(i.Rects());
+    Bitmap bits_d = Rasterize(d.Rects());
+    for (int p = 0; p < kGrid * kGrid; p++) {
+      ASSERT_EQ(bits_u[p], bits_a[p] || bits_b[p]) << "union at " << p;
+      ASSERT_EQ(bits_i[p], bits_a[p] && bits_b[p]) << "intersect at " << p;
+      ASSERT_EQ(bits_d[p], bits_a[p] && !bits_b[p]) << "subtract at " << p;
+    }
+  }
+}
+
+TEST(RegionPropertyTest, AlgebraicIdentities) {
+  std::mt19937 rng(91011);
+  for (int iteration = 0; iteration < 300; iteration++) {
+    Region a = Region::FromRects(RandomRects(rng));
+    Region b = Region::FromRects(RandomRects(rng));
+    Region c = Region::FromRects(RandomRects(rng));
+
+    // Canonical form makes equal pixel sets compare equal
+    EXPECT_EQ(a.Union(b), b.Union(a));
+    EXPECT_EQ(a.Intersect(b), b.Intersect(a));
+    EXPECT_EQ(a.Union(b).Union(c), a.Union(b.Union(c)));
+    EXPECT_EQ(a.Intersect(b.Union(c)), a.Intersect(b).Union(a.Intersect(c)));
+    EXPECT_EQ(a.Union(a), a);
+    EXPECT_EQ(a.Intersect(a), a);
+    EXPECT_TRUE(a.Subtract(a).IsEmpty());
+    EXPECT_EQ(a.Subtract(b).Union(a.Intersect(b)), a);
+    EXPECT_EQ(a.Union(b).Area(), a.Area() + b.Area() - a.Intersect(b).Area());
+  }
+}
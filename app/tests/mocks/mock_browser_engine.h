@@ -52,9 +52,12 @@ class MockBrowserEngine : public BrowserEngine {
   MOCK_METHOD(void, SetSize, (BrowserId id, int width, int height), (override));
   MOCK_METHOD(void, SetDeviceScaleFactor, (BrowserId id, float scale_factor), (override));
   MOCK_METHOD(void, Invalidate, (BrowserId id), (override));
+  MOCK_METHOD(void, SetBrowserVisible, (BrowserId id, bool visible), (override));
 
   // Input Events
   MOCK_METHOD(void, SetFocus, (BrowserId id, bool focus), (override));
+  MOCK_METHOD(void, NotifyUserInput, (BrowserId id), (override));
+  MOCK_METHOD(void, NotifyAgentDemand, (BrowserId id), (override));
 
   // Message Loop Integration
   MOCK_METHOD(void, DoMessageLoopWork, (), (override));
@@ -0,0 +1,205 @@
+#include "platform/chat_list_layout.h"
+
+#include <algorithm>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace athena::platform;
+
+namespace {
+
+// Straightforward reference layout: a list of (spacing, height)
+struct NaiveLayout {
+  std::vector<std::pair<int, int>> items;
+
+  int Top(size_t index) const {
+    int y = 0;
+    for (size_t i = 0; i < index; ++i) {
+      y += items[i].first + items[i].second;
+    }
+    return y + items[index].first;
+  }
+
+  int Total() const { return items.empty() ? 0 : Top(items.size() - 1) + items.back().second; }
+
+  size_t IndexAt(int y) const {
+    int end = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+      end += items[i].first + items[i].second;
+      if (y < end) {
+        return i;
+      }
+    }
+    return items.size() - 1;
+  }
+};
+
+}  // namespace
+
+TEST(ChatListLayoutTest, EmptyLayout) {
+  ChatListLayout layout;
+  EXPECT_TRUE(layout.IsEmpty());
+  EXPECT_EQ(layout.TotalHeight(), 0);
+
+  auto range = layout.VisibleRange(0, 500);
+  EXPECT_EQ(range.first, range.last);
+}
+
+TEST(ChatListLayoutTest, PositionsIncludeSpacing) {
+  ChatListLayout layout(50);
+  EXPECT_EQ(layout.Append(0), 0u);
+  EXPECT_EQ(layout.Append(24), 1u);
+  EXPECT_EQ(layout.Append(34), 2u);
+
+  // Unmeasured messages use the estimate
+  EXPECT_FALSE(layout.IsMeasured(1));
+  EXPECT_EQ(layout.Top(0), 0);
+  EXPECT_EQ(layout.Top(1), 74);
+  EXPECT_EQ(layout.Top(2), 158);
+  EXPECT_EQ(layout.TotalHeight(), 208);
+
+  EXPECT_EQ(layout.SetHeight(1, 120), 70);
+  EXPECT_TRUE(layout.IsMeasured(1));
+  EXPECT_EQ(layout.Bottom(1), 194);
+  EXPECT_EQ(layout.Top(2), 228);
+  EXPECT_EQ(layout.TotalHeight(), 278);
+}
+
+TEST(ChatListLayoutTest, IndexAtAndVisibleRange) {
+  ChatListLayout layout(100);
+  for (int i = 0; i < 10; ++i) {
+    layout.Append(i == 0 ? 0 : 20);  // Message i spans [120i - 20, 120i + 100)
+  }
+
+  EXPECT_EQ(layout.IndexAt(-5), 0u);
+  EXPECT_EQ(layout.IndexAt(99), 0u);
+  EXPECT_EQ(layout.IndexAt(100), 1u);  // The gap above a message belongs to it
+  EXPECT_EQ(layout.IndexAt(219), 1u);
+  EXPECT_EQ(layout.IndexAt(220), 2u);
+  EXPECT_EQ(layout.IndexAt(100000), 9u);
+
+  auto range = layout.VisibleRange(250, 500);
+  EXPECT_EQ(range.first, 2u);
+  EXPECT_EQ(range.last, 5u);
+
+  range = layout.VisibleRange(layout.TotalHeight(), layout.TotalHeight() + 100);
+  EXPECT_EQ(range.first, range.last);
+}
+
+TEST(ChatListLayoutTest, InvalidateKeepsHeightsAsEstimates) {
+  ChatListLayout layout(40);
+  layout.Append(0);
+  layout.Append(10);
+  layout.SetHeight(0, 200);
+  layout.SetHeight(1, 300);
+
+  layout.InvalidateHeights();
+  EXPECT_FALSE(layout.IsMeasured(0));
+  EXPECT_FALSE(layout.IsMeasured(1));
+  EXPECT_EQ(layout.TotalHeight(), 510);
+
+  // Re-measuring at the same height changes nothing but the flag
+  EXPECT_EQ(layout.SetHeight(0, 200), 0);
+  EXPECT_TRUE(layout.IsMeasured(0));
+
+  layout.Invalidate(0);
+  EXPECT_FALSE(layout.IsMeasured(0));
+  EXPECT_EQ(layout.Height(0), 200);
+}
+
+TEST(ChatListLayoutTest, RemoveFrontShiftsIndices) {
+  ChatListLayout layout(10);
+  for (int i = 0; i < 5; ++i) {
+    layout.SetHeight(layout.Append(5), 100 + i);
+  }
+
+  layout.RemoveFront(2);
+  ASSERT_EQ(layout.Count(), 3u);
+  EXPECT_EQ(layout.Height(0), 102);
+  EXPECT_EQ(layout.Top(0), 5);
+  EXPECT_EQ(layout.IndexAt(0), 0u);
+  EXPECT_EQ(layout.TotalHeight(), 107 + 108 + 109);
+
+  layout.RemoveFront(10);
+  EXPECT_TRUE(layout.IsEmpty());
+  EXPECT_EQ(layout.TotalHeight(), 0);
+
+  layout.Append(0);
+  EXPECT_EQ(layout.TotalHeight(), 10);
+}
+
+TEST(ChatListLayoutTest, MatchesNaiveLayoutUnderRandomEdits) {
+  std::mt19937 rng(7);
+  ChatListLayout layout(60);
+  NaiveLayout naive;
+
+  for (int step = 0; step < 5000; ++step) {
+    int op = static_cast<int>(rng() % 10);
+    if (op < 4 || naive.items.empty()) {
+      int spacing = static_cast<int>(rng() % 40);
+      layout.Append(spacing);
+      naive.items.emplace_back(spacing, 60);
+    } else if (op < 8) {
+      size_t index = rng() % naive.items.size();
+      int height = static_cast<int>(rng() % 500);
+      EXPECT_EQ(layout.SetHeight(index, height), height - naive.items[index].second);
+      naive.items[index].second = height;
+    } else if (op < 9) {
+      size_t count = 1 + rng() % 3;
+      layout.RemoveFront(count);
+      naive.items.erase(naive.items.begin(),
+                        naive.items.begin() + std::min(count, naive.items.size()));
+    } else if (!naive.items.empty()) {
+      int y = static_cast<int>(rng() % (naive.Total() + 1));
+      EXPECT_EQ(layout.IndexAt(y), naive.IndexAt(y)) << "y " << y;
+    }
+
+    ASSERT_EQ(layout.Count(), naive.items.size());
+    ASSERT_EQ(layout.TotalHeight(), naive.Total());
+    if (!naive.items.empty()) {
+      size_t index = rng() % naive.items.size();
+      ASSERT_EQ(layout.Top(index), naive.Top(index)) << "step " << step;
+    }
+  }
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// A 100k-message conversation: the per-frame work of a scrolling view (find
+// the visible range, re-measure a few messages). Timings are reported, not
+// asserted, since they depend on the machine.
+
+TEST(ChatListLayoutBenchmark, ScrollLongConversation) {
+  const size_t kMessages = 100000;
+  ChatListLayout layout(80);
+  for (size_t i = 0; i < kMessages; ++i) {
+    layout.Append(i == 0 ? 0 : 24);
+  }
+
+  std::mt19937 rng(1);
+  const int kFrames = 100000;
+  size_t visible = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int frame = 0; frame < kFrames; ++frame) {
+    int top = static_cast<int>(rng() % static_cast<unsigned>(layout.TotalHeight()));
+    auto range = layout.VisibleRange(top, top + 900);
+    for (size_t i = range.first; i < range.last; ++i) {
+      layout.SetHeight(i, 60 + static_cast<int>(rng() % 400));
+    }
+    visible += range.last - range.first;
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double us_per_frame =
+      std::chrono::duration<double, std::micro>(end - start).count() / static_cast<double>(kFrames);
+  std::cout << "[ BENCH    ] 100k-message layout: " << us_per_frame << " us/frame ("
+            << static_cast<double>(visible) / kFrames << " visible)" << std::endl;
+  ::testing::Test::RecordProperty("us_per_frame", std::to_string(us_per_frame));
+
+  EXPECT_EQ(layout.Count(), kMessages);
+}
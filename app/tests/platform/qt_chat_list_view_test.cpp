@@ -0,0 +1,169 @@
+#include "platform/qt_chat_list_view.h"
+
+#include <gtest/gtest.h>
+#include <QApplication>
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QScrollBar>
+
+using namespace athena::platform;
+
+namespace {
+
+AgentPanelPalette MakeTestPalette() {
+  AgentPanelPalette palette;
+  palette.dark = false;
+  palette.accent = QColor("#2563EB");
+
+  palette.userBubble.background = QColor("#2563EB");
+  palette.userBubble.text = QColor("#F8FAFC");
+  palette.userBubble.label = QColor("#F8FAFC");
+
+  palette.assistantBubble.background = QColor("#1F2937");
+  palette.assistantBubble.text = QColor("#F9FAFB");
+  palette.assistantBubble.label = QColor("#E2E8F0");
+
+  return palette;
+}
+
+void PumpQtEvents(int iterations = 6) {
+  for (int i = 0; i < iterations; ++i) {
+    QCoreApplication::processEvents(QEventLoop::AllEvents, 50);
+  }
+}
+
+int CountBubbles(const ChatListView& view, bool visibleOnly) {
+  int count = 0;
+  for (ChatBubble* bubble : view.viewport()->findChildren<ChatBubble*>()) {
+    if (!visibleOnly || bubble->isVisible()) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+// Bubble at the top of the viewport and its on-screen offset
+ChatBubble* TopBubble(const ChatListView& view) {
+  ChatBubble* top = nullptr;
+  for (ChatBubble* bubble : view.viewport()->findChildren<ChatBubble*>()) {
+    if (bubble->isVisible() && bubble->geometry().bottom() >= 0 &&
+        (!top || bubble->y() < top->y())) {
+      top = bubble;
+    }
+  }
+  return top;
+}
+
+}  // namespace
+
+class QtChatListViewTest : public ::testing::Test {
+ protected:
+  static void SetUpTestSuite() {
+    if (!QApplication::instance()) {
+      static int argc = 1;
+      static char app_name[] = "qt_chat_list_view_test";
+      static char* argv[] = {app_name, nullptr};
+
+      qputenv("QT_QPA_PLATFORM", QByteArray("offscreen"));
+
+      app_ = new QApplication(argc, argv);
+    }
+  }
+
+  void SetUp() override {
+    view_.ApplyTheme(MakeTestPalette());
+    view_.resize(420, 600);
+    view_.show();
+    PumpQtEvents();
+  }
+
+  void AddConversation(int messages) {
+    for (int i = 0; i < messages; ++i) {
+      view_.AddMessage(i % 2 == 0 ? ChatBubble::Role::User : ChatBubble::Role::Assistant,
+                       QStringLiteral("Message %1 with **some** markdown").arg(i),
+                       false);
+    }
+    PumpQtEvents();
+  }
+
+  static QApplication* app_;
+  ChatListView view_;
+};
+
+QApplication* QtChatListViewTest::app_ = nullptr;
+
+TEST_F(QtChatListViewTest, OnlyMessagesInViewGetBubbles) {
+  AddConversation(10000);
+
+  EXPECT_EQ(view_.MessageCount(), 10000u);
+  EXPECT_GT(view_.verticalScrollBar()->maximum(), 0);
+
+  // A 600 px viewport plus overscan holds a few dozen short messages at most
+  EXPECT_GT(CountBubbles(view_, true), 0);
+  EXPECT_LT(CountBubbles(view_, false), 60);
+}
+
+TEST_F(QtChatListViewTest, ScrollingRecyclesBubbles) {
+  AddConversation(2000);
+  const int bubbles = CountBubbles(view_, false);
+
+  QScrollBar* bar = view_.verticalScrollBar();
+  for (int value = bar->maximum(); value >= 0; value -= bar->pageStep()) {
+    bar->setValue(value);
+    PumpQtEvents(1);
+  }
+  bar->setValue(0);
+  PumpQtEvents();
+
+  ChatBubble* top = TopBubble(view_);
+  ASSERT_NE(top, nullptr);
+  EXPECT_EQ(top->GetMessage(), QStringLiteral("Message 0 with **some** markdown"));
+  EXPECT_LE(CountBubbles(view_, false), bubbles + 10);
+}
+
+TEST_F(QtChatListViewTest, StaysAtBottomWhileStreaming) {
+  AddConversation(50);
+  QScrollBar* bar = view_.verticalScrollBar();
+  bar->setValue(bar->maximum());
+  PumpQtEvents();
+
+  uint64_t id = view_.AddMessage(ChatBubble::Role::Assistant, QString(), false);
+  for (int i = 0; i < 40; ++i) {
+    view_.AppendToMessage(id, QStringLiteral("Line %1 of the streamed answer.\n\n").arg(i));
+    PumpQtEvents(1);
+  }
+  PumpQtEvents();
+
+  EXPECT_EQ(bar->value(), bar->maximum());
+  EXPECT_EQ(view_.LastMessage(ChatBubble::Role::Assistant), id);
+}
+
+TEST_F(QtChatListViewTest, KeepsPositionWhenScrolledUp) {
+  AddConversation(200);
+  uint64_t id = view_.LastMessage(ChatBubble::Role::Assistant);
+
+  QScrollBar* bar = view_.verticalScrollBar();
+  bar->setValue(bar->maximum() / 2);
+  PumpQtEvents();
+  ChatBubble* top = TopBubble(view_);
+  ASSERT_NE(top, nullptr);
+  const QString topMessage = top->GetMessage();
+  const int topY = top->y();
+
+  // Growth below the viewport must not move what the user is reading
+  view_.AppendToMessage(id, QStringLiteral("\n\nA long continuation.\n\nAnd more."));
+  PumpQtEvents();
+
+  top = TopBubble(view_);
+  ASSERT_NE(top, nullptr);
+  EXPECT_EQ(top->GetMessage(), topMessage);
+  EXPECT_EQ(top->y(), topY);
+
+  view_.RemoveOldest(50);
+  PumpQtEvents();
+  EXPECT_EQ(view_.MessageCount(), 150u);
+  top = TopBubble(view_);
+  ASSERT_NE(top, nullptr);
+  EXPECT_EQ(top->GetMessage(), topMessage);
+}
@@ -0,0 +1,100 @@
+#include "platform/qt_markdown_stream.h"
+
+#include <gtest/gtest.h>
+#include <QString>
+
+using namespace athena::platform;
+
+namespace {
+
+// Feed |message| in pieces of |step| characters, as the stream would
+int StableEndStreamed(const QString& message, int step) {
+  MarkdownStreamSplitter splitter;
+  QString received;
+  for (int pos = 0; pos < message.size(); pos += step) {
+    received += message.mid(pos, step);
+    splitter.Scan(received);
+  }
+  return splitter.StableEnd();
+}
+
+}  // namespace
+
+TEST(MarkdownStreamSplitterTest, BlankLineEndsBlock) {
+  MarkdownStreamSplitter splitter;
+  QString message = QStringLiteral("First paragraph\nstill first\n\nSecond para");
+  splitter.Scan(message);
+
+  EXPECT_EQ(splitter.StableEnd(), message.indexOf(QStringLiteral("Second")));
+}
+
+TEST(MarkdownStreamSplitterTest, UnfinishedLineIsNotScanned) {
+  MarkdownStreamSplitter splitter;
+  QString message = QStringLiteral("Paragraph\n");
+  splitter.Scan(message);
+  EXPECT_EQ(splitter.StableEnd(), 0);
+
+  // The blank line only counts once its newline has arrived
+  message += QStringLiteral("  ");
+  splitter.Scan(message);
+  EXPECT_EQ(splitter.StableEnd(), 0);
+
+  message += QStringLiteral("\n");
+  splitter.Scan(message);
+  EXPECT_EQ(splitter.StableEnd(), message.size());
+}
+
+TEST(MarkdownStreamSplitterTest, HeadingIsABlockOfItsOwn) {
+  MarkdownStreamSplitter splitter;
+  QString message = QStringLiteral("## Summary\nText under it");
+  splitter.Scan(message);
+  EXPECT_EQ(splitter.StableEnd(), message.indexOf(QStringLiteral("Text")));
+
+  // Not headings: seven hashes, or no space after them
+  MarkdownStreamSplitter other;
+  other.Scan(QStringLiteral("####### no\n#hashtag\nmore"));
+  EXPECT_EQ(other.StableEnd(), 0);
+}
+
+TEST(MarkdownStreamSplitterTest, BlankLinesInsideCodeFenceDoNotSplit) {
+  MarkdownStreamSplitter splitter;
+  QString message = QStringLiteral("Intro\n```cpp\nint a;\n\nint b;\n");
+  splitter.Scan(message);
+
+  // The fence starts its own block; nothing inside it is stable yet
+  EXPECT_TRUE(splitter.InCodeFence());
+  EXPECT_EQ(splitter.StableEnd(), message.indexOf(QStringLiteral("```")));
+
+  // A shorter or different fence does not close it
+  message += QStringLiteral("~~~\n``\n");
+  splitter.Scan(message);
+  EXPECT_TRUE(splitter.InCodeFence());
+
+  message += QStringLiteral("```\nAfter");
+  splitter.Scan(message);
+  EXPECT_FALSE(splitter.InCodeFence());
+  EXPECT_EQ(splitter.StableEnd(), message.indexOf(QStringLiteral("After")));
+}
+
+TEST(MarkdownStreamSplitterTest, ChunkSizeDoesNotChangeResult) {
+  QString message = QStringLiteral(
+      "# Title\n\nSome text with `code`.\n\n- one\n- two\n\n````\n```\nnested\n\n````\n\nTail");
+  const int expected = message.indexOf(QStringLiteral("Tail"));
+
+  for (int step = 1; step <= message.size(); ++step) {
+    EXPECT_EQ(StableEndStreamed(message, step), expected) << "step " << step;
+  }
+}
+
+TEST(MarkdownStreamSplitterTest, ResetStartsOver) {
+  MarkdownStreamSplitter splitter;
+  splitter.Scan(QStringLiteral("```\ncode\n"));
+  EXPECT_TRUE(splitter.InCodeFence());
+
+  splitter.Reset();
+  EXPECT_FALSE(splitter.InCodeFence());
+  EXPECT_EQ(splitter.StableEnd(), 0);
+
+  splitter.Scan(QStringLiteral("Fresh\n\n"));
+  EXPECT_EQ(splitter.StableEnd(), 7);
+}
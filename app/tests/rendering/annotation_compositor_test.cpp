@@ -0,0 +1,177 @@
+#include "rendering/annotation_compositor.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace athena::rendering;
+using namespace athena::core;
+
+class AnnotationCompositorTest : public ::testing::Test {
+ protected:
+  static constexpr int kWidth = 64;
+  static constexpr int kHeight = 48;
+
+  AnnotationCompositorTest()
+      : frame_(kWidth * kHeight * 4, 0), compositor_(frame_.data(), Size(kWidth, kHeight)) {}
+
+  const uint8_t* PixelAt(int x, int y) const { return &frame_[(y * kWidth + x) * 4]; }
+
+  bool IsColor(int x, int y, const AnnotationCompositor::Color& color) const {
+    const uint8_t* px = PixelAt(x, y);
+    return px[0] == color.r && px[1] == color.g && px[2] == color.b && px[3] == color.a;
+  }
+
+  bool IsBlank(int x, int y) const {
+    const uint8_t* px = PixelAt(x, y);
+    return px[0] == 0 && px[1] == 0 && px[2] == 0 && px[3] == 0;
+  }
+
+  int CountPainted() const {
+    int count = 0;
+    for (int y = 0; y < kHeight; y++) {
+      for (int x = 0; x < kWidth; x++) {
+        if (!IsBlank(x, y)) {
+          count++;
+        }
+      }
+    }
+    return count;
+  }
+
+  std::vector<uint8_t> frame_;
+  AnnotationCompositor compositor_;
+};
+
+// ============================================================================
+// Primitive Tests
+// ============================================================================
+
+TEST_F(AnnotationCompositorTest, FillRectPaintsExactArea) {
+  const AnnotationCompositor::Color red{255, 0, 0, 255};
+  compositor_.FillRect(Rect(2, 3, 4, 5), red);
+
+  EXPECT_EQ(CountPainted(), 20);
+  EXPECT_TRUE(IsColor(2, 3, red));
+  EXPECT_TRUE(IsColor(5, 7, red));
+  EXPECT_TRUE(IsBlank(6, 7));
+  EXPECT_TRUE(IsBlank(5, 8));
+}
+
+TEST_F(AnnotationCompositorTest, FillRectIsClippedToFrame) {
+  const AnnotationCompositor::Color red{255, 0, 0, 255};
+  compositor_.FillRect(Rect(-10, -10, 12, 12), red);
+  compositor_.FillRect(Rect(kWidth - 1, kHeight - 1, 50, 50), red);
+  compositor_.FillRect(Rect(1000, 1000, 5, 5), red);
+
+  EXPECT_EQ(CountPainted(), 4 + 1);
+}
+
+TEST_F(AnnotationCompositorTest, FillRectBlendsTranslucentColor) {
+  std::fill(frame_.begin(), frame_.end(), 255);  // Opaque white
+  compositor_.FillRect(Rect(0, 0, 1, 1), {0, 0, 0, 128});
+
+  const uint8_t* px = PixelAt(0, 0);
+  EXPECT_NEAR(px[0], 127, 1);
+  EXPECT_EQ(px[3], 255);
+}
+
+TEST_F(AnnotationCompositorTest, StrokeRectLeavesInteriorUntouched) {
+  const AnnotationCompositor::Color blue{0, 0, 255, 255};
+  compositor_.StrokeRect(Rect(10, 10, 20, 10), blue, 2);
+
+  EXPECT_TRUE(IsColor(10, 10, blue));
+  EXPECT_TRUE(IsColor(29, 19, blue));
+  EXPECT_TRUE(IsColor(11, 15, blue));
+  EXPECT_TRUE(IsBlank(15, 15));
+  EXPECT_EQ(CountPainted(), 20 * 10 - 16 * 6);
+}
+
+TEST_F(AnnotationCompositorTest, ThickStrokeOnTinyBoxFillsIt) {
+  const AnnotationCompositor::Color blue{0, 0, 255, 255};
+  compositor_.StrokeRect(Rect(0, 0, 3, 3), blue, 10);
+
+  EXPECT_EQ(CountPainted(), 9);
+}
+
+// ============================================================================
+// Text Tests
+// ============================================================================
+
+TEST_F(AnnotationCompositorTest, MeasureTextScalesWithFont) {
+  EXPECT_EQ(AnnotationCompositor::MeasureText("", 2), Size(0, 0));
+  EXPECT_EQ(AnnotationCompositor::MeasureText("7", 1), Size(5, 7));
+  EXPECT_EQ(AnnotationCompositor::MeasureText("12", 2), Size(22, 14));
+}
+
+TEST_F(AnnotationCompositorTest, DrawTextRendersGlyphBits) {
+  const AnnotationCompositor::Color white{255, 255, 255, 255};
+  compositor_.DrawText(Point(0, 0), "1", white, 1);
+
+  // "1": row 0 = 0x04 (middle column only), row 6 = 0x0E (three columns)
+  EXPECT_TRUE(IsColor(2, 0, white));
+  EXPECT_TRUE(IsBlank(0, 0));
+  EXPECT_TRUE(IsColor(1, 6, white));
+  EXPECT_TRUE(IsColor(3, 6, white));
+  EXPECT_EQ(CountPainted(), 10);
+}
+
+TEST_F(AnnotationCompositorTest, DrawTextScalesPixels) {
+  const AnnotationCompositor::Color white{255, 255, 255, 255};
+  compositor_.DrawText(Point(0, 0), "1", white, 3);
+
+  EXPECT_EQ(CountPainted(), 10 * 9);
+}
+
+TEST_F(AnnotationCompositorTest, LowercaseMatchesUppercase) {
+  const AnnotationCompositor::Color white{255, 255, 255, 255};
+  compositor_.DrawText(Point(0, 0), "a", white, 1);
+  std::vector<uint8_t> lower = frame_;
+
+  std::fill(frame_.begin(), frame_.end(), 0);
+  compositor_.DrawText(Point(0, 0), "A", white, 1);
+
+  EXPECT_EQ(frame_, lower);
+}
+
+TEST_F(AnnotationCompositorTest, UnknownCharactersAreBlank) {
+  compositor_.DrawText(Point(0, 0), " ~", {255, 255, 255, 255}, 1);
+
+  EXPECT_EQ(CountPainted(), 0);
+}
+
+// ============================================================================
+// Annotation Tests
+// ============================================================================
+
+TEST_F(AnnotationCompositorTest, AnnotationTagSitsAboveBox) {
+  compositor_.DrawAnnotations({{Rect(10, 30, 20, 10), "3"}}, 1);
+
+  const auto color = AnnotationCompositor::PaletteColor(0);
+  // Tag is 7x9 (5x7 glyph + 1px padding) directly above the box
+  EXPECT_TRUE(IsColor(10, 21, color));
+  EXPECT_TRUE(IsColor(10, 30, color));
+  EXPECT_TRUE(IsBlank(20, 35));
+}
+
+TEST_F(AnnotationCompositorTest, AnnotationTagMovesInsideAtTopEdge) {
+  compositor_.DrawAnnotations({{Rect(0, 0, 30, 20), "1"}}, 1);
+
+  // Tag overlaps the box interior instead of leaving the frame
+  const auto color = AnnotationCompositor::PaletteColor(0);
+  EXPECT_TRUE(IsColor(6, 5, color));
+}
+
+TEST_F(AnnotationCompositorTest, AnnotationsCyclePalette) {
+  compositor_.DrawAnnotations({{Rect(0, 20, 10, 10), ""}, {Rect(30, 20, 10, 10), ""}}, 1);
+
+  EXPECT_TRUE(IsColor(0, 20, AnnotationCompositor::PaletteColor(0)));
+  EXPECT_TRUE(IsColor(30, 20, AnnotationCompositor::PaletteColor(1)));
+  EXPECT_EQ(AnnotationCompositor::PaletteColor(0).r, AnnotationCompositor::PaletteColor(8).r);
+}
+
+TEST_F(AnnotationCompositorTest, NullFrameIsIgnored) {
+  AnnotationCompositor compositor(nullptr, Size(10, 10));
+  compositor.DrawAnnotations({{Rect(0, 0, 5, 5), "1"}}, 1);
+  SUCCEED();
+}
@@ -386,10 +386,44 @@ TEST_F(BufferManagerTest, CopyFromCEFDirtyPartiallyOutOfBounds) {
   auto copy_result = manager_.CopyFromCEFDirty(*buffer, cef_buffer.data(), size, dirty_rects);
   ASSERT_TRUE(copy_result.IsOk());
 
-  // Should skip the invalid rect
+  // Rect should be clipped to the buffer: only (90,90)-(100,100) is copied
   const uint8_t* buffer_data = buffer->GetData();
-  for (size_t i = 0; i < buffer->GetSizeInBytes(); ++i) {
-    EXPECT_EQ(buffer_data[i], 0);
+  for (int y = 0; y < size.height; ++y) {
+    for (int x = 0; x < size.width; ++x) {
+      uint8_t expected = (x >= 90 && y >= 90) ? 255 : 0;
+      int offset = y * buffer->stride + x * 4;
+      ASSERT_EQ(buffer_data[offset], expected) << "Pixel mismatch at (" << x << ", " << y << ")";
+    }
+  }
+}
+
+TEST_F(BufferManagerTest, CopyFromCEFDirtyOverlappingRects) {
+  Size size{100, 100};
+  auto result = manager_.AllocateBuffer(size);
+  ASSERT_TRUE(result.IsOk());
+  auto buffer = std::move(result).Value();
+
+  std::vector<uint8_t> cef_buffer(size.width * 4 * size.height);
+  for (size_t i = 0; i < cef_buffer.size(); ++i) {
+    cef_buffer[i] = static_cast<uint8_t>(i % 251);
+  }
+
+  // Overlapping, duplicate and full-width rects
+  std::vector<Rect> dirty_rects{
+      {10, 10, 30, 30}, {20, 20, 30, 30}, {10, 10, 30, 30}, {0, 60, 100, 5}};
+
+  auto copy_result = manager_.CopyFromCEFDirty(*buffer, cef_buffer.data(), size, dirty_rects);
+  ASSERT_TRUE(copy_result.IsOk());
+
+  Region damage = Region::FromRects(dirty_rects);
+  const uint8_t* buffer_data = buffer->GetData();
+  for (int y = 0; y < size.height; ++y) {
+    for (int x = 0; x < size.width; ++x) {
+      int offset = y * buffer->stride + x * 4;
+      int src_offset = (y * size.width + x) * 4;
+      uint8_t expected = damage.Contains(Point(x, y)) ? cef_buffer[src_offset] : 0;
+      ASSERT_EQ(buffer_data[offset], expected) << "Pixel mismatch at (" << x << ", " << y << ")";
+    }
   }
 }
 
@@ -398,33 +432,97 @@ TEST_F(BufferManagerTest, CopyFromCEFDirtyPartiallyOutOfBounds) {
 // ============================================================================
 
 TEST_F(BufferManagerTest, StrideCalculationAligned) {
-  Size size{100, 100};  // 100 * 4 = 400 bytes (already 4-byte aligned)
+  Size size{800, 100};  // 800 * 4 = 3200 bytes (already 64-byte aligned)
   auto result = manager_.AllocateBuffer(size);
   ASSERT_TRUE(result.IsOk());
   auto buffer = std::move(result).Value();
 
-  EXPECT_EQ(buffer->stride, 400);
-  EXPECT_EQ(buffer->stride % 4, 0);
+  EXPECT_EQ(buffer->stride, 3200);
+  EXPECT_EQ(buffer->stride % 64, 0);
 }
 
 TEST_F(BufferManagerTest, StrideCalculationSmallWidth) {
-  Size size{1, 1};  // 1 * 4 = 4 bytes (4-byte aligned)
+  Size size{1, 1};  // 1 * 4 = 4 bytes, padded to one cache line
   auto result = manager_.AllocateBuffer(size);
   ASSERT_TRUE(result.IsOk());
   auto buffer = std::move(result).Value();
 
-  EXPECT_EQ(buffer->stride, 4);
-  EXPECT_EQ(buffer->stride % 4, 0);
+  EXPECT_EQ(buffer->stride, 64);
+  EXPECT_EQ(buffer->stride % 64, 0);
 }
 
 TEST_F(BufferManagerTest, StrideCalculationOddWidth) {
-  Size size{123, 100};  // 123 * 4 = 492 bytes (4-byte aligned)
+  Size size{123, 100};  // 123 * 4 = 492 bytes, padded to 512
   auto result = manager_.AllocateBuffer(size);
   ASSERT_TRUE(result.IsOk());
   auto buffer = std::move(result).Value();
 
-  EXPECT_EQ(buffer->stride, 492);
-  EXPECT_EQ(buffer->stride % 4, 0);
+  EXPECT_EQ(buffer->stride, 512);
+  EXPECT_EQ(buffer->stride % 64, 0);
+}
+
+TEST_F(BufferManagerTest, BufferRowsAreCacheLineAligned) {
+  auto result = manager_.AllocateBuffer(Size{123, 10});
+  ASSERT_TRUE(result.IsOk());
+  auto buffer = std::move(result).Value();
+
+  for (int y = 0; y < buffer->physical_size.height; ++y) {
+    auto row = reinterpret_cast<uintptr_t>(buffer->GetData() + y * buffer->stride);
+    EXPECT_EQ(row % 64, 0u) << "row " << y;
+  }
+}
+
+// ============================================================================
+// Pooling Tests
+// ============================================================================
+
+TEST_F(BufferManagerTest, FreedBufferIsReusedForSimilarSize) {
+  BufferPool pool;
+  BufferManager manager(pool);
+
+  uint8_t* first_ptr = nullptr;
+  {
+    auto first = std::move(manager.AllocateBuffer(Size{800, 600})).Value();
+    first_ptr = first->GetData();
+  }
+
+  // A resize by a few pixels lands in the same size class
+  auto second = std::move(manager.AllocateBuffer(Size{804, 598})).Value();
+
+  EXPECT_EQ(second->GetData(), first_ptr);
+  EXPECT_EQ(pool.GetStats().hits, 1u);
+  EXPECT_EQ(pool.GetStats().misses, 1u);
+}
+
+TEST_F(BufferManagerTest, RecycledBufferIsZeroedByDefault) {
+  BufferPool pool;
+  BufferManager manager(pool);
+
+  {
+    auto dirty = std::move(manager.AllocateBuffer(Size{10, 10})).Value();
+    std::memset(dirty->GetData(), 0xAB, dirty->GetSizeInBytes());
+  }
+
+  auto buffer = std::move(manager.AllocateBuffer(Size{10, 10})).Value();
+  ASSERT_EQ(pool.GetStats().hits, 1u);
+  for (size_t i = 0; i < buffer->GetSizeInBytes(); ++i) {
+    ASSERT_EQ(buffer->GetData()[i], 0) << "Byte at index " << i << " is not zero";
+  }
+}
+
+TEST_F(BufferManagerTest, UninitializedBufferSkipsClear) {
+  BufferPool pool;
+  BufferManager manager(pool);
+
+  {
+    auto dirty = std::move(manager.AllocateBuffer(Size{10, 10})).Value();
+    std::memset(dirty->GetData(), 0xAB, dirty->GetSizeInBytes());
+  }
+
+  auto buffer =
+      std::move(manager.AllocateBuffer(Size{10, 10}, BufferManager::BufferInit::kUninitialized))
+          .Value();
+  EXPECT_EQ(buffer->GetData()[0], 0xAB);
 }
 
 // ============================================================================
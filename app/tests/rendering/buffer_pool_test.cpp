@@ -0,0 +1,287 @@
+#include "rendering/buffer_pool.h"
+
+#include <chrono>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace athena::rendering;
+
+class BufferPoolTest : public ::testing::Test {
+ protected:
+  BufferPool pool_;
+};
+
+// ============================================================================
+// Size Class Tests
+// ============================================================================
+
+TEST_F(BufferPoolTest, SizeClassRoundsSmallRequestsToPage) {
+  EXPECT_EQ(BufferPool::SizeClass(0), 0u);
+  EXPECT_EQ(BufferPool::SizeClass(1), BufferPool::kPageSize);
+  EXPECT_EQ(BufferPool::SizeClass(BufferPool::kPageSize), BufferPool::kPageSize);
+}
+
+TEST_F(BufferPoolTest, SizeClassBoundsWaste) {
+  for (size_t bytes = 1000; bytes < 64 * 1024 * 1024; bytes = bytes * 9 / 7) {
+    size_t capacity = BufferPool::SizeClass(bytes);
+    EXPECT_GE(capacity, bytes);
+    // Four classes per doubling: at most 25% over, plus huge-page rounding
+    EXPECT_LE(capacity, bytes + bytes / 4 + BufferPool::kHugePageSize) << bytes;
+  }
+}
+
+TEST_F(BufferPoolTest, NearbyFrameSizesShareClass) {
+  // 800x600 and 804x598 BGRA frames
+  EXPECT_EQ(BufferPool::SizeClass(800 * 600 * 4), BufferPool::SizeClass(804 * 598 * 4));
+}
+
+TEST_F(BufferPoolTest, LargeClassesAreWholeHugePages) {
+  size_t capacity = BufferPool::SizeClass(3840 * 2160 * 4);
+  EXPECT_EQ(capacity % BufferPool::kHugePageSize, 0u);
+}
+
+// ============================================================================
+// Acquire / Release Tests
+// ============================================================================
+
+TEST_F(BufferPoolTest, AcquireZeroBytesReturnsEmptyBlock) {
+  auto block = pool_.Acquire(0);
+
+  EXPECT_FALSE(block);
+  EXPECT_EQ(pool_.GetStats().misses, 0u);
+}
+
+TEST_F(BufferPoolTest, BlocksAreAligned) {
+  for (size_t bytes : {1, 100, 5000, 3 * 1024 * 1024}) {
+    auto block = pool_.Acquire(bytes);
+    ASSERT_TRUE(block);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(block.data()) % BufferPool::kAlignment, 0u);
+    EXPECT_GE(block.capacity(), bytes);
+  }
+}
+
+TEST_F(BufferPoolTest, ReleasedBlockIsReused) {
+  uint8_t* first = nullptr;
+  {
+    auto block = pool_.Acquire(100000);
+    first = block.data();
+  }
+
+  auto block = pool_.Acquire(100000);
+
+  EXPECT_EQ(block.data(), first);
+  EXPECT_FALSE(block.IsZeroed());
+  auto stats = pool_.GetStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.cached_blocks, 0u);
+}
+
+TEST_F(BufferPoolTest, DifferentClassIsNotReused) {
+  { auto block = pool_.Acquire(100000); }
+
+  auto block = pool_.Acquire(1000000);
+
+  auto stats = pool_.GetStats();
+  EXPECT_EQ(stats.hits, 0u);
+  EXPECT_EQ(stats.misses, 2u);
+  EXPECT_EQ(stats.cached_blocks, 1u);
+}
+
+TEST_F(BufferPoolTest, StatsTrackBytesInUse) {
+  auto block = pool_.Acquire(100000);
+  EXPECT_EQ(pool_.GetStats().in_use_bytes, block.capacity());
+  EXPECT_EQ(pool_.GetStats().cached_bytes, 0u);
+
+  size_t capacity = block.capacity();
+  block.Reset();
+
+  EXPECT_FALSE(block);
+  EXPECT_EQ(pool_.GetStats().in_use_bytes, 0u);
+  EXPECT_EQ(pool_.GetStats().cached_bytes, capacity);
+}
+
+TEST_F(BufferPoolTest, MoveTransfersOwnership) {
+  auto block = pool_.Acquire(5000);
+  uint8_t* data = block.data();
+
+  BufferPool::Block moved(std::move(block));
+  EXPECT_FALSE(block);
+  EXPECT_EQ(moved.data(), data);
+
+  BufferPool::Block assigned;
+  assigned = std::move(moved);
+  EXPECT_EQ(assigned.data(), data);
+  EXPECT_EQ(pool_.GetStats().cached_blocks, 0u);
+}
+
+TEST_F(BufferPoolTest, CacheLimitEvictsOldestBlocks) {
+  BufferPool::Options options;
+  options.max_cached_bytes = 2 * 64 * 1024;
+  BufferPool pool(options);
+
+  uint8_t* oldest = nullptr;
+  {
+    auto a = pool.Acquire(64 * 1024);
+    auto b = pool.Acquire(64 * 1024);
+    auto c = pool.Acquire(64 * 1024);
+    oldest = a.data();
+    a.Reset();  // Released first, so evicted first
+  }
+
+  auto stats = pool.GetStats();
+  EXPECT_EQ(stats.evictions, 1u);
+  EXPECT_EQ(stats.cached_blocks, 2u);
+  EXPECT_LE(stats.cached_bytes, options.max_cached_bytes);
+
+  // Only the two newer blocks remain cached
+  auto x = pool.Acquire(64 * 1024);
+  auto y = pool.Acquire(64 * 1024);
+  EXPECT_NE(x.data(), oldest);
+  EXPECT_NE(y.data(), oldest);
+}
+
+TEST_F(BufferPoolTest, OversizedBlockIsNotCached) {
+  BufferPool::Options options;
+  options.max_cached_bytes = 4096;
+  BufferPool pool(options);
+
+  { auto block = pool.Acquire(100000); }
+
+  EXPECT_EQ(pool.GetStats().cached_blocks, 0u);
+  EXPECT_EQ(pool.GetStats().evictions, 1u);
+}
+
+TEST_F(BufferPoolTest, TrimFreesCachedBlocks) {
+  { auto block = pool_.Acquire(100000); }
+  ASSERT_EQ(pool_.GetStats().cached_blocks, 1u);
+
+  pool_.Trim();
+
+  EXPECT_EQ(pool_.GetStats().cached_blocks, 0u);
+  EXPECT_EQ(pool_.GetStats().cached_bytes, 0u);
+}
+
+TEST_F(BufferPoolTest, BlockMayOutlivePool) {
+  BufferPool::Block block;
+  {
+    BufferPool pool;
+    block = pool.Acquire(100000);
+  }
+
+  ASSERT_TRUE(block);
+  std::memset(block.data(), 1, block.capacity());
+  block.Reset();  // Must not touch the destroyed pool
+  SUCCEED();
+}
+
+TEST_F(BufferPoolTest, HugePageBlocksStartZeroed) {
+  auto block = pool_.Acquire(BufferPool::kHugePageSize);
+  ASSERT_TRUE(block);
+
+  if (!block.IsZeroed()) {
+    GTEST_SKIP() << "Huge-page mapping not available on this platform";
+  }
+  for (size_t i = 0; i < block.capacity(); i += BufferPool::kPageSize) {
+    ASSERT_EQ(block.data()[i], 0);
+  }
+}
+
+TEST_F(BufferPoolTest, ConcurrentAcquireRelease) {
+  constexpr int kThreads = 4;
+  constexpr int kIterations = 500;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([this, t]() {
+      for (int i = 0; i < kIterations; i++) {
+        auto block = pool_.Acquire(4096 * (1 + (i + t) % 4));
+        block.data()[0] = static_cast<uint8_t>(i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto stats = pool_.GetStats();
+  EXPECT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(kThreads * kIterations));
+  EXPECT_EQ(stats.in_use_bytes, 0u);
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// Simulate an interactive window resize: one frame buffer is allocated per
+// step, filled, and freed when the next step arrives. Timings are reported
+// (not asserted, since they depend on the machine); the hit rate is asserted.
+
+namespace {
+
+constexpr int kResizeSteps = 200;
+
+// Frame size for resize step i: a drag from 1280x720 towards 1400x800
+size_t FrameBytesForStep(int i) {
+  int width = 1280 + (i % 120);
+  int height = 720 + (i % 80);
+  return static_cast<size_t>(width) * height * 4;
+}
+
+// Write one byte per page, the way a frame copy would first touch the memory
+void TouchPages(uint8_t* data, size_t bytes) {
+  for (size_t i = 0; i < bytes; i += BufferPool::kPageSize) {
+    data[i] = 1;
+  }
+}
+
+template <typename Fn>
+double MeasureMicros(Fn&& fn) {
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+}  // namespace
+
+TEST(BufferPoolBenchmark, ResizeChurnFreshAllocations) {
+  double micros = MeasureMicros([]() {
+    std::unique_ptr<uint8_t[]> frame;
+    for (int i = 0; i < kResizeSteps; i++) {
+      size_t bytes = FrameBytesForStep(i);
+      frame = std::make_unique<uint8_t[]>(bytes);  // Zero-filled, as before pooling
+      TouchPages(frame.get(), bytes);
+    }
+  });
+
+  std::cout << "[ BENCH    ] fresh allocations: " << micros / kResizeSteps << " us/step"
+            << std::endl;
+  ::testing::Test::RecordProperty("us_per_step", std::to_string(micros / kResizeSteps));
+}
+
+TEST(BufferPoolBenchmark, ResizeChurnPooledAllocations) {
+  BufferPool pool;
+
+  double micros = MeasureMicros([&pool]() {
+    BufferPool::Block frame;
+    for (int i = 0; i < kResizeSteps; i++) {
+      size_t bytes = FrameBytesForStep(i);
+      frame.Reset();  // Previous frame is freed before the next is allocated
+      frame = pool.Acquire(bytes);
+      TouchPages(frame.data(), bytes);
+    }
+  });
+
+  auto stats = pool.GetStats();
+  std::cout << "[ BENCH    ] pooled allocations: " << micros / kResizeSteps << " us/step, "
+            << stats.hits << " hits, " << stats.misses << " misses" << std::endl;
+  ::testing::Test::RecordProperty("us_per_step", std::to_string(micros / kResizeSteps));
+
+  // The whole drag spans only a couple of size classes
+  EXPECT_LE(stats.misses, 4u);
+  EXPECT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(kResizeSteps));
+}
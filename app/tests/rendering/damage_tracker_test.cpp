@@ -0,0 +1,231 @@
+#include "rendering/damage_tracker.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace athena::rendering;
+using namespace athena::core;
+
+class DamageTrackerTest : public ::testing::Test {
+ protected:
+  // Take an initial capture so later captures can be incremental
+  uint64_t Prime(const Size& size = Size(800, 600)) {
+    tracker_.AddDamage(size, {});
+    return tracker_.Consume(std::nullopt).token;
+  }
+
+  DamageTracker tracker_;
+};
+
+// ============================================================================
+// Token Tests
+// ============================================================================
+
+TEST_F(DamageTrackerTest, InitialStateHasNoToken) {
+  EXPECT_EQ(tracker_.CurrentToken(), DamageTracker::kInvalidToken);
+  EXPECT_TRUE(tracker_.HasDamage());
+}
+
+TEST_F(DamageTrackerTest, FirstCaptureIsFullFrame) {
+  tracker_.AddDamage(Size(800, 600), {Rect(10, 10, 5, 5)});
+  auto capture = tracker_.Consume(std::nullopt);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+  EXPECT_EQ(capture.bounds, Rect(0, 0, 800, 600));
+  EXPECT_EQ(capture.frame_size, Size(800, 600));
+  EXPECT_NE(capture.token, DamageTracker::kInvalidToken);
+  EXPECT_EQ(tracker_.CurrentToken(), capture.token);
+}
+
+TEST_F(DamageTrackerTest, InvalidTokenNeverMatches) {
+  Prime();
+  auto capture = tracker_.Consume(DamageTracker::kInvalidToken);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+}
+
+TEST_F(DamageTrackerTest, TokensAreUniqueAcrossTrackers) {
+  DamageTracker other;
+  other.AddDamage(Size(800, 600), {});
+
+  uint64_t token = Prime();
+  uint64_t other_token = other.Consume(std::nullopt).token;
+
+  EXPECT_NE(token, other_token);
+
+  // A token from another tracker is stale here
+  auto capture = tracker_.Consume(other_token);
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+}
+
+// ============================================================================
+// Change Detection Tests
+// ============================================================================
+
+TEST_F(DamageTrackerTest, UnchangedFrameReportsNoChange) {
+  uint64_t token = Prime();
+  EXPECT_FALSE(tracker_.HasDamage());
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_FALSE(capture.changed);
+  EXPECT_EQ(capture.token, token);
+  EXPECT_EQ(tracker_.CurrentToken(), token);
+}
+
+TEST_F(DamageTrackerTest, UnchangedFrameCanBePolledRepeatedly) {
+  uint64_t token = Prime();
+
+  for (int i = 0; i < 3; i++) {
+    auto capture = tracker_.Consume(token);
+    EXPECT_FALSE(capture.changed);
+    EXPECT_EQ(capture.token, token);
+  }
+}
+
+TEST_F(DamageTrackerTest, DamageReportsBoundingBox) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(10, 20, 30, 40), Rect(100, 100, 10, 10)});
+
+  EXPECT_TRUE(tracker_.HasDamage());
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_FALSE(capture.full_frame);
+  EXPECT_EQ(capture.bounds, Rect(10, 20, 100, 90));
+  EXPECT_NE(capture.token, token);
+}
+
+TEST_F(DamageTrackerTest, DamageAccumulatesAcrossPaints) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(0, 0, 10, 10)});
+  tracker_.AddDamage(Size(800, 600), {Rect(50, 50, 10, 10)});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_EQ(capture.bounds, Rect(0, 0, 60, 60));
+}
+
+TEST_F(DamageTrackerTest, ConsumeResetsDamage) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(0, 0, 10, 10)});
+
+  auto first = tracker_.Consume(token);
+  ASSERT_TRUE(first.changed);
+
+  auto second = tracker_.Consume(first.token);
+  EXPECT_FALSE(second.changed);
+  EXPECT_EQ(second.token, first.token);
+}
+
+TEST_F(DamageTrackerTest, StaleTokenYieldsFullFrame) {
+  uint64_t stale = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(0, 0, 10, 10)});
+  tracker_.Consume(stale);
+
+  // Older token no longer describes the last capture
+  auto capture = tracker_.Consume(stale);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+  EXPECT_EQ(capture.bounds, Rect(0, 0, 800, 600));
+}
+
+TEST_F(DamageTrackerTest, DamageReportsExactRegion) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(0, 0, 10, 10), Rect(5, 5, 10, 10)});
+  tracker_.AddDamage(Size(800, 600), {Rect(100, 100, 10, 10)});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_EQ(capture.region.Area(), 100 + 100 - 25 + 100);
+  EXPECT_FALSE(capture.region.Contains(Point(50, 50)));
+  EXPECT_EQ(capture.bounds, capture.region.Bounds());
+}
+
+TEST_F(DamageTrackerTest, DamageIsClippedToFrame) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(790, 590, 50, 50), Rect(900, 900, 10, 10)});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_EQ(capture.bounds, Rect(790, 590, 10, 10));
+}
+
+TEST_F(DamageTrackerTest, EmptyDirtyListMeansFullRepaint) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+}
+
+TEST_F(DamageTrackerTest, FullCoverageIsReportedAsFullFrame) {
+  uint64_t token = Prime();
+  tracker_.AddDamage(Size(800, 600), {Rect(0, 0, 800, 300), Rect(0, 300, 800, 300)});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_TRUE(capture.full_frame);
+}
+
+// ============================================================================
+// Invalidation Tests
+// ============================================================================
+
+TEST_F(DamageTrackerTest, ResizeInvalidatesWholeFrame) {
+  uint64_t token = Prime(Size(800, 600));
+  tracker_.AddDamage(Size(1024, 768), {Rect(0, 0, 10, 10)});
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_TRUE(capture.full_frame);
+  EXPECT_EQ(capture.frame_size, Size(1024, 768));
+  EXPECT_EQ(capture.bounds, Rect(0, 0, 1024, 768));
+}
+
+TEST_F(DamageTrackerTest, InvalidateAllForcesFullFrame) {
+  uint64_t token = Prime();
+  tracker_.InvalidateAll();
+
+  auto capture = tracker_.Consume(token);
+
+  EXPECT_TRUE(capture.changed);
+  EXPECT_TRUE(capture.full_frame);
+}
+
+// ============================================================================
+// Thread Safety Tests
+// ============================================================================
+
+TEST_F(DamageTrackerTest, ConcurrentPaintAndConsume) {
+  uint64_t token = Prime();
+  constexpr int kPaints = 1000;
+
+  std::thread painter([this]() {
+    for (int i = 0; i < kPaints; i++) {
+      tracker_.AddDamage(Size(800, 600), {Rect(i % 800, i % 600, 1, 1)});
+    }
+  });
+
+  int changes = 0;
+  for (int i = 0; i < 100; i++) {
+    auto capture = tracker_.Consume(token);
+    token = capture.token;
+    if (capture.changed) {
+      changes++;
+    }
+  }
+
+  painter.join();
+
+  // Whatever the interleaving, nothing painted may be lost
+  auto last = tracker_.Consume(token);
+  EXPECT_TRUE(changes > 0 || last.changed);
+}
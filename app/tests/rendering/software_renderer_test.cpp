@@ -0,0 +1,230 @@
+#include "rendering/software_renderer.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace athena::rendering;
+using namespace athena::core;
+
+namespace {
+
+// A BGRA frame (CEF layout) filled with one color
+std::vector<uint8_t> SolidFrame(const Size& size, uint8_t r, uint8_t g, uint8_t b) {
+  std::vector<uint8_t> frame(static_cast<size_t>(size.width) * size.height * 4);
+  for (size_t i = 0; i < frame.size(); i += 4) {
+    frame[i] = b;
+    frame[i + 1] = g;
+    frame[i + 2] = r;
+    frame[i + 3] = 255;
+  }
+  return frame;
+}
+
+// RGBA pixel at (x, y) of a captured image
+std::vector<uint8_t> PixelAt(const std::vector<uint8_t>& rgba, const Size& size, int x, int y) {
+  size_t offset = (static_cast<size_t>(y) * size.width + x) * 4;
+  return {rgba[offset], rgba[offset + 1], rgba[offset + 2], rgba[offset + 3]};
+}
+
+const std::vector<uint8_t> kRed = {255, 0, 0, 255};
+const std::vector<uint8_t> kGreen = {0, 255, 0, 255};
+const std::vector<uint8_t> kBlue = {0, 0, 255, 255};
+
+}  // namespace
+
+class SoftwareRendererTest : public ::testing::Test {
+ protected:
+  BufferPool pool_;
+  SoftwareRenderer renderer_{pool_};
+};
+
+// ============================================================================
+// Paint Tests
+// ============================================================================
+
+TEST_F(SoftwareRendererTest, NoFrameBeforeFirstPaint) {
+  std::vector<uint8_t> rgba;
+  Size size;
+
+  EXPECT_FALSE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_TRUE(renderer_.GetViewSize().IsEmpty());
+  EXPECT_EQ(renderer_.GetMemoryUsage(), 0u);
+}
+
+TEST_F(SoftwareRendererTest, CaptureConvertsBgraToRgba) {
+  Size frame_size(40, 30);
+  auto frame = SolidFrame(frame_size, 255, 0, 0);
+  ASSERT_TRUE(renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, frame.data(), frame_size));
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+
+  EXPECT_EQ(size, frame_size);
+  EXPECT_EQ(rgba.size(), 40u * 30u * 4u);
+  EXPECT_EQ(PixelAt(rgba, size, 0, 0), kRed);
+  EXPECT_EQ(PixelAt(rgba, size, 39, 29), kRed);
+}
+
+TEST_F(SoftwareRendererTest, DirtyPaintUpdatesOnlyDirtyRects) {
+  Size frame_size(40, 30);
+  auto red = SolidFrame(frame_size, 255, 0, 0);
+  auto green = SolidFrame(frame_size, 0, 255, 0);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, red.data(), frame_size);
+
+  ASSERT_TRUE(renderer_.OnPaint(
+      SoftwareRenderer::Layer::kView, {Rect(10, 10, 5, 5)}, green.data(), frame_size));
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_EQ(PixelAt(rgba, size, 12, 12), kGreen);
+  EXPECT_EQ(PixelAt(rgba, size, 0, 0), kRed);
+  EXPECT_EQ(PixelAt(rgba, size, 15, 15), kRed);
+}
+
+TEST_F(SoftwareRendererTest, ResizeReplacesWholeFrame) {
+  auto small = SolidFrame(Size(20, 20), 255, 0, 0);
+  auto large = SolidFrame(Size(60, 40), 0, 0, 255);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, small.data(), Size(20, 20));
+
+  // Dirty rects are ignored when the size changes
+  ASSERT_TRUE(renderer_.OnPaint(
+      SoftwareRenderer::Layer::kView, {Rect(0, 0, 1, 1)}, large.data(), Size(60, 40)));
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_EQ(size, Size(60, 40));
+  EXPECT_EQ(PixelAt(rgba, size, 59, 39), kBlue);
+}
+
+TEST_F(SoftwareRendererTest, NullBufferIsRejected) {
+  EXPECT_FALSE(renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, nullptr, Size(10, 10)));
+}
+
+TEST_F(SoftwareRendererTest, InvalidSizeIsRejected) {
+  auto frame = SolidFrame(Size(1, 1), 0, 0, 0);
+  EXPECT_FALSE(renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, frame.data(), Size(0, 10)));
+  EXPECT_TRUE(renderer_.GetViewSize().IsEmpty());
+}
+
+// ============================================================================
+// Capture Region Tests
+// ============================================================================
+
+TEST_F(SoftwareRendererTest, CaptureRegion) {
+  Size frame_size(40, 30);
+  auto red = SolidFrame(frame_size, 255, 0, 0);
+  auto green = SolidFrame(frame_size, 0, 255, 0);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, red.data(), frame_size);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {Rect(10, 10, 5, 5)}, green.data(), frame_size);
+
+  Rect region(10, 10, 10, 10);
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size, &region));
+
+  EXPECT_EQ(size, Size(10, 10));
+  EXPECT_EQ(PixelAt(rgba, size, 0, 0), kGreen);
+  EXPECT_EQ(PixelAt(rgba, size, 9, 9), kRed);
+}
+
+TEST_F(SoftwareRendererTest, CaptureRegionIsClippedToView) {
+  auto frame = SolidFrame(Size(40, 30), 255, 0, 0);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, frame.data(), Size(40, 30));
+
+  Rect overlapping(30, 20, 50, 50);
+  Rect outside(100, 100, 10, 10);
+  std::vector<uint8_t> rgba;
+  Size size;
+
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size, &overlapping));
+  EXPECT_EQ(size, Size(10, 10));
+  EXPECT_FALSE(renderer_.CaptureViewPixels(&rgba, &size, &outside));
+}
+
+// ============================================================================
+// Popup Tests
+// ============================================================================
+
+TEST_F(SoftwareRendererTest, VisiblePopupIsComposited) {
+  auto view = SolidFrame(Size(40, 30), 255, 0, 0);
+  auto popup = SolidFrame(Size(10, 5), 0, 0, 255);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, view.data(), Size(40, 30));
+  renderer_.SetPopupVisible(true);
+  renderer_.SetPopupRect(Rect(5, 20, 10, 5));
+  renderer_.OnPaint(SoftwareRenderer::Layer::kPopup, {}, popup.data(), Size(10, 5));
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_EQ(PixelAt(rgba, size, 5, 20), kBlue);
+  EXPECT_EQ(PixelAt(rgba, size, 14, 24), kBlue);
+  EXPECT_EQ(PixelAt(rgba, size, 4, 20), kRed);
+  EXPECT_EQ(PixelAt(rgba, size, 15, 24), kRed);
+}
+
+TEST_F(SoftwareRendererTest, PopupRectIsScaledToPhysicalPixels) {
+  auto view = SolidFrame(Size(80, 60), 255, 0, 0);
+  auto popup = SolidFrame(Size(20, 10), 0, 0, 255);
+  renderer_.SetDeviceScaleFactor(2.0f);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, view.data(), Size(80, 60));
+  renderer_.SetPopupVisible(true);
+  renderer_.SetPopupRect(Rect(5, 20, 10, 5));  // View coordinates
+  renderer_.OnPaint(SoftwareRenderer::Layer::kPopup, {}, popup.data(), Size(20, 10));
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_EQ(PixelAt(rgba, size, 10, 40), kBlue);
+  EXPECT_EQ(PixelAt(rgba, size, 9, 40), kRed);
+}
+
+TEST_F(SoftwareRendererTest, HiddenPopupIsDropped) {
+  auto view = SolidFrame(Size(40, 30), 255, 0, 0);
+  auto popup = SolidFrame(Size(10, 5), 0, 0, 255);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, view.data(), Size(40, 30));
+  renderer_.SetPopupVisible(true);
+  renderer_.SetPopupRect(Rect(0, 0, 10, 5));
+  renderer_.OnPaint(SoftwareRenderer::Layer::kPopup, {}, popup.data(), Size(10, 5));
+  size_t with_popup = renderer_.GetMemoryUsage();
+
+  renderer_.SetPopupVisible(false);
+
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size));
+  EXPECT_EQ(PixelAt(rgba, size, 0, 0), kRed);
+  EXPECT_LT(renderer_.GetMemoryUsage(), with_popup);
+}
+
+TEST_F(SoftwareRendererTest, PopupIsClippedToCaptureRegion) {
+  auto view = SolidFrame(Size(40, 30), 255, 0, 0);
+  auto popup = SolidFrame(Size(10, 10), 0, 0, 255);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, view.data(), Size(40, 30));
+  renderer_.SetPopupVisible(true);
+  renderer_.SetPopupRect(Rect(35, 25, 10, 10));  // Extends past the view
+  renderer_.OnPaint(SoftwareRenderer::Layer::kPopup, {}, popup.data(), Size(10, 10));
+
+  Rect region(30, 20, 10, 10);
+  std::vector<uint8_t> rgba;
+  Size size;
+  ASSERT_TRUE(renderer_.CaptureViewPixels(&rgba, &size, &region));
+  EXPECT_EQ(PixelAt(rgba, size, 4, 4), kRed);
+  EXPECT_EQ(PixelAt(rgba, size, 5, 5), kBlue);
+  EXPECT_EQ(PixelAt(rgba, size, 9, 9), kBlue);
+}
+
+// ============================================================================
+// Memory Tests
+// ============================================================================
+
+TEST_F(SoftwareRendererTest, FramesComeFromPool) {
+  auto frame = SolidFrame(Size(200, 100), 255, 0, 0);
+  renderer_.OnPaint(SoftwareRenderer::Layer::kView, {}, frame.data(), Size(200, 100));
+
+  EXPECT_GE(renderer_.GetMemoryUsage(), 200u * 100u * 4u);
+  EXPECT_EQ(pool_.GetStats().in_use_bytes, renderer_.GetMemoryUsage());
+}
@@ -0,0 +1,170 @@
+#include "rendering/tile_stitcher.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace athena::rendering;
+using namespace athena::core;
+
+namespace {
+
+// Build a tile whose pixels encode their page row in the red channel
+std::vector<uint8_t> MakeTile(const Size& size, int page_y) {
+  std::vector<uint8_t> pixels(size.width * size.height * 4);
+  for (int y = 0; y < size.height; y++) {
+    for (int x = 0; x < size.width; x++) {
+      uint8_t* px = &pixels[(y * size.width + x) * 4];
+      px[0] = static_cast<uint8_t>((page_y + y) % 256);
+      px[1] = static_cast<uint8_t>(x % 256);
+      px[2] = 0;
+      px[3] = 255;
+    }
+  }
+  return pixels;
+}
+
+uint8_t RedAt(const TileStitcher& stitcher, int x, int y) {
+  return stitcher.Pixels()[(y * stitcher.OutputSize().width + x) * 4];
+}
+
+}  // namespace
+
+class TileStitcherTest : public ::testing::Test {
+ protected:
+  TileStitcher stitcher_;
+};
+
+// ============================================================================
+// Setup Tests
+// ============================================================================
+
+TEST_F(TileStitcherTest, ScaledSizeRoundsDown) {
+  EXPECT_EQ(TileStitcher::ScaledSize(Size(801, 601), 0.5f), Size(400, 300));
+  EXPECT_EQ(TileStitcher::ScaledSize(Size(1, 1), 0.5f), Size(1, 1));
+}
+
+TEST_F(TileStitcherTest, BeginRejectsInvalidArguments) {
+  EXPECT_FALSE(stitcher_.Begin(Size(0, 100), 0.5f));
+  EXPECT_FALSE(stitcher_.Begin(Size(100, 100), 0.0f));
+  EXPECT_FALSE(stitcher_.Begin(Size(100, 100), 1.5f));
+}
+
+TEST_F(TileStitcherTest, BeginEnforcesMemoryBudget) {
+  EXPECT_FALSE(stitcher_.Begin(Size(1000, 1000), 1.0f, 1000 * 1000 * 4 - 1));
+  EXPECT_TRUE(stitcher_.Begin(Size(1000, 1000), 1.0f, 1000 * 1000 * 4));
+}
+
+TEST_F(TileStitcherTest, AddTileBeforeBeginFails) {
+  auto tile = MakeTile(Size(10, 10), 0);
+  EXPECT_FALSE(stitcher_.AddTile(tile.data(), Size(10, 10), 0));
+}
+
+// ============================================================================
+// Stitching Tests
+// ============================================================================
+
+TEST_F(TileStitcherTest, SingleTileAtFullScale) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 3), 1.0f));
+  auto tile = MakeTile(Size(4, 3), 0);
+
+  ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 3), 0));
+
+  EXPECT_TRUE(stitcher_.IsComplete());
+  EXPECT_EQ(stitcher_.Pixels(), tile);
+}
+
+TEST_F(TileStitcherTest, ContiguousTilesAtFullScale) {
+  const Size page(8, 30);
+  ASSERT_TRUE(stitcher_.Begin(page, 1.0f));
+
+  for (int y = 0; y < page.height; y += 10) {
+    auto tile = MakeTile(Size(8, 10), y);
+    ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(8, 10), y));
+  }
+
+  ASSERT_TRUE(stitcher_.IsComplete());
+  EXPECT_EQ(stitcher_.Pixels(), MakeTile(page, 0));
+}
+
+TEST_F(TileStitcherTest, OverlappingLastTile) {
+  // 25 rows captured with a 10-row viewport: offsets 0, 10, then clamped to 15
+  const Size page(4, 25);
+  ASSERT_TRUE(stitcher_.Begin(page, 1.0f));
+
+  for (int y : {0, 10, 15}) {
+    auto tile = MakeTile(Size(4, 10), y);
+    ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 10), y));
+  }
+
+  ASSERT_TRUE(stitcher_.IsComplete());
+  EXPECT_EQ(stitcher_.Pixels(), MakeTile(page, 0));
+}
+
+TEST_F(TileStitcherTest, HalfScaleAveragesBlocks) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 20), 0.5f));
+
+  for (int y = 0; y < 20; y += 10) {
+    auto tile = MakeTile(Size(4, 10), y);
+    ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 10), y));
+  }
+
+  ASSERT_TRUE(stitcher_.IsComplete());
+  EXPECT_EQ(stitcher_.OutputSize(), Size(2, 10));
+
+  // Output row r averages page rows 2r and 2r+1 (rounded)
+  for (int r = 0; r < 10; r++) {
+    EXPECT_EQ(RedAt(stitcher_, 0, r), (2 * r + 2 * r + 1 + 1) / 2) << "row " << r;
+  }
+}
+
+TEST_F(TileStitcherTest, HalfScaleWithOddTileBoundary) {
+  // Tile boundary at row 7 splits the block for output row 3 (rows 6-7)
+  ASSERT_TRUE(stitcher_.Begin(Size(2, 14), 0.5f));
+
+  auto first = MakeTile(Size(2, 7), 0);
+  ASSERT_TRUE(stitcher_.AddTile(first.data(), Size(2, 7), 0));
+  EXPECT_EQ(stitcher_.NextPageRow(), 8);
+
+  auto second = MakeTile(Size(2, 7), 7);
+  ASSERT_TRUE(stitcher_.AddTile(second.data(), Size(2, 7), 7));
+
+  EXPECT_TRUE(stitcher_.IsComplete());
+}
+
+TEST_F(TileStitcherTest, GapIsRejected) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 30), 1.0f));
+  auto tile = MakeTile(Size(4, 10), 0);
+  ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 10), 0));
+
+  auto skipped = MakeTile(Size(4, 10), 20);
+  EXPECT_FALSE(stitcher_.AddTile(skipped.data(), Size(4, 10), 20));
+  EXPECT_FALSE(stitcher_.IsComplete());
+}
+
+TEST_F(TileStitcherTest, WidthMismatchIsRejected) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 10), 1.0f));
+  auto tile = MakeTile(Size(5, 10), 0);
+
+  EXPECT_FALSE(stitcher_.AddTile(tile.data(), Size(5, 10), 0));
+}
+
+TEST_F(TileStitcherTest, TileTallerThanPageIsClipped) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 5), 1.0f));
+  auto tile = MakeTile(Size(4, 10), 0);
+
+  ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 10), 0));
+
+  EXPECT_TRUE(stitcher_.IsComplete());
+  EXPECT_EQ(stitcher_.Pixels(), MakeTile(Size(4, 5), 0));
+}
+
+TEST_F(TileStitcherTest, TakePixelsReleasesImage) {
+  ASSERT_TRUE(stitcher_.Begin(Size(4, 4), 1.0f));
+  auto tile = MakeTile(Size(4, 4), 0);
+  ASSERT_TRUE(stitcher_.AddTile(tile.data(), Size(4, 4), 0));
+
+  auto pixels = stitcher_.TakePixels();
+
+  EXPECT_EQ(pixels, tile);
+  EXPECT_TRUE(stitcher_.Pixels().empty());
+}
@@ -0,0 +1,105 @@
+#include "resources/file_stream.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace athena::resources;
+namespace fs = std::filesystem;
+
+class FileStreamTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = fs::path(::testing::TempDir()) / "file_stream_test";
+    fs::remove_all(root_);
+    fs::create_directories(root_);
+  }
+
+  void TearDown() override { fs::remove_all(root_); }
+
+  std::string WriteFile(const std::string& name, const std::string& contents) {
+    std::ofstream file(root_ / name, std::ios::binary);
+    file << contents;
+    return (root_ / name).string();
+  }
+
+  fs::path root_;
+};
+
+TEST_F(FileStreamTest, ReadsAtOffsets) {
+  auto stream = FileStream::Open(WriteFile("video.mp4", "0123456789"));
+  ASSERT_NE(stream, nullptr);
+  EXPECT_EQ(stream->Size(), 10u);
+
+  char buffer[4];
+  EXPECT_EQ(stream->ReadAt(3, buffer, 4), 4);
+  EXPECT_EQ(std::string(buffer, 4), "3456");
+  EXPECT_EQ(stream->ReadAt(0, buffer, 2), 2);
+  EXPECT_EQ(std::string(buffer, 2), "01");
+}
+
+TEST_F(FileStreamTest, ShortReadOnlyAtEnd) {
+  auto stream = FileStream::Open(WriteFile("app.wasm", "0123456789"));
+  ASSERT_NE(stream, nullptr);
+
+  char buffer[8];
+  EXPECT_EQ(stream->ReadAt(7, buffer, 8), 3);
+  EXPECT_EQ(std::string(buffer, 3), "789");
+  EXPECT_EQ(stream->ReadAt(10, buffer, 8), 0);
+  EXPECT_EQ(stream->ReadAt(100, buffer, 8), 0);
+}
+
+TEST_F(FileStreamTest, RejectsMissingFilesAndDirectories) {
+  EXPECT_EQ(FileStream::Open((root_ / "missing.mp4").string()), nullptr);
+  EXPECT_EQ(FileStream::Open(root_.string()), nullptr);
+
+  auto empty = FileStream::Open(WriteFile("empty.map", ""));
+  ASSERT_NE(empty, nullptr);
+  EXPECT_EQ(empty->Size(), 0u);
+}
+
+TEST_F(FileStreamTest, ETagFollowsSize) {
+  auto first = FileStream::Open(WriteFile("a.mp4", "aaaa"));
+  auto same = FileStream::Open((root_ / "a.mp4").string());
+  auto other = FileStream::Open(WriteFile("b.mp4", "bbbbbbbb"));
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(same, nullptr);
+  ASSERT_NE(other, nullptr);
+
+  EXPECT_EQ(first->ETag(), same->ETag());
+  EXPECT_NE(first->ETag(), other->ETag());
+  EXPECT_EQ(first->ETag().front(), '"');
+  EXPECT_EQ(first->ETag().back(), '"');
+}
+
+TEST_F(FileStreamTest, ConcurrentReadsDoNotInterfere) {
+  std::string contents;
+  for (int i = 0; i < 4096; ++i) {
+    contents.push_back(static_cast<char>('a' + i % 26));
+  }
+  auto stream = FileStream::Open(WriteFile("big.bin", contents));
+  ASSERT_NE(stream, nullptr);
+
+  std::vector<std::thread> readers;
+  std::vector<char> ok(8, 0);  // Not vector<bool>: threads write neighbours
+  for (int t = 0; t < 8; ++t) {
+    readers.emplace_back([&, t] {
+      bool all_match = true;
+      char buffer[64];
+      for (uint64_t offset = t; offset + 64 <= contents.size(); offset += 61) {
+        all_match = all_match && stream->ReadAt(offset, buffer, 64) == 64 &&
+                    std::string(buffer, 64) == contents.substr(offset, 64);
+      }
+      ok[t] = all_match;
+    });
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  for (int t = 0; t < 8; ++t) {
+    EXPECT_TRUE(ok[t]) << t;
+  }
+}
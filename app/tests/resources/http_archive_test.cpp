@@ -0,0 +1,175 @@
+#include "resources/http_archive.h"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace athena::resources;
+
+namespace {
+
+void AddPage(HttpArchive& archive, const std::string& url, const std::string& body) {
+  archive.Add("GET", url, 200, "OK", "text/html", {{"Cache-Control", "no-cache"}}, body);
+}
+
+}  // namespace
+
+// ============================================================================
+// Recording Tests
+// ============================================================================
+
+TEST(HttpArchiveTest, FindsRecordedResponse) {
+  HttpArchive archive;
+  archive.Add("GET",
+              "https://example.com/app.js",
+              200,
+              "OK",
+              "application/javascript",
+              {{"Content-Type", "application/javascript"}, {"ETag", "\"v1\""}},
+              "console.log(1)");
+
+  auto entry = archive.Find("GET", "https://example.com/app.js");
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->status, 200);
+  EXPECT_EQ(entry->mime_type, "application/javascript");
+  EXPECT_EQ(*entry->body, "console.log(1)");
+  EXPECT_EQ(entry->headers.size(), 2u);
+
+  EXPECT_EQ(archive.Find("POST", "https://example.com/app.js"), nullptr);
+  EXPECT_EQ(archive.Find("GET", "https://example.com/other.js"), nullptr);
+}
+
+TEST(HttpArchiveTest, DropsTransferHeaders) {
+  EXPECT_FALSE(HttpArchive::ShouldRecordHeader("Content-Encoding"));
+  EXPECT_FALSE(HttpArchive::ShouldRecordHeader("content-length"));
+  EXPECT_FALSE(HttpArchive::ShouldRecordHeader("Transfer-Encoding"));
+  EXPECT_TRUE(HttpArchive::ShouldRecordHeader("Content-Type"));
+  EXPECT_TRUE(HttpArchive::ShouldRecordHeader("Set-Cookie"));
+
+  HttpArchive archive;
+  archive.Add("GET",
+              "https://example.com/",
+              200,
+              "OK",
+              "text/html",
+              {{"Content-Encoding", "br"}, {"Content-Length", "17"}, {"Vary", "Accept"}},
+              "<html></html>");
+  auto entry = archive.Find("GET", "https://example.com/");
+  ASSERT_NE(entry, nullptr);
+  ASSERT_EQ(entry->headers.size(), 1u);
+  EXPECT_EQ(entry->headers[0].first, "Vary");
+}
+
+TEST(HttpArchiveTest, LaterResponseReplacesEarlier) {
+  HttpArchive archive;
+  AddPage(archive, "https://example.com/", "first");
+  AddPage(archive, "https://example.com/", "second");
+
+  EXPECT_EQ(archive.Size(), 1u);
+  EXPECT_EQ(*archive.Find("GET", "https://example.com/")->body, "second");
+}
+
+TEST(HttpArchiveTest, IdenticalBodiesAreStoredOnce) {
+  HttpArchive archive;
+  AddPage(archive, "https://a.example/pixel.gif", "GIF89a");
+  AddPage(archive, "https://b.example/pixel.gif", "GIF89a");
+  AddPage(archive, "https://c.example/", "<html></html>");
+
+  auto stats = archive.GetStats();
+  EXPECT_EQ(stats.entries, 3u);
+  EXPECT_EQ(stats.bodies, 2u);
+  EXPECT_EQ(archive.Find("GET", "https://a.example/pixel.gif")->body,
+            archive.Find("GET", "https://b.example/pixel.gif")->body);
+}
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+TEST(HttpArchiveTest, IgnoresFragments) {
+  HttpArchive archive;
+  AddPage(archive, "https://example.com/docs#intro", "docs");
+
+  ASSERT_NE(archive.Find("GET", "https://example.com/docs"), nullptr);
+  ASSERT_NE(archive.Find("GET", "https://example.com/docs#usage"), nullptr);
+}
+
+TEST(HttpArchiveTest, UnknownQueryFallsBackToSamePath) {
+  HttpArchive archive;
+  AddPage(archive, "https://example.com/feed?t=200", "t200");
+  AddPage(archive, "https://example.com/feed?t=100", "t100");
+  AddPage(archive, "https://example.com/feeds", "other");
+
+  EXPECT_EQ(*archive.Find("GET", "https://example.com/feed?t=200")->body, "t200");
+  // Cache buster never recorded: lowest recorded query wins, deterministically
+  EXPECT_EQ(*archive.Find("GET", "https://example.com/feed?t=999")->body, "t100");
+  EXPECT_EQ(*archive.Find("GET", "https://example.com/feed")->body, "t100");
+
+  AddPage(archive, "https://example.com/feed", "bare");
+  EXPECT_EQ(*archive.Find("GET", "https://example.com/feed?t=999")->body, "bare");
+  EXPECT_EQ(archive.Find("GET", "https://example.com/fee?t=1"), nullptr);
+}
+
+// ============================================================================
+// Serialization Tests
+// ============================================================================
+
+TEST(HttpArchiveTest, SerializeRoundTrip) {
+  HttpArchive archive;
+  archive.Add("GET",
+              "https://example.com/",
+              301,
+              "Moved Permanently",
+              "",
+              {{"Location", "https://www.example.com/"}},
+              "");
+  AddPage(archive, "https://www.example.com/", std::string("bin\0ary", 7));
+  AddPage(archive, "https://www.example.com/copy", std::string("bin\0ary", 7));
+
+  auto parsed = HttpArchive::Parse(archive.Serialize());
+  ASSERT_TRUE(parsed.IsOk()) << parsed.GetError().Message();
+  const HttpArchive& copy = *parsed.Value();
+
+  EXPECT_EQ(copy.GetStats().entries, 3u);
+  EXPECT_EQ(copy.GetStats().bodies, 2u);
+  auto redirect = copy.Find("GET", "https://example.com/");
+  ASSERT_NE(redirect, nullptr);
+  EXPECT_EQ(redirect->status, 301);
+  EXPECT_EQ(redirect->status_text, "Moved Permanently");
+  ASSERT_EQ(redirect->headers.size(), 1u);
+  EXPECT_EQ(redirect->headers[0].second, "https://www.example.com/");
+  EXPECT_EQ(*copy.Find("GET", "https://www.example.com/")->body, std::string("bin\0ary", 7));
+
+  // Serialization is deterministic, so archives can be diffed and cached
+  EXPECT_EQ(copy.Serialize(), archive.Serialize());
+}
+
+TEST(HttpArchiveTest, RejectsCorruptData) {
+  HttpArchive archive;
+  AddPage(archive, "https://example.com/", "hello");
+  const std::string data = archive.Serialize();
+
+  EXPECT_TRUE(HttpArchive::Parse("").IsError());
+  EXPECT_TRUE(HttpArchive::Parse("GIF89a").IsError());
+  EXPECT_TRUE(HttpArchive::Parse(data.substr(0, data.size() - 1)).IsError());
+  EXPECT_TRUE(HttpArchive::Parse(data + "x").IsError());
+
+  // Entry pointing past the body table
+  std::string bad_index = data;
+  bad_index[bad_index.size() - 4] = 5;
+  EXPECT_TRUE(HttpArchive::Parse(bad_index).IsError());
+}
+
+TEST(HttpArchiveTest, SaveAndLoadFile) {
+  const std::string path = ::testing::TempDir() + "http_archive_test.athar";
+  HttpArchive archive;
+  AddPage(archive, "https://example.com/", "<h1>offline</h1>");
+  ASSERT_TRUE(archive.SaveToFile(path).IsOk());
+
+  auto loaded = HttpArchive::LoadFromFile(path);
+  ASSERT_TRUE(loaded.IsOk());
+  EXPECT_EQ(*loaded.Value()->Find("GET", "https://example.com/")->body, "<h1>offline</h1>");
+  std::remove(path.c_str());
+
+  EXPECT_TRUE(HttpArchive::LoadFromFile(path).IsError());
+}
@@ -0,0 +1,77 @@
+#include "resources/http_range.h"
+
+#include <gtest/gtest.h>
+
+using namespace athena::resources;
+
+// ============================================================================
+// Range Tests
+// ============================================================================
+
+TEST(HttpRangeTest, ParsesClosedAndOpenRanges) {
+  ByteRange range;
+  ASSERT_EQ(ParseRangeHeader("bytes=0-99", 1000, range), RangeStatus::kSatisfiable);
+  EXPECT_EQ(range.first, 0u);
+  EXPECT_EQ(range.last, 99u);
+  EXPECT_EQ(range.Length(), 100u);
+
+  ASSERT_EQ(ParseRangeHeader("bytes=500-", 1000, range), RangeStatus::kSatisfiable);
+  EXPECT_EQ(range.first, 500u);
+  EXPECT_EQ(range.last, 999u);
+}
+
+TEST(HttpRangeTest, ClampsLastPositionToSize) {
+  ByteRange range;
+  ASSERT_EQ(ParseRangeHeader("bytes=900-5000", 1000, range), RangeStatus::kSatisfiable);
+  EXPECT_EQ(range.last, 999u);
+}
+
+TEST(HttpRangeTest, ParsesSuffixRanges) {
+  ByteRange range;
+  ASSERT_EQ(ParseRangeHeader("bytes=-100", 1000, range), RangeStatus::kSatisfiable);
+  EXPECT_EQ(range.first, 900u);
+  EXPECT_EQ(range.last, 999u);
+
+  // Longer than the resource: the whole resource
+  ASSERT_EQ(ParseRangeHeader("bytes=-5000", 1000, range), RangeStatus::kSatisfiable);
+  EXPECT_EQ(range.first, 0u);
+
+  EXPECT_EQ(ParseRangeHeader("bytes=-0", 1000, range), RangeStatus::kUnsatisfiable);
+}
+
+TEST(HttpRangeTest, RangePastEndIsUnsatisfiable) {
+  ByteRange range;
+  EXPECT_EQ(ParseRangeHeader("bytes=1000-", 1000, range), RangeStatus::kUnsatisfiable);
+  EXPECT_EQ(ParseRangeHeader("bytes=0-", 0, range), RangeStatus::kUnsatisfiable);
+  EXPECT_EQ(FormatUnsatisfiedRange(1000), "bytes */1000");
+}
+
+TEST(HttpRangeTest, IgnoresMalformedAndMultipleRanges) {
+  ByteRange range;
+  EXPECT_EQ(ParseRangeHeader("", 1000, range), RangeStatus::kNone);
+  EXPECT_EQ(ParseRangeHeader("items=0-5", 1000, range), RangeStatus::kNone);
+  EXPECT_EQ(ParseRangeHeader("bytes=5", 1000, range), RangeStatus::kNone);
+  EXPECT_EQ(ParseRangeHeader("bytes=9-5", 1000, range), RangeStatus::kNone);
+  EXPECT_EQ(ParseRangeHeader("bytes=+1-5", 1000, range), RangeStatus::kNone);
+  EXPECT_EQ(ParseRangeHeader("bytes=0-1,5-9", 1000, range), RangeStatus::kNone);
+}
+
+TEST(HttpRangeTest, FormatsContentRange) {
+  ByteRange range;
+  range.first = 100;
+  range.last = 199;
+  EXPECT_EQ(FormatContentRange(range, 1000), "bytes 100-199/1000");
+}
+
+// ============================================================================
+// Conditional Request Tests
+// ============================================================================
+
+TEST(HttpRangeTest, IfNoneMatchUsesWeakComparison) {
+  EXPECT_TRUE(IfNoneMatchMatches("\"abc\"", "\"abc\""));
+  EXPECT_TRUE(IfNoneMatchMatches("W/\"abc\"", "\"abc\""));
+  EXPECT_TRUE(IfNoneMatchMatches("\"old\", \"abc\"", "\"abc\""));
+  EXPECT_TRUE(IfNoneMatchMatches(" * ", "\"abc\""));
+  EXPECT_FALSE(IfNoneMatchMatches("\"old\"", "\"abc\""));
+  EXPECT_FALSE(IfNoneMatchMatches("", "\"abc\""));
+}
@@ -0,0 +1,201 @@
+#include "resources/resource_bundle.h"
+#include "resources/resource_cache.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace athena::resources;
+namespace fs = std::filesystem;
+
+namespace {
+
+std::shared_ptr<const ResourceBundle> Load(const std::string& bytes) {
+  auto bundle = ResourceBundle::FromMemory(bytes);
+  EXPECT_TRUE(bundle.IsOk()) << (bundle ? "" : bundle.GetError().Message());
+  return bundle ? bundle.Value() : nullptr;
+}
+
+}  // namespace
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+TEST(ResourceBundleTest, FindsEveryPackedFile) {
+  ResourceBundleWriter writer;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(writer.Add("assets/chunk-" + std::to_string(i) + ".js",
+                           "console.log(" + std::to_string(i) + ");"));
+  }
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  auto bundle = Load(bytes.Value());
+  ASSERT_NE(bundle, nullptr);
+
+  EXPECT_EQ(bundle->Size(), 1000u);
+  for (int i = 0; i < 1000; ++i) {
+    auto entry = bundle->Find("assets/chunk-" + std::to_string(i) + ".js");
+    ASSERT_TRUE(entry.has_value()) << i;
+    EXPECT_EQ(entry->data, "console.log(" + std::to_string(i) + ");");
+  }
+}
+
+TEST(ResourceBundleTest, MissingPathsAreNotFound) {
+  ResourceBundleWriter writer;
+  writer.Add("index.html", "<p>home</p>");
+  writer.Add("favicon.ico", "icon");
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  auto bundle = Load(bytes.Value());
+  ASSERT_NE(bundle, nullptr);
+
+  // Every path lands on some slot; the stored path must still match
+  EXPECT_FALSE(bundle->Find("index.htm").has_value());
+  EXPECT_FALSE(bundle->Find("").has_value());
+  EXPECT_FALSE(bundle->Find("assets/index.html").has_value());
+}
+
+TEST(ResourceBundleTest, EmptyBundle) {
+  auto bytes = ResourceBundleWriter().Build();
+  ASSERT_TRUE(bytes.IsOk());
+  auto bundle = Load(bytes.Value());
+  ASSERT_NE(bundle, nullptr);
+
+  EXPECT_EQ(bundle->Size(), 0u);
+  EXPECT_FALSE(bundle->Find("index.html").has_value());
+}
+
+TEST(ResourceBundleTest, KeepsContentsAlignedAndHashed) {
+  ResourceBundleWriter writer;
+  writer.Add("a.txt", "x");
+  writer.Add("b.txt", std::string("\0binary\0", 8));
+  writer.Add("empty.txt", "");
+  EXPECT_FALSE(writer.Add("a.txt", "duplicate"));
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  auto bundle = Load(bytes.Value());
+  ASSERT_NE(bundle, nullptr);
+
+  for (const char* path : {"a.txt", "b.txt", "empty.txt"}) {
+    auto entry = bundle->Find(path);
+    ASSERT_TRUE(entry.has_value()) << path;
+    EXPECT_EQ((entry->data.data() - bytes.Value().data()) % 16, 0) << path;
+    EXPECT_EQ(entry->content_hash, HashResourceContents(entry->data)) << path;
+  }
+  EXPECT_EQ(bundle->Find("a.txt")->data, "x");
+  EXPECT_EQ(bundle->Find("b.txt")->data, std::string("\0binary\0", 8));
+  EXPECT_TRUE(bundle->Find("empty.txt")->data.empty());
+}
+
+// ============================================================================
+// Validation Tests
+// ============================================================================
+
+TEST(ResourceBundleTest, RejectsCorruptData) {
+  ResourceBundleWriter writer;
+  writer.Add("index.html", "<p>home</p>");
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  const std::string& good = bytes.Value();
+
+  EXPECT_FALSE(ResourceBundle::FromMemory("").IsOk());
+  EXPECT_FALSE(ResourceBundle::FromMemory("ATHAR\x01 not a bundle").IsOk());
+  EXPECT_FALSE(ResourceBundle::FromMemory(std::string_view(good).substr(0, 24)).IsOk());
+
+  // Data pointing past the end of the file
+  std::string bad_entry = good;
+  bad_entry[16 + 4 + 8 + 7] = '\x7F';
+  EXPECT_FALSE(ResourceBundle::FromMemory(bad_entry).IsOk());
+
+  // Displacement pointing at a slot that does not exist
+  std::string bad_displacement = good;
+  bad_displacement.replace(16, 4, "\xF0\xFF\xFF\xFF", 4);
+  EXPECT_FALSE(ResourceBundle::FromMemory(bad_displacement).IsOk());
+}
+
+// ============================================================================
+// ResourceCache Integration Tests
+// ============================================================================
+
+TEST(ResourceBundleTest, CachePrefersBundleOverLooseFiles) {
+  fs::path root = fs::path(::testing::TempDir()) / "resource_bundle_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+  {
+    std::ofstream file(root / "index.html", std::ios::binary);
+    file << "loose";
+  }
+  {
+    std::ofstream file(root / "only-loose.css", std::ios::binary);
+    file << "body {}";
+  }
+
+  ResourceBundleWriter writer;
+  writer.Add("index.html", "packed");
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  fs::path bundle_path = root / "homepage.bundle";
+  {
+    std::ofstream file(bundle_path, std::ios::binary);
+    file << bytes.Value();
+  }
+  auto bundle = ResourceBundle::Open(bundle_path.string());
+  ASSERT_TRUE(bundle.IsOk());
+  ResourceCache cache({root.string()}, bundle.Value());
+
+  auto packed = cache.Get("index.html");
+  ASSERT_NE(packed, nullptr);
+  EXPECT_EQ(packed->data, "packed");
+  EXPECT_EQ(packed->mime_type, "text/html");
+
+  // Same ETag as a loose copy of the same bytes would get
+  ResourceCache loose_cache({root.string()});
+  {
+    std::ofstream file(root / "index.html", std::ios::binary | std::ios::trunc);
+    file << "packed";
+  }
+  EXPECT_EQ(packed->etag, loose_cache.Get("index.html")->etag);
+
+  auto fallback = cache.Get("only-loose.css");
+  ASSERT_NE(fallback, nullptr);
+  EXPECT_EQ(fallback->data, "body {}");
+  EXPECT_EQ(cache.Get("../homepage.bundle"), nullptr);
+
+  fs::remove_all(root);
+}
+
+TEST(ResourceBundleTest, CachePrefersLooseFilesNewerThanBundle) {
+  fs::path root = fs::path(::testing::TempDir()) / "resource_bundle_newer_test";
+  fs::remove_all(root);
+  fs::create_directories(root);
+
+  ResourceBundleWriter writer;
+  writer.Add("index.html", "packed");
+  writer.Add("app.css", "packed");
+  auto bytes = writer.Build();
+  ASSERT_TRUE(bytes.IsOk());
+  auto bundle = ResourceBundle::FromMemory(bytes.Value());
+  ASSERT_TRUE(bundle.IsOk());
+
+  // index.html was rebuilt after packing; app.css predates the bundle
+  const auto bundle_time = fs::file_time_type::clock::now();
+  {
+    std::ofstream file(root / "index.html", std::ios::binary);
+    file << "rebuilt";
+  }
+  {
+    std::ofstream file(root / "app.css", std::ios::binary);
+    file << "old";
+  }
+  fs::last_write_time(root / "index.html", bundle_time + std::chrono::hours(1));
+  fs::last_write_time(root / "app.css", bundle_time - std::chrono::hours(1));
+
+  ResourceCache cache({root.string()}, bundle.Value(), bundle_time);
+  EXPECT_EQ(cache.Get("index.html")->data, "rebuilt");
+  EXPECT_EQ(cache.Get("app.css")->data, "packed");
+
+  fs::remove_all(root);
+}
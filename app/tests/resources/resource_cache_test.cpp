@@ -0,0 +1,151 @@
+#include "resources/resource_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace athena::resources;
+namespace fs = std::filesystem;
+
+class ResourceCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    root_ = fs::path(::testing::TempDir()) / "resource_cache_test";
+    fs::remove_all(root_);
+    fs::create_directories(root_ / "assets");
+  }
+
+  void TearDown() override { fs::remove_all(root_); }
+
+  void WriteFile(const std::string& path, const std::string& contents) {
+    std::ofstream file(root_ / path, std::ios::binary);
+    file << contents;
+  }
+
+  fs::path root_;
+};
+
+// ============================================================================
+// Lookup Tests
+// ============================================================================
+
+TEST_F(ResourceCacheTest, MapsFileContents) {
+  WriteFile("index.html", "<!DOCTYPE html><p>home</p>");
+  ResourceCache cache({root_.string()});
+
+  auto resource = cache.Get("index.html");
+  ASSERT_NE(resource, nullptr);
+  EXPECT_EQ(resource->data, "<!DOCTYPE html><p>home</p>");
+  EXPECT_EQ(resource->mime_type, "text/html");
+  EXPECT_EQ(cache.Get("missing.html"), nullptr);
+}
+
+TEST_F(ResourceCacheTest, ServesRepeatRequestsFromCache) {
+  WriteFile("index.html", "v1");
+  ResourceCache cache({root_.string()});
+
+  auto first = cache.Get("index.html");
+  fs::remove(root_ / "index.html");  // Replaced like scripts/build-homepage.sh does
+  WriteFile("index.html", "v2");
+  auto second = cache.Get("index.html");
+
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(second->data, "v1");
+  auto stats = cache.GetStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.entries, 1u);
+  EXPECT_EQ(stats.mapped_bytes, 2u);
+}
+
+TEST_F(ResourceCacheTest, SearchesRootsInOrder) {
+  fs::path fallback = root_ / "fallback";
+  fs::create_directories(fallback);
+  WriteFile("fallback/app.js", "fallback");
+  WriteFile("fallback/only.js", "only");
+  WriteFile("app.js", "primary");
+  ResourceCache cache({root_.string(), fallback.string()});
+
+  EXPECT_EQ(cache.Get("app.js")->data, "primary");
+  EXPECT_EQ(cache.Get("only.js")->data, "only");
+}
+
+TEST_F(ResourceCacheTest, RejectsPathsOutsideBundle) {
+  EXPECT_TRUE(ResourceCache::IsSafePath("assets/app.js"));
+  EXPECT_TRUE(ResourceCache::IsSafePath("a..b/c"));
+  EXPECT_FALSE(ResourceCache::IsSafePath("../secret"));
+  EXPECT_FALSE(ResourceCache::IsSafePath("assets/../../secret"));
+  EXPECT_FALSE(ResourceCache::IsSafePath("/etc/passwd"));
+  EXPECT_FALSE(ResourceCache::IsSafePath("assets\\app.js"));
+
+  fs::create_directories(root_ / "bundle");
+  WriteFile("secret.txt", "secret");
+  ResourceCache cache({(root_ / "bundle").string()});
+  EXPECT_EQ(cache.Get("../secret.txt"), nullptr);
+}
+
+TEST_F(ResourceCacheTest, ServesEmptyFiles) {
+  WriteFile("empty.txt", "");
+  ResourceCache cache({root_.string()});
+
+  auto resource = cache.Get("empty.txt");
+  ASSERT_NE(resource, nullptr);
+  EXPECT_TRUE(resource->data.empty());
+  EXPECT_EQ(cache.Get("assets"), nullptr);  // Directories are not resources
+}
+
+TEST_F(ResourceCacheTest, StreamsLargeFilesInsteadOfMapping) {
+  WriteFile("assets/intro.mp4", std::string(ResourceCache::kMaxMappedSize + 1, 'v'));
+  WriteFile("small.mp4", "v");
+  ResourceCache cache({root_.string()});
+
+  auto large = cache.Get("assets/intro.mp4");
+  ASSERT_NE(large, nullptr);
+  EXPECT_TRUE(large->data.empty());
+  EXPECT_EQ(large->file_path, (root_ / "assets/intro.mp4").string());
+  EXPECT_EQ(large->mime_type, "video/mp4");
+
+  auto small = cache.Get("small.mp4");
+  ASSERT_NE(small, nullptr);
+  EXPECT_TRUE(small->file_path.empty());
+  EXPECT_EQ(cache.GetStats().mapped_bytes, 1u);
+}
+
+// ============================================================================
+// Header Tests
+// ============================================================================
+
+TEST_F(ResourceCacheTest, ETagFollowsContents) {
+  WriteFile("a.js", "same");
+  WriteFile("b.js", "same");
+  WriteFile("c.js", "different");
+  ResourceCache cache({root_.string()});
+
+  const std::string etag = cache.Get("a.js")->etag;
+  EXPECT_EQ(etag.front(), '"');
+  EXPECT_EQ(etag.back(), '"');
+  EXPECT_EQ(cache.Get("b.js")->etag, etag);
+  EXPECT_NE(cache.Get("c.js")->etag, etag);
+}
+
+TEST_F(ResourceCacheTest, DetectsFingerprintedAssets) {
+  EXPECT_TRUE(ResourceCache::IsFingerprinted("assets/index-BxQ3k2lz.js"));
+  EXPECT_TRUE(ResourceCache::IsFingerprinted("assets/vendor-4f9a1c2e.css"));
+  EXPECT_FALSE(ResourceCache::IsFingerprinted("index.html"));
+  EXPECT_FALSE(ResourceCache::IsFingerprinted("assets/logo.svg"));
+  EXPECT_FALSE(ResourceCache::IsFingerprinted("assets/my-component.js"));
+  EXPECT_FALSE(ResourceCache::IsFingerprinted("fonts/inter-4f9a1c2e.woff2"));
+
+  WriteFile("assets/index-BxQ3k2lz.js", "x");
+  ResourceCache cache({root_.string()});
+  EXPECT_TRUE(cache.Get("assets/index-BxQ3k2lz.js")->immutable);
+}
+
+TEST_F(ResourceCacheTest, MimeTypesFromExtension) {
+  EXPECT_EQ(ResourceCache::GetMimeType("index.html"), "text/html");
+  EXPECT_EQ(ResourceCache::GetMimeType("assets/app.MJS"), "application/javascript");
+  EXPECT_EQ(ResourceCache::GetMimeType("module.wasm"), "application/wasm");
+  EXPECT_EQ(ResourceCache::GetMimeType("v.d/README"), "application/octet-stream");
+  EXPECT_EQ(ResourceCache::GetMimeType("data.bin"), "application/octet-stream");
+}
@@ -0,0 +1,303 @@
+#include "runtime/http_response_parser.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace athena::runtime;
+
+namespace {
+
+// Parser plus the body it produced
+struct Parsed {
+  std::string body;
+  std::vector<std::string_view> fragments;
+  HttpResponseParser parser;
+
+  Parsed()
+      : parser([this](std::string_view fragment) {
+          body.append(fragment);
+          fragments.push_back(fragment);
+        }) {}
+};
+
+// Feed |response| in pieces of the given sizes (the last piece takes the rest)
+std::string ParseInPieces(const std::string& response,
+                          const std::vector<size_t>& sizes,
+                          HttpResponseParser* out_state = nullptr) {
+  std::string body;
+  HttpResponseParser parser([&body](std::string_view fragment) { body.append(fragment); });
+  size_t pos = 0;
+  for (size_t size : sizes) {
+    size = std::min(size, response.size() - pos);
+    parser.Feed(std::string_view(response).substr(pos, size));
+    pos += size;
+  }
+  parser.Feed(std::string_view(response).substr(pos));
+  EXPECT_TRUE(parser.IsComplete()) << parser.GetError();
+  if (out_state) {
+    *out_state = parser;
+  }
+  return body;
+}
+
+std::string Chunked(const std::vector<std::string>& chunks, const std::string& trailers = "") {
+  std::string out = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n";
+  char size[32];
+  for (const std::string& chunk : chunks) {
+    std::snprintf(size, sizeof(size), "%zx\r\n", chunk.size());
+    out += size + chunk + "\r\n";
+  }
+  return out + "0\r\n" + trailers + "\r\n";
+}
+
+}  // namespace
+
+// ============================================================================
+// Framing Tests
+// ============================================================================
+
+TEST(HttpResponseParserTest, ContentLengthBody) {
+  Parsed parsed;
+  std::string response =
+      "HTTP/1.1 201 Created\r\nContent-Type: application/json\r\nContent-Length: 11\r\n\r\n"
+      "{\"ok\":true}";
+
+  EXPECT_EQ(parsed.parser.Feed(response), response.size());
+  EXPECT_TRUE(parsed.parser.IsComplete());
+  EXPECT_EQ(parsed.parser.StatusCode(), 201);
+  EXPECT_EQ(parsed.parser.GetHeader("content-type").value_or(""), "application/json");
+  EXPECT_EQ(parsed.parser.ContentLength().value_or(0), 11u);
+  EXPECT_EQ(parsed.body, "{\"ok\":true}");
+  EXPECT_TRUE(parsed.parser.KeepAlive());
+
+  // Zero-copy: the body is a view into the fed buffer
+  ASSERT_EQ(parsed.fragments.size(), 1u);
+  EXPECT_EQ(parsed.fragments[0].data(), response.data() + response.size() - 11);
+}
+
+TEST(HttpResponseParserTest, ChunkedBodyWithExtensionsAndTrailers) {
+  Parsed parsed;
+  std::string response =
+      "HTTP/1.1 200 OK\r\nTransfer-Encoding: gzip, Chunked\r\n\r\n"
+      "5;name=value\r\nhello\r\nA\r\n, chunked!\r\n0\r\nX-Checksum: 42\r\n\r\n";
+
+  EXPECT_EQ(parsed.parser.Feed(response), response.size());
+  EXPECT_TRUE(parsed.parser.IsComplete()) << parsed.parser.GetError();
+  EXPECT_EQ(parsed.body, "hello, chunked!");
+  EXPECT_FALSE(parsed.parser.ContentLength().has_value());
+  EXPECT_TRUE(parsed.parser.KeepAlive());
+}
+
+TEST(HttpResponseParserTest, CloseDelimitedBody) {
+  Parsed parsed;
+  parsed.parser.Feed("HTTP/1.1 200 OK\r\n\r\nstreamed ");
+  parsed.parser.Feed("until close");
+  EXPECT_FALSE(parsed.parser.IsComplete());
+
+  EXPECT_TRUE(parsed.parser.FinishAtEof());
+  EXPECT_EQ(parsed.body, "streamed until close");
+  EXPECT_FALSE(parsed.parser.KeepAlive());
+
+  // EOF in the middle of a framed body is an error
+  Parsed truncated;
+  truncated.parser.Feed("HTTP/1.1 200 OK\r\nContent-Length: 10\r\n\r\nshort");
+  EXPECT_FALSE(truncated.parser.FinishAtEof());
+  EXPECT_TRUE(truncated.parser.HasError());
+}
+
+TEST(HttpResponseParserTest, BodilessAndInterimResponses) {
+  Parsed parsed;
+  std::string response =
+      "HTTP/1.1 100 Continue\r\n\r\n"
+      "HTTP/1.1 204 No Content\r\nContent-Length: 99\r\n\r\n";
+  EXPECT_EQ(parsed.parser.Feed(response), response.size());
+  EXPECT_TRUE(parsed.parser.IsComplete());
+  EXPECT_EQ(parsed.parser.StatusCode(), 204);
+  EXPECT_TRUE(parsed.body.empty());
+
+  Parsed not_modified;
+  not_modified.parser.Feed("HTTP/1.1 304 Not Modified\r\nETag: \"x\"\r\n\r\n");
+  EXPECT_TRUE(not_modified.parser.IsComplete());
+  EXPECT_TRUE(not_modified.parser.KeepAlive());
+}
+
+TEST(HttpResponseParserTest, StopsAtEndOfResponseForPipelining) {
+  Parsed parsed;
+  std::string first = "HTTP/1.1 200 OK\r\nContent-Length: 3\r\n\r\none";
+  std::string second = Chunked({"two"});
+  std::string both = first + second;
+
+  size_t consumed = parsed.parser.Feed(both);
+  EXPECT_EQ(consumed, first.size());
+  EXPECT_EQ(parsed.body, "one");
+
+  parsed.body.clear();
+  parsed.parser.Reset();
+  EXPECT_EQ(parsed.parser.Feed(std::string_view(both).substr(consumed)), second.size());
+  EXPECT_TRUE(parsed.parser.IsComplete());
+  EXPECT_EQ(parsed.body, "two");
+}
+
+TEST(HttpResponseParserTest, KeepAliveRules) {
+  Parsed close;
+  close.parser.Feed("HTTP/1.1 200 OK\r\nConnection: Close\r\nContent-Length: 0\r\n\r\n");
+  EXPECT_TRUE(close.parser.IsComplete());
+  EXPECT_FALSE(close.parser.KeepAlive());
+
+  Parsed http10;
+  http10.parser.Feed("HTTP/1.0 200 OK\r\nContent-Length: 0\r\n\r\n");
+  EXPECT_FALSE(http10.parser.KeepAlive());
+
+  Parsed http10_keep_alive;
+  http10_keep_alive.parser.Feed(
+      "HTTP/1.0 200 OK\r\nConnection: keep-alive\r\nContent-Length: 0\r\n\r\n");
+  EXPECT_TRUE(http10_keep_alive.parser.KeepAlive());
+}
+
+TEST(HttpResponseParserTest, RejectsMalformedResponses) {
+  const char* cases[] = {
+      "SSH-2.0-OpenSSH\r\n\r\n",
+      "HTTP/2 200 OK\r\n\r\n",
+      "HTTP/1.1 2x0 OK\r\n\r\n",
+      "HTTP/1.1 200 OK\r\nno colon here\r\n\r\n",
+      "HTTP/1.1 200 OK\r\nContent-Length: 5\r\nContent-Length: 6\r\n\r\n",
+      "HTTP/1.1 200 OK\r\nContent-Length: -1\r\n\r\n",
+      "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nzz\r\n",
+      "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\nffffffffffffffff\r\n",
+      "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nabcX\r\n",
+  };
+  for (const char* response : cases) {
+    Parsed parsed;
+    parsed.parser.Feed(response);
+    EXPECT_TRUE(parsed.parser.HasError()) << response;
+    EXPECT_FALSE(parsed.parser.GetError().empty()) << response;
+  }
+
+  // Header flood without ever finishing the header block
+  Parsed flood;
+  flood.parser.Feed("HTTP/1.1 200 OK\r\n");
+  std::string header = "X-Filler: " + std::string(1000, 'a') + "\r\n";
+  for (int i = 0; i < 100 && !flood.parser.HasError(); ++i) {
+    flood.parser.Feed(header);
+  }
+  EXPECT_TRUE(flood.parser.HasError());
+}
+
+// ============================================================================
+// Fuzz-Style Tests
+// ============================================================================
+
+TEST(HttpResponseParserTest, EverySplitPointGivesSameBody) {
+  const std::string responses[] = {
+      "HTTP/1.1 200 OK\r\nContent-Length: 12\r\nX-Test: 1\r\n\r\nhello world!",
+      Chunked({"data: {\"type\":\"chunk\"}\n\n", "x", "0123456789abcdef"}, "X-T: 1\r\n"),
+  };
+  for (const std::string& response : responses) {
+    HttpResponseParser whole;
+    std::string expected = ParseInPieces(response, {}, &whole);
+
+    for (size_t split = 0; split <= response.size(); ++split) {
+      EXPECT_EQ(ParseInPieces(response, {split}), expected) << "split at " << split;
+    }
+    // One byte at a time
+    EXPECT_EQ(ParseInPieces(response, std::vector<size_t>(response.size(), 1)), expected);
+  }
+}
+
+TEST(HttpResponseParserTest, RandomChunkingsAndReadSizes) {
+  std::mt19937 rng(12345);
+  for (int round = 0; round < 200; ++round) {
+    std::vector<std::string> chunks;
+    std::string expected;
+    int chunk_count = static_cast<int>(rng() % 20);
+    for (int i = 0; i < chunk_count; ++i) {
+      std::string chunk(1 + rng() % 300, '\0');
+      for (char& c : chunk) {
+        c = static_cast<char>(rng());  // Binary, including CR and LF
+      }
+      expected += chunk;
+      chunks.push_back(std::move(chunk));
+    }
+    std::string response = Chunked(chunks);
+
+    std::vector<size_t> reads;
+    for (size_t total = 0; total < response.size();) {
+      reads.push_back(1 + rng() % 64);
+      total += reads.back();
+    }
+    EXPECT_EQ(ParseInPieces(response, reads), expected) << "round " << round;
+  }
+}
+
+TEST(HttpResponseParserTest, MutatedInputNeverOverrunsOrHangs) {
+  std::mt19937 rng(777);
+  const std::string seed = Chunked({"hello", "world"}, "X-T: 1\r\n") +
+                           "HTTP/1.1 200 OK\r\nContent-Length: 4\r\n\r\nnext";
+  for (int round = 0; round < 2000; ++round) {
+    std::string input = seed;
+    int mutations = 1 + static_cast<int>(rng() % 8);
+    for (int i = 0; i < mutations; ++i) {
+      size_t at = rng() % input.size();
+      switch (rng() % 3) {
+        case 0:
+          input[at] = static_cast<char>(rng());
+          break;
+        case 1:
+          input.erase(at, 1 + rng() % 4);
+          break;
+        default:
+          input.insert(at, 1 + rng() % 4, static_cast<char>(rng()));
+          break;
+      }
+      if (input.empty()) {
+        input = "x";
+      }
+    }
+
+    HttpResponseParser parser([&input](std::string_view fragment) {
+      // Fragments must lie inside the fed buffer
+      ASSERT_GE(fragment.data(), input.data());
+      ASSERT_LE(fragment.data() + fragment.size(), input.data() + input.size());
+    });
+    size_t consumed = parser.Feed(input);
+    EXPECT_LE(consumed, input.size());
+    if (consumed < input.size()) {
+      EXPECT_TRUE(parser.IsComplete() || parser.HasError());
+    }
+    parser.FinishAtEof();
+    EXPECT_TRUE(parser.IsComplete() || parser.HasError());
+  }
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// A 64 MB chunked stream in 16 KB socket-sized reads. Throughput is reported,
+// not asserted, since it depends on the machine.
+
+TEST(HttpResponseParserBenchmark, ChunkedThroughput) {
+  std::vector<std::string> chunks(4096, std::string(16 * 1024, 'x'));
+  std::string response = Chunked(chunks);
+  const size_t kReadSize = 16 * 1024;
+
+  uint64_t body_bytes = 0;
+  HttpResponseParser parser(
+      [&body_bytes](std::string_view fragment) { body_bytes += fragment.size(); });
+  auto start = std::chrono::steady_clock::now();
+  for (size_t pos = 0; pos < response.size(); pos += kReadSize) {
+    parser.Feed(std::string_view(response).substr(pos, kReadSize));
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  double mb_per_second = static_cast<double>(response.size()) / (1024 * 1024) / seconds;
+  std::cout << "[ BENCH    ] chunked parse: " << mb_per_second << " MB/s" << std::endl;
+  ::testing::Test::RecordProperty("mb_per_second", std::to_string(mb_per_second));
+
+  EXPECT_TRUE(parser.IsComplete());
+  EXPECT_EQ(body_bytes, 4096u * 16 * 1024);
+}
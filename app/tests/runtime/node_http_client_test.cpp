@@ -0,0 +1,233 @@
+#include "runtime/node_http_client.h"
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <gtest/gtest.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace athena::runtime;
+
+namespace {
+
+// Minimal HTTP server on a Unix socket. |respond| maps a request path to the
+// raw response; |close_after_response| mimics Node closing idle keep-alives.
+class FakeNodeServer {
+ public:
+  using Responder = std::function<std::string(const std::string& path)>;
+
+  explicit FakeNodeServer(Responder respond, bool close_after_response = false)
+      : respond_(std::move(respond)), close_after_response_(close_after_response) {
+    path_ = "/tmp/athena-http-client-test-" + std::to_string(getpid()) + "-" +
+            std::to_string(next_id_++) + ".sock";
+    unlink(path_.c_str());
+    listen_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path_.c_str(), sizeof(addr.sun_path) - 1);
+    bind(listen_fd_, (struct sockaddr*)&addr, sizeof(addr));
+    listen(listen_fd_, 16);
+    accept_thread_ = std::thread([this] { AcceptLoop(); });
+  }
+
+  ~FakeNodeServer() {
+    shutdown(listen_fd_, SHUT_RDWR);
+    close(listen_fd_);
+    accept_thread_.join();
+    for (auto& thread : connection_threads_) {
+      thread.join();
+    }
+    unlink(path_.c_str());
+  }
+
+  const std::string& path() const { return path_; }
+  int accepted() const { return accepted_; }
+
+ private:
+  void AcceptLoop() {
+    while (true) {
+      int fd = accept(listen_fd_, nullptr, nullptr);
+      if (fd < 0) {
+        return;
+      }
+      accepted_++;
+      connection_threads_.emplace_back([this, fd] { Serve(fd); });
+    }
+  }
+
+  void Serve(int fd) {
+    std::string buffer;
+    char chunk[4096];
+    while (true) {
+      size_t end = buffer.find("\r\n\r\n");
+      if (end == std::string::npos) {
+        ssize_t count = recv(fd, chunk, sizeof(chunk), 0);
+        if (count <= 0) {
+          break;
+        }
+        buffer.append(chunk, static_cast<size_t>(count));
+        continue;
+      }
+
+      // Requests in these tests carry at most a small body after the headers
+      std::string head = buffer.substr(0, end);
+      size_t body_size = 0;
+      size_t length_pos = head.find("Content-Length: ");
+      if (length_pos != std::string::npos) {
+        body_size = std::stoul(head.substr(length_pos + 16));
+      }
+      while (buffer.size() < end + 4 + body_size) {
+        ssize_t count = recv(fd, chunk, sizeof(chunk), 0);
+        if (count <= 0) {
+          close(fd);
+          return;
+        }
+        buffer.append(chunk, static_cast<size_t>(count));
+      }
+      buffer.erase(0, end + 4 + body_size);
+
+      std::string path = head.substr(head.find(' ') + 1);
+      path = path.substr(0, path.find(' '));
+      std::string response = respond_(path);
+      send(fd, response.data(), response.size(), MSG_NOSIGNAL);
+      if (close_after_response_) {
+        break;
+      }
+    }
+    close(fd);
+  }
+
+  static std::atomic<int> next_id_;
+
+  Responder respond_;
+  bool close_after_response_;
+  std::string path_;
+  int listen_fd_ = -1;
+  std::atomic<int> accepted_{0};
+  std::thread accept_thread_;
+  std::vector<std::thread> connection_threads_;
+};
+
+std::atomic<int> FakeNodeServer::next_id_{0};
+
+std::string Ok(const std::string& body) {
+  return "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: " +
+         std::to_string(body.size()) + "\r\n\r\n" + body;
+}
+
+NodeHttpRequest Get(const std::string& path) {
+  NodeHttpRequest request;
+  request.path = path;
+  return request;
+}
+
+}  // namespace
+
+TEST(NodeHttpClientTest, ReusesKeepAliveConnection) {
+  FakeNodeServer server([](const std::string& path) { return Ok("{\"path\":\"" + path + "\"}"); });
+  NodeHttpClient client(server.path());
+
+  for (int i = 0; i < 5; ++i) {
+    auto response = client.Send(Get("/health"));
+    ASSERT_TRUE(response.IsOk()) << response.GetError().Message();
+    EXPECT_EQ(response.Value(), "{\"path\":\"/health\"}");
+  }
+
+  EXPECT_EQ(server.accepted(), 1);
+  auto stats = client.GetStats();
+  EXPECT_EQ(stats.requests, 5u);
+  EXPECT_EQ(stats.connections_opened, 1u);
+  EXPECT_EQ(stats.connections_reused, 4u);
+}
+
+TEST(NodeHttpClientTest, DecodesChunkedResponses) {
+  FakeNodeServer server([](const std::string&) {
+    return std::string(
+        "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+        "5\r\nhello\r\n7;ext=1\r\n, world\r\n0\r\n\r\n");
+  });
+  NodeHttpClient client(server.path());
+
+  auto first = client.Send(Get("/v1/chat"));
+  ASSERT_TRUE(first.IsOk()) << first.GetError().Message();
+  EXPECT_EQ(first.Value(), "hello, world");
+
+  // The connection ends cleanly after the last chunk and is reused
+  auto second = client.Send(Get("/v1/chat"));
+  ASSERT_TRUE(second.IsOk());
+  EXPECT_EQ(server.accepted(), 1);
+}
+
+TEST(NodeHttpClientTest, ReconnectsWhenServerClosedIdleConnection) {
+  FakeNodeServer server([](const std::string&) { return Ok("ok"); },
+                        /*close_after_response=*/true);
+  NodeHttpClient client(server.path());
+
+  for (int i = 0; i < 3; ++i) {
+    auto response = client.Send(Get("/health"));
+    ASSERT_TRUE(response.IsOk()) << response.GetError().Message();
+    EXPECT_EQ(response.Value(), "ok");
+  }
+  EXPECT_EQ(server.accepted(), 3);
+}
+
+TEST(NodeHttpClientTest, ConnectionCloseIsNotPooled) {
+  FakeNodeServer server([](const std::string&) {
+    return std::string("HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 2\r\n\r\nok");
+  });
+  NodeHttpClient client(server.path());
+
+  ASSERT_TRUE(client.Send(Get("/a")).IsOk());
+  ASSERT_TRUE(client.Send(Get("/b")).IsOk());
+  EXPECT_EQ(client.GetStats().connections_opened, 2u);
+  EXPECT_EQ(client.GetStats().connections_reused, 0u);
+}
+
+TEST(NodeHttpClientTest, SendsRequestBody) {
+  FakeNodeServer server([](const std::string& path) { return Ok(path); });
+  NodeHttpClient client(server.path());
+
+  NodeHttpRequest request;
+  request.method = "POST";
+  request.path = "/v1/echo";
+  request.body = "{\"message\":\"hello\"}";
+  request.request_id = "req-1";
+
+  // The server reads the body before answering; a second request proves framing
+  ASSERT_TRUE(client.Send(request).IsOk());
+  auto response = client.Send(Get("/after"));
+  ASSERT_TRUE(response.IsOk());
+  EXPECT_EQ(response.Value(), "/after");
+}
+
+TEST(NodeHttpClientTest, SendAsyncCompletesOnWorkerThread) {
+  FakeNodeServer server([](const std::string&) { return Ok("async"); });
+  NodeHttpClient client(server.path());
+
+  std::promise<std::pair<std::string, std::thread::id>> done;
+  client.SendAsync(Get("/health"), [&done](athena::utils::Result<std::string> result) {
+    done.set_value({result ? result.Value() : result.GetError().Message(),
+                    std::this_thread::get_id()});
+  });
+
+  auto future = done.get_future();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  auto [body, thread] = future.get();
+  EXPECT_EQ(body, "async");
+  EXPECT_NE(thread, std::this_thread::get_id());
+}
+
+TEST(NodeHttpClientTest, FailsWhenRuntimeIsNotListening) {
+  NodeHttpClient client("/tmp/athena-http-client-test-missing.sock");
+
+  auto response = client.Send(Get("/health"));
+  EXPECT_FALSE(response.IsOk());
+  EXPECT_NE(response.GetError().Message().find("connect"), std::string::npos);
+}
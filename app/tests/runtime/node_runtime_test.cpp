@@ -0,0 +1,103 @@
+#include "runtime/node_runtime.h"
+
+#include <QCoreApplication>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <signal.h>
+#include <string>
+#include <unistd.h>
+
+using namespace athena::runtime;
+
+namespace {
+
+class NodeRuntimeTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    // With an event loop, InitializeAsync() returns while the runtime starts
+    static int argc = 0;
+    qt_app_ = std::make_unique<QCoreApplication>(argc, nullptr);
+
+    // A "runtime" that starts but never prints READY
+    script_ = "/tmp/athena-node-runtime-test-" + std::to_string(getpid()) + ".sh";
+    std::ofstream(script_) << "exec sleep 30\n";
+
+    config_.node_executable = "/bin/sh";
+    config_.runtime_script_path = script_;
+    config_.socket_path = "/tmp/athena-node-runtime-test-" + std::to_string(getpid()) + ".sock";
+    config_.startup_timeout_ms = 30000;
+  }
+
+  void TearDown() override {
+    std::remove(script_.c_str());
+    qt_app_.reset();
+  }
+
+  std::unique_ptr<QCoreApplication> qt_app_;
+  std::string script_;
+  NodeRuntimeConfig config_;
+};
+
+}  // namespace
+
+TEST_F(NodeRuntimeTest, InitializeAsyncReturnsWhileStarting) {
+  NodeRuntime runtime(config_);
+  bool called = false;
+
+  ASSERT_TRUE(runtime.InitializeAsync([&](athena::utils::Result<void>) { called = true; }).IsOk());
+
+  EXPECT_EQ(runtime.GetState(), RuntimeState::STARTING);
+  EXPECT_FALSE(runtime.IsReady());
+  EXPECT_GT(runtime.GetPid(), 0);
+  EXPECT_FALSE(called);
+}
+
+TEST_F(NodeRuntimeTest, SecondStartFailsWithoutDisturbingTheFirst) {
+  NodeRuntime runtime(config_);
+  int first_calls = 0;
+  int second_calls = 0;
+
+  ASSERT_TRUE(runtime.InitializeAsync([&](athena::utils::Result<void>) { first_calls++; }).IsOk());
+  int pid = runtime.GetPid();
+
+  // Application::InitializeRuntime() skips a runtime that is not STOPPED, so
+  // this never happens there; a start that slipped through must not cancel
+  // the one still waiting for READY
+  auto second = runtime.InitializeAsync([&](athena::utils::Result<void>) { second_calls++; });
+  ASSERT_FALSE(second.IsOk());
+  EXPECT_NE(second.GetError().Message().find("already initialized"), std::string::npos);
+
+  EXPECT_EQ(runtime.GetState(), RuntimeState::STARTING);
+  EXPECT_EQ(runtime.GetPid(), pid);
+  EXPECT_EQ(first_calls, 0);
+  EXPECT_EQ(second_calls, 0);
+}
+
+TEST_F(NodeRuntimeTest, ShutdownStopsAStartingRuntime) {
+  NodeRuntime runtime(config_);
+  bool called = false;
+
+  ASSERT_TRUE(runtime.InitializeAsync([&](athena::utils::Result<void>) { called = true; }).IsOk());
+  int pid = runtime.GetPid();
+
+  runtime.Shutdown();
+
+  EXPECT_EQ(runtime.GetState(), RuntimeState::STOPPED);
+  EXPECT_EQ(runtime.GetPid(), -1);
+  EXPECT_NE(kill(pid, 0), 0);
+  EXPECT_FALSE(called);
+}
+
+TEST_F(NodeRuntimeTest, StartFailsForAMissingScript) {
+  config_.runtime_script_path = "/nonexistent/athena/server.js";
+  NodeRuntime runtime(config_);
+  bool called = false;
+
+  auto result = runtime.InitializeAsync([&](athena::utils::Result<void>) { called = true; });
+
+  EXPECT_FALSE(result.IsOk());
+  EXPECT_EQ(runtime.GetState(), RuntimeState::STOPPED);
+  EXPECT_FALSE(called);
+}
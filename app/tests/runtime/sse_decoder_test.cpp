@@ -0,0 +1,201 @@
+#include "runtime/sse_decoder.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace athena::runtime;
+
+namespace {
+
+// Decoder plus the events it dispatched
+struct Decoded {
+  std::vector<SseEvent> events;
+  SseDecoder decoder;
+
+  Decoded() : decoder([this](const SseEvent& event) { events.push_back(event); }) {}
+};
+
+std::vector<SseEvent> DecodeInPieces(const std::string& stream, size_t piece) {
+  Decoded decoded;
+  for (size_t pos = 0; pos < stream.size(); pos += piece) {
+    EXPECT_TRUE(decoded.decoder.Feed(std::string_view(stream).substr(pos, piece)));
+  }
+  return decoded.events;
+}
+
+bool SameEvents(const std::vector<SseEvent>& a, const std::vector<SseEvent>& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].type != b[i].type || a[i].data != b[i].data || a[i].id != b[i].id) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// ============================================================================
+// Field Tests
+// ============================================================================
+
+TEST(SseDecoderTest, DispatchesAtBlankLine) {
+  Decoded decoded;
+  decoded.decoder.Feed("data: {\"type\":\"chunk\",\"content\":\"Hi\"}\n");
+  EXPECT_TRUE(decoded.events.empty());
+
+  decoded.decoder.Feed("\n");
+  ASSERT_EQ(decoded.events.size(), 1u);
+  EXPECT_EQ(decoded.events[0].type, "message");
+  EXPECT_EQ(decoded.events[0].data, "{\"type\":\"chunk\",\"content\":\"Hi\"}");
+  EXPECT_EQ(decoded.events[0].id, "");
+}
+
+TEST(SseDecoderTest, MultiLineDataEventAndComments) {
+  Decoded decoded;
+  decoded.decoder.Feed(
+      ": keep-alive\n"
+      "event: update\n"
+      "data: first\n"
+      "data:second\n"
+      "data\n"
+      "unknown: ignored\n"
+      "\n");
+
+  ASSERT_EQ(decoded.events.size(), 1u);
+  EXPECT_EQ(decoded.events[0].type, "update");
+  // Only one space after the colon is stripped; a bare "data" adds an empty line
+  EXPECT_EQ(decoded.events[0].data, "first\nsecond\n");
+}
+
+TEST(SseDecoderTest, EventsWithoutDataAreNotDispatched) {
+  Decoded decoded;
+  decoded.decoder.Feed("event: ping\n\n: comment\n\ndata:\n\n");
+
+  // "data:" with an empty value is an event with empty data, typed "message"
+  ASSERT_EQ(decoded.events.size(), 1u);
+  EXPECT_EQ(decoded.events[0].type, "message");
+  EXPECT_EQ(decoded.events[0].data, "");
+}
+
+TEST(SseDecoderTest, LastEventIdAndRetry) {
+  Decoded decoded;
+  decoded.decoder.Feed(std::string("id: 41\ndata: a\n\ndata: b\n\nid: 4") + '\0' +
+                       "2\ndata: c\n\n"
+                       "retry: 2500\n"
+                       "retry: soon\n"
+                       "id\ndata: d\n\n");
+
+  ASSERT_EQ(decoded.events.size(), 4u);
+  EXPECT_EQ(decoded.events[0].id, "41");
+  EXPECT_EQ(decoded.events[1].id, "41");  // Persists across events
+  EXPECT_EQ(decoded.events[2].id, "41");  // IDs containing NUL are ignored
+  EXPECT_EQ(decoded.events[3].id, "");    // A bare "id" clears it
+  ASSERT_TRUE(decoded.decoder.RetryMs().has_value());
+  EXPECT_EQ(*decoded.decoder.RetryMs(), 2500u);
+}
+
+// ============================================================================
+// Stream Tests
+// ============================================================================
+
+TEST(SseDecoderTest, MixedLineEndingsAndByteOrderMark) {
+  Decoded decoded;
+  decoded.decoder.Feed("\xEF\xBB\xBF" "data: one\r\n\r\ndata: two\r\rdata: three\n\n");
+
+  ASSERT_EQ(decoded.events.size(), 3u);
+  EXPECT_EQ(decoded.events[0].data, "one");
+  EXPECT_EQ(decoded.events[1].data, "two");
+  EXPECT_EQ(decoded.events[2].data, "three");
+}
+
+TEST(SseDecoderTest, EverySplitPointGivesSameEvents) {
+  // Multi-byte UTF-8, CRLF and multi-line data, as a socket might split them
+  const std::string stream =
+      "\xEF\xBB\xBF" "id: 7\r\n"
+      "data: {\"content\":\"caf\xC3\xA9 \xE2\x9C\x93 \xF0\x9F\x9A\x80\"}\r\n"
+      "\r\n"
+      "event: done\r\n"
+      "data: line one\r\n"
+      "data: line two\r\n"
+      "\r\n";
+  const auto expected = DecodeInPieces(stream, stream.size());
+  ASSERT_EQ(expected.size(), 2u);
+  EXPECT_EQ(expected[0].data, "{\"content\":\"caf\xC3\xA9 \xE2\x9C\x93 \xF0\x9F\x9A\x80\"}");
+  EXPECT_EQ(expected[1].data, "line one\nline two");
+
+  for (size_t split = 0; split <= stream.size(); ++split) {
+    Decoded decoded;
+    decoded.decoder.Feed(std::string_view(stream).substr(0, split));
+    decoded.decoder.Feed(std::string_view(stream).substr(split));
+    EXPECT_TRUE(SameEvents(decoded.events, expected)) << "split at " << split;
+  }
+  EXPECT_TRUE(SameEvents(DecodeInPieces(stream, 1), expected));
+}
+
+TEST(SseDecoderTest, ResetDropsPartialEventButKeepsLastId) {
+  Decoded decoded;
+  decoded.decoder.Feed("id: 9\ndata: complete\n\ndata: cut off");
+  ASSERT_EQ(decoded.events.size(), 1u);
+
+  // The connection dropped mid-event; the next stream starts clean
+  decoded.decoder.Reset();
+  EXPECT_EQ(decoded.decoder.LastEventId(), "9");
+
+  decoded.decoder.Feed("data: fresh\n\n");
+  ASSERT_EQ(decoded.events.size(), 2u);
+  EXPECT_EQ(decoded.events[1].data, "fresh");
+  EXPECT_EQ(decoded.events[1].id, "9");
+}
+
+TEST(SseDecoderTest, OversizedEventIsAnError) {
+  Decoded decoded;
+  std::string line = "data: " + std::string(SseDecoder::kMaxEventBytes / 2, 'x') + "\n";
+  EXPECT_TRUE(decoded.decoder.Feed(line));
+  EXPECT_FALSE(decoded.decoder.Feed(line + line));
+  EXPECT_TRUE(decoded.decoder.HasError());
+  EXPECT_FALSE(decoded.decoder.Feed("\n"));
+  EXPECT_TRUE(decoded.events.empty());
+
+  decoded.decoder.Reset();
+  EXPECT_TRUE(decoded.decoder.Feed("data: ok\n\n"));
+  EXPECT_EQ(decoded.events.size(), 1u);
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// Agent-style chunk events (short JSON payloads) in 16 KB socket-sized reads.
+// Throughput is reported, not asserted, since it depends on the machine.
+
+TEST(SseDecoderBenchmark, ChunkEventThroughput) {
+  std::string stream;
+  const std::string event =
+      "data: {\"type\":\"chunk\",\"content\":\"The quick brown fox jumps over the lazy dog. \","
+      "\"sessionId\":\"0f8fad5b-d9cb-469f-a165-70867728950e\"}\n\n";
+  while (stream.size() < 64 * 1024 * 1024) {
+    stream += event;
+  }
+  const size_t kReadSize = 16 * 1024;
+
+  size_t events = 0;
+  SseDecoder decoder([&events](const SseEvent&) { ++events; });
+  auto start = std::chrono::steady_clock::now();
+  for (size_t pos = 0; pos < stream.size(); pos += kReadSize) {
+    decoder.Feed(std::string_view(stream).substr(pos, kReadSize));
+  }
+  auto end = std::chrono::steady_clock::now();
+
+  double seconds = std::chrono::duration<double>(end - start).count();
+  double mb_per_second = static_cast<double>(stream.size()) / (1024 * 1024) / seconds;
+  std::cout << "[ BENCH    ] SSE decode: " << mb_per_second << " MB/s, "
+            << static_cast<double>(events) / seconds / 1e6 << " M events/s" << std::endl;
+  ::testing::Test::RecordProperty("mb_per_second", std::to_string(mb_per_second));
+
+  EXPECT_EQ(events, stream.size() / event.size());
+}
@@ -0,0 +1,270 @@
+#include "utils/log_writer.h"
+
+#include "utils/logging.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace athena::utils;
+
+namespace {
+
+std::string ReadFile(const std::string& path) {
+  std::ifstream file(path);
+  return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+std::vector<std::string> ReadLines(const std::string& path) {
+  std::vector<std::string> lines;
+  std::istringstream stream(ReadFile(path));
+  for (std::string line; std::getline(stream, line);) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+// Log file removed before and after each test
+class TempLogFile {
+ public:
+  explicit TempLogFile(const std::string& name) : path_("/tmp/athena_" + name + ".log") {
+    std::remove(path_.c_str());
+  }
+  ~TempLogFile() { std::remove(path_.c_str()); }
+
+  const std::string& path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+LogWriterOptions MakeOptions(size_t buffer_bytes, LogFlushPolicy policy) {
+  LogWriterOptions options;
+  options.buffer_bytes = buffer_bytes;
+  options.flush_policy = policy;
+  return options;
+}
+
+}  // namespace
+
+// ============================================================================
+// Ordering Tests
+// ============================================================================
+
+TEST(LogWriterTest, KeepsEachThreadsLinesInOrder) {
+  TempLogFile log("log_writer_order");
+  LogWriter writer;
+  writer.Start();
+  const int file = writer.OpenFile(log.path());
+  ASSERT_NE(file, LogWriter::kNoFile);
+
+  const int kThreads = 4;
+  const int kLines = 5000;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&writer, file, t]() {
+      for (int i = 0; i < kLines; ++i) {
+        writer.Submit(std::to_string(t) + " " + std::to_string(i), LogWriter::kFile, file);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  writer.Flush();
+
+  std::vector<int> next(kThreads, 0);
+  const auto lines = ReadLines(log.path());
+  for (const auto& line : lines) {
+    int t = 0;
+    int i = 0;
+    ASSERT_EQ(std::sscanf(line.c_str(), "%d %d", &t, &i), 2) << line;
+    ASSERT_EQ(i, next[t]) << "thread " << t;
+    ++next[t];
+  }
+  EXPECT_EQ(lines.size() + writer.DroppedCount(), static_cast<size_t>(kThreads * kLines));
+  writer.CloseFile(file);
+}
+
+TEST(LogWriterTest, SharesFilesByPath) {
+  TempLogFile log("log_writer_shared");
+  LogWriter writer;
+  const int first = writer.OpenFile(log.path());
+  const int second = writer.OpenFile(log.path());
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(writer.OpenFile("/nonexistent-dir/athena.log"), LogWriter::kNoFile);
+
+  writer.Submit("one", LogWriter::kFile, first);
+  writer.CloseFile(first);  // Still open for the second user
+  writer.Submit("two", LogWriter::kFile, second);
+  writer.CloseFile(second);
+
+  EXPECT_EQ(ReadFile(log.path()), "one\ntwo\n");
+}
+
+// ============================================================================
+// Bounded Memory Tests
+// ============================================================================
+
+TEST(LogWriterTest, FullBufferDropsAndCounts) {
+  TempLogFile log("log_writer_drops");
+  // Not started: nothing drains the 4 KB ring until Flush()
+  LogWriter writer(MakeOptions(4096, LogFlushPolicy::kInterval));
+  const int file = writer.OpenFile(log.path());
+
+  const std::string line(100, 'x');
+  size_t accepted = 0;
+  for (int i = 0; i < 100; ++i) {
+    accepted += writer.Submit(line, LogWriter::kFile, file) ? 1 : 0;
+  }
+  EXPECT_GT(accepted, 0u);
+  EXPECT_LT(accepted, 100u);
+  EXPECT_EQ(writer.DroppedCount(), 100 - accepted);
+
+  writer.Flush();
+  EXPECT_EQ(ReadLines(log.path()).size(), accepted);
+
+  // Space is reclaimed once drained
+  EXPECT_TRUE(writer.Submit(line, LogWriter::kFile, file));
+  writer.CloseFile(file);
+}
+
+TEST(LogWriterTest, UrgentLinesAreNeverDropped) {
+  TempLogFile log("log_writer_urgent");
+  LogWriter writer(MakeOptions(4096, LogFlushPolicy::kInterval));
+  const int file = writer.OpenFile(log.path());
+
+  const std::string line(100, 'x');
+  while (writer.Submit(line, LogWriter::kFile, file)) {
+  }
+  EXPECT_TRUE(writer.Submit("urgent", LogWriter::kFile, file, true));
+  writer.Flush();
+
+  const auto lines = ReadLines(log.path());
+  ASSERT_FALSE(lines.empty());
+  EXPECT_EQ(lines.back(), "urgent");
+  writer.CloseFile(file);
+}
+
+TEST(LogWriterTest, TruncatesLinesLongerThanTheLimit) {
+  TempLogFile log("log_writer_truncate");
+  LogWriter writer(MakeOptions(4096, LogFlushPolicy::kInterval));
+  const int file = writer.OpenFile(log.path());
+
+  EXPECT_TRUE(writer.Submit(std::string(10000, 'y'), LogWriter::kFile, file));
+  writer.Flush();
+
+  const auto lines = ReadLines(log.path());
+  ASSERT_EQ(lines.size(), 1u);
+  EXPECT_LT(lines[0].size(), 4096u);
+  EXPECT_EQ(lines[0].substr(lines[0].size() - 12), " [truncated]");
+  writer.CloseFile(file);
+}
+
+// ============================================================================
+// Flush Policy Tests
+// ============================================================================
+
+TEST(LogWriterTest, IntervalPolicyWritesWithoutFlush) {
+  TempLogFile log("log_writer_interval");
+  LogWriterOptions options = MakeOptions(64 * 1024, LogFlushPolicy::kInterval);
+  options.flush_interval = std::chrono::milliseconds(10);
+  LogWriter writer(options);
+  writer.Start();
+  const int file = writer.OpenFile(log.path());
+
+  writer.Submit("eventually", LogWriter::kFile, file);
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (ReadFile(log.path()).empty() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(ReadFile(log.path()), "eventually\n");
+  writer.CloseFile(file);
+}
+
+TEST(LogWriterTest, EveryLinePolicyAndStopWriteSynchronously) {
+  TempLogFile log("log_writer_sync");
+  LogWriter writer(MakeOptions(64 * 1024, LogFlushPolicy::kEveryLine));
+  writer.Start();
+  const int file = writer.OpenFile(log.path());
+
+  writer.Submit("first", LogWriter::kFile, file);
+  EXPECT_EQ(ReadFile(log.path()), "first\n");
+
+  LogWriter buffered(MakeOptions(64 * 1024, LogFlushPolicy::kInterval));
+  buffered.Start();
+  const int buffered_file = buffered.OpenFile(log.path());
+  buffered.Submit("second", LogWriter::kFile, buffered_file);
+  buffered.Stop();  // Writes what is buffered
+  buffered.Submit("third", LogWriter::kFile, buffered_file);
+  EXPECT_EQ(ReadFile(log.path()), "first\nsecond\nthird\n");
+
+  buffered.CloseFile(buffered_file);
+  writer.CloseFile(file);
+}
+
+TEST(LogWriterTest, FatalIsWrittenBeforeReturning) {
+  TempLogFile log("log_writer_fatal");
+  Logger logger("fatal");
+  logger.EnableConsoleOutput(false);
+  logger.EnableFileOutput(true);
+  logger.SetOutputFile(log.path());
+
+  logger.Info("before");
+  logger.Fatal("going down: {}", 42);
+
+  const std::string content = ReadFile(log.path());
+  EXPECT_NE(content.find("[INFO] before"), std::string::npos);
+  EXPECT_NE(content.find("[FATAL] going down: 42"), std::string::npos);
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// Cost of a log call on the calling thread, buffered versus written before
+// returning. Timings are reported, not asserted, since they depend on the
+// machine and the disk.
+
+TEST(LogWriterBenchmark, LogCallLatency) {
+  const int kThreads = 4;
+  const int kLines = 50000;
+  const std::string line =
+      "[2025-01-01 12:00:00.000] [BrowserControl] [INFO] GET /internal/get_page_summary tab=3";
+
+  for (LogFlushPolicy policy : {LogFlushPolicy::kUrgent, LogFlushPolicy::kEveryLine}) {
+    TempLogFile log("log_writer_bench");
+    LogWriter writer(MakeOptions(1024 * 1024, policy));
+    writer.Start();
+    const int file = writer.OpenFile(log.path());
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&writer, &line, file]() {
+        for (int i = 0; i < kLines; ++i) {
+          writer.Submit(line, LogWriter::kFile, file);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    writer.Flush();
+
+    double ns_per_line =
+        std::chrono::duration<double, std::nano>(end - start).count() / (kThreads * kLines);
+    const char* name = policy == LogFlushPolicy::kEveryLine ? "every_line" : "buffered";
+    std::cout << "[ BENCH    ] " << name << ": " << ns_per_line << " ns per log call ("
+              << kThreads << " threads), " << writer.DroppedCount() << " dropped" << std::endl;
+    ::testing::Test::RecordProperty(std::string(name) + "_ns_per_call",
+                                    std::to_string(ns_per_line));
+    writer.CloseFile(file);
+  }
+}
@@ -1,13 +1,50 @@
 #include "utils/logging.h"
 
+#include <chrono>
+#include <ctime>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <iomanip>
+#include <iostream>
+#include <nlohmann/json.hpp>
 #include <sstream>
+#include <string_view>
 #include <thread>
 #include <vector>
 
 using namespace athena::utils;
 
+namespace {
+
+// Counts how often it is formatted
+struct Probe {
+  int* formatted;
+};
+
+std::ostream& operator<<(std::ostream& stream, const Probe& probe) {
+  ++*probe.formatted;
+  return stream << "probe";
+}
+
+enum class Color { kRed = 1, kGreen = 2 };
+
+// Reference stamp, formatted from scratch
+std::string SlowTimestamp(std::chrono::system_clock::time_point time) {
+  auto time_t_value = std::chrono::system_clock::to_time_t(
+      std::chrono::floor<std::chrono::seconds>(time));
+  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                time - std::chrono::floor<std::chrono::seconds>(time))
+                .count();
+  std::tm tm_buf;
+  localtime_r(&time_t_value, &tm_buf);
+  std::ostringstream oss;
+  oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S") << '.' << std::setfill('0') << std::setw(3)
+      << ms;
+  return oss.str();
+}
+
+}  // namespace
+
 TEST(LoggerTest, DefaultConstructor) {
   Logger logger("test");
   EXPECT_EQ(logger.GetName(), "test");
@@ -156,3 +193,166 @@ TEST(LoggerTest, ThreadSafety) {
     thread.join();
   }
 }
+
+// ============================================================================
+// Formatting Tests
+// ============================================================================
+
+TEST(LogFormatTest, ReplacesPlaceholdersInOrder) {
+  const char* null_text = nullptr;
+  EXPECT_EQ(Format("int {} size {} neg {}", 42, size_t{7}, -13), "int 42 size 7 neg -13");
+  EXPECT_EQ(Format("{} {} {}", 1.5, 0.1f, 1e20), "1.5 0.1 1e+20");
+  EXPECT_EQ(Format("{}/{}/{}", true, 'x', Color::kGreen), "true/x/2");
+  EXPECT_EQ(Format("{} {} {} {}", "literal", std::string("string"), std::string_view("view"),
+                   null_text),
+            "literal string view (null)");
+
+  int formatted = 0;
+  EXPECT_EQ(Format("[{}]", Probe{&formatted}), "[probe]");
+  EXPECT_EQ(formatted, 1);
+}
+
+TEST(LogFormatTest, MismatchedPlaceholdersAndArguments) {
+  // Unfilled placeholders stay; surplus arguments are dropped
+  EXPECT_EQ(Format("{} and {}", 1), "1 and {}");
+  EXPECT_EQ(Format("only {}", 1, 2, 3), "only 1");
+  EXPECT_EQ(Format("no placeholders", 1), "no placeholders");
+  EXPECT_EQ(Format("{"), "{");
+
+  std::string out = "prefix: ";
+  FormatTo(out, "{}-{}", 1, 2);
+  EXPECT_EQ(out, "prefix: 1-2");
+
+  static_assert(log_internal::CountPlaceholders("a {} b {} c {") == 2);
+}
+
+TEST(LogFormatTest, DisabledLevelsAreNotFormatted) {
+  Logger logger("test");
+  logger.SetLevel(LogLevel::kWarn);
+  logger.EnableConsoleOutput(false);
+
+  int formatted = 0;
+  logger.Debug("{}", Probe{&formatted});
+  logger.Info("{}", Probe{&formatted});
+  EXPECT_EQ(formatted, 0);
+
+  logger.Warn("{}", Probe{&formatted});
+  EXPECT_EQ(formatted, 1);
+}
+
+TEST(LogFormatTest, MacrosSkipArgumentEvaluation) {
+  Logger logger("test");
+  logger.SetLevel(LogLevel::kInfo);
+  logger.EnableConsoleOutput(false);
+
+  int evaluated = 0;
+  auto expensive = [&evaluated]() {
+    ++evaluated;
+    return std::string(4096, 'x');
+  };
+
+  ATHENA_LOG_DEBUG(logger, "payload {}", expensive());
+  EXPECT_EQ(evaluated, 0);
+
+  ATHENA_LOG_INFO(logger, "payload {}", expensive());
+  ATHENA_LOG_WARN(logger, "no arguments");
+  EXPECT_EQ(evaluated, 1);
+}
+
+// ============================================================================
+// Line Layout Tests
+// ============================================================================
+
+TEST(LogTimestampTest, MatchesLocalTimeAcrossSeconds) {
+  LogTimestamp timestamp;
+  const auto base = std::chrono::system_clock::from_time_t(1735732799);
+  for (int ms : {0, 7, 45, 999, 1000, 1001, 1999, 2500, 500, 61000, 86400123}) {
+    const auto time = base + std::chrono::milliseconds(ms);
+    EXPECT_EQ(timestamp.Format(time), SlowTimestamp(time)) << ms;
+  }
+  EXPECT_EQ(timestamp.Format(base).size(), LogTimestamp::kLength);
+}
+
+TEST(LoggerTest, JsonLinesOutput) {
+  const std::string test_file = "/tmp/athena_test_log_json.txt";
+  std::remove(test_file.c_str());
+
+  const std::string message = "quote \" backslash \\ newline \n tab \t bell \x07 caf\xC3\xA9";
+  {
+    Logger logger("json \"test\"");
+    logger.EnableConsoleOutput(false);
+    logger.EnableFileOutput(true);
+    logger.SetOutputFile(test_file);
+    logger.SetFormat(LogOutputFormat::kJsonLines);
+
+    logger.Info(message);
+    logger.Error("Code {}", 42);
+  }
+
+  std::ifstream file(test_file);
+  std::vector<nlohmann::json> lines;
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(nlohmann::json::parse(line));
+  }
+  ASSERT_EQ(lines.size(), 2u);
+
+  EXPECT_EQ(lines[0]["msg"], message);
+  EXPECT_EQ(lines[0]["level"], "INFO");
+  EXPECT_EQ(lines[0]["logger"], "json \"test\"");
+  EXPECT_TRUE(lines[0]["ts"].is_number_integer());
+  EXPECT_EQ(lines[0]["time"].get<std::string>().size(), LogTimestamp::kLength);
+  EXPECT_EQ(lines[1]["msg"], "Code 42");
+  EXPECT_EQ(lines[1]["level"], "ERROR");
+
+  std::remove(test_file.c_str());
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// Cost per call of a disabled debug statement with a string argument, through
+// the methods and the macros, and of the per-line formatting work. Timings
+// are reported, not asserted.
+
+TEST(LoggerBenchmark, PerCallCost) {
+  Logger logger("bench");
+  logger.SetLevel(LogLevel::kInfo);
+  logger.EnableConsoleOutput(false);
+
+  const int kCalls = 2000000;
+  const std::string payload(2048, 'p');
+  auto measure = [kCalls](const char* name, auto&& call) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kCalls; ++i) {
+      call(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ns_per_call = std::chrono::duration<double, std::nano>(end - start).count() / kCalls;
+    std::cout << "[ BENCH    ] " << name << ": " << ns_per_call << " ns per call" << std::endl;
+    ::testing::Test::RecordProperty(std::string(name) + "_ns_per_call",
+                                    std::to_string(ns_per_call));
+  };
+
+  measure("disabled_method", [&](int i) { logger.Debug("Tab {} payload {}", i, payload); });
+  measure("disabled_method_copy",
+          [&](int i) { logger.Debug("Tab {} payload {}", i, std::string(payload)); });
+  measure("disabled_macro_copy",
+          [&](int i) { ATHENA_LOG_DEBUG(logger, "Tab {} payload {}", i, std::string(payload)); });
+
+  std::string out;
+  measure("format", [&](int i) {
+    out.clear();
+    FormatTo(out, "GET {} tab={} took {} ms ok={}", "/internal/get_page_summary", i, 1.25, true);
+  });
+
+  // Per-line timestamp: cached per second versus localtime_r and put_time
+  LogTimestamp timestamp;
+  const auto start = std::chrono::system_clock::now();
+  size_t length = 0;
+  measure("timestamp_cached", [&](int i) {
+    length += timestamp.Format(start + std::chrono::microseconds(i)).size();
+  });
+  measure("timestamp_put_time",
+          [&](int i) { length += SlowTimestamp(start + std::chrono::microseconds(i)).size(); });
+  EXPECT_EQ(length, 2u * kCalls * LogTimestamp::kLength);
+}
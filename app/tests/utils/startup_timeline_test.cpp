@@ -0,0 +1,111 @@
+#include "utils/startup_timeline.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace athena::utils;
+using std::chrono::milliseconds;
+
+namespace {
+
+const StartupTimeline::Clock::time_point kOrigin{};
+
+}  // namespace
+
+TEST(StartupTimelineTest, PhasesAreRelativeToOrigin) {
+  StartupTimeline timeline(kOrigin);
+  timeline.Mark("window_system_initialized", kOrigin + milliseconds(120));
+  timeline.Mark("cef_initialized", kOrigin + milliseconds(420));
+
+  auto phases = timeline.GetPhases();
+  ASSERT_EQ(phases.size(), 2u);
+  EXPECT_EQ(phases[0].name, "window_system_initialized");
+  EXPECT_DOUBLE_EQ(phases[0].at_ms, 120.0);
+  EXPECT_DOUBLE_EQ(phases[0].delta_ms, 120.0);
+  EXPECT_EQ(phases[1].name, "cef_initialized");
+  EXPECT_DOUBLE_EQ(phases[1].at_ms, 420.0);
+  EXPECT_DOUBLE_EQ(phases[1].delta_ms, 300.0);
+}
+
+TEST(StartupTimelineTest, PhasesAreOrderedByTimeNotByMarkOrder) {
+  StartupTimeline timeline(kOrigin);
+  // Marked from a callback after the fact, but it happened first
+  timeline.Mark("cef_initialized", kOrigin + milliseconds(400));
+  timeline.Mark("node_spawned", kOrigin + milliseconds(50));
+
+  auto phases = timeline.GetPhases();
+  ASSERT_EQ(phases.size(), 2u);
+  EXPECT_EQ(phases[0].name, "node_spawned");
+  EXPECT_EQ(phases[1].name, "cef_initialized");
+  EXPECT_DOUBLE_EQ(phases[1].delta_ms, 350.0);
+}
+
+TEST(StartupTimelineTest, OnlyFirstMarkCounts) {
+  StartupTimeline timeline(kOrigin);
+  timeline.Mark("first_load_end", kOrigin + milliseconds(900));
+  timeline.Mark("first_load_end", kOrigin + milliseconds(5000));
+
+  auto phases = timeline.GetPhases();
+  ASSERT_EQ(phases.size(), 1u);
+  EXPECT_DOUBLE_EQ(phases[0].at_ms, 900.0);
+  EXPECT_TRUE(timeline.Has("first_load_end"));
+  EXPECT_FALSE(timeline.Has("node_ready"));
+}
+
+TEST(StartupTimelineTest, CompletesWhenExpectedPhasesResolve) {
+  StartupTimeline timeline(kOrigin);
+  timeline.Expect("first_load_end");
+  timeline.Expect("node_ready");
+
+  timeline.Mark("cef_initialized", kOrigin + milliseconds(400));
+  EXPECT_FALSE(timeline.IsComplete());
+
+  timeline.Mark("first_load_end", kOrigin + milliseconds(900));
+  EXPECT_FALSE(timeline.IsComplete());
+
+  // Node failed to start: nothing left to wait for
+  timeline.Cancel("node_ready");
+  EXPECT_TRUE(timeline.IsComplete());
+}
+
+TEST(StartupTimelineTest, ExpectingAPhaseThatAlreadyHappenedDoesNotBlock) {
+  StartupTimeline timeline(kOrigin);
+  timeline.Mark("node_ready", kOrigin + milliseconds(10));
+  timeline.Expect("node_ready");
+  timeline.Expect("first_load_end");
+
+  timeline.Mark("first_load_end", kOrigin + milliseconds(20));
+  EXPECT_TRUE(timeline.IsComplete());
+}
+
+TEST(StartupTimelineTest, SummaryListsPhases) {
+  StartupTimeline timeline(kOrigin);
+  timeline.Mark("cef_initialized", kOrigin + milliseconds(812));
+  timeline.Mark("node_ready", kOrigin + milliseconds(1500));
+
+  EXPECT_EQ(timeline.Summary(),
+            "   812.0 ms  (+812.0 ms)  cef_initialized\n"
+            "  1500.0 ms  (+688.0 ms)  node_ready\n");
+}
+
+TEST(StartupTimelineTest, ConcurrentMarks) {
+  StartupTimeline timeline;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&timeline, i] {
+      for (int j = 0; j < 100; ++j) {
+        timeline.Mark("phase_" + std::to_string(i) + "_" + std::to_string(j % 10));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto phases = timeline.GetPhases();
+  EXPECT_EQ(phases.size(), 80u);
+  for (size_t i = 1; i < phases.size(); ++i) {
+    EXPECT_LE(phases[i - 1].at_ms, phases[i].at_ms);
+  }
+}
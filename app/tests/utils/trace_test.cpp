@@ -0,0 +1,213 @@
+#include "utils/trace.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace athena::utils;
+
+// ============================================================================
+// Span Tests
+// ============================================================================
+
+TEST(TracerTest, SpansAreIgnoredWhileDisabled) {
+  Tracer tracer;
+  {
+    TraceSpan span("control", "Route", tracer);
+    EXPECT_FALSE(span.IsRecording());
+    span.AddArg("path", "/internal/tab_info");
+  }
+  tracer.Record("control", "SocketRead", 0, 10);
+  EXPECT_EQ(tracer.EventCount(), 0u);
+}
+
+TEST(TracerTest, NestedSpansRecordTimesAndArgs) {
+  Tracer tracer;
+  tracer.Start();
+  {
+    TraceSpan outer("control", "Route", tracer);
+    outer.AddArg("path", "/internal/execute_js");
+    {
+      TraceSpan inner("browser", "JsDispatch", tracer);
+      inner.AddArg("bytes", int64_t{42});
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+  }
+  tracer.Stop();
+
+  auto events = tracer.GetEvents();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_STREQ(events[0].name, "Route");
+  EXPECT_STREQ(events[1].name, "JsDispatch");
+  EXPECT_STREQ(events[1].category, "browser");
+  EXPECT_EQ(events[0].args, "\"path\":\"/internal/execute_js\"");
+  EXPECT_EQ(events[1].args, "\"bytes\":42");
+
+  // The inner span lies within the outer one
+  EXPECT_GE(events[1].duration_us, 2000);
+  EXPECT_LE(events[0].start_us, events[1].start_us);
+  EXPECT_GE(events[0].start_us + events[0].duration_us,
+            events[1].start_us + events[1].duration_us);
+  EXPECT_EQ(events[0].pid, Tracer::ProcessId());
+  EXPECT_EQ(events[0].tid, Tracer::ThreadId());
+}
+
+TEST(TracerTest, SpansCarryTheCurrentRequestId) {
+  Tracer tracer;
+  tracer.Start();
+  const uint64_t first = Tracer::NextRequestId();
+  const uint64_t second = Tracer::NextRequestId();
+  EXPECT_NE(first, 0u);
+  EXPECT_NE(first, second);
+
+  EXPECT_EQ(Tracer::CurrentRequestId(), 0u);
+  {
+    ScopedTraceRequest request(first);
+    TraceSpan span("control", "Route", tracer);
+    {
+      ScopedTraceRequest nested(second);
+      EXPECT_EQ(Tracer::CurrentRequestId(), second);
+    }
+    EXPECT_EQ(Tracer::CurrentRequestId(), first);
+  }
+  EXPECT_EQ(Tracer::CurrentRequestId(), 0u);
+
+  auto events = tracer.GetEvents();
+  ASSERT_EQ(events.size(), 1u);
+  EXPECT_EQ(events[0].request_id, first);
+}
+
+// ============================================================================
+// Buffer Tests
+// ============================================================================
+
+TEST(TracerTest, ThreadsRecordIntoBoundedBuffers) {
+  Tracer tracer;
+  tracer.Start(100);
+
+  const int kThreads = 4;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&tracer]() {
+      for (int i = 0; i < 150; ++i) {
+        TraceSpan span("render", "Paint", tracer);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Each thread keeps its first 100 spans and drops the rest
+  EXPECT_EQ(tracer.EventCount(), static_cast<size_t>(kThreads * 100));
+  EXPECT_EQ(tracer.DroppedCount(), static_cast<uint64_t>(kThreads * 50));
+
+  auto events = tracer.GetEvents();
+  for (size_t i = 1; i < events.size(); ++i) {
+    ASSERT_LE(events[i - 1].start_us, events[i].start_us);
+  }
+
+  // Restarting discards everything, including buffers of exited threads
+  tracer.Start();
+  EXPECT_EQ(tracer.EventCount(), 0u);
+  EXPECT_EQ(tracer.DroppedCount(), 0u);
+}
+
+TEST(TracerTest, BufferLimitIsClamped) {
+  Tracer tracer;
+  tracer.Start(0);
+  EXPECT_EQ(tracer.GetMaxEventsPerThread(), 1u);
+
+  tracer.Start(Tracer::kMaxEventsPerThread * 1024);
+  EXPECT_EQ(tracer.GetMaxEventsPerThread(), Tracer::kMaxEventsPerThread);
+
+  tracer.Start(100);
+  EXPECT_EQ(tracer.GetMaxEventsPerThread(), 100u);
+}
+
+// ============================================================================
+// Export Tests
+// ============================================================================
+
+TEST(TracerTest, ExportsChromeTraceJson) {
+  Tracer tracer;
+  tracer.Start();
+  {
+    ScopedTraceRequest request(7);
+    TraceSpan span("control", "Route", tracer);
+    span.AddArg("path", "/internal/query_content?\"quoted\"");
+  }
+
+  // A span reported by a renderer process for the same request
+  TraceEvent renderer;
+  renderer.category = "renderer";
+  renderer.name = "RendererEval";
+  renderer.start_us = Tracer::NowMicros();
+  renderer.duration_us = 150;
+  renderer.request_id = 7;
+  renderer.pid = Tracer::ProcessId() + 1;
+  renderer.tid = 1;
+  tracer.Record(renderer);
+
+  auto trace = nlohmann::json::parse(tracer.ExportChromeTrace());
+  ASSERT_TRUE(trace.contains("traceEvents"));
+  EXPECT_EQ(trace["otherData"]["droppedEvents"], 0);
+
+  int process_names = 0;
+  int spans = 0;
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "M") {
+      ++process_names;
+      EXPECT_EQ(event["args"]["name"],
+                event["pid"] == Tracer::ProcessId() ? "Browser" : "Renderer");
+      continue;
+    }
+    ++spans;
+    EXPECT_EQ(event["ph"], "X");
+    EXPECT_EQ(event["args"]["request_id"], 7);
+    if (event["name"] == "Route") {
+      EXPECT_EQ(event["cat"], "control");
+      EXPECT_EQ(event["args"]["path"], "/internal/query_content?\"quoted\"");
+      EXPECT_EQ(event["tid"], Tracer::ThreadId());
+    } else {
+      EXPECT_EQ(event["name"], "RendererEval");
+      EXPECT_EQ(event["dur"], 150);
+    }
+  }
+  EXPECT_EQ(process_names, 2);
+  EXPECT_EQ(spans, 2);
+}
+
+// ============================================================================
+// Benchmarks
+// ============================================================================
+// Cost of a span on the calling thread with tracing off and on. Timings are
+// reported, not asserted, since they depend on the machine.
+
+TEST(TracerBenchmark, SpanCost) {
+  const int kSpans = 200000;
+  Tracer tracer;
+
+  for (bool enabled : {false, true}) {
+    if (enabled) {
+      tracer.Start(kSpans);
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kSpans; ++i) {
+      TraceSpan span("control", "Route", tracer);
+    }
+    auto end = std::chrono::steady_clock::now();
+    tracer.Stop();
+
+    double ns_per_span = std::chrono::duration<double, std::nano>(end - start).count() / kSpans;
+    const char* name = enabled ? "enabled" : "disabled";
+    std::cout << "[ BENCH    ] " << name << ": " << ns_per_span << " ns per span" << std::endl;
+    ::testing::Test::RecordProperty(std::string(name) + "_ns_per_span",
+                                    std::to_string(ns_per_span));
+  }
+  EXPECT_EQ(tracer.EventCount(), static_cast<size_t>(kSpans));
+}
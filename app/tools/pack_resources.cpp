@@ -0,0 +1,114 @@
+/**
+ * Packs a directory into a resource bundle (see resources/resource_bundle.h).
+ *
+ * Usage: athena-pack-resources <input-dir> <output-file>
+ *
+ * Run by the build for resources/homepage. Paths are stored relative to the
+ * input directory with forward slashes, as app:// requests them. The output
+ * is only rewritten when its contents change, and always by rename, so a
+ * running browser keeps its mapping of the previous bundle. An unchanged
+ * output is touched instead: ResourceCache serves loose files newer than the
+ * bundle, and the input was just checked against it.
+ */
+
+#include "resources/resource_bundle.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace fs = std::filesystem;
+using athena::resources::ResourceBundleWriter;
+
+namespace {
+
+bool ReadFile(const fs::path& path, std::string& contents) {
+  std::ifstream stream(path, std::ios::binary);
+  if (!stream) {
+    return false;
+  }
+  std::stringstream buffer;
+  buffer << stream.rdbuf();
+  contents = buffer.str();
+  return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <input-dir> <output-file>" << std::endl;
+    return 2;
+  }
+  const fs::path input = argv[1];
+  const fs::path output = argv[2];
+  std::error_code error;
+
+  // An unbuilt homepage is normal in development; never serve a stale bundle
+  if (!fs::is_directory(input, error)) {
+    fs::remove(output, error);
+    std::cout << "No homepage build at " << input.string() << ", skipping bundle" << std::endl;
+    return 0;
+  }
+
+  // Sorted so identical inputs give identical bundles
+  std::vector<fs::path> files;
+  for (fs::recursive_directory_iterator it(input, error), end; !error && it != end;
+       it.increment(error)) {
+    if (it->is_regular_file(error)) {
+      files.push_back(it->path());
+    }
+  }
+  if (error) {
+    std::cerr << "Failed to list " << input.string() << ": " << error.message() << std::endl;
+    return 1;
+  }
+  std::sort(files.begin(), files.end());
+
+  ResourceBundleWriter writer;
+  for (const fs::path& file : files) {
+    std::string contents;
+    if (!ReadFile(file, contents)) {
+      std::cerr << "Failed to read " << file.string() << std::endl;
+      return 1;
+    }
+    writer.Add(file.lexically_relative(input).generic_string(), std::move(contents));
+  }
+
+  auto bundle = writer.Build();
+  if (!bundle) {
+    std::cerr << bundle.GetError().Message() << std::endl;
+    return 1;
+  }
+
+  std::string existing;
+  if (ReadFile(output, existing) && existing == bundle.Value()) {
+    fs::last_write_time(output, fs::file_time_type::clock::now(), error);
+    return 0;
+  }
+
+  fs::create_directories(output.parent_path(), error);
+  const fs::path temp = output.string() + ".tmp";
+  {
+    std::ofstream stream(temp, std::ios::binary | std::ios::trunc);
+    stream.write(bundle.Value().data(), static_cast<std::streamsize>(bundle.Value().size()));
+    if (!stream) {
+      std::cerr << "Failed to write " << temp.string() << std::endl;
+      return 1;
+    }
+  }
+  fs::rename(temp, output, error);
+  if (error) {
+    std::cerr << "Failed to rename " << temp.string() << ": " << error.message() << std::endl;
+    return 1;
+  }
+
+  std::cout << "Packed " << files.size() << " files (" << bundle.Value().size()
+            << " bytes) into " << output.string() << std::endl;
+  return 0;
+}
@@ -19,4 +19,19 @@ echo "📦 Copying homepage to resources/homepage/..."
 rm -rf "$ROOT_DIR/resources/homepage/"*
 cp -r dist/* "$ROOT_DIR/resources/homepage/"
 
+# Bundles packed by earlier builds hold the old assets; repack them with the
+# packer built next to them, or remove them so the loose files are served
+if [ -d "$ROOT_DIR/build" ]; then
+  while IFS= read -r -d '' bundle; do
+    packer="$(dirname "$(dirname "$bundle")")/athena-pack-resources"
+    if [ -x "$packer" ]; then
+      echo "📦 Repacking $bundle..."
+      "$packer" "$ROOT_DIR/resources/homepage" "$bundle"
+    else
+      echo "🗑️  Removing stale $bundle"
+      rm -f "$bundle"
+    fi
+  done < <(find "$ROOT_DIR/build" -path "*/resources/homepage.bundle" -print0)
+fi
+
 echo "✅ Homepage build complete: resources/homepage/"